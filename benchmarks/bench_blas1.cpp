@@ -0,0 +1,278 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#include "benchmark_common.hpp"
+
+#include <cmath>
+
+// BLAS 1 algorithms.  The vector algorithms take vectors of length
+// state.range(0); the matrix norms take square matrices of that
+// dimension.
+
+namespace linalg_benchmarks {
+namespace {
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct copy_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    vector<Scalar, Layout> x(n, 1);
+    vector<Scalar, Layout> y(n, 2);
+    auto x_in = Access::apply(x.view);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) { LinearAlgebra::copy(exec..., x_in, y.view); });
+      benchmark::ClobberMemory();
+    }
+    set_rates(state, 0.0, 2.0 * n * sizeof(Scalar));
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct swap_elements_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    vector<Scalar, Layout> x(n, 1);
+    vector<Scalar, Layout> y(n, 2);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) { LinearAlgebra::swap_elements(exec..., x.view, y.view); });
+      benchmark::ClobberMemory();
+    }
+    set_rates(state, 0.0, 4.0 * n * sizeof(Scalar));
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct scale_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    vector<Scalar, Layout> x(n, 1);
+    // Scaling by -1 keeps the values bounded over all iterations.
+    const Scalar alpha(-1);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) { LinearAlgebra::scale(exec..., alpha, x.view); });
+      benchmark::ClobberMemory();
+    }
+    set_rates(state, n * flops_per_mul<Scalar>, 2.0 * n * sizeof(Scalar));
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct add_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    vector<Scalar, Layout> x(n, 1);
+    vector<Scalar, Layout> y(n, 2);
+    vector<Scalar, Layout> z(n, 3);
+    auto x_in = Access::apply(x.view);
+    auto y_in = Access::apply(y.view);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) { LinearAlgebra::add(exec..., x_in, y_in, z.view); });
+      benchmark::ClobberMemory();
+    }
+    set_rates(state, n * flops_per_add<Scalar>, 3.0 * n * sizeof(Scalar));
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct dot_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    vector<Scalar, Layout> x(n, 1);
+    vector<Scalar, Layout> y(n, 2);
+    auto x_in = Access::apply(x.view);
+    auto y_in = Access::apply(y.view);
+    for (auto _ : state) {
+      auto result = Policy::call([&] (auto... exec) { return LinearAlgebra::dot(exec..., x_in, y_in); });
+      benchmark::DoNotOptimize(result);
+    }
+    set_rates(state, n * flops_per_fma<Scalar>, 2.0 * n * sizeof(Scalar));
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct dotc_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    vector<Scalar, Layout> x(n, 1);
+    vector<Scalar, Layout> y(n, 2);
+    auto x_in = Access::apply(x.view);
+    auto y_in = Access::apply(y.view);
+    for (auto _ : state) {
+      auto result = Policy::call([&] (auto... exec) { return LinearAlgebra::dotc(exec..., x_in, y_in); });
+      benchmark::DoNotOptimize(result);
+    }
+    set_rates(state, n * flops_per_fma<Scalar>, 2.0 * n * sizeof(Scalar));
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct vector_sum_of_squares_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    vector<Scalar, Layout> x(n, 1);
+    auto x_in = Access::apply(x.view);
+    const LinearAlgebra::sum_of_squares_result<real_t<Scalar>> init{0.0, 1.0};
+    for (auto _ : state) {
+      auto result = Policy::call([&] (auto... exec) {
+        return LinearAlgebra::vector_sum_of_squares(exec..., x_in, init);
+      });
+      benchmark::DoNotOptimize(result);
+    }
+    set_rates(state, n * flops_per_fma<Scalar>, 1.0 * n * sizeof(Scalar));
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct vector_two_norm_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    vector<Scalar, Layout> x(n, 1);
+    auto x_in = Access::apply(x.view);
+    for (auto _ : state) {
+      auto result = Policy::call([&] (auto... exec) { return LinearAlgebra::vector_two_norm(exec..., x_in); });
+      benchmark::DoNotOptimize(result);
+    }
+    set_rates(state, n * flops_per_fma<Scalar>, 1.0 * n * sizeof(Scalar));
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct vector_abs_sum_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    vector<Scalar, Layout> x(n, 1);
+    auto x_in = Access::apply(x.view);
+    for (auto _ : state) {
+      auto result = Policy::call([&] (auto... exec) { return LinearAlgebra::vector_abs_sum(exec..., x_in); });
+      benchmark::DoNotOptimize(result);
+    }
+    set_rates(state, n * flops_per_add<Scalar>, 1.0 * n * sizeof(Scalar));
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct vector_idx_abs_max_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    vector<Scalar, Layout> x(n, 1);
+    auto x_in = Access::apply(x.view);
+    for (auto _ : state) {
+      auto result = Policy::call([&] (auto... exec) { return LinearAlgebra::vector_idx_abs_max(exec..., x_in); });
+      benchmark::DoNotOptimize(result);
+    }
+    set_rates(state, 0.0, 1.0 * n * sizeof(Scalar));
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct apply_givens_rotation_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    vector<Scalar, Layout> x(n, 1);
+    vector<Scalar, Layout> y(n, 2);
+    // A rotation keeps the values bounded over all iterations.
+    using std::cos;
+    using std::sin;
+    const real_t<Scalar> c = cos(real_t<Scalar>(0.5));
+    const real_t<Scalar> s = sin(real_t<Scalar>(0.5));
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) { LinearAlgebra::apply_givens_rotation(exec..., x.view, y.view, c, s); });
+      benchmark::ClobberMemory();
+    }
+    const double real_flops_per_element = is_complex_v<Scalar> ? 12.0 : 6.0;
+    set_rates(state, n * real_flops_per_element, 4.0 * n * sizeof(Scalar));
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct matrix_frob_norm_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    matrix<Scalar, Layout> A(n, n, 1);
+    auto A_in = Access::apply(A.view);
+    for (auto _ : state) {
+      auto result = Policy::call([&] (auto... exec) { return LinearAlgebra::matrix_frob_norm(exec..., A_in); });
+      benchmark::DoNotOptimize(result);
+    }
+    set_rates(state, double(n) * n * flops_per_fma<Scalar>, double(n) * n * sizeof(Scalar));
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct matrix_one_norm_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    matrix<Scalar, Layout> A(n, n, 1);
+    auto A_in = Access::apply(A.view);
+    for (auto _ : state) {
+      auto result = Policy::call([&] (auto... exec) { return LinearAlgebra::matrix_one_norm(exec..., A_in); });
+      benchmark::DoNotOptimize(result);
+    }
+    set_rates(state, double(n) * n * flops_per_add<Scalar>, double(n) * n * sizeof(Scalar));
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct matrix_inf_norm_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    matrix<Scalar, Layout> A(n, n, 1);
+    auto A_in = Access::apply(A.view);
+    for (auto _ : state) {
+      auto result = Policy::call([&] (auto... exec) { return LinearAlgebra::matrix_inf_norm(exec..., A_in); });
+      benchmark::DoNotOptimize(result);
+    }
+    set_rates(state, double(n) * n * flops_per_add<Scalar>, double(n) * n * sizeof(Scalar));
+  }
+};
+
+void register_blas1_benchmarks()
+{
+  register_sweep<copy_benchmark>("copy", vector_sizes);
+  register_sweep<swap_elements_benchmark>("swap_elements", vector_sizes, false);
+  register_sweep<scale_benchmark>("scale", vector_sizes, false);
+  register_sweep<add_benchmark>("add", vector_sizes);
+  register_sweep<dot_benchmark>("dot", vector_sizes);
+  register_sweep<dotc_benchmark>("dotc", vector_sizes);
+  register_sweep<vector_sum_of_squares_benchmark>("vector_sum_of_squares", vector_sizes);
+  register_sweep<vector_two_norm_benchmark>("vector_two_norm", vector_sizes);
+  register_sweep<vector_abs_sum_benchmark>("vector_abs_sum", vector_sizes);
+  register_sweep<vector_idx_abs_max_benchmark>("vector_idx_abs_max", vector_sizes);
+  register_sweep<apply_givens_rotation_benchmark>("apply_givens_rotation", vector_sizes, false);
+  register_sweep<matrix_frob_norm_benchmark>("matrix_frob_norm", matrix_vector_sizes);
+  register_sweep<matrix_one_norm_benchmark>("matrix_one_norm", matrix_vector_sizes);
+  register_sweep<matrix_inf_norm_benchmark>("matrix_inf_norm", matrix_vector_sizes);
+}
+
+} // end anonymous namespace
+} // end namespace linalg_benchmarks
+
+LINALG_BENCHMARK_MAIN(linalg_benchmarks::register_blas1_benchmarks)
@@ -0,0 +1,291 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#include "benchmark_common.hpp"
+
+// BLAS 2 algorithms, on square matrices of dimension state.range(0).
+
+namespace linalg_benchmarks {
+namespace {
+
+// Flops and bytes of an algorithm that does num_fmas multiply-adds
+// and reads or writes matrix_entries matrix entries and
+// vector_entries vector entries.
+template<class Scalar>
+void set_blas2_rates(benchmark::State& state, double num_fmas,
+                     double matrix_entries, double vector_entries)
+{
+  set_rates(state, num_fmas * flops_per_fma<Scalar>,
+            (matrix_entries + vector_entries) * sizeof(Scalar));
+}
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct matrix_vector_product_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    matrix<Scalar, Layout> A(n, n, 1);
+    vector<Scalar, Layout> x(n, 2);
+    vector<Scalar, Layout> y(n, 3);
+    auto A_in = Access::apply(A.view);
+    auto x_in = Access::apply(x.view);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) { LinearAlgebra::matrix_vector_product(exec..., A_in, x_in, y.view); });
+      benchmark::ClobberMemory();
+    }
+    set_blas2_rates<Scalar>(state, double(n) * n, double(n) * n, 2.0 * n);
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct updating_matrix_vector_product_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    matrix<Scalar, Layout> A(n, n, 1);
+    vector<Scalar, Layout> x(n, 2);
+    vector<Scalar, Layout> y(n, 3);
+    vector<Scalar, Layout> z(n, 4);
+    auto A_in = Access::apply(A.view);
+    auto x_in = Access::apply(x.view);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) {
+        LinearAlgebra::matrix_vector_product(exec..., A_in, x_in, y.view, z.view);
+      });
+      benchmark::ClobberMemory();
+    }
+    set_blas2_rates<Scalar>(state, double(n) * n, double(n) * n, 3.0 * n);
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct symmetric_matrix_vector_product_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    matrix<Scalar, Layout> A(n, n, 1);
+    vector<Scalar, Layout> x(n, 2);
+    vector<Scalar, Layout> y(n, 3);
+    auto A_in = Access::apply(A.view);
+    auto x_in = Access::apply(x.view);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) {
+        LinearAlgebra::symmetric_matrix_vector_product(exec..., A_in, LinearAlgebra::lower_triangle, x_in, y.view);
+      });
+      benchmark::ClobberMemory();
+    }
+    set_blas2_rates<Scalar>(state, double(n) * n, double(n) * (n + 1) / 2, 2.0 * n);
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct hermitian_matrix_vector_product_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    matrix<Scalar, Layout> A(n, n, 1);
+    vector<Scalar, Layout> x(n, 2);
+    vector<Scalar, Layout> y(n, 3);
+    auto A_in = Access::apply(A.view);
+    auto x_in = Access::apply(x.view);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) {
+        LinearAlgebra::hermitian_matrix_vector_product(exec..., A_in, LinearAlgebra::lower_triangle, x_in, y.view);
+      });
+      benchmark::ClobberMemory();
+    }
+    set_blas2_rates<Scalar>(state, double(n) * n, double(n) * (n + 1) / 2, 2.0 * n);
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct triangular_matrix_vector_product_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    matrix<Scalar, Layout> A(n, n, 1);
+    vector<Scalar, Layout> x(n, 2);
+    vector<Scalar, Layout> y(n, 3);
+    auto A_in = Access::apply(A.view);
+    auto x_in = Access::apply(x.view);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) {
+        LinearAlgebra::triangular_matrix_vector_product(exec..., A_in, LinearAlgebra::lower_triangle,
+          LinearAlgebra::explicit_diagonal, x_in, y.view);
+      });
+      benchmark::ClobberMemory();
+    }
+    set_blas2_rates<Scalar>(state, double(n) * (n + 1) / 2, double(n) * (n + 1) / 2, 2.0 * n);
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct triangular_matrix_vector_solve_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    matrix<Scalar, Layout> A(n, n, 1);
+    A.make_diagonally_dominant();
+    vector<Scalar, Layout> b(n, 2);
+    vector<Scalar, Layout> x(n, 3);
+    auto A_in = Access::apply(A.view);
+    auto b_in = Access::apply(b.view);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) {
+        LinearAlgebra::triangular_matrix_vector_solve(exec..., A_in, LinearAlgebra::lower_triangle,
+          LinearAlgebra::explicit_diagonal, b_in, x.view);
+      });
+      benchmark::ClobberMemory();
+    }
+    set_blas2_rates<Scalar>(state, double(n) * (n + 1) / 2, double(n) * (n + 1) / 2, 2.0 * n);
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct matrix_rank_1_update_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    vector<Scalar, Layout> x(n, 1);
+    vector<Scalar, Layout> y(n, 2);
+    matrix<Scalar, Layout> A(n, n, 3);
+    auto x_in = Access::apply(x.view);
+    auto y_in = Access::apply(y.view);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) { LinearAlgebra::matrix_rank_1_update(exec..., x_in, y_in, A.view); });
+      benchmark::ClobberMemory();
+    }
+    set_blas2_rates<Scalar>(state, double(n) * n, 2.0 * n * n, 2.0 * n);
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct matrix_rank_1_update_c_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    vector<Scalar, Layout> x(n, 1);
+    vector<Scalar, Layout> y(n, 2);
+    matrix<Scalar, Layout> A(n, n, 3);
+    auto x_in = Access::apply(x.view);
+    auto y_in = Access::apply(y.view);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) { LinearAlgebra::matrix_rank_1_update_c(exec..., x_in, y_in, A.view); });
+      benchmark::ClobberMemory();
+    }
+    set_blas2_rates<Scalar>(state, double(n) * n, 2.0 * n * n, 2.0 * n);
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct symmetric_matrix_rank_1_update_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    vector<Scalar, Layout> x(n, 1);
+    matrix<Scalar, Layout> A(n, n, 2);
+    auto x_in = Access::apply(x.view);
+    const Scalar alpha(2);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) {
+        LinearAlgebra::symmetric_matrix_rank_1_update(exec..., alpha, x_in, A.view, LinearAlgebra::lower_triangle);
+      });
+      benchmark::ClobberMemory();
+    }
+    set_blas2_rates<Scalar>(state, double(n) * (n + 1) / 2, double(n) * (n + 1), 1.0 * n);
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct hermitian_matrix_rank_1_update_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    vector<Scalar, Layout> x(n, 1);
+    matrix<Scalar, Layout> A(n, n, 2);
+    auto x_in = Access::apply(x.view);
+    const real_t<Scalar> alpha(2);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) {
+        LinearAlgebra::hermitian_matrix_rank_1_update(exec..., alpha, x_in, A.view, LinearAlgebra::lower_triangle);
+      });
+      benchmark::ClobberMemory();
+    }
+    set_blas2_rates<Scalar>(state, double(n) * (n + 1) / 2, double(n) * (n + 1), 1.0 * n);
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct symmetric_matrix_rank_2_update_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    vector<Scalar, Layout> x(n, 1);
+    vector<Scalar, Layout> y(n, 2);
+    matrix<Scalar, Layout> A(n, n, 3);
+    auto x_in = Access::apply(x.view);
+    auto y_in = Access::apply(y.view);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) {
+        LinearAlgebra::symmetric_matrix_rank_2_update(exec..., x_in, y_in, A.view, LinearAlgebra::lower_triangle);
+      });
+      benchmark::ClobberMemory();
+    }
+    set_blas2_rates<Scalar>(state, double(n) * (n + 1), double(n) * (n + 1), 2.0 * n);
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct hermitian_matrix_rank_2_update_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    vector<Scalar, Layout> x(n, 1);
+    vector<Scalar, Layout> y(n, 2);
+    matrix<Scalar, Layout> A(n, n, 3);
+    auto x_in = Access::apply(x.view);
+    auto y_in = Access::apply(y.view);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) {
+        LinearAlgebra::hermitian_matrix_rank_2_update(exec..., x_in, y_in, A.view, LinearAlgebra::lower_triangle);
+      });
+      benchmark::ClobberMemory();
+    }
+    set_blas2_rates<Scalar>(state, double(n) * (n + 1), double(n) * (n + 1), 2.0 * n);
+  }
+};
+
+void register_blas2_benchmarks()
+{
+  register_sweep<matrix_vector_product_benchmark>("matrix_vector_product", matrix_vector_sizes);
+  register_sweep<updating_matrix_vector_product_benchmark>("updating_matrix_vector_product", matrix_vector_sizes);
+  register_sweep<symmetric_matrix_vector_product_benchmark>("symmetric_matrix_vector_product", matrix_vector_sizes);
+  register_sweep<hermitian_matrix_vector_product_benchmark>("hermitian_matrix_vector_product", matrix_vector_sizes);
+  register_sweep<triangular_matrix_vector_product_benchmark>("triangular_matrix_vector_product", matrix_vector_sizes);
+  register_sweep<triangular_matrix_vector_solve_benchmark>("triangular_matrix_vector_solve", matrix_vector_sizes);
+  register_sweep<matrix_rank_1_update_benchmark>("matrix_rank_1_update", matrix_vector_sizes);
+  register_sweep<matrix_rank_1_update_c_benchmark>("matrix_rank_1_update_c", matrix_vector_sizes);
+  register_sweep<symmetric_matrix_rank_1_update_benchmark>("symmetric_matrix_rank_1_update", matrix_vector_sizes);
+  register_sweep<hermitian_matrix_rank_1_update_benchmark>("hermitian_matrix_rank_1_update", matrix_vector_sizes);
+  register_sweep<symmetric_matrix_rank_2_update_benchmark>("symmetric_matrix_rank_2_update", matrix_vector_sizes);
+  register_sweep<hermitian_matrix_rank_2_update_benchmark>("hermitian_matrix_rank_2_update", matrix_vector_sizes);
+}
+
+} // end anonymous namespace
+} // end namespace linalg_benchmarks
+
+LINALG_BENCHMARK_MAIN(linalg_benchmarks::register_blas2_benchmarks)
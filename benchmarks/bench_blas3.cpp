@@ -0,0 +1,317 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#include "benchmark_common.hpp"
+
+// BLAS 3 algorithms, on square matrices of dimension state.range(0).
+
+namespace linalg_benchmarks {
+namespace {
+
+// Flops and bytes of an algorithm on n x n matrices that does
+// num_fmas multiply-adds and reads or writes num_matrices matrices.
+template<class Scalar>
+void set_blas3_rates(benchmark::State& state, double num_fmas, double num_matrices)
+{
+  const double n = double(state.range(0));
+  set_rates(state, num_fmas * flops_per_fma<Scalar>, num_matrices * n * n * sizeof(Scalar));
+}
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct matrix_product_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    matrix<Scalar, Layout> A(n, n, 1);
+    matrix<Scalar, Layout> B(n, n, 2);
+    matrix<Scalar, Layout> C(n, n, 3);
+    auto A_in = Access::apply(A.view);
+    auto B_in = Access::apply(B.view);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) { LinearAlgebra::matrix_product(exec..., A_in, B_in, C.view); });
+      benchmark::ClobberMemory();
+    }
+    set_blas3_rates<Scalar>(state, double(n) * n * n, 3.0);
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct updating_matrix_product_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    matrix<Scalar, Layout> A(n, n, 1);
+    matrix<Scalar, Layout> B(n, n, 2);
+    matrix<Scalar, Layout> E(n, n, 3);
+    matrix<Scalar, Layout> C(n, n, 4);
+    auto A_in = Access::apply(A.view);
+    auto B_in = Access::apply(B.view);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) { LinearAlgebra::matrix_product(exec..., A_in, B_in, E.view, C.view); });
+      benchmark::ClobberMemory();
+    }
+    set_blas3_rates<Scalar>(state, double(n) * n * n, 4.0);
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct symmetric_matrix_product_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    matrix<Scalar, Layout> A(n, n, 1);
+    matrix<Scalar, Layout> B(n, n, 2);
+    matrix<Scalar, Layout> C(n, n, 3);
+    auto A_in = Access::apply(A.view);
+    auto B_in = Access::apply(B.view);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) {
+        LinearAlgebra::symmetric_matrix_product(exec..., A_in, LinearAlgebra::lower_triangle, B_in, C.view);
+      });
+      benchmark::ClobberMemory();
+    }
+    set_blas3_rates<Scalar>(state, double(n) * n * n, 2.5);
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct hermitian_matrix_product_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    matrix<Scalar, Layout> A(n, n, 1);
+    matrix<Scalar, Layout> B(n, n, 2);
+    matrix<Scalar, Layout> C(n, n, 3);
+    auto A_in = Access::apply(A.view);
+    auto B_in = Access::apply(B.view);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) {
+        LinearAlgebra::hermitian_matrix_product(exec..., A_in, LinearAlgebra::lower_triangle, B_in, C.view);
+      });
+      benchmark::ClobberMemory();
+    }
+    set_blas3_rates<Scalar>(state, double(n) * n * n, 2.5);
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct triangular_matrix_product_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    matrix<Scalar, Layout> A(n, n, 1);
+    matrix<Scalar, Layout> B(n, n, 2);
+    matrix<Scalar, Layout> C(n, n, 3);
+    auto A_in = Access::apply(A.view);
+    auto B_in = Access::apply(B.view);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) {
+        LinearAlgebra::triangular_matrix_product(exec..., A_in, LinearAlgebra::lower_triangle,
+          LinearAlgebra::explicit_diagonal, B_in, C.view);
+      });
+      benchmark::ClobberMemory();
+    }
+    set_blas3_rates<Scalar>(state, double(n) * n * (n + 1) / 2, 2.5);
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct triangular_matrix_matrix_left_solve_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    matrix<Scalar, Layout> A(n, n, 1);
+    A.make_diagonally_dominant();
+    matrix<Scalar, Layout> B(n, n, 2);
+    matrix<Scalar, Layout> X(n, n, 3);
+    auto A_in = Access::apply(A.view);
+    auto B_in = Access::apply(B.view);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) {
+        LinearAlgebra::triangular_matrix_matrix_left_solve(exec..., A_in, LinearAlgebra::lower_triangle,
+          LinearAlgebra::explicit_diagonal, B_in, X.view);
+      });
+      benchmark::ClobberMemory();
+    }
+    set_blas3_rates<Scalar>(state, double(n) * n * (n + 1) / 2, 2.5);
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct triangular_matrix_matrix_right_solve_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    matrix<Scalar, Layout> A(n, n, 1);
+    A.make_diagonally_dominant();
+    matrix<Scalar, Layout> B(n, n, 2);
+    matrix<Scalar, Layout> X(n, n, 3);
+    auto A_in = Access::apply(A.view);
+    auto B_in = Access::apply(B.view);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) {
+        LinearAlgebra::triangular_matrix_matrix_right_solve(exec..., A_in, LinearAlgebra::lower_triangle,
+          LinearAlgebra::explicit_diagonal, B_in, X.view);
+      });
+      benchmark::ClobberMemory();
+    }
+    set_blas3_rates<Scalar>(state, double(n) * n * (n + 1) / 2, 2.5);
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct symmetric_matrix_rank_k_update_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    matrix<Scalar, Layout> A(n, n, 1);
+    matrix<Scalar, Layout> C(n, n, 2);
+    auto A_in = Access::apply(A.view);
+    const Scalar alpha(2);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) {
+        LinearAlgebra::symmetric_matrix_rank_k_update(exec..., alpha, A_in, C.view, LinearAlgebra::lower_triangle);
+      });
+      benchmark::ClobberMemory();
+    }
+    set_blas3_rates<Scalar>(state, double(n) * n * (n + 1) / 2, 2.0);
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct hermitian_matrix_rank_k_update_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    matrix<Scalar, Layout> A(n, n, 1);
+    matrix<Scalar, Layout> C(n, n, 2);
+    auto A_in = Access::apply(A.view);
+    const real_t<Scalar> alpha(2);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) {
+        LinearAlgebra::hermitian_matrix_rank_k_update(exec..., alpha, A_in, C.view, LinearAlgebra::lower_triangle);
+      });
+      benchmark::ClobberMemory();
+    }
+    set_blas3_rates<Scalar>(state, double(n) * n * (n + 1) / 2, 2.0);
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct symmetric_matrix_rank_2k_update_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    matrix<Scalar, Layout> A(n, n, 1);
+    matrix<Scalar, Layout> B(n, n, 2);
+    matrix<Scalar, Layout> C(n, n, 3);
+    auto A_in = Access::apply(A.view);
+    auto B_in = Access::apply(B.view);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) {
+        LinearAlgebra::symmetric_matrix_rank_2k_update(exec..., A_in, B_in, C.view, LinearAlgebra::lower_triangle);
+      });
+      benchmark::ClobberMemory();
+    }
+    set_blas3_rates<Scalar>(state, double(n) * n * (n + 1), 3.0);
+  }
+};
+
+template<class Scalar, class Layout, class Access, class Policy>
+struct hermitian_matrix_rank_2k_update_benchmark {
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    matrix<Scalar, Layout> A(n, n, 1);
+    matrix<Scalar, Layout> B(n, n, 2);
+    matrix<Scalar, Layout> C(n, n, 3);
+    auto A_in = Access::apply(A.view);
+    auto B_in = Access::apply(B.view);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) {
+        LinearAlgebra::hermitian_matrix_rank_2k_update(exec..., A_in, B_in, C.view, LinearAlgebra::lower_triangle);
+      });
+      benchmark::ClobberMemory();
+    }
+    set_blas3_rates<Scalar>(state, double(n) * n * (n + 1), 3.0);
+  }
+};
+
+// Batched matrix_product of num_batches n x n matrices, stored as
+// rank-3 arrays whose leftmost extent is the batch index.  With
+// layout_left, consecutive matrices are interleaved ("batch-major").
+template<class Scalar, class Layout, class Access, class Policy>
+struct batched_matrix_product_benchmark {
+  // Not a power of two, so that the batch-major strides do not all
+  // map to the same cache sets.
+  static constexpr std::size_t num_batches = 1000;
+
+  static void run(benchmark::State& state)
+  {
+    using batch_view = mdspan<Scalar, dextents<std::size_t, 3>, Layout>;
+    const std::size_t n = state.range(0);
+    std::vector<Scalar> A_storage(num_batches * n * n);
+    std::vector<Scalar> B_storage(num_batches * n * n);
+    std::vector<Scalar> C_storage(num_batches * n * n);
+    value_generator gen(1);
+    for (std::size_t k = 0; k < A_storage.size(); ++k) {
+      A_storage[k] = gen.template next<Scalar>();
+      B_storage[k] = gen.template next<Scalar>();
+    }
+    batch_view A(A_storage.data(), num_batches, n, n);
+    batch_view B(B_storage.data(), num_batches, n, n);
+    batch_view C(C_storage.data(), num_batches, n, n);
+    auto A_in = Access::apply(A);
+    auto B_in = Access::apply(B);
+    for (auto _ : state) {
+      Policy::call([&] (auto... exec) { LinearAlgebra::matrix_product(exec..., A_in, B_in, C); });
+      benchmark::ClobberMemory();
+    }
+    set_rates(state, double(num_batches) * n * n * n * flops_per_fma<Scalar>,
+              3.0 * num_batches * n * n * sizeof(Scalar));
+  }
+};
+
+void register_blas3_benchmarks()
+{
+  register_sweep<matrix_product_benchmark>("matrix_product", matrix_matrix_sizes);
+  register_sweep<updating_matrix_product_benchmark>("updating_matrix_product", matrix_matrix_sizes);
+  register_sweep<symmetric_matrix_product_benchmark>("symmetric_matrix_product", matrix_matrix_sizes);
+  register_sweep<hermitian_matrix_product_benchmark>("hermitian_matrix_product", matrix_matrix_sizes);
+  register_sweep<triangular_matrix_product_benchmark>("triangular_matrix_product", matrix_matrix_sizes);
+  register_sweep<triangular_matrix_matrix_left_solve_benchmark>("triangular_matrix_matrix_left_solve", matrix_matrix_sizes);
+  register_sweep<triangular_matrix_matrix_right_solve_benchmark>("triangular_matrix_matrix_right_solve", matrix_matrix_sizes);
+  register_sweep<symmetric_matrix_rank_k_update_benchmark>("symmetric_matrix_rank_k_update", matrix_matrix_sizes);
+  register_sweep<hermitian_matrix_rank_k_update_benchmark>("hermitian_matrix_rank_k_update", matrix_matrix_sizes);
+  register_sweep<symmetric_matrix_rank_2k_update_benchmark>("symmetric_matrix_rank_2k_update", matrix_matrix_sizes);
+  register_sweep<hermitian_matrix_rank_2k_update_benchmark>("hermitian_matrix_rank_2k_update", matrix_matrix_sizes);
+
+  constexpr size_range batch_matrix_sizes{4, 16, 2};
+  register_one<batched_matrix_product_benchmark, double, layout_left, plain_access, serial_policy>(
+    "batched_matrix_product", batch_matrix_sizes);
+  register_one<batched_matrix_product_benchmark, float, layout_left, plain_access, serial_policy>(
+    "batched_matrix_product", batch_matrix_sizes);
+  register_one<batched_matrix_product_benchmark, double, layout_right, plain_access, serial_policy>(
+    "batched_matrix_product", batch_matrix_sizes);
+  register_one<batched_matrix_product_benchmark, double, layout_left, plain_access, thread_pool_policy>(
+    "batched_matrix_product", batch_matrix_sizes);
+}
+
+} // end anonymous namespace
+} // end namespace linalg_benchmarks
+
+LINALG_BENCHMARK_MAIN(linalg_benchmarks::register_blas3_benchmarks)
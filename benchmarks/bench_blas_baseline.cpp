@@ -0,0 +1,504 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#include "benchmark_common.hpp"
+
+#include <cmath>
+
+// The linked BLAS, called directly on the same problems as the
+// bench_blas1, bench_blas2, and bench_blas3 benchmarks.  Each
+// benchmark has the name of the corresponding std::linalg benchmark
+// with the execution policy replaced by "blas", e.g.,
+//
+//   matrix_product/double/layout_left/plain/blas/256
+//
+// so that the two runs' results can be compared line by line.  The
+// BLAS's in-place TRMV and TRMM stand in for the std::linalg
+// triangular products, which write a separate output.
+
+// See the notes on ABI mangling in blas_dispatch.hpp.  The
+// declarations that blas_dispatch.hpp also has must match it.
+
+extern "C" double
+ddot_ (const int* pN, const double* X, const int* pINCX,
+       const double* Y, const int* pINCY);
+extern "C" double
+dnrm2_ (const int* pN, const double* X, const int* pINCX);
+extern "C" double
+dasum_ (const int* pN, const double* X, const int* pINCX);
+extern "C" void
+dscal_ (const int* pN, const double* pALPHA, double* X, const int* pINCX);
+extern "C" void
+dcopy_ (const int* pN, const double* X, const int* pINCX,
+        double* Y, const int* pINCY);
+extern "C" void
+dswap_ (const int* pN, double* X, const int* pINCX,
+        double* Y, const int* pINCY);
+extern "C" void
+drot_ (const int* pN, double* X, const int* pINCX,
+       double* Y, const int* pINCY, const double* pC, const double* pS);
+
+extern "C" void
+dgemv_ (const char TRANS[], const int* pM, const int* pN,
+        const double* pALPHA, const double* A, const int* pLDA,
+        const double* X, const int* pINCX,
+        const double* pBETA, double* Y, const int* pINCY);
+extern "C" void
+dsymv_ (const char UPLO[], const int* pN,
+        const double* pALPHA, const double* A, const int* pLDA,
+        const double* X, const int* pINCX,
+        const double* pBETA, double* Y, const int* pINCY);
+extern "C" void
+dtrmv_ (const char UPLO[], const char TRANS[], const char DIAG[],
+        const int* pN, const double* A, const int* pLDA,
+        double* X, const int* pINCX);
+extern "C" void
+dtrsv_ (const char UPLO[], const char TRANS[], const char DIAG[],
+        const int* pN, const double* A, const int* pLDA,
+        double* X, const int* pINCX);
+extern "C" void
+dger_ (const int* pM, const int* pN, const double* pALPHA,
+       const double* X, const int* pINCX,
+       const double* Y, const int* pINCY,
+       double* A, const int* pLDA);
+extern "C" void
+dsyr_ (const char UPLO[], const int* pN, const double* pALPHA,
+       const double* X, const int* pINCX,
+       double* A, const int* pLDA);
+extern "C" void
+dsyr2_ (const char UPLO[], const int* pN, const double* pALPHA,
+        const double* X, const int* pINCX,
+        const double* Y, const int* pINCY,
+        double* A, const int* pLDA);
+
+extern "C" void
+dgemm_ (const char TRANSA[], const char TRANSB[],
+        const int* pM, const int* pN, const int* pK,
+        const double* pALPHA,
+        const double* A, const int* pLDA,
+        const double* B, const int* pLDB,
+        const double* pBETA,
+        double* C, const int* pLDC);
+extern "C" void
+zgemm_ (const char TRANSA[], const char TRANSB[],
+        const int* pM, const int* pN, const int* pK,
+        const void* pALPHA,
+        const void* A, const int* pLDA,
+        const void* B, const int* pLDB,
+        const void* pBETA,
+        void* C, const int* pLDC);
+extern "C" void
+dsymm_ (const char SIDE[], const char UPLO[],
+        const int* pM, const int* pN,
+        const double* pALPHA, const double* A, const int* pLDA,
+        const double* B, const int* pLDB,
+        const double* pBETA, double* C, const int* pLDC);
+extern "C" void
+dtrmm_ (const char SIDE[], const char UPLO[], const char TRANSA[], const char DIAG[],
+        const int* pM, const int* pN,
+        const double* pALPHA, const double* A, const int* pLDA,
+        double* B, const int* pLDB);
+extern "C" void
+dtrsm_ (const char SIDE[], const char UPLO[], const char TRANSA[], const char DIAG[],
+        const int* pM, const int* pN,
+        const double* pALPHA, const double* A, const int* pLDA,
+        double* B, const int* pLDB);
+extern "C" void
+dsyrk_ (const char UPLO[], const char TRANS[],
+        const int* pN, const int* pK,
+        const double* pALPHA, const double* A, const int* pLDA,
+        const double* pBETA, double* C, const int* pLDC);
+extern "C" void
+dsyr2k_ (const char UPLO[], const char TRANS[],
+         const int* pN, const int* pK,
+         const double* pALPHA, const double* A, const int* pLDA,
+         const double* B, const int* pLDB,
+         const double* pBETA, double* C, const int* pLDC);
+
+namespace linalg_benchmarks {
+namespace {
+
+using dvector = vector<double, layout_left>;
+using dmatrix = matrix<double, layout_left>;
+
+constexpr int one = 1;
+
+// BLAS 1
+
+void dot_blas(benchmark::State& state)
+{
+  const int n = int(state.range(0));
+  dvector x(n, 1);
+  dvector y(n, 2);
+  for (auto _ : state) {
+    double result = ddot_(&n, x.storage.data(), &one, y.storage.data(), &one);
+    benchmark::DoNotOptimize(result);
+  }
+  set_rates(state, n * flops_per_fma<double>, 2.0 * n * sizeof(double));
+}
+
+void vector_two_norm_blas(benchmark::State& state)
+{
+  const int n = int(state.range(0));
+  dvector x(n, 1);
+  for (auto _ : state) {
+    double result = dnrm2_(&n, x.storage.data(), &one);
+    benchmark::DoNotOptimize(result);
+  }
+  set_rates(state, n * flops_per_fma<double>, 1.0 * n * sizeof(double));
+}
+
+void vector_abs_sum_blas(benchmark::State& state)
+{
+  const int n = int(state.range(0));
+  dvector x(n, 1);
+  for (auto _ : state) {
+    double result = dasum_(&n, x.storage.data(), &one);
+    benchmark::DoNotOptimize(result);
+  }
+  set_rates(state, n * flops_per_add<double>, 1.0 * n * sizeof(double));
+}
+
+void scale_blas(benchmark::State& state)
+{
+  const int n = int(state.range(0));
+  dvector x(n, 1);
+  const double alpha = -1.0;
+  for (auto _ : state) {
+    dscal_(&n, &alpha, x.storage.data(), &one);
+    benchmark::ClobberMemory();
+  }
+  set_rates(state, n * flops_per_mul<double>, 2.0 * n * sizeof(double));
+}
+
+void copy_blas(benchmark::State& state)
+{
+  const int n = int(state.range(0));
+  dvector x(n, 1);
+  dvector y(n, 2);
+  for (auto _ : state) {
+    dcopy_(&n, x.storage.data(), &one, y.storage.data(), &one);
+    benchmark::ClobberMemory();
+  }
+  set_rates(state, 0.0, 2.0 * n * sizeof(double));
+}
+
+void swap_elements_blas(benchmark::State& state)
+{
+  const int n = int(state.range(0));
+  dvector x(n, 1);
+  dvector y(n, 2);
+  for (auto _ : state) {
+    dswap_(&n, x.storage.data(), &one, y.storage.data(), &one);
+    benchmark::ClobberMemory();
+  }
+  set_rates(state, 0.0, 4.0 * n * sizeof(double));
+}
+
+void apply_givens_rotation_blas(benchmark::State& state)
+{
+  const int n = int(state.range(0));
+  dvector x(n, 1);
+  dvector y(n, 2);
+  const double c = std::cos(0.5);
+  const double s = std::sin(0.5);
+  for (auto _ : state) {
+    drot_(&n, x.storage.data(), &one, y.storage.data(), &one, &c, &s);
+    benchmark::ClobberMemory();
+  }
+  set_rates(state, 6.0 * n, 4.0 * n * sizeof(double));
+}
+
+// BLAS 2
+
+void set_blas2_rates(benchmark::State& state, double num_fmas,
+                     double matrix_entries, double vector_entries)
+{
+  set_rates(state, num_fmas * flops_per_fma<double>,
+            (matrix_entries + vector_entries) * sizeof(double));
+}
+
+void matrix_vector_product_blas(benchmark::State& state)
+{
+  const int n = int(state.range(0));
+  dmatrix A(n, n, 1);
+  dvector x(n, 2);
+  dvector y(n, 3);
+  const double alpha = 1.0;
+  const double beta = 0.0;
+  for (auto _ : state) {
+    dgemv_("N", &n, &n, &alpha, A.storage.data(), &n, x.storage.data(), &one,
+           &beta, y.storage.data(), &one);
+    benchmark::ClobberMemory();
+  }
+  set_blas2_rates(state, double(n) * n, double(n) * n, 2.0 * n);
+}
+
+void symmetric_matrix_vector_product_blas(benchmark::State& state)
+{
+  const int n = int(state.range(0));
+  dmatrix A(n, n, 1);
+  dvector x(n, 2);
+  dvector y(n, 3);
+  const double alpha = 1.0;
+  const double beta = 0.0;
+  for (auto _ : state) {
+    dsymv_("L", &n, &alpha, A.storage.data(), &n, x.storage.data(), &one,
+           &beta, y.storage.data(), &one);
+    benchmark::ClobberMemory();
+  }
+  set_blas2_rates(state, double(n) * n, double(n) * (n + 1) / 2, 2.0 * n);
+}
+
+void triangular_matrix_vector_product_blas(benchmark::State& state)
+{
+  const int n = int(state.range(0));
+  dmatrix A(n, n, 1);
+  dvector x(n, 2);
+  for (auto _ : state) {
+    dtrmv_("L", "N", "N", &n, A.storage.data(), &n, x.storage.data(), &one);
+    benchmark::ClobberMemory();
+  }
+  set_blas2_rates(state, double(n) * (n + 1) / 2, double(n) * (n + 1) / 2, 2.0 * n);
+}
+
+void triangular_matrix_vector_solve_blas(benchmark::State& state)
+{
+  const int n = int(state.range(0));
+  dmatrix A(n, n, 1);
+  A.make_diagonally_dominant();
+  dvector x(n, 2);
+  for (auto _ : state) {
+    dtrsv_("L", "N", "N", &n, A.storage.data(), &n, x.storage.data(), &one);
+    benchmark::ClobberMemory();
+  }
+  set_blas2_rates(state, double(n) * (n + 1) / 2, double(n) * (n + 1) / 2, 2.0 * n);
+}
+
+void matrix_rank_1_update_blas(benchmark::State& state)
+{
+  const int n = int(state.range(0));
+  dvector x(n, 1);
+  dvector y(n, 2);
+  dmatrix A(n, n, 3);
+  const double alpha = 1.0;
+  for (auto _ : state) {
+    dger_(&n, &n, &alpha, x.storage.data(), &one, y.storage.data(), &one, A.storage.data(), &n);
+    benchmark::ClobberMemory();
+  }
+  set_blas2_rates(state, double(n) * n, 2.0 * n * n, 2.0 * n);
+}
+
+void symmetric_matrix_rank_1_update_blas(benchmark::State& state)
+{
+  const int n = int(state.range(0));
+  dvector x(n, 1);
+  dmatrix A(n, n, 2);
+  const double alpha = 2.0;
+  for (auto _ : state) {
+    dsyr_("L", &n, &alpha, x.storage.data(), &one, A.storage.data(), &n);
+    benchmark::ClobberMemory();
+  }
+  set_blas2_rates(state, double(n) * (n + 1) / 2, double(n) * (n + 1), 1.0 * n);
+}
+
+void symmetric_matrix_rank_2_update_blas(benchmark::State& state)
+{
+  const int n = int(state.range(0));
+  dvector x(n, 1);
+  dvector y(n, 2);
+  dmatrix A(n, n, 3);
+  const double alpha = 1.0;
+  for (auto _ : state) {
+    dsyr2_("L", &n, &alpha, x.storage.data(), &one, y.storage.data(), &one, A.storage.data(), &n);
+    benchmark::ClobberMemory();
+  }
+  set_blas2_rates(state, double(n) * (n + 1), double(n) * (n + 1), 2.0 * n);
+}
+
+// BLAS 3
+
+template<class Scalar>
+void set_blas3_rates(benchmark::State& state, double num_fmas, double num_matrices)
+{
+  const double n = double(state.range(0));
+  set_rates(state, num_fmas * flops_per_fma<Scalar>, num_matrices * n * n * sizeof(Scalar));
+}
+
+void matrix_product_blas(benchmark::State& state)
+{
+  const int n = int(state.range(0));
+  dmatrix A(n, n, 1);
+  dmatrix B(n, n, 2);
+  dmatrix C(n, n, 3);
+  const double alpha = 1.0;
+  const double beta = 0.0;
+  for (auto _ : state) {
+    dgemm_("N", "N", &n, &n, &n, &alpha, A.storage.data(), &n, B.storage.data(), &n,
+           &beta, C.storage.data(), &n);
+    benchmark::ClobberMemory();
+  }
+  set_blas3_rates<double>(state, double(n) * n * n, 3.0);
+}
+
+void complex_matrix_product_blas(benchmark::State& state)
+{
+  using cdouble = std::complex<double>;
+  const int n = int(state.range(0));
+  matrix<cdouble, layout_left> A(n, n, 1);
+  matrix<cdouble, layout_left> B(n, n, 2);
+  matrix<cdouble, layout_left> C(n, n, 3);
+  const cdouble alpha(1.0);
+  const cdouble beta(0.0);
+  for (auto _ : state) {
+    zgemm_("N", "N", &n, &n, &n, &alpha, A.storage.data(), &n, B.storage.data(), &n,
+           &beta, C.storage.data(), &n);
+    benchmark::ClobberMemory();
+  }
+  set_blas3_rates<cdouble>(state, double(n) * n * n, 3.0);
+}
+
+void symmetric_matrix_product_blas(benchmark::State& state)
+{
+  const int n = int(state.range(0));
+  dmatrix A(n, n, 1);
+  dmatrix B(n, n, 2);
+  dmatrix C(n, n, 3);
+  const double alpha = 1.0;
+  const double beta = 0.0;
+  for (auto _ : state) {
+    dsymm_("L", "L", &n, &n, &alpha, A.storage.data(), &n, B.storage.data(), &n,
+           &beta, C.storage.data(), &n);
+    benchmark::ClobberMemory();
+  }
+  set_blas3_rates<double>(state, double(n) * n * n, 2.5);
+}
+
+void triangular_matrix_product_blas(benchmark::State& state)
+{
+  const int n = int(state.range(0));
+  dmatrix A(n, n, 1);
+  dmatrix B(n, n, 2);
+  // Scale by 1/n so that B stays bounded over all iterations.
+  const double alpha = 1.0 / n;
+  for (auto _ : state) {
+    dtrmm_("L", "L", "N", "N", &n, &n, &alpha, A.storage.data(), &n, B.storage.data(), &n);
+    benchmark::ClobberMemory();
+  }
+  set_blas3_rates<double>(state, double(n) * n * (n + 1) / 2, 2.5);
+}
+
+void triangular_matrix_matrix_left_solve_blas(benchmark::State& state)
+{
+  const int n = int(state.range(0));
+  dmatrix A(n, n, 1);
+  A.make_diagonally_dominant();
+  dmatrix B(n, n, 2);
+  const double alpha = 1.0;
+  for (auto _ : state) {
+    dtrsm_("L", "L", "N", "N", &n, &n, &alpha, A.storage.data(), &n, B.storage.data(), &n);
+    benchmark::ClobberMemory();
+  }
+  set_blas3_rates<double>(state, double(n) * n * (n + 1) / 2, 2.5);
+}
+
+void triangular_matrix_matrix_right_solve_blas(benchmark::State& state)
+{
+  const int n = int(state.range(0));
+  dmatrix A(n, n, 1);
+  A.make_diagonally_dominant();
+  dmatrix B(n, n, 2);
+  const double alpha = 1.0;
+  for (auto _ : state) {
+    dtrsm_("R", "L", "N", "N", &n, &n, &alpha, A.storage.data(), &n, B.storage.data(), &n);
+    benchmark::ClobberMemory();
+  }
+  set_blas3_rates<double>(state, double(n) * n * (n + 1) / 2, 2.5);
+}
+
+void symmetric_matrix_rank_k_update_blas(benchmark::State& state)
+{
+  const int n = int(state.range(0));
+  dmatrix A(n, n, 1);
+  dmatrix C(n, n, 2);
+  const double alpha = 2.0;
+  const double beta = 1.0;
+  for (auto _ : state) {
+    dsyrk_("L", "N", &n, &n, &alpha, A.storage.data(), &n, &beta, C.storage.data(), &n);
+    benchmark::ClobberMemory();
+  }
+  set_blas3_rates<double>(state, double(n) * n * (n + 1) / 2, 2.0);
+}
+
+void symmetric_matrix_rank_2k_update_blas(benchmark::State& state)
+{
+  const int n = int(state.range(0));
+  dmatrix A(n, n, 1);
+  dmatrix B(n, n, 2);
+  dmatrix C(n, n, 3);
+  const double alpha = 1.0;
+  const double beta = 1.0;
+  for (auto _ : state) {
+    dsyr2k_("L", "N", &n, &n, &alpha, A.storage.data(), &n, B.storage.data(), &n,
+            &beta, C.storage.data(), &n);
+    benchmark::ClobberMemory();
+  }
+  set_blas3_rates<double>(state, double(n) * n * (n + 1), 3.0);
+}
+
+void register_baseline(const std::string& name, const char* element_type,
+                       void (*function)(benchmark::State&), size_range sizes)
+{
+  const std::string full_name = name + "/" + element_type + "/layout_left/plain/blas";
+  benchmark::RegisterBenchmark(full_name.c_str(), function)
+    ->RangeMultiplier(sizes.multiplier)
+    ->Range(sizes.lo, sizes.hi)
+    ->UseRealTime();
+}
+
+void register_blas_baseline_benchmarks()
+{
+  register_baseline("dot", "double", dot_blas, vector_sizes);
+  register_baseline("vector_two_norm", "double", vector_two_norm_blas, vector_sizes);
+  register_baseline("vector_abs_sum", "double", vector_abs_sum_blas, vector_sizes);
+  register_baseline("scale", "double", scale_blas, vector_sizes);
+  register_baseline("copy", "double", copy_blas, vector_sizes);
+  register_baseline("swap_elements", "double", swap_elements_blas, vector_sizes);
+  register_baseline("apply_givens_rotation", "double", apply_givens_rotation_blas, vector_sizes);
+
+  register_baseline("matrix_vector_product", "double", matrix_vector_product_blas, matrix_vector_sizes);
+  register_baseline("symmetric_matrix_vector_product", "double", symmetric_matrix_vector_product_blas, matrix_vector_sizes);
+  register_baseline("triangular_matrix_vector_product", "double", triangular_matrix_vector_product_blas, matrix_vector_sizes);
+  register_baseline("triangular_matrix_vector_solve", "double", triangular_matrix_vector_solve_blas, matrix_vector_sizes);
+  register_baseline("matrix_rank_1_update", "double", matrix_rank_1_update_blas, matrix_vector_sizes);
+  register_baseline("symmetric_matrix_rank_1_update", "double", symmetric_matrix_rank_1_update_blas, matrix_vector_sizes);
+  register_baseline("symmetric_matrix_rank_2_update", "double", symmetric_matrix_rank_2_update_blas, matrix_vector_sizes);
+
+  register_baseline("matrix_product", "double", matrix_product_blas, matrix_matrix_sizes);
+  register_baseline("matrix_product", "complex<double>", complex_matrix_product_blas, matrix_matrix_sizes);
+  register_baseline("symmetric_matrix_product", "double", symmetric_matrix_product_blas, matrix_matrix_sizes);
+  register_baseline("triangular_matrix_product", "double", triangular_matrix_product_blas, matrix_matrix_sizes);
+  register_baseline("triangular_matrix_matrix_left_solve", "double", triangular_matrix_matrix_left_solve_blas, matrix_matrix_sizes);
+  register_baseline("triangular_matrix_matrix_right_solve", "double", triangular_matrix_matrix_right_solve_blas, matrix_matrix_sizes);
+  register_baseline("symmetric_matrix_rank_k_update", "double", symmetric_matrix_rank_k_update_blas, matrix_matrix_sizes);
+  register_baseline("symmetric_matrix_rank_2k_update", "double", symmetric_matrix_rank_2k_update_blas, matrix_matrix_sizes);
+}
+
+} // end anonymous namespace
+} // end namespace linalg_benchmarks
+
+LINALG_BENCHMARK_MAIN(linalg_benchmarks::register_blas_baseline_benchmarks)
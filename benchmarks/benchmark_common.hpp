@@ -0,0 +1,334 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef LINALG_BENCHMARKS_BENCHMARK_COMMON_HPP_
+#define LINALG_BENCHMARKS_BENCHMARK_COMMON_HPP_
+
+#include <benchmark/benchmark.h>
+
+// Benchmarks currently use parentheses (e.g., A(i,j))
+// for the array access operator,
+// instead of square brackets (e.g., A[i,j]).
+// This must be defined before including any mdspan headers.
+#define MDSPAN_USE_PAREN_OPERATOR 1
+
+#include <mdspan/mdspan.hpp>
+#include <experimental/linalg>
+#include <algorithm>
+#include <array>
+#include <complex>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#ifdef LINALG_HAS_EXECUTION
+#  include <execution>
+#endif
+
+// Each benchmark is a class template
+//
+//   template<class Scalar, class Layout, class Access, class Policy>
+//   struct some_benchmark {
+//     static void run(benchmark::State& state);
+//   };
+//
+// where state.range(0) is the problem size.  register_sweep
+// instantiates it over element types, layouts, accessors, and
+// execution policies, and registers each instance under a name like
+//
+//   matrix_product/double/layout_left/plain/serial/256
+//
+// so that --benchmark_filter can select any slice of the sweep.
+// Benchmarks report FLOP/s and bytes_per_second; the byte counts are
+// the minimum memory traffic, i.e., each operand read or written once.
+
+namespace linalg_benchmarks {
+
+namespace MdSpan = MDSPAN_IMPL_STANDARD_NAMESPACE;
+namespace LinearAlgebra = MDSPAN_IMPL_STANDARD_NAMESPACE :: MDSPAN_IMPL_PROPOSED_NAMESPACE :: linalg;
+
+using MdSpan::dextents;
+using MdSpan::layout_left;
+using MdSpan::layout_right;
+using MdSpan::layout_stride;
+using MdSpan::mdspan;
+
+// Names of element types and layouts
+
+template<class T> struct type_name;
+template<> struct type_name<float> { static constexpr const char* value = "float"; };
+template<> struct type_name<double> { static constexpr const char* value = "double"; };
+template<> struct type_name<std::complex<float>> { static constexpr const char* value = "complex<float>"; };
+template<> struct type_name<std::complex<double>> { static constexpr const char* value = "complex<double>"; };
+template<> struct type_name<layout_left> { static constexpr const char* value = "layout_left"; };
+template<> struct type_name<layout_right> { static constexpr const char* value = "layout_right"; };
+template<> struct type_name<layout_stride> { static constexpr const char* value = "layout_stride"; };
+
+// Element types
+
+template<class Scalar>
+inline constexpr bool is_complex_v = LinearAlgebra::impl::is_complex_v<Scalar>;
+
+// Real type of Scalar (e.g., double for std::complex<double>).
+template<class Scalar>
+using real_t = decltype(LinearAlgebra::impl::real_if_needed(Scalar{}));
+
+// Real floating-point operations in one multiply-add, multiply, or
+// add of Scalar.
+template<class Scalar>
+inline constexpr double flops_per_fma = is_complex_v<Scalar> ? 8.0 : 2.0;
+template<class Scalar>
+inline constexpr double flops_per_mul = is_complex_v<Scalar> ? 6.0 : 1.0;
+template<class Scalar>
+inline constexpr double flops_per_add = is_complex_v<Scalar> ? 2.0 : 1.0;
+
+// Report flops floating-point operations and the given number of
+// bytes of memory traffic per iteration.
+inline void set_rates(benchmark::State& state, double flops, double bytes)
+{
+  state.counters["FLOP/s"] = benchmark::Counter(flops,
+    benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::kIs1000);
+  state.SetBytesProcessed(std::int64_t(state.iterations()) * std::int64_t(bytes));
+}
+
+// Deterministic pseudorandom values in [-1, 1], or in the unit
+// square for complex types.
+class value_generator {
+public:
+  explicit value_generator(std::uint64_t seed) : state_(seed * 2654435761u + 1) {}
+
+  template<class Scalar>
+  Scalar next()
+  {
+    if constexpr (is_complex_v<Scalar>) {
+      using real_type = typename Scalar::value_type;
+      const real_type re = next<real_type>();
+      return Scalar(re, next<real_type>());
+    }
+    else {
+      state_ = state_ * 6364136223846793005u + 1442695040888963407u;
+      return Scalar(double(state_ >> 11) * (2.0 / 9007199254740992.0) - 1.0);
+    }
+  }
+
+private:
+  std::uint64_t state_;
+};
+
+// Layouts.  layout_stride matrices are column major with padding
+// between columns, as for a submatrix view.  layout_stride vectors
+// have stride 2.
+
+template<class Layout, class Extents>
+typename Layout::template mapping<Extents> make_mapping(const Extents& ext)
+{
+  if constexpr (std::is_same_v<Layout, layout_stride>) {
+    if constexpr (Extents::rank() == 1) {
+      return {ext, std::array<std::size_t, 1>{2}};
+    }
+    else {
+      return {ext, std::array<std::size_t, 2>{1, ext.extent(0) + 16}};
+    }
+  }
+  else {
+    return typename Layout::template mapping<Extents>(ext);
+  }
+}
+
+template<class Scalar, class Layout>
+struct vector {
+  using view_type = mdspan<Scalar, dextents<std::size_t, 1>, Layout>;
+
+  vector(std::size_t n, std::uint64_t seed)
+  {
+    auto mapping = make_mapping<Layout>(dextents<std::size_t, 1>(n));
+    storage.resize(mapping.required_span_size());
+    view = view_type(storage.data(), mapping);
+    value_generator gen(seed);
+    for (std::size_t i = 0; i < n; ++i) {
+      view(i) = gen.template next<Scalar>();
+    }
+  }
+
+  std::vector<Scalar> storage;
+  view_type view;
+};
+
+template<class Scalar, class Layout>
+struct matrix {
+  using view_type = mdspan<Scalar, dextents<std::size_t, 2>, Layout>;
+
+  matrix(std::size_t num_rows, std::size_t num_cols, std::uint64_t seed)
+  {
+    auto mapping = make_mapping<Layout>(dextents<std::size_t, 2>(num_rows, num_cols));
+    storage.resize(mapping.required_span_size());
+    view = view_type(storage.data(), mapping);
+    value_generator gen(seed);
+    for (std::size_t j = 0; j < num_cols; ++j) {
+      for (std::size_t i = 0; i < num_rows; ++i) {
+        view(i,j) = gen.template next<Scalar>();
+      }
+    }
+  }
+
+  // Make the diagonal dominant, so that triangular solves with this
+  // matrix stay well conditioned.
+  void make_diagonally_dominant()
+  {
+    const std::size_t n = std::min(view.extent(0), view.extent(1));
+    for (std::size_t i = 0; i < n; ++i) {
+      view(i,i) += Scalar(real_t<Scalar>(view.extent(0)));
+    }
+  }
+
+  std::vector<Scalar> storage;
+  view_type view;
+};
+
+// Accessors, applied to the benchmarks' input operands.
+
+struct plain_access {
+  static constexpr const char* name = "plain";
+  template<class View>
+  static View apply(View v) { return v; }
+};
+
+struct scaled_access {
+  static constexpr const char* name = "scaled";
+  template<class View>
+  static auto apply(View v) {
+    return LinearAlgebra::scaled(typename View::value_type(2), v);
+  }
+};
+
+struct conjugated_access {
+  static constexpr const char* name = "conjugated";
+  template<class View>
+  static auto apply(View v) { return LinearAlgebra::conjugated(v); }
+};
+
+// Execution policies.  Policy::call(f) calls f with the policy as its
+// only argument, or with no arguments for the overloads without an
+// execution policy.
+
+struct serial_policy {
+  static constexpr const char* name = "serial";
+  template<class F>
+  static decltype(auto) call(F&& f) { return f(); }
+};
+
+#ifdef LINALG_HAS_EXECUTION
+struct par_policy {
+  static constexpr const char* name = "par";
+  template<class F>
+  static decltype(auto) call(F&& f) { return f(std::execution::par); }
+};
+#endif
+
+struct thread_pool_policy {
+  static constexpr const char* name = "thread_pool_exec";
+  template<class F>
+  static decltype(auto) call(F&& f) { return f(LinearAlgebra::thread_pool_exec{}); }
+};
+
+#ifdef LINALG_ENABLE_TBB
+struct tbb_policy {
+  static constexpr const char* name = "tbb_exec";
+  template<class F>
+  static decltype(auto) call(F&& f) { return f(LinearAlgebra::tbb_exec{}); }
+};
+#endif
+
+// Problem sizes lo, lo * multiplier, ..., up to hi.
+struct size_range {
+  std::int64_t lo;
+  std::int64_t hi;
+  int multiplier;
+};
+
+inline constexpr size_range vector_sizes{1 << 10, 1 << 22, 8};
+inline constexpr size_range matrix_vector_sizes{64, 4096, 4};
+inline constexpr size_range matrix_matrix_sizes{32, 1024, 4};
+
+template<template<class, class, class, class> class Bench,
+         class Scalar, class Layout, class Access, class Policy>
+void register_one(const std::string& name, size_range sizes)
+{
+  const std::string full_name = name + "/" + type_name<Scalar>::value + "/" +
+    type_name<Layout>::value + "/" + Access::name + "/" + Policy::name;
+  benchmark::RegisterBenchmark(full_name.c_str(), &Bench<Scalar, Layout, Access, Policy>::run)
+    ->RangeMultiplier(sizes.multiplier)
+    ->Range(sizes.lo, sizes.hi)
+    ->UseRealTime();
+}
+
+// Register Bench over
+//
+// * all four element types, with layout_left, plain access and no
+//   execution policy;
+// * layout_right and layout_stride, with double;
+// * scaled and conjugated input operands, with double and
+//   std::complex<double>, unless sweep_access is false (e.g., for
+//   algorithms whose operands are all outputs); and
+// * each available parallel execution policy, with double.
+template<template<class, class, class, class> class Bench>
+void register_sweep(const std::string& name, size_range sizes, bool sweep_access = true)
+{
+  using cfloat = std::complex<float>;
+  using cdouble = std::complex<double>;
+
+  register_one<Bench, float, layout_left, plain_access, serial_policy>(name, sizes);
+  register_one<Bench, double, layout_left, plain_access, serial_policy>(name, sizes);
+  register_one<Bench, cfloat, layout_left, plain_access, serial_policy>(name, sizes);
+  register_one<Bench, cdouble, layout_left, plain_access, serial_policy>(name, sizes);
+
+  register_one<Bench, double, layout_right, plain_access, serial_policy>(name, sizes);
+  register_one<Bench, double, layout_stride, plain_access, serial_policy>(name, sizes);
+
+  if (sweep_access) {
+    register_one<Bench, double, layout_left, scaled_access, serial_policy>(name, sizes);
+    register_one<Bench, cdouble, layout_left, scaled_access, serial_policy>(name, sizes);
+    register_one<Bench, cdouble, layout_left, conjugated_access, serial_policy>(name, sizes);
+  }
+
+#ifdef LINALG_HAS_EXECUTION
+  register_one<Bench, double, layout_left, plain_access, par_policy>(name, sizes);
+#endif
+  register_one<Bench, double, layout_left, plain_access, thread_pool_policy>(name, sizes);
+#ifdef LINALG_ENABLE_TBB
+  register_one<Bench, double, layout_left, plain_access, tbb_policy>(name, sizes);
+#endif
+}
+
+} // end namespace linalg_benchmarks
+
+// Define main for a benchmark executable whose benchmarks
+// register_function registers.
+#define LINALG_BENCHMARK_MAIN(register_function) \
+  int main(int argc, char** argv) {              \
+    register_function();                         \
+    benchmark::Initialize(&argc, argv);          \
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) { \
+      return 1;                                  \
+    }                                            \
+    benchmark::RunSpecifiedBenchmarks();         \
+    benchmark::Shutdown();                       \
+    return 0;                                    \
+  }
+
+#endif // LINALG_BENCHMARKS_BENCHMARK_COMMON_HPP_
@@ -0,0 +1,36 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#include "comp_bench_common.hpp"
+
+// setup_givens_rotation and apply_givens_rotation
+
+template<class Scalar>
+void instantiate(comp_bench::operands<Scalar>& ops)
+{
+  namespace LinearAlgebra = comp_bench::LinearAlgebra;
+  using real_type = comp_bench::real_t<Scalar>;
+  Scalar f(1), g(2), s, r;
+  real_type c;
+  LinearAlgebra::setup_givens_rotation(f, g, c, s, r);
+  comp_bench::for_each_policy([&] (auto... exec) {
+    LinearAlgebra::apply_givens_rotation(exec..., ops.x, ops.y, c, s);
+    LinearAlgebra::apply_givens_rotation(exec..., ops.x, ops.y, c, real_type(1));
+  });
+}
+
+COMP_BENCH_INSTANTIATE()
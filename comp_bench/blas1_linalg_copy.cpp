@@ -0,0 +1,34 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#include "comp_bench_common.hpp"
+
+// copy
+
+template<class Scalar>
+void instantiate(comp_bench::operands<Scalar>& ops)
+{
+  namespace LinearAlgebra = comp_bench::LinearAlgebra;
+  comp_bench::for_each_policy([&] (auto... exec) {
+    LinearAlgebra::copy(exec..., ops.x, ops.y);
+    LinearAlgebra::copy(exec..., LinearAlgebra::scaled(Scalar(2), ops.x), ops.y);
+    LinearAlgebra::copy(exec..., ops.A, ops.B);
+    LinearAlgebra::copy(exec..., LinearAlgebra::conjugate_transposed(ops.A), ops.B);
+  });
+}
+
+COMP_BENCH_INSTANTIATE()
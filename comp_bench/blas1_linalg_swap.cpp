@@ -0,0 +1,32 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#include "comp_bench_common.hpp"
+
+// swap_elements
+
+template<class Scalar>
+void instantiate(comp_bench::operands<Scalar>& ops)
+{
+  namespace LinearAlgebra = comp_bench::LinearAlgebra;
+  comp_bench::for_each_policy([&] (auto... exec) {
+    LinearAlgebra::swap_elements(exec..., ops.x, ops.y);
+    LinearAlgebra::swap_elements(exec..., ops.A, LinearAlgebra::transposed(ops.B));
+  });
+}
+
+COMP_BENCH_INSTANTIATE()
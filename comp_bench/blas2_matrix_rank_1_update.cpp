@@ -0,0 +1,47 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#include "comp_bench_common.hpp"
+
+// matrix_rank_1_update, matrix_rank_1_update_c,
+// symmetric_matrix_rank_1_update, and hermitian_matrix_rank_1_update
+
+template<class Scalar>
+void instantiate(comp_bench::operands<Scalar>& ops)
+{
+  namespace LinearAlgebra = comp_bench::LinearAlgebra;
+  using real_type = comp_bench::real_t<Scalar>;
+  constexpr auto t = LinearAlgebra::lower_triangle;
+  comp_bench::for_each_policy([&] (auto... exec) {
+    LinearAlgebra::matrix_rank_1_update(exec..., ops.x, ops.y, ops.A);
+    LinearAlgebra::matrix_rank_1_update(exec..., LinearAlgebra::scaled(Scalar(2), ops.x), ops.y, ops.A);
+    LinearAlgebra::matrix_rank_1_update_c(exec..., ops.x, ops.y, ops.A);
+    LinearAlgebra::symmetric_matrix_rank_1_update(exec..., Scalar(2), ops.x, ops.A, t);
+    LinearAlgebra::hermitian_matrix_rank_1_update(exec..., real_type(2), ops.x, ops.A, t);
+#if defined(LINALG_FIX_RANK_UPDATES)
+    LinearAlgebra::matrix_rank_1_update(exec..., ops.x, ops.y, ops.E, ops.A);
+    LinearAlgebra::matrix_rank_1_update_c(exec..., ops.x, ops.y, ops.E, ops.A);
+    LinearAlgebra::symmetric_matrix_rank_1_update(exec..., Scalar(2), ops.x, ops.E, ops.A, t);
+    LinearAlgebra::hermitian_matrix_rank_1_update(exec..., real_type(2), ops.x, ops.E, ops.A, t);
+#else
+    LinearAlgebra::symmetric_matrix_rank_1_update(exec..., ops.x, ops.A, t);
+    LinearAlgebra::hermitian_matrix_rank_1_update(exec..., ops.x, ops.A, t);
+#endif // LINALG_FIX_RANK_UPDATES
+  });
+}
+
+COMP_BENCH_INSTANTIATE()
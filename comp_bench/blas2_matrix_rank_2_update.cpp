@@ -0,0 +1,38 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#include "comp_bench_common.hpp"
+
+// symmetric_matrix_rank_2_update and hermitian_matrix_rank_2_update
+
+template<class Scalar>
+void instantiate(comp_bench::operands<Scalar>& ops)
+{
+  namespace LinearAlgebra = comp_bench::LinearAlgebra;
+  constexpr auto t = LinearAlgebra::lower_triangle;
+  comp_bench::for_each_policy([&] (auto... exec) {
+    LinearAlgebra::symmetric_matrix_rank_2_update(exec..., ops.x, ops.y, ops.A, t);
+    LinearAlgebra::symmetric_matrix_rank_2_update(exec..., LinearAlgebra::scaled(Scalar(2), ops.x), ops.y, ops.A, t);
+    LinearAlgebra::hermitian_matrix_rank_2_update(exec..., ops.x, ops.y, ops.A, t);
+#if defined(LINALG_FIX_RANK_UPDATES)
+    LinearAlgebra::symmetric_matrix_rank_2_update(exec..., ops.x, ops.y, ops.E, ops.A, t);
+    LinearAlgebra::hermitian_matrix_rank_2_update(exec..., ops.x, ops.y, ops.E, ops.A, t);
+#endif // LINALG_FIX_RANK_UPDATES
+  });
+}
+
+COMP_BENCH_INSTANTIATE()
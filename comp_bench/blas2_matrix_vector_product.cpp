@@ -0,0 +1,45 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#include "comp_bench_common.hpp"
+
+// matrix_vector_product, symmetric_matrix_vector_product,
+// hermitian_matrix_vector_product, and triangular_matrix_vector_product
+
+template<class Scalar>
+void instantiate(comp_bench::operands<Scalar>& ops)
+{
+  namespace LinearAlgebra = comp_bench::LinearAlgebra;
+  constexpr auto t = LinearAlgebra::lower_triangle;
+  constexpr auto d = LinearAlgebra::explicit_diagonal;
+  comp_bench::for_each_policy([&] (auto... exec) {
+    LinearAlgebra::matrix_vector_product(exec..., ops.A, ops.x, ops.y);
+    LinearAlgebra::matrix_vector_product(exec..., ops.A, ops.x, ops.y, ops.z);
+    LinearAlgebra::matrix_vector_product(exec..., LinearAlgebra::transposed(ops.A), ops.x, ops.y);
+    LinearAlgebra::matrix_vector_product(exec..., LinearAlgebra::scaled(Scalar(2), ops.A), ops.x, ops.y);
+    LinearAlgebra::matrix_vector_product(exec..., LinearAlgebra::conjugate_transposed(ops.A), ops.x, ops.y);
+    LinearAlgebra::symmetric_matrix_vector_product(exec..., ops.A, t, ops.x, ops.y);
+    LinearAlgebra::symmetric_matrix_vector_product(exec..., ops.A, t, ops.x, ops.y, ops.z);
+    LinearAlgebra::hermitian_matrix_vector_product(exec..., ops.A, t, ops.x, ops.y);
+    LinearAlgebra::hermitian_matrix_vector_product(exec..., ops.A, t, ops.x, ops.y, ops.z);
+    LinearAlgebra::triangular_matrix_vector_product(exec..., ops.A, t, d, ops.x, ops.y);
+    LinearAlgebra::triangular_matrix_vector_product(exec..., ops.A, t, d, ops.x, ops.y, ops.z);
+    LinearAlgebra::triangular_matrix_vector_product(exec..., ops.A, t, d, ops.y);
+  });
+}
+
+COMP_BENCH_INSTANTIATE()
@@ -0,0 +1,35 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#include "comp_bench_common.hpp"
+
+// matrix_product on rank-3 (batched) operands
+
+template<class Scalar>
+void instantiate(comp_bench::operands<Scalar>&)
+{
+  namespace LinearAlgebra = comp_bench::LinearAlgebra;
+  using batch_extents_t = comp_bench::MdSpan::dextents<std::size_t, 3>;
+  comp_bench::MdSpan::mdspan<Scalar, batch_extents_t, comp_bench::MdSpan::layout_left> A, B, C, E;
+  comp_bench::for_each_policy([&] (auto... exec) {
+    LinearAlgebra::matrix_product(exec..., A, B, C);
+    LinearAlgebra::matrix_product(exec..., A, B, E, C);
+    LinearAlgebra::matrix_product(exec..., LinearAlgebra::scaled(Scalar(2), A), B, C);
+  });
+}
+
+COMP_BENCH_INSTANTIATE()
@@ -0,0 +1,48 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#include "comp_bench_common.hpp"
+
+// matrix_product, symmetric_matrix_product, hermitian_matrix_product,
+// triangular_matrix_product, triangular_matrix_left_product, and
+// triangular_matrix_right_product
+
+template<class Scalar>
+void instantiate(comp_bench::operands<Scalar>& ops)
+{
+  namespace LinearAlgebra = comp_bench::LinearAlgebra;
+  constexpr auto t = LinearAlgebra::lower_triangle;
+  constexpr auto d = LinearAlgebra::explicit_diagonal;
+  comp_bench::for_each_policy([&] (auto... exec) {
+    LinearAlgebra::matrix_product(exec..., ops.A, ops.B, ops.C);
+    LinearAlgebra::matrix_product(exec..., ops.A, ops.B, ops.E, ops.C);
+    LinearAlgebra::matrix_product(exec..., LinearAlgebra::transposed(ops.A), ops.B, ops.C);
+    LinearAlgebra::matrix_product(exec..., LinearAlgebra::scaled(Scalar(2), ops.A), LinearAlgebra::conjugate_transposed(ops.B), ops.C);
+    LinearAlgebra::symmetric_matrix_product(exec..., ops.A, t, ops.B, ops.C);
+    LinearAlgebra::symmetric_matrix_product(exec..., ops.B, ops.A, t, ops.C);
+    LinearAlgebra::symmetric_matrix_product(exec..., ops.A, t, ops.B, ops.E, ops.C);
+    LinearAlgebra::hermitian_matrix_product(exec..., ops.A, t, ops.B, ops.C);
+    LinearAlgebra::hermitian_matrix_product(exec..., ops.B, ops.A, t, ops.C);
+    LinearAlgebra::hermitian_matrix_product(exec..., ops.A, t, ops.B, ops.E, ops.C);
+    LinearAlgebra::triangular_matrix_product(exec..., ops.A, t, d, ops.B, ops.C);
+    LinearAlgebra::triangular_matrix_product(exec..., ops.B, ops.A, t, d, ops.C);
+    LinearAlgebra::triangular_matrix_left_product(exec..., ops.A, t, d, ops.C);
+    LinearAlgebra::triangular_matrix_right_product(exec..., ops.A, t, d, ops.C);
+  });
+}
+
+COMP_BENCH_INSTANTIATE()
@@ -0,0 +1,36 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#include "comp_bench_common.hpp"
+
+// triangular_matrix_matrix_left_solve and
+// triangular_matrix_matrix_right_solve
+
+template<class Scalar>
+void instantiate(comp_bench::operands<Scalar>& ops)
+{
+  namespace LinearAlgebra = comp_bench::LinearAlgebra;
+  constexpr auto t = LinearAlgebra::lower_triangle;
+  constexpr auto d = LinearAlgebra::explicit_diagonal;
+  comp_bench::for_each_policy([&] (auto... exec) {
+    LinearAlgebra::triangular_matrix_matrix_left_solve(exec..., ops.A, t, d, ops.B, ops.C);
+    LinearAlgebra::triangular_matrix_matrix_left_solve(exec..., LinearAlgebra::transposed(ops.A), LinearAlgebra::upper_triangle, d, ops.B, ops.C);
+    LinearAlgebra::triangular_matrix_matrix_right_solve(exec..., ops.A, t, d, ops.B, ops.C);
+  });
+}
+
+COMP_BENCH_INSTANTIATE()
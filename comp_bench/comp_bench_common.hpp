@@ -0,0 +1,90 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef LINALG_COMP_BENCH_COMP_BENCH_COMMON_HPP_
+#define LINALG_COMP_BENCH_COMP_BENCH_COMMON_HPP_
+
+// Each compilation benchmark is one translation unit that includes
+// <experimental/linalg> and instantiates the overload sets of one
+// algorithm header, the way user code would call them: with each
+// element type, with plain, scaled, conjugated, and transposed
+// operands, and with each execution policy.  Each file defines
+//
+//   template<class Scalar> void instantiate(operands<Scalar>& ops);
+//
+// and ends with COMP_BENCH_INSTANTIATE(), which explicitly
+// instantiates it for float, double, and their complex types.
+// include_only.cpp instantiates nothing; its compile time is the
+// cost of parsing the headers, which the other files share.
+// run_comp_bench.py times the files and counts their instantiations.
+
+#include <mdspan/mdspan.hpp>
+#include <experimental/linalg>
+#include <complex>
+#include <cstddef>
+
+#ifdef LINALG_HAS_EXECUTION
+#  include <execution>
+#endif
+
+namespace comp_bench {
+
+namespace MdSpan = MDSPAN_IMPL_STANDARD_NAMESPACE;
+namespace LinearAlgebra = MDSPAN_IMPL_STANDARD_NAMESPACE :: MDSPAN_IMPL_PROPOSED_NAMESPACE :: linalg;
+
+using vector_extents_t = MdSpan::dextents<std::size_t, 1>;
+using matrix_extents_t = MdSpan::dextents<std::size_t, 2>;
+
+template<class Scalar>
+using real_t = decltype(LinearAlgebra::impl::real_if_needed(Scalar{}));
+
+// Operands of every algorithm.  The translation units only compile;
+// nothing runs, so the views need not point to anything.
+template<class Scalar>
+struct operands {
+  MdSpan::mdspan<Scalar, vector_extents_t> x;
+  MdSpan::mdspan<Scalar, vector_extents_t> y;
+  MdSpan::mdspan<Scalar, vector_extents_t> z;
+  MdSpan::mdspan<Scalar, matrix_extents_t, MdSpan::layout_left> A;
+  MdSpan::mdspan<Scalar, matrix_extents_t, MdSpan::layout_left> B;
+  MdSpan::mdspan<Scalar, matrix_extents_t, MdSpan::layout_left> C;
+  MdSpan::mdspan<Scalar, matrix_extents_t, MdSpan::layout_left> E;
+};
+
+// Call f with no arguments, then with each execution policy.
+template<class F>
+void for_each_policy(F&& f)
+{
+  f();
+#ifdef LINALG_HAS_EXECUTION
+  f(std::execution::par);
+#endif
+  f(LinearAlgebra::thread_pool_exec{});
+#ifdef LINALG_ENABLE_TBB
+  f(LinearAlgebra::tbb_exec{});
+#endif
+}
+
+} // end namespace comp_bench
+
+#define COMP_BENCH_INSTANTIATE() \
+  template void instantiate<float>(comp_bench::operands<float>&); \
+  template void instantiate<double>(comp_bench::operands<double>&); \
+  template void instantiate<std::complex<float>>(comp_bench::operands<std::complex<float>>&); \
+  template void instantiate<std::complex<double>>(comp_bench::operands<std::complex<double>>&);
+
+#endif // LINALG_COMP_BENCH_COMP_BENCH_COMMON_HPP_
@@ -0,0 +1,303 @@
+#!/usr/bin/env python3
+
+"""Time the compilation benchmarks and count their instantiations.
+
+For each compilation benchmark (one translation unit per algorithm
+header; see comp_bench_common.hpp), rerun the build's own compile
+command at -O0 with the compiler's timing report turned on
+(-ftime-report for GCC, -ftime-trace for Clang), and record
+
+* wall_s: wall-clock time of the whole compilation;
+* frontend_s: time in the front end (parsing and instantiation);
+* instantiation_s: time spent instantiating templates;
+* linalg_functions: number of functions in the linalg namespace that
+  the object file defines, i.e., the number of instantiations; and
+* overload_sets: linalg_functions by overload set (e.g., "dot" or
+  "impl::trsv_lower_triangular_left_side").
+
+Times are the fastest of --repeat compilations.  include_only's times
+are the cost of parsing the headers; each other benchmark's times
+minus include_only's are the cost of its overload sets.
+
+The results go to OUTPUT_DIR/comp_bench_results.json, together with
+the compiler's reports.  --history appends one line per benchmark to a
+CSV file, so that the numbers can be tracked over time.  --baseline
+compares against an earlier comp_bench_results.json, and fails if any
+benchmark instantiates more functions, or takes longer in the front
+end by more than --time-tolerance.
+"""
+
+import argparse
+import csv
+import datetime
+import json
+import os
+import re
+import shlex
+import subprocess
+import sys
+import time
+
+def load_compile_commands(compile_commands_path, sources_dir):
+    """Map each compilation benchmark's name to its compile command."""
+    if not os.path.exists(compile_commands_path):
+        sys.exit(f"{compile_commands_path} does not exist; configure with a "
+                 "Makefile or Ninja generator and build linalg_comp_bench first")
+    with open(compile_commands_path) as f:
+        entries = json.load(f)
+    sources_dir = os.path.realpath(sources_dir)
+    commands = {}
+    for entry in entries:
+        source = os.path.realpath(os.path.join(entry["directory"], entry["file"]))
+        if os.path.dirname(source) != sources_dir:
+            continue
+        if "arguments" in entry:
+            args = list(entry["arguments"])
+        else:
+            args = shlex.split(entry["command"])
+        name = os.path.splitext(os.path.basename(source))[0]
+        commands[name] = (entry["directory"], args)
+    return commands
+
+def compiler_kind(compiler):
+    version = subprocess.run([compiler, "--version"], capture_output=True, text=True).stdout
+    if "clang" in version.lower():
+        return "clang"
+    if "gcc" in version.lower() or "g++" in version.lower() or "free software foundation" in version.lower():
+        return "gcc"
+    sys.exit(f"Unsupported compiler {compiler}: comp_bench needs GCC or Clang")
+
+def compiler_version(compiler):
+    version = subprocess.run([compiler, "--version"], capture_output=True, text=True).stdout
+    return version.splitlines()[0] if version else compiler
+
+def replace_output(args, object_path):
+    """Return args with the object file replaced by object_path."""
+    result = []
+    skip_next = False
+    for arg in args:
+        if skip_next:
+            skip_next = False
+            continue
+        if arg == "-o":
+            skip_next = True
+            continue
+        if arg.startswith("-o") and len(arg) > 2:
+            continue
+        result.append(arg)
+    return result + ["-o", object_path]
+
+# GCC -ftime-report lines look like
+#  phase parsing                      :   2.79 ( 90%)   1.36 ( 94%)   4.21 ( 91%)   213M ( 90%)
+gcc_report_line = re.compile(
+    r"^\s*\|?(?P<name>[^:]+?)\s*:\s*[\d.]+\s*\(\s*\d+%\)\s*[\d.]+\s*\(\s*\d+%\)\s*(?P<wall>[\d.]+)")
+
+def parse_gcc_report(report):
+    phases = {}
+    for line in report.splitlines():
+        m = gcc_report_line.match(line)
+        if m:
+            phases[m.group("name")] = float(m.group("wall"))
+    return {
+        "frontend_s": phases.get("phase parsing", 0.0) + phases.get("phase lang. deferred", 0.0),
+        "instantiation_s": phases.get("template instantiation", 0.0),
+    }
+
+def parse_clang_trace(trace_path):
+    with open(trace_path) as f:
+        events = json.load(f)["traceEvents"]
+    totals = {}
+    for event in events:
+        name = event.get("name", "")
+        if name.startswith("Total "):
+            totals[name[len("Total "):]] = event.get("dur", 0) * 1.0e-6
+    return {
+        "frontend_s": totals.get("Frontend", 0.0),
+        "instantiation_s": totals.get("InstantiateFunction", 0.0) + totals.get("InstantiateClass", 0.0),
+    }
+
+def strip_arguments(name):
+    """Remove template arguments and function parameters from a
+    demangled name, e.g., "double ns::linalg::dot<...>(...)" becomes
+    "double ns::linalg::dot()"."""
+    name = name.replace("(anonymous namespace)", "anonymous").replace("operator()", "operator_call")
+    out = []
+    angle_depth = 0
+    paren_depth = 0
+    for ch in name:
+        if ch == "<":
+            angle_depth += 1
+        elif ch == ">" and angle_depth > 0:
+            angle_depth -= 1
+        elif angle_depth > 0:
+            pass
+        elif ch == "(":
+            paren_depth += 1
+            if paren_depth == 1:
+                out.append(ch)
+        elif ch == ")":
+            paren_depth -= 1
+            if paren_depth == 0:
+                out.append(ch)
+        elif paren_depth == 0:
+            out.append(ch)
+    return "".join(out)
+
+overload_set_name = re.compile(r"linalg::((?:\w+::)*?\w+)\(")
+
+def count_linalg_functions(nm, object_path):
+    """Count the functions in the linalg namespace that the object
+    file defines, by overload set."""
+    symbols = subprocess.run([nm, "--defined-only", "-C", object_path],
+                             capture_output=True, text=True, check=True).stdout
+    overload_sets = {}
+    for line in symbols.splitlines():
+        fields = line.split(None, 2)
+        if len(fields) != 3 or fields[1] not in ("T", "t", "W", "w"):
+            continue
+        m = overload_set_name.search(strip_arguments(fields[2]))
+        if m:
+            overload_sets[m.group(1)] = overload_sets.get(m.group(1), 0) + 1
+    return overload_sets
+
+def run_benchmark(name, directory, args, kind, repeat, nm, output_dir):
+    object_path = os.path.join(output_dir, name + ".o")
+    command = replace_output(args, object_path) + ["-O0"]
+    command += ["-ftime-report"] if kind == "gcc" else ["-ftime-trace"]
+    best = None
+    for _ in range(repeat):
+        start = time.perf_counter()
+        completed = subprocess.run(command, cwd=directory, capture_output=True, text=True)
+        wall = time.perf_counter() - start
+        if completed.returncode != 0:
+            sys.exit(f"Compiling {name} failed:\n{completed.stderr}")
+        if best is not None and wall >= best["wall_s"]:
+            continue
+        if kind == "gcc":
+            report_path = os.path.join(output_dir, name + ".time-report.txt")
+            with open(report_path, "w") as f:
+                f.write(completed.stderr)
+            best = parse_gcc_report(completed.stderr)
+        else:
+            best = parse_clang_trace(os.path.join(output_dir, name + ".json"))
+        best["wall_s"] = wall
+    overload_sets = count_linalg_functions(nm, object_path)
+    best["linalg_functions"] = sum(overload_sets.values())
+    best["overload_sets"] = overload_sets
+    return best
+
+def git_commit(sources_dir):
+    completed = subprocess.run(["git", "-C", sources_dir, "describe", "--always", "--dirty"],
+                               capture_output=True, text=True)
+    return completed.stdout.strip() if completed.returncode == 0 else "unknown"
+
+def append_history(history_path, date, commit, compiler, results):
+    new_file = not os.path.exists(history_path)
+    with open(history_path, "a", newline="") as f:
+        writer = csv.writer(f)
+        if new_file:
+            writer.writerow(["date", "commit", "compiler", "benchmark",
+                             "wall_s", "frontend_s", "instantiation_s", "linalg_functions"])
+        for name, r in sorted(results.items()):
+            writer.writerow([date, commit, compiler, name,
+                             f"{r['wall_s']:.3f}", f"{r['frontend_s']:.3f}",
+                             f"{r['instantiation_s']:.3f}", r["linalg_functions"]])
+
+def compare(baseline, results, time_tolerance, min_time_delta):
+    """Return a list of regressions of results relative to baseline."""
+    regressions = []
+    for name, r in sorted(results.items()):
+        b = baseline.get(name)
+        if b is None:
+            continue
+        if r["linalg_functions"] > b["linalg_functions"]:
+            grown = [f"{key} {b['overload_sets'].get(key, 0)} -> {count}"
+                     for key, count in sorted(r["overload_sets"].items())
+                     if count > b["overload_sets"].get(key, 0)]
+            regressions.append(f"{name}: {b['linalg_functions']} -> {r['linalg_functions']} "
+                               f"linalg functions ({', '.join(grown)})")
+        delta = r["frontend_s"] - b["frontend_s"]
+        if delta > min_time_delta and delta > time_tolerance * b["frontend_s"]:
+            regressions.append(f"{name}: front end {b['frontend_s']:.2f} s -> {r['frontend_s']:.2f} s")
+    return regressions
+
+def print_table(results, baseline, verbose):
+    def delta(name, key, fmt):
+        if baseline is None or name not in baseline:
+            return ""
+        return f" ({r[key] - baseline[name][key]:{fmt}})"
+    print(f"{'benchmark':40} {'wall [s]':>16} {'front end [s]':>18} {'instantiation [s]':>18} {'functions':>14}")
+    for name, r in sorted(results.items()):
+        print(f"{name:40} {r['wall_s']:8.2f}{delta(name, 'wall_s', '+.2f'):8}"
+              f" {r['frontend_s']:10.2f}{delta(name, 'frontend_s', '+.2f'):8}"
+              f" {r['instantiation_s']:10.2f}{delta(name, 'instantiation_s', '+.2f'):8}"
+              f" {r['linalg_functions']:8}{delta(name, 'linalg_functions', '+d'):6}")
+        if verbose:
+            for key, count in sorted(r["overload_sets"].items(), key=lambda item: -item[1]):
+                print(f"    {key:60} {count:8}")
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compile-commands", required=True,
+                        help="the build's compile_commands.json")
+    parser.add_argument("--sources", required=True,
+                        help="directory of the compilation benchmarks' sources")
+    parser.add_argument("--output-dir", required=True,
+                        help="directory for the results and the compiler's reports")
+    parser.add_argument("--repeat", type=int, default=3,
+                        help="compile each benchmark this many times, and keep the fastest")
+    parser.add_argument("--nm", default="nm", help="nm executable")
+    parser.add_argument("--filter", default="", help="only run benchmarks whose names match this regex")
+    parser.add_argument("--history", help="CSV file to which to append the results")
+    parser.add_argument("--baseline", help="comp_bench_results.json of an earlier run to compare against")
+    parser.add_argument("--time-tolerance", type=float, default=0.10,
+                        help="largest allowed relative growth in front-end time")
+    parser.add_argument("--min-time-delta", type=float, default=0.10,
+                        help="ignore growth in front-end time of fewer seconds than this")
+    parser.add_argument("--verbose", action="store_true",
+                        help="print the number of functions in each overload set")
+    options = parser.parse_args()
+
+    commands = load_compile_commands(options.compile_commands, options.sources)
+    if not commands:
+        sys.exit(f"No compile commands for sources in {options.sources}")
+    os.makedirs(options.output_dir, exist_ok=True)
+
+    compiler = next(iter(commands.values()))[1][0]
+    kind = compiler_kind(compiler)
+    selected = re.compile(options.filter)
+    results = {}
+    for name, (directory, args) in sorted(commands.items()):
+        if not selected.search(name):
+            continue
+        results[name] = run_benchmark(name, directory, args, kind, options.repeat,
+                                      options.nm, options.output_dir)
+
+    date = datetime.datetime.now().isoformat(timespec="seconds")
+    commit = git_commit(options.sources)
+    version = compiler_version(compiler)
+    with open(os.path.join(options.output_dir, "comp_bench_results.json"), "w") as f:
+        json.dump({"date": date, "commit": commit, "compiler": version, "results": results},
+                  f, indent=2, sort_keys=True)
+    if options.history:
+        append_history(options.history, date, commit, version, results)
+
+    baseline = None
+    if options.baseline:
+        with open(options.baseline) as f:
+            baseline = json.load(f)["results"]
+    print(f"{version}, {commit}")
+    print_table(results, baseline, options.verbose)
+
+    if baseline is not None:
+        regressions = compare(baseline, results, options.time_tolerance, options.min_time_delta)
+        if regressions:
+            print("\nCompilation regressions relative to " + options.baseline + ":")
+            for regression in regressions:
+                print("  " + regression)
+            return 1
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -64,7 +64,7 @@ template<class ElementType1,
          class Layout2,
          class Accessor2,
          class Scalar>
-Scalar dot(
+constexpr Scalar dot(
   impl::inline_exec_t&& /* exec */,
   mdspan<ElementType1, extents<SizeType1, ext1>, Layout1, Accessor1> v1,
   mdspan<ElementType2, extents<SizeType2, ext2>, Layout2, Accessor2> v2,
@@ -74,6 +74,20 @@ Scalar dot(
                 v2.static_extent(0) == dynamic_extent ||
                 v1.static_extent(0) == v2.static_extent(0));
 
+  if constexpr (impl::use_unrolled_dot_v<decltype(v1), decltype(v2)>) {
+    return impl::unrolled_dot(v1, v2, init);
+  }
+#if defined(__cpp_lib_is_constant_evaluated)
+  // Without is_constant_evaluated, this constexpr overload cannot
+  // tell whether it may call the (non-constexpr) vector kernel.
+  else if constexpr (impl::use_simd_dot_v<decltype(v1), decltype(v2), Scalar>) {
+    if (! std::is_constant_evaluated() &&
+        impl::is_contiguous_vector(v1) && impl::is_contiguous_vector(v2)) {
+      return init + impl::extractScalingFactor(v1) * impl::extractScalingFactor(v2) *
+        impl::simd_dot(v1, v2);
+    }
+  }
+#endif
   using size_type = std::common_type_t<SizeType1, SizeType2>;
   for (size_type k = 0; k < v1.extent(0); ++k) {
     init += v1(k) * v2(k);
@@ -126,11 +140,18 @@ template<class ElementType1,
          class Layout2,
          class Accessor2,
          class Scalar>
-Scalar dot(mdspan<ElementType1, extents<SizeType1, ext1>, Layout1, Accessor1> v1,
-           mdspan<ElementType2, extents<SizeType2, ext2>, Layout2, Accessor2> v2,
-           Scalar init)
+constexpr Scalar dot(mdspan<ElementType1, extents<SizeType1, ext1>, Layout1, Accessor1> v1,
+                     mdspan<ElementType2, extents<SizeType2, ext2>, Layout2, Accessor2> v2,
+                     Scalar init)
 {
-  return dot(impl::default_exec_t{}, v1, v2, init);
+  // Short vectors of compile-time length skip the execution policy
+  // mapping, so that dot can be used in constant expressions.
+  if constexpr (impl::use_unrolled_dot_v<decltype(v1), decltype(v2)>) {
+    return dot(impl::inline_exec_t{}, v1, v2, init);
+  }
+  else {
+    return dot(impl::default_exec_t{}, v1, v2, init);
+  }
 }
 
 template<class ElementType1,
@@ -206,7 +227,7 @@ template<class ElementType1,
          ::std::size_t ext2,
          class Layout2,
          class Accessor2>
-auto dot(
+constexpr auto dot(
   mdspan<ElementType1, extents<SizeType1, ext1>, Layout1, Accessor1> v1,
   mdspan<ElementType2, extents<SizeType2, ext2>, Layout2, Accessor2> v2)
 -> decltype(dot_detail::dot_return_type_deducer(v1, v2))
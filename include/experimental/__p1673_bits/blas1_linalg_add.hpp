@@ -55,6 +55,13 @@ void add_rank_1(
                 y.static_extent(0) == dynamic_extent ||
                 x.static_extent(0) == y.static_extent(0));
 
+  if constexpr (impl::are_flat_operands_v<decltype(x), decltype(y), decltype(z)>) {
+    if (impl::is_flat(x, y, z)) {
+      impl::flat_add(x.data_handle(), y.data_handle(), z.data_handle(), z.extent(0));
+      return;
+    }
+  }
+
   using size_type = std::common_type_t<SizeType_x, SizeType_y, SizeType_z>;
   for (size_type i = 0; i < z.extent(0); ++i) {
     z(i) = x(i) + y(i);
@@ -104,6 +111,16 @@ void add_rank_2(
                 y.static_extent(1) == dynamic_extent ||
                 x.static_extent(1) == y.static_extent(1));
 
+  if constexpr (impl::are_flat_operands_v<decltype(x), decltype(y), decltype(z)>) {
+    if (impl::is_flat(x, y, z)) {
+      impl::flat_add(x.data_handle(), y.data_handle(), z.data_handle(), z.size());
+    }
+    else {
+      impl::strided_for_each([&] (auto i, auto j) { z(i,j) = x(i,j) + y(i,j); }, z, x, y);
+    }
+    return;
+  }
+
   using size_type = std::common_type_t<SizeType_x, SizeType_y, SizeType_z>;
   for (size_type j = 0; j < x.extent(1); ++j) {
     for (size_type i = 0; i < x.extent(0); ++i) {
@@ -42,6 +42,13 @@ void copy_rank_1(
   static_assert(x.static_extent(0) == dynamic_extent ||
                 y.static_extent(0) == dynamic_extent ||
                 x.static_extent(0) == y.static_extent(0));
+  if constexpr (impl::are_flat_operands_v<decltype(x), decltype(y)>) {
+    if (impl::is_flat(x, y)) {
+      impl::flat_copy(x.data_handle(), y.data_handle(), y.extent(0));
+      return;
+    }
+  }
+
   using size_type = std::common_type_t<SizeType_x, SizeType_y>;
   for (size_type i = 0; i < y.extent(0); ++i) {
     y(i) = x(i);
@@ -70,6 +77,16 @@ void copy_rank_2(
   static_assert(x.static_extent(1) == dynamic_extent ||
                 y.static_extent(1) == dynamic_extent ||
                 x.static_extent(1) == y.static_extent(1));
+  if constexpr (impl::are_flat_operands_v<decltype(x), decltype(y)>) {
+    if (impl::is_flat(x, y)) {
+      impl::flat_copy(x.data_handle(), y.data_handle(), y.size());
+    }
+    else {
+      impl::strided_for_each([&] (auto i, auto j) { y(i,j) = x(i,j); }, y, x);
+    }
+    return;
+  }
+
   using size_type = std::common_type_t<SizeType_x, SizeType_y>;
   for (size_type j = 0; j < y.extent(1); ++j) {
     for (size_type i = 0; i < y.extent(0); ++i) {
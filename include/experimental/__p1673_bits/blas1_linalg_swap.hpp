@@ -45,6 +45,13 @@ void swap_rank_1(
                 y.static_extent(0) == dynamic_extent ||
                 x.static_extent(0) == y.static_extent(0));
 
+  if constexpr (are_flat_operands_v<decltype(x), decltype(y)>) {
+    if (is_flat(x, y)) {
+      flat_swap(x.data_handle(), y.data_handle(), y.extent(0));
+      return;
+    }
+  }
+
   using std::swap;
   using size_type = std::common_type_t<SizeType_x, SizeType_y>;
 
@@ -77,6 +84,16 @@ void swap_rank_2(
                 x.static_extent(1) == y.static_extent(1));
 
   using std::swap;
+  if constexpr (are_flat_operands_v<decltype(x), decltype(y)>) {
+    if (is_flat(x, y)) {
+      flat_swap(x.data_handle(), y.data_handle(), y.size());
+    }
+    else {
+      strided_for_each([&] (auto i, auto j) { swap(x(i,j), y(i,j)); }, y, x);
+    }
+    return;
+  }
+
   using size_type = ::std::common_type_t<SizeType_x, SizeType_y>;
 
   for (size_type j = 0; j < y.extent(1); ++j) {
@@ -18,6 +18,7 @@
 #ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS1_MATRIX_FROB_NORM_HPP_
 #define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS1_MATRIX_FROB_NORM_HPP_
 
+#include "blas1_vector_sum_of_squares.hpp"
 #include <cmath>
 #include <cstdlib>
 
@@ -78,6 +79,19 @@ Scalar matrix_frob_norm(
     return result;
   }
 
+  using value_type = typename decltype(A)::value_type;
+  if constexpr (impl::use_blue_norm_v<value_type, Scalar>) {
+    impl::blue_sum_of_squares<Scalar> ssq;
+    for (size_type i = 0; i < A.extent(0); ++i) {
+      for (size_type j = 0; j < A.extent(1); ++j) {
+        ssq.add_parts(value_type(A(i,j)));
+      }
+    }
+    const auto ssq_res = ssq.result();
+    result += ssq_res.scaling_factor * sqrt(ssq_res.scaled_sum_of_squares);
+    return result;
+  }
+
   // Rescaling avoids unwarranted overflow or underflow.
   Scalar scale = 0.0;
   Scalar ssq = 1.0;
@@ -85,12 +99,13 @@ Scalar matrix_frob_norm(
     for (size_type j = 0; j < A.extent(1); ++j) {
       const auto absaij = abs(A(i,j));
       if (absaij != 0.0) {
-        const auto quotient = scale / absaij;
         if (scale < absaij) {
+          const auto quotient = scale / absaij;
           ssq = Scalar(1.0) + ssq * quotient * quotient;
           scale = absaij;
         }
         else {
+          const auto quotient = absaij / scale;
           ssq = ssq + quotient * quotient;
         }
       }
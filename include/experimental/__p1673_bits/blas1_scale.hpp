@@ -35,6 +35,13 @@ void linalg_scale_rank_1(
   const Scalar alpha,
   mdspan<ElementType, extents<SizeType, ext0>, Layout, Accessor> x)
 {
+  if constexpr (impl::are_flat_operands_v<decltype(x)>) {
+    if (impl::is_flat(x)) {
+      impl::flat_scale(alpha, x.data_handle(), x.extent(0));
+      return;
+    }
+  }
+
   for (SizeType i = 0; i < x.extent(0); ++i) {
     x(i) *= alpha;
   }
@@ -51,6 +58,16 @@ void linalg_scale_rank_2(
   const Scalar alpha,
   mdspan<ElementType, extents<SizeType, numRows, numCols>, Layout, Accessor> A)
 {
+  if constexpr (impl::are_flat_operands_v<decltype(A)>) {
+    if (impl::is_flat(A)) {
+      impl::flat_scale(alpha, A.data_handle(), A.size());
+    }
+    else {
+      impl::strided_for_each([&] (auto i, auto j) { A(i,j) *= alpha; }, A);
+    }
+    return;
+  }
+
   for (SizeType j = 0; j < A.extent(1); ++j) {
     for (SizeType i = 0; i < A.extent(0); ++i) {
       A(i,j) *= alpha;
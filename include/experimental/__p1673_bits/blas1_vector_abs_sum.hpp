@@ -65,7 +65,13 @@ Scalar vector_abs_sum(
              impl::abs_if_needed(impl::real_if_needed(std::declval<value_type>())) +
              impl::abs_if_needed(impl::imag_if_needed(std::declval<value_type>())));
   static_assert(std::is_convertible_v<sum_type, Scalar>);
-  
+
+  if constexpr (impl::use_simd_abs_sum_v<decltype(v), Scalar>) {
+    if (impl::is_contiguous_vector(v)) {
+      return init + impl::simd_abs_sum(v);
+    }
+  }
+
   const SizeType numElt = v.extent(0);
   if constexpr (std::is_arithmetic_v<value_type>) {
     for (SizeType i = 0; i < numElt; ++i) {
@@ -60,6 +60,12 @@ SizeType vector_idx_abs_max_default_impl(
     return std::numeric_limits<SizeType>::max();
   }
 
+  if constexpr (impl::use_simd_idx_abs_max_v<decltype(v)>) {
+    if (impl::is_contiguous_vector(v) && impl::simd_idx_abs_max_fits(v)) {
+      return impl::simd_idx_abs_max(v);
+    }
+  }
+
   if constexpr (std::is_arithmetic_v<value_type>) {
     SizeType maxInd = 0;
     magnitude_type maxVal = abs(v(0));
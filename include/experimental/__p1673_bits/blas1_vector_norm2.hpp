@@ -60,6 +60,19 @@ Scalar vector_two_norm(
   mdspan<ElementType, extents<SizeType, ext0>, Layout, Accessor> x,
   Scalar init)
 {
+  using std::sqrt;
+  using value_type = typename decltype(x)::value_type;
+  if constexpr (impl::is_complex_v<value_type> && impl::use_blue_norm_v<value_type, Scalar>) {
+    // The norm does not need vector_sum_of_squares' scaling factor,
+    // the largest magnitude, which would cost an abs per element.
+    impl::blue_sum_of_squares<Scalar> ssq;
+    for (SizeType i = 0; i < x.extent(0); ++i) {
+      ssq.add_parts(value_type(x(i)));
+    }
+    const auto ssq_res = ssq.result();
+    return init + ssq_res.scaling_factor * sqrt(ssq_res.scaled_sum_of_squares);
+  }
+
   // Initialize the sum of squares result
   sum_of_squares_result<Scalar> ssq_init;
   ssq_init.scaling_factor = Scalar{};
@@ -70,7 +83,6 @@ Scalar vector_two_norm(
   // Compute the sum of squares using an algorithm that avoids
   // underflow and overflow by scaling.
   auto ssq_res = vector_sum_of_squares(exec, x, ssq_init);
-  using std::sqrt;
   return init + ssq_res.scaling_factor * sqrt(ssq_res.scaled_sum_of_squares);
 }
 
@@ -20,6 +20,8 @@
 
 #include <cmath>
 #include <cstdlib>
+#include <limits>
+#include <type_traits>
 
 namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
 namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
@@ -33,6 +35,173 @@ struct sum_of_squares_result {
   Scalar scaled_sum_of_squares;
 };
 
+// Combine two scaled sums of squares: return a result whose value,
+// scaling_factor^2 * scaled_sum_of_squares, is the sum of x's and y's
+// values.  The scaling factor is the larger of theirs, so nothing
+// overflows unless the combined value does.  The operation is
+// commutative and, up to rounding, associative, and any result with
+// a zero scaling factor is an identity, so parallel reductions can
+// use it to merge the partial results of vector_sum_of_squares on
+// parts of a vector.  A NaN scaling factor propagates.
+template<class Scalar>
+sum_of_squares_result<Scalar>
+combine_sum_of_squares(const sum_of_squares_result<Scalar>& x,
+                       const sum_of_squares_result<Scalar>& y)
+{
+  const bool x_is_larger =
+    y.scaling_factor <= x.scaling_factor || x.scaling_factor != x.scaling_factor;
+  const auto& larger = x_is_larger ? x : y;
+  const auto& smaller = x_is_larger ? y : x;
+  if (smaller.scaling_factor == Scalar{}) {
+    return larger;
+  }
+  // This also keeps two infinite scaling factors from making NaN.
+  if (smaller.scaling_factor == larger.scaling_factor) {
+    return {larger.scaling_factor,
+            larger.scaled_sum_of_squares + smaller.scaled_sum_of_squares};
+  }
+  const auto quotient = smaller.scaling_factor / larger.scaling_factor;
+  return {larger.scaling_factor,
+          larger.scaled_sum_of_squares + smaller.scaled_sum_of_squares * quotient * quotient};
+}
+
+namespace impl {
+
+// Blue's algorithm for the sum of squares (J. L. Blue, "A Portable
+// Fortran Program to Find the Euclidean Norm of a Vector," ACM TOMS
+// 4 (1978)), with the constants of E. Anderson, "Algorithm 978: Safe
+// Scaling in the Level 1 BLAS," ACM TOMS 44 (2017), as in LAPACK's
+// DNRM2.
+//
+// Each magnitude goes into one of three accumulators, by whether its
+// square would underflow, overflow, or neither.  Magnitudes in the
+// first and last ranges are scaled by a power of two before squaring,
+// so no sum overflows or underflows, and the scaling is exact.
+// Unlike the Reference BLAS DNRM2 rescaling, adding a magnitude
+// needs no division and no data-dependent branch, so compilers can
+// vectorize the loop.  Two accumulations merge by adding their sums,
+// so they can come from parallel partial reductions.
+constexpr int blue_floor_half(int n) { return n >= 0 ? n / 2 : -((1 - n) / 2); }
+constexpr int blue_ceil_half(int n) { return -blue_floor_half(-n); }
+
+template<class Scalar>
+constexpr Scalar power_of_two(int e)
+{
+  Scalar result(1.0);
+  for (; e > 0; --e) {
+    result *= Scalar(2.0);
+  }
+  for (; e < 0; ++e) {
+    result /= Scalar(2.0);
+  }
+  return result;
+}
+
+template<class Scalar>
+struct blue_sum_of_squares {
+  using limits = ::std::numeric_limits<Scalar>;
+  // Magnitudes in [tsml, tbig] have squares that neither underflow
+  // nor overflow.  Smaller magnitudes are scaled up by ssml, and
+  // larger ones down by sbig.
+  static constexpr Scalar tsml = power_of_two<Scalar>(blue_ceil_half(limits::min_exponent - 1));
+  static constexpr Scalar tbig = power_of_two<Scalar>(blue_floor_half(limits::max_exponent - limits::digits + 1));
+  static constexpr Scalar ssml = power_of_two<Scalar>(-blue_floor_half(limits::min_exponent - limits::digits));
+  static constexpr Scalar sbig = power_of_two<Scalar>(-blue_ceil_half(limits::max_exponent + limits::digits - 1));
+
+  Scalar small{};
+  Scalar medium{};
+  Scalar big{};
+  // Largest magnitude added, or NaN if any was NaN.
+  Scalar max_abs{};
+
+  // Add the square of a magnitude.  NaN goes into medium.
+  void add(Scalar abs_value) {
+    const bool is_big = abs_value > tbig;
+    const bool is_small = abs_value < tsml;
+    const Scalar scaled_big = abs_value * sbig;
+    const Scalar scaled_small = abs_value * ssml;
+    big += is_big ? scaled_big * scaled_big : Scalar{};
+    small += is_small ? scaled_small * scaled_small : Scalar{};
+    medium += ! is_big && ! is_small ? abs_value * abs_value : Scalar{};
+    max_abs = (max_abs < abs_value || abs_value != abs_value) ? abs_value : max_abs;
+  }
+
+  // Add the squares of the real and imaginary parts of value.  For
+  // real values, this is value's square.  For complex values, it is
+  // their magnitude's square, but max_abs only bounds the magnitudes.
+  template<class Value>
+  void add_parts(const Value& value) {
+    add(static_cast<Scalar>(abs_if_needed(real_if_needed(value))));
+    if constexpr (is_complex_v<Value>) {
+      add(static_cast<Scalar>(abs_if_needed(imag_if_needed(value))));
+    }
+  }
+
+  void merge(const blue_sum_of_squares& other) {
+    small += other.small;
+    medium += other.medium;
+    big += other.big;
+    const Scalar a = other.max_abs;
+    max_abs = (max_abs < a || a != a) ? a : max_abs;
+  }
+
+  // For parallel reductions.
+  static blue_sum_of_squares merged(blue_sum_of_squares x, const blue_sum_of_squares& y) {
+    x.merge(y);
+    return x;
+  }
+
+  // The sum of squares, scaled by max_abs.
+  sum_of_squares_result<Scalar> result() const {
+    if (max_abs == Scalar{}) {
+      return {Scalar{}, Scalar{}};
+    }
+    if (max_abs == limits::infinity()) {
+      return {max_abs, Scalar(1.0)};
+    }
+    // Each quotient is at most the number of terms in its sum.
+    // ssml * max_abs may overflow if there are big terms, but then
+    // the small terms are negligible.
+    const Scalar scale = max_abs;
+    Scalar ssq = medium / scale / scale;
+    if (big != Scalar{}) {
+      const Scalar s = sbig * scale;
+      ssq += big / s / s;
+    }
+    if (small != Scalar{}) {
+      const Scalar s = ssml * scale;
+      ssq += small / s / s;
+    }
+    return {scale, ssq};
+  }
+};
+
+// Whether the algorithms use blue_sum_of_squares<Scalar> for
+// elements of type Value.  vector_sum_of_squares must report the
+// largest magnitude of any element as the scaling factor, so it only
+// uses Blue's algorithm for real elements.  The norms use it for
+// complex elements as well.
+template<class Scalar>
+inline constexpr bool is_blue_scalar_v =
+  std::is_floating_point_v<Scalar> && ::std::numeric_limits<Scalar>::radix == 2;
+
+template<class Value, class Scalar>
+inline constexpr bool use_blue_sum_of_squares_v =
+  is_blue_scalar_v<Scalar> && std::is_floating_point_v<Value>;
+
+template<class Value, class Scalar, class = void>
+struct use_blue_norm : std::bool_constant<use_blue_sum_of_squares_v<Value, Scalar>> {};
+
+template<class Value, class Scalar>
+struct use_blue_norm<Value, Scalar, std::enable_if_t<is_complex_v<Value>>>
+  : std::bool_constant<is_blue_scalar_v<Scalar> &&
+                       std::is_floating_point_v<typename Value::value_type>> {};
+
+template<class Value, class Scalar>
+inline constexpr bool use_blue_norm_v = use_blue_norm<Value, Scalar>::value;
+
+} // end namespace impl
+
 namespace
 {
 template <class Exec, class x_t, class Scalar, class = void>
@@ -74,6 +243,21 @@ sum_of_squares_result<Scalar> vector_sum_of_squares(
     return init;
   }
 
+  if constexpr (impl::use_simd_sum_of_squares_v<decltype(x), Scalar>) {
+    if (impl::is_contiguous_vector(x) && impl::simd_sum_of_squares(x, init)) {
+      return init;
+    }
+  }
+
+  using value_type = typename decltype(x)::value_type;
+  if constexpr (impl::use_blue_sum_of_squares_v<value_type, Scalar>) {
+    impl::blue_sum_of_squares<Scalar> ssq;
+    for (SizeType i = 0; i < x.extent(0); ++i) {
+      ssq.add_parts(value_type(x(i)));
+    }
+    return combine_sum_of_squares(init, ssq.result());
+  }
+
   // Rescaling, as in the Reference BLAS DNRM2 implementation, avoids
   // unwarranted overflow or underflow.
 
@@ -369,6 +369,29 @@ void matrix_rank_1_update(
   mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y,
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_rank_1_update_dispatch_to_blas<decltype(x), decltype(y), decltype(A)>()) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+    auto init_A = [&] { impl::blas_zero_triangle<void>(A); };
+#else
+    auto init_A = [] {};
+#endif // LINALG_FIX_RANK_UPDATES
+    if (impl::matrix_rank_1_update_blas(x, y, A, init_A)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::is_ger_blockable_v<decltype(x), decltype(y), decltype(A)>) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+    constexpr bool overwrite = true;
+#else
+    constexpr bool overwrite = false;
+#endif // LINALG_FIX_RANK_UPDATES
+    impl::blocked_ger<overwrite>(x, y, impl::make_strided_matrix_view(A).as_const(), A);
+    return;
+  }
+
   using size_type = ::std::common_type_t<SizeType_x, SizeType_y, SizeType_A>;
 
   for (size_type i = 0; i < A.extent(0); ++i) {
@@ -410,6 +433,21 @@ void matrix_rank_1_update(
   mdspan<ElementType_E, extents<SizeType_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_rank_1_update_dispatch_to_blas<decltype(x), decltype(y), decltype(A)>()) {
+    if (impl::matrix_rank_1_update_blas(x, y, A, [&] { impl::blas_copy_triangle<void>(E, A); })) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::is_ger_blockable_v<decltype(x), decltype(y), decltype(A)> &&
+                impl::is_gemm_packable_matrix_v<decltype(E)> &&
+                std::is_same_v<typename decltype(E)::value_type, typename decltype(A)::value_type>) {
+    impl::blocked_ger<false>(x, y, impl::make_strided_matrix_view(E).as_const(), A);
+    return;
+  }
+
   using size_type = ::std::common_type_t<SizeType_x, SizeType_y, SizeType_A>;
 
   for (size_type i = 0; i < A.extent(0); ++i) {
@@ -694,9 +732,31 @@ void symmetric_matrix_rank_1_update(
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
   Triangle /* t */)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::symmetric_matrix_rank_1_update_dispatch_to_blas<ScaleFactorType, decltype(x), decltype(A)>()) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+    auto init_A = [&] { impl::blas_zero_triangle<Triangle>(A); };
+#else
+    auto init_A = [] {};
+#endif // LINALG_FIX_RANK_UPDATES
+    if (impl::symmetric_matrix_rank_1_update_blas(alpha, x, A, Triangle{}, init_A)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
   using index_type = std::common_type_t<SizeType_x, SizeType_A>;
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::is_layout_blas_packed_v<Layout_A>) {
+    impl::packed_for_each_stored_element<Triangle>(A, [&] (index_type i, index_type j, auto&& A_ij) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+      A_ij = alpha * x(i) * x(j);
+#else
+      A_ij += alpha * x(i) * x(j);
+#endif // LINALG_FIX_RANK_UPDATES
+    });
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (index_type i = 0; i < A.extent(0); ++i) {
       for (index_type j = 0; j <= i; ++j) {
 #if defined(LINALG_FIX_RANK_UPDATES)
@@ -751,9 +811,22 @@ void symmetric_matrix_rank_1_update(
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
   Triangle /* t */)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::symmetric_matrix_rank_1_update_dispatch_to_blas<ScaleFactorType, decltype(x), decltype(A)>()) {
+    if (impl::symmetric_matrix_rank_1_update_blas(alpha, x, A, Triangle{}, [&] { impl::blas_copy_triangle<Triangle>(E, A); })) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
   using index_type = std::common_type_t<SizeType_x, SizeType_E, SizeType_A>;
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::is_layout_blas_packed_v<Layout_A>) {
+    impl::packed_for_each_stored_element<Triangle>(A, [&] (index_type i, index_type j, auto&& A_ij) {
+      A_ij = E(i,j) + alpha * x(i) * x(j);
+    });
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (index_type j = 0; j < A.extent(1); ++j) {
       for (index_type i = j; i < A.extent(0); ++i) {
         A(i,j) = E(i,j) + alpha * x(i) * x(j);
@@ -963,9 +1036,31 @@ void symmetric_matrix_rank_1_update(
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
   Triangle /* t */)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::symmetric_matrix_rank_1_update_dispatch_to_blas<typename decltype(A)::value_type, decltype(x), decltype(A)>()) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+    auto init_A = [&] { impl::blas_zero_triangle<Triangle>(A); };
+#else
+    auto init_A = [] {};
+#endif // LINALG_FIX_RANK_UPDATES
+    if (impl::symmetric_matrix_rank_1_update_blas(typename decltype(A)::value_type(1), x, A, Triangle{}, init_A)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
   using index_type = std::common_type_t<SizeType_x, SizeType_A>;
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::is_layout_blas_packed_v<Layout_A>) {
+    impl::packed_for_each_stored_element<Triangle>(A, [&] (index_type i, index_type j, auto&& A_ij) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+      A_ij = x(i) * x(j);
+#else
+      A_ij += x(i) * x(j);
+#endif // LINALG_FIX_RANK_UPDATES
+    });
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (index_type i = 0; i < A.extent(0); ++i) {
       for (index_type j = 0; j <= i; ++j) {
 #if defined(LINALG_FIX_RANK_UPDATES)
@@ -1019,9 +1114,22 @@ void symmetric_matrix_rank_1_update(
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
   Triangle /* t */)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::symmetric_matrix_rank_1_update_dispatch_to_blas<typename decltype(A)::value_type, decltype(x), decltype(A)>()) {
+    if (impl::symmetric_matrix_rank_1_update_blas(typename decltype(A)::value_type(1), x, A, Triangle{}, [&] { impl::blas_copy_triangle<Triangle>(E, A); })) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
   using index_type = std::common_type_t<SizeType_x, SizeType_E, SizeType_A>;
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::is_layout_blas_packed_v<Layout_A>) {
+    impl::packed_for_each_stored_element<Triangle>(A, [&] (index_type i, index_type j, auto&& A_ij) {
+      A_ij = E(i,j) + x(i) * x(j);
+    });
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (index_type i = 0; i < A.extent(0); ++i) {
       for (index_type j = 0; j <= i; ++j) {
         A(i,j) = E(i,j) + x(i) * x(j);
@@ -1228,7 +1336,32 @@ void hermitian_matrix_rank_1_update(
   alpha = impl::real_if_needed(alpha);
 #endif // LINALG_FIX_RANK_UPDATES
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::hermitian_matrix_rank_1_update_dispatch_to_blas<ScaleFactorType, decltype(x), decltype(A)>()) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+    auto init_A = [&] { impl::blas_zero_triangle<Triangle>(A); };
+#else
+    auto init_A = [] {};
+#endif // LINALG_FIX_RANK_UPDATES
+    if (impl::hermitian_matrix_rank_1_update_blas(alpha, x, A, Triangle{}, init_A)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::is_layout_blas_packed_v<Layout_A>) {
+    impl::packed_for_each_stored_element<Triangle>(A, [&] (index_type i, index_type j, auto&& A_ij) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+      A_ij = alpha * x(i) * impl::conj_if_needed(x(j));
+#else
+      if (i == j) {
+        A_ij = impl::real_if_needed(A_ij);
+      }
+      A_ij += alpha * x(i) * impl::conj_if_needed(x(j));
+#endif // LINALG_FIX_RANK_UPDATES
+    });
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (index_type i = 0; i < A.extent(0); ++i) {
       for (index_type j = 0; j <= i; ++j) {
 #if defined(LINALG_FIX_RANK_UPDATES)
@@ -1295,7 +1428,25 @@ void hermitian_matrix_rank_1_update(
   alpha = impl::real_if_needed(alpha);
 #endif // LINALG_FIX_RANK_UPDATES
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::hermitian_matrix_rank_1_update_dispatch_to_blas<ScaleFactorType, decltype(x), decltype(A)>()) {
+    if (impl::hermitian_matrix_rank_1_update_blas(alpha, x, A, Triangle{}, [&] { impl::blas_copy_triangle<Triangle>(E, A); })) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::is_layout_blas_packed_v<Layout_A>) {
+    impl::packed_for_each_stored_element<Triangle>(A, [&] (index_type i, index_type j, auto&& A_ij) {
+      if (i == j) {
+        A_ij = impl::real_if_needed(E(i,j)) + alpha * x(i) * impl::conj_if_needed(x(j));
+      }
+      else {
+        A_ij = E(i,j) + alpha * x(i) * impl::conj_if_needed(x(j));
+      }
+    });
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (index_type j = 0; j < A.extent(1); ++j) {
       for (index_type i = j; i < A.extent(0); ++i) {
         if (i == j) {
@@ -1517,9 +1668,34 @@ void hermitian_matrix_rank_1_update(
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
   Triangle /* t */)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::hermitian_matrix_rank_1_update_dispatch_to_blas<typename decltype(A)::value_type, decltype(x), decltype(A)>()) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+    auto init_A = [&] { impl::blas_zero_triangle<Triangle>(A); };
+#else
+    auto init_A = [] {};
+#endif // LINALG_FIX_RANK_UPDATES
+    if (impl::hermitian_matrix_rank_1_update_blas(typename decltype(A)::value_type(1), x, A, Triangle{}, init_A)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
   using index_type = std::common_type_t<SizeType_x, SizeType_A>;
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::is_layout_blas_packed_v<Layout_A>) {
+    impl::packed_for_each_stored_element<Triangle>(A, [&] (index_type i, index_type j, auto&& A_ij) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+      A_ij = x(i) * impl::conj_if_needed(x(j));
+#else
+      if (i == j) {
+        A_ij = impl::real_if_needed(A_ij);
+      }
+      A_ij += x(i) * impl::conj_if_needed(x(j));
+#endif // LINALG_FIX_RANK_UPDATES
+    });
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (index_type i = 0; i < A.extent(0); ++i) {
       for (index_type j = 0; j <= i; ++j) {
 #if defined(LINALG_FIX_RANK_UPDATES)
@@ -1578,9 +1754,27 @@ void hermitian_matrix_rank_1_update(
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
   Triangle /* t */)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::hermitian_matrix_rank_1_update_dispatch_to_blas<typename decltype(A)::value_type, decltype(x), decltype(A)>()) {
+    if (impl::hermitian_matrix_rank_1_update_blas(typename decltype(A)::value_type(1), x, A, Triangle{}, [&] { impl::blas_copy_triangle<Triangle>(E, A); })) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
   using index_type = std::common_type_t<SizeType_x, SizeType_E, SizeType_A>;
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::is_layout_blas_packed_v<Layout_A>) {
+    impl::packed_for_each_stored_element<Triangle>(A, [&] (index_type i, index_type j, auto&& A_ij) {
+      if (i == j) {
+        A_ij = impl::real_if_needed(E(i,j)) + x(i) * impl::conj_if_needed(x(j));
+      }
+      else {
+        A_ij = E(i,j) + x(i) * impl::conj_if_needed(x(j));
+      }
+    });
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (index_type i = 0; i < A.extent(0); ++i) {
       for (index_type j = 0; j <= i; ++j) {
         if (i == j) {
@@ -204,6 +204,28 @@ void symmetric_matrix_rank_2_update(
 {
   using index_type = std::common_type_t<IndexType_x, IndexType_y, IndexType_A>;
   constexpr bool lower_tri = std::is_same_v<Triangle, lower_triangle_t>;
+
+  if constexpr (impl::is_layout_blas_packed_v<Layout_A>) {
+    impl::packed_for_each_stored_element<Triangle>(A, [&] (index_type i, index_type j, auto&& A_ij) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+      A_ij = x(i) * y(j) + y(i) * x(j);
+#else
+      A_ij += x(i) * y(j) + y(i) * x(j);
+#endif // LINALG_FIX_RANK_UPDATES
+    });
+    return;
+  }
+
+  if constexpr (impl::is_syr2_blockable_v<decltype(x), decltype(y), decltype(A)>) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+    constexpr bool overwrite = true;
+#else
+    constexpr bool overwrite = false;
+#endif // LINALG_FIX_RANK_UPDATES
+    impl::blocked_syr2<false, overwrite, Triangle>(x, y, impl::make_strided_matrix_view(A).as_const(), A);
+    return;
+  }
+
   for (index_type j = 0; j < A.extent(1); ++j) {
     const index_type i_lower = lower_tri ? j : index_type(0);
     const index_type i_upper = lower_tri ? A.extent(0) : j+1;
@@ -256,6 +278,21 @@ void symmetric_matrix_rank_2_update(
   using index_type = std::common_type_t<IndexType_x, IndexType_y,
     typename Extents_E::index_type, typename Extents_A::index_type>;
   constexpr bool lower_tri = std::is_same_v<Triangle, lower_triangle_t>;
+
+  if constexpr (impl::is_layout_blas_packed_v<Layout_A>) {
+    impl::packed_for_each_stored_element<Triangle>(A, [&] (index_type i, index_type j, auto&& A_ij) {
+      A_ij = E(i,j) + x(i) * y(j) + y(i) * x(j);
+    });
+    return;
+  }
+
+  if constexpr (impl::is_syr2_blockable_v<decltype(x), decltype(y), decltype(A)> &&
+                impl::is_gemm_packable_matrix_v<decltype(E)> &&
+                std::is_same_v<typename decltype(E)::value_type, typename decltype(A)::value_type>) {
+    impl::blocked_syr2<false, false, Triangle>(x, y, impl::make_strided_matrix_view(E).as_const(), A);
+    return;
+  }
+
   for (index_type j = 0; j < A.extent(1); ++j) {
     const index_type i_lower = lower_tri ? j : index_type(0);
     const index_type i_upper = lower_tri ? A.extent(0) : j+1;
@@ -479,6 +516,31 @@ void hermitian_matrix_rank_2_update(
 
   constexpr bool lower_tri =
     std::is_same_v<Triangle, lower_triangle_t>;
+
+  if constexpr (impl::is_layout_blas_packed_v<Layout_A>) {
+    impl::packed_for_each_stored_element<Triangle>(A, [&] (index_type i, index_type j, auto&& A_ij) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+      A_ij = x(i) * impl::conj_if_needed(y(j)) + y(i) * impl::conj_if_needed(x(j));
+#else
+      if (i == j) {
+        A_ij = impl::real_if_needed(A_ij);
+      }
+      A_ij += x(i) * impl::conj_if_needed(y(j)) + y(i) * impl::conj_if_needed(x(j));
+#endif // LINALG_FIX_RANK_UPDATES
+    });
+    return;
+  }
+
+  if constexpr (impl::is_syr2_blockable_v<decltype(x), decltype(y), decltype(A)>) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+    constexpr bool overwrite = true;
+#else
+    constexpr bool overwrite = false;
+#endif // LINALG_FIX_RANK_UPDATES
+    impl::blocked_syr2<true, overwrite, Triangle>(x, y, impl::make_strided_matrix_view(A).as_const(), A);
+    return;
+  }
+
   for (index_type j = 0; j < A.extent(1); ++j) {
     const index_type i_lower = lower_tri ? j : index_type(0);
     const index_type i_upper = lower_tri ? A.extent(0) : j+1;
@@ -534,6 +596,26 @@ void hermitian_matrix_rank_2_update(
     typename Extents_E::index_type, typename Extents_A::index_type>;
   constexpr bool lower_tri =
     std::is_same_v<Triangle, lower_triangle_t>;
+
+  if constexpr (impl::is_layout_blas_packed_v<Layout_A>) {
+    impl::packed_for_each_stored_element<Triangle>(A, [&] (index_type i, index_type j, auto&& A_ij) {
+      if (i == j) {
+        A_ij = impl::real_if_needed(E(i,j)) + x(i) * impl::conj_if_needed(y(j)) + y(i) * impl::conj_if_needed(x(j));
+      }
+      else {
+        A_ij = E(i,j) + x(i) * impl::conj_if_needed(y(j)) + y(i) * impl::conj_if_needed(x(j));
+      }
+    });
+    return;
+  }
+
+  if constexpr (impl::is_syr2_blockable_v<decltype(x), decltype(y), decltype(A)> &&
+                impl::is_gemm_packable_matrix_v<decltype(E)> &&
+                std::is_same_v<typename decltype(E)::value_type, typename decltype(A)::value_type>) {
+    impl::blocked_syr2<true, false, Triangle>(x, y, impl::make_strided_matrix_view(E).as_const(), A);
+    return;
+  }
+
   for (index_type j = 0; j < A.extent(1); ++j) {
     const index_type i_lower = lower_tri ? j : index_type(0);
     const index_type i_upper = lower_tri ? A.extent(0) : j+1;
@@ -263,20 +263,38 @@ MDSPAN_TEMPLATE_REQUIRES(
          class Accessor_y,
          /* requires */ (Layout_A::template mapping<extents<SizeType_A, numRows_A, numCols_A> >::is_always_unique())
 )
-void matrix_vector_product(
+constexpr void matrix_vector_product(
   impl::inline_exec_t&& /* exec */,
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
   mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
   mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y)
 {
-  using size_type = std::common_type_t<
-    std::common_type_t<
-      std::common_type_t<SizeType_A, SizeType_x>,
-      SizeType_y>>;
-  for (size_type i = 0; i < A.extent(0); ++i) {
-    y(i) = ElementType_y{};
-    for (size_type j = 0; j < A.extent(1); ++j) {
-      y(i) += A(i,j) * x(j);
+  if constexpr (impl::use_unrolled_matrix_vector_product_v<decltype(A), decltype(x), decltype(y)>) {
+    impl::unrolled_matrix_vector_product(A, x, y, [] (auto) { return ElementType_y{}; });
+    return;
+  }
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_vector_product_dispatch_to_blas<decltype(A), decltype(x), decltype(y)>()) {
+    if (impl::matrix_vector_product_blas(A, x, ElementType_y{}, y, [] {})) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::is_gemv_blockable_v<decltype(A), decltype(x), decltype(y)>) {
+    impl::blocked_gemv_rows(A, x, y, [] (auto) { return ElementType_y{}; },
+      0, ::std::ptrdiff_t(A.extent(0)));
+  }
+  else {
+    using size_type = std::common_type_t<
+      std::common_type_t<
+        std::common_type_t<SizeType_A, SizeType_x>,
+        SizeType_y>>;
+    for (size_type i = 0; i < A.extent(0); ++i) {
+      y(i) = ElementType_y{};
+      for (size_type j = 0; j < A.extent(1); ++j) {
+        y(i) += A(i,j) * x(j);
+      }
     }
   }
 }
@@ -328,12 +346,19 @@ template<class ElementType_A,
          class SizeType_y, ::std::size_t ext_y,
          class Layout_y,
          class Accessor_y>
-void matrix_vector_product(
+constexpr void matrix_vector_product(
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
   mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
   mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y)
 {
-  matrix_vector_product(impl::default_exec_t{}, A, x, y);
+  // Small matrices of compile-time size skip the execution policy
+  // mapping, so that this can be used in constant expressions.
+  if constexpr (impl::use_unrolled_matrix_vector_product_v<decltype(A), decltype(x), decltype(y)>) {
+    matrix_vector_product(impl::inline_exec_t{}, A, x, y);
+  }
+  else {
+    matrix_vector_product(impl::default_exec_t{}, A, x, y);
+  }
 }
 
 namespace impl {
@@ -352,6 +377,13 @@ namespace impl {
 
   template<class Layout, class Extents>
   constexpr bool always_unique_mapping_v = always_unique_mapping<Layout, Extents>::value;
+
+  // The symmetric, Hermitian, and triangular algorithms only access
+  // one triangle of A, so they also take layout_blas_packed, whose
+  // mapping is not unique.
+  template<class Layout, class Extents>
+  constexpr bool triangle_accessible_mapping_v =
+    always_unique_mapping_v<Layout, Extents> || is_layout_blas_packed_v<Layout>;
 } // namespace impl
 
 // Updating general matrix-vector product: z := y + A * x
@@ -380,22 +412,41 @@ MDSPAN_TEMPLATE_REQUIRES(
          class Accessor_z,
          /* requires */ (impl::always_unique_mapping_v<Layout_A, Extents_A /* SizeType_A, numRows_A, numCols_A */> && Extents_A::rank() == 2)
 )
-void matrix_vector_product(
+constexpr void matrix_vector_product(
   impl::inline_exec_t&& /* exec */,
   mdspan<ElementType_A, Extents_A /* extents<SizeType_A, numRows_A, numCols_A> */, Layout_A, Accessor_A> A,
   mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
   mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y,
   mdspan<ElementType_z, extents<SizeType_z, ext_z>, Layout_z, Accessor_z> z)
 {
-  using size_type = std::common_type_t<
-    std::common_type_t<
-      std::common_type_t<typename Extents_A::size_type /* SizeType_A */, SizeType_x>,
-      SizeType_y>,
-    SizeType_z>;
-  for (size_type i = 0; i < A.extent(0); ++i) {
-    z(i) = y(i);
-    for (size_type j = 0; j < A.extent(1); ++j) {
-      z(i) += A(i,j) * x(j);
+  if constexpr (impl::use_unrolled_matrix_vector_product_v<decltype(A), decltype(x), decltype(z)> &&
+                impl::all_static_extents_v<decltype(y)>) {
+    impl::unrolled_matrix_vector_product(A, x, z, [&] (auto i) { return y(i); });
+    return;
+  }
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_vector_product_dispatch_to_blas<decltype(A), decltype(x), decltype(z)>()) {
+    if (impl::matrix_vector_product_blas(A, x, ElementType_z(1), z, [&] { linalg::copy(y, z); })) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::is_gemv_blockable_v<decltype(A), decltype(x), decltype(z)>) {
+    impl::blocked_gemv_rows(A, x, z, [&] (auto i) { return y(i); },
+      0, ::std::ptrdiff_t(A.extent(0)));
+  }
+  else {
+    using size_type = std::common_type_t<
+      std::common_type_t<
+        std::common_type_t<typename Extents_A::size_type /* SizeType_A */, SizeType_x>,
+        SizeType_y>,
+      SizeType_z>;
+    for (size_type i = 0; i < A.extent(0); ++i) {
+      z(i) = y(i);
+      for (size_type j = 0; j < A.extent(1); ++j) {
+        z(i) += A(i,j) * x(j);
+      }
     }
   }
 }
@@ -466,13 +517,19 @@ MDSPAN_TEMPLATE_REQUIRES(
          class Accessor_z,
          /* requires */ (impl::always_unique_mapping_v<Layout_A, Extents_A /* extents<SizeType_A, numRows_A, numCols_A> */ > && Extents_A::rank() == 2)
 )
-void matrix_vector_product(
+constexpr void matrix_vector_product(
   mdspan<ElementType_A, Extents_A /* extents<SizeType_A, numRows_A, numCols_A> */, Layout_A, Accessor_A> A,
   mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
   mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y,
   mdspan<ElementType_z, extents<SizeType_z, ext_z>, Layout_z, Accessor_z> z)
 {
-  matrix_vector_product(impl::default_exec_t{}, A, x, y, z);
+  if constexpr (impl::use_unrolled_matrix_vector_product_v<decltype(A), decltype(x), decltype(z)> &&
+                impl::all_static_extents_v<decltype(y)>) {
+    matrix_vector_product(impl::inline_exec_t{}, A, x, y, z);
+  }
+  else {
+    matrix_vector_product(impl::default_exec_t{}, A, x, y, z);
+  }
 }
 
 
@@ -493,7 +550,7 @@ MDSPAN_TEMPLATE_REQUIRES(
          class SizeType_y, ::std::size_t ext_y,
          class Layout_y,
          class Accessor_y,
-         /* requires */ (Layout_A::template mapping<extents<SizeType_A, numRows_A, numCols_A>>::is_always_unique())
+         /* requires */ (impl::triangle_accessible_mapping_v<Layout_A, extents<SizeType_A, numRows_A, numCols_A>>)
 )
 void symmetric_matrix_vector_product(
   impl::inline_exec_t&& /* exec */,
@@ -502,6 +559,19 @@ void symmetric_matrix_vector_product(
   mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
   mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::symmetric_matrix_vector_product_dispatch_to_blas<decltype(A), decltype(x), decltype(y)>()) {
+    if (impl::symmetric_matrix_vector_product_blas(A, t, x, ElementType_y{}, y, [] {})) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::is_symv_blockable_v<decltype(A), decltype(x), decltype(y)>) {
+    impl::blocked_symv<false, Triangle>(A, x, y, [] (auto) { return ElementType_y{}; });
+    return;
+  }
+
   using size_type = std::common_type_t<
       std::common_type_t<SizeType_A, SizeType_x>,
     SizeType_y>;
@@ -510,7 +580,10 @@ void symmetric_matrix_vector_product(
     y(i) = ElementType_y{};
   }
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::is_layout_blas_packed_v<Layout_A>) {
+    impl::packed_symmetric_matrix_vector_product<false, Triangle>(A, x, y);
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (size_type j = 0; j < A.extent(1); ++j) {
       y(j) += A(j,j) * x(j);
       for (size_type i = j + size_type(1); i < A.extent(0); ++i) {
@@ -579,7 +652,7 @@ MDSPAN_TEMPLATE_REQUIRES(
          class SizeType_y, ::std::size_t ext_y,
          class Layout_y,
          class Accessor_y,
-         /* requires */ (Layout_A::template mapping<extents<SizeType_A, numRows_A, numCols_A>>::is_always_unique())
+         /* requires */ (impl::triangle_accessible_mapping_v<Layout_A, extents<SizeType_A, numRows_A, numCols_A>>)
 )
 void symmetric_matrix_vector_product(
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
@@ -613,7 +686,7 @@ MDSPAN_TEMPLATE_REQUIRES(
 	 class Extents_z,
          class Layout_z,
          class Accessor_z,
-         /* requires */ (impl::always_unique_mapping_v<Layout_A, Extents_A> && Extents_A::rank() == 2 && Extents_z::rank() == 1)
+         /* requires */ (impl::triangle_accessible_mapping_v<Layout_A, Extents_A> && Extents_A::rank() == 2 && Extents_z::rank() == 1)
 )
 void symmetric_matrix_vector_product(
   impl::inline_exec_t&& /* exec */,
@@ -623,6 +696,19 @@ void symmetric_matrix_vector_product(
   mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y,
   mdspan<ElementType_z, Extents_z, Layout_z, Accessor_z> z)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::symmetric_matrix_vector_product_dispatch_to_blas<decltype(A), decltype(x), decltype(z)>()) {
+    if (impl::symmetric_matrix_vector_product_blas(A, t, x, ElementType_z(1), z, [&] { linalg::copy(y, z); })) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::is_symv_blockable_v<decltype(A), decltype(x), decltype(z)>) {
+    impl::blocked_symv<false, Triangle>(A, x, z, [&] (auto i) { return y(i); });
+    return;
+  }
+
   using size_type = std::common_type_t<
     std::common_type_t<
       std::common_type_t<typename Extents_A::size_type, SizeType_x>,
@@ -633,7 +719,10 @@ void symmetric_matrix_vector_product(
     z(i) = y(i);
   }
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::is_layout_blas_packed_v<Layout_A>) {
+    impl::packed_symmetric_matrix_vector_product<false, Triangle>(A, x, z);
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (size_type j = 0; j < A.extent(1); ++j) {
       z(j) += A(j,j) * x(j);
       for (size_type i = j + size_type(1); i < A.extent(0); ++i) {
@@ -715,7 +804,7 @@ MDSPAN_TEMPLATE_REQUIRES(
          /* class SizeType_z, ::std::size_t ext_z, */
          class Layout_z,
          class Accessor_z,
-         /* requires */ (impl::always_unique_mapping_v<Layout_A, Extents_A /* extents<SizeType_A, numRows_A, numCols_A> */ > && Extents_A::rank() == 2 && Extents_z::rank() == 1)
+         /* requires */ (impl::triangle_accessible_mapping_v<Layout_A, Extents_A> && Extents_A::rank() == 2 && Extents_z::rank() == 1)
 )
 void symmetric_matrix_vector_product(
   mdspan<ElementType_A,  Extents_A /* extents<SizeType_A, numRows_A, numCols_A> */ , Layout_A, Accessor_A> A,
@@ -746,7 +835,7 @@ MDSPAN_TEMPLATE_REQUIRES(
          class SizeType_y, ::std::size_t ext_y,
          class Layout_y,
          class Accessor_y,
-         /* requires */ (Layout_A::template mapping<extents<SizeType_A, numRows_A, numCols_A>>::is_always_unique())
+         /* requires */ (impl::triangle_accessible_mapping_v<Layout_A, extents<SizeType_A, numRows_A, numCols_A>>)
 )
 void hermitian_matrix_vector_product(
   impl::inline_exec_t&& /* exec */,
@@ -755,6 +844,19 @@ void hermitian_matrix_vector_product(
   mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
   mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_vector_product_dispatch_to_blas<decltype(A), decltype(x), decltype(y)>()) {
+    if (impl::hermitian_matrix_vector_product_blas(A, t, x, ElementType_y{}, y, [] {})) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::is_symv_blockable_v<decltype(A), decltype(x), decltype(y)>) {
+    impl::blocked_symv<true, Triangle>(A, x, y, [] (auto) { return ElementType_y{}; });
+    return;
+  }
+
   using size_type = std::common_type_t<
       std::common_type_t<SizeType_A, SizeType_x>,
     SizeType_y>;
@@ -763,7 +865,10 @@ void hermitian_matrix_vector_product(
     y(i) = ElementType_y{};
   }
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::is_layout_blas_packed_v<Layout_A>) {
+    impl::packed_symmetric_matrix_vector_product<true, Triangle>(A, x, y);
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (size_type j = 0; j < A.extent(1); ++j) {
       y(j) += impl::real_if_needed(A(j,j)) * x(j);
       for (size_type i = j + size_type(1); i < A.extent(0); ++i) {
@@ -801,7 +906,7 @@ MDSPAN_TEMPLATE_REQUIRES(
          class SizeType_y, ::std::size_t ext_y,
          class Layout_y,
          class Accessor_y,
-         /* requires */ (Layout_A::template mapping<extents<SizeType_A, numRows_A, numCols_A>>::is_always_unique())
+         /* requires */ (impl::triangle_accessible_mapping_v<Layout_A, extents<SizeType_A, numRows_A, numCols_A>>)
 )
 void hermitian_matrix_vector_product(
   ExecutionPolicy&& exec,
@@ -835,7 +940,7 @@ MDSPAN_TEMPLATE_REQUIRES(
          class SizeType_y, ::std::size_t ext_y,
          class Layout_y,
          class Accessor_y,
-         /* requires */ (Layout_A::template mapping<extents<SizeType_A, numRows_A, numCols_A>>::is_always_unique())
+         /* requires */ (impl::triangle_accessible_mapping_v<Layout_A, extents<SizeType_A, numRows_A, numCols_A>>)
 )
 void hermitian_matrix_vector_product(
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
@@ -873,7 +978,7 @@ MDSPAN_TEMPLATE_REQUIRES(
 	 /* class SizeType_z, ::std::size_t ext_z, */
          class Layout_z,
          class Accessor_z,
-         /* requires */ (impl::always_unique_mapping_v<Layout_A, Extents_A /* extents<SizeType_A, numRows_A, numCols_A> */ > && Extents_A::rank() == 2 && Extents_z::rank() == 1)
+         /* requires */ (impl::triangle_accessible_mapping_v<Layout_A, Extents_A> && Extents_A::rank() == 2 && Extents_z::rank() == 1)
 )
 void hermitian_matrix_vector_product(
   impl::inline_exec_t&& /* exec */,
@@ -883,6 +988,19 @@ void hermitian_matrix_vector_product(
   mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y,
   mdspan<ElementType_z, Extents_z /* extents<SizeType_z, ext_z> */ , Layout_z, Accessor_z> z)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_vector_product_dispatch_to_blas<decltype(A), decltype(x), decltype(z)>()) {
+    if (impl::hermitian_matrix_vector_product_blas(A, t, x, ElementType_z(1), z, [&] { linalg::copy(y, z); })) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::is_symv_blockable_v<decltype(A), decltype(x), decltype(z)>) {
+    impl::blocked_symv<true, Triangle>(A, x, z, [&] (auto i) { return y(i); });
+    return;
+  }
+
   using size_type = std::common_type_t<
     std::common_type_t<
       std::common_type_t<typename Extents_A::size_type /* SizeType_A */ , SizeType_x>,
@@ -893,7 +1011,10 @@ void hermitian_matrix_vector_product(
     z(i) = y(i);
   }
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::is_layout_blas_packed_v<Layout_A>) {
+    impl::packed_symmetric_matrix_vector_product<true, Triangle>(A, x, z);
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (size_type j = 0; j < A.extent(1); ++j) {
       z(j) += impl::real_if_needed(A(j,j)) * x(j);
       for (size_type i = j + size_type(1); i < A.extent(0); ++i) {
@@ -976,7 +1097,7 @@ MDSPAN_TEMPLATE_REQUIRES(
          ::std::size_t ext_z, */
          class Layout_z,
          class Accessor_z,
-         /* requires */ (impl::always_unique_mapping_v<Layout_A, Extents_A /* extents<SizeType_A, numRows_A, numCols_A> */ > && Extents_A::rank() == 2)
+         /* requires */ (impl::triangle_accessible_mapping_v<Layout_A, Extents_A> && Extents_A::rank() == 2)
 )
 void hermitian_matrix_vector_product(
   mdspan<ElementType_A, Extents_A /* extents<SizeType_A, numRows_A, numCols_A> */ , Layout_A, Accessor_A> A,
@@ -1007,7 +1128,7 @@ MDSPAN_TEMPLATE_REQUIRES(
          class SizeType_y, ::std::size_t ext_y,
          class Layout_y,
          class Accessor_y,
-         /* requires */ (Layout_A::template mapping<extents<SizeType_A, numRows_A, numCols_A>>::is_always_unique())
+         /* requires */ (impl::triangle_accessible_mapping_v<Layout_A, extents<SizeType_A, numRows_A, numCols_A>>)
 )
 void triangular_matrix_vector_product(
   impl::inline_exec_t&& /* exec */,
@@ -1017,6 +1138,14 @@ void triangular_matrix_vector_product(
   mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
   mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_vector_product_dispatch_to_blas<decltype(A), decltype(x), decltype(y)>()) {
+    if (impl::triangular_matrix_vector_blas<false>(A, t, d, x, y)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
   using size_type = std::common_type_t<
       std::common_type_t<SizeType_A, SizeType_x>,
     SizeType_y>;
@@ -1106,7 +1235,7 @@ MDSPAN_TEMPLATE_REQUIRES(
          class SizeType_y, ::std::size_t ext_y,
          class Layout_y,
          class Accessor_y,
-         /* requires */ (Layout_A::template mapping<extents<SizeType_A, numRows_A, numCols_A>>::is_always_unique())
+         /* requires */ (impl::triangle_accessible_mapping_v<Layout_A, extents<SizeType_A, numRows_A, numCols_A>>)
 )
 void triangular_matrix_vector_product(
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
@@ -1147,7 +1276,7 @@ MDSPAN_TEMPLATE_REQUIRES(
          ::std::size_t ext_z, */
          class Layout_z,
          class Accessor_z,
-         /* requires */ (impl::always_unique_mapping_v<Layout_A, Extents_A /* extents<SizeType_A, numRows_A, numCols_A> */ > && Extents_A::rank() == 2)
+         /* requires */ (impl::triangle_accessible_mapping_v<Layout_A, Extents_A> && Extents_A::rank() == 2)
 )
 void triangular_matrix_vector_product(
   impl::inline_exec_t&& /* exec */,
@@ -1158,6 +1287,14 @@ void triangular_matrix_vector_product(
   mdspan<ElementType_y, Extents_y /* extents<SizeType_y, ext_y> */ , Layout_y, Accessor_y> y,
   mdspan<ElementType_z, Extents_z /* extents<SizeType_z, ext_z> */ , Layout_z, Accessor_z> z)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_vector_product_dispatch_to_blas<decltype(A), decltype(x), decltype(z)>()) {
+    if (impl::triangular_matrix_vector_product_blas(A, t, d, x, y, z)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
   using size_type = std::common_type_t<
     std::common_type_t<
       std::common_type_t<
@@ -1263,7 +1400,7 @@ MDSPAN_TEMPLATE_REQUIRES(
          ::std::size_t ext_z, */
          class Layout_z,
          class Accessor_z,
-         /* requires */ (impl::always_unique_mapping_v<Layout_A, Extents_A /* extents<SizeType_A, numRows_A, numCols_A> */ > && Extents_A::rank() == 2)
+         /* requires */ (impl::triangle_accessible_mapping_v<Layout_A, Extents_A> && Extents_A::rank() == 2)
 )
 void triangular_matrix_vector_product(
   mdspan<ElementType_A, Extents_A /* extents<SizeType_A, numRows_A, numCols_A> */ , Layout_A, Accessor_A> A,
@@ -1292,7 +1429,7 @@ MDSPAN_TEMPLATE_REQUIRES(
          ::std::size_t ext_y,
          class Layout_y,
          class Accessor_y,
-         /* requires */ (impl::always_unique_mapping_v<Layout_A, extents<SizeType_A, numRows_A, numCols_A>>)
+         /* requires */ (impl::triangle_accessible_mapping_v<Layout_A, extents<SizeType_A, numRows_A, numCols_A>>)
 )
 void triangular_matrix_vector_product(
   linalg::impl::inline_exec_t&& /* exec */,
@@ -1301,6 +1438,14 @@ void triangular_matrix_vector_product(
   DiagonalStorage d,
   mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_vector_product_dispatch_to_blas<decltype(A), decltype(y), decltype(y)>()) {
+    if (impl::triangular_matrix_vector_blas<false>(A, t, d, y, y)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
   using size_type = std::common_type_t<SizeType_A, SizeType_y>;
   constexpr bool explicitDiagonal =
     std::is_same_v<DiagonalStorage, explicit_diagonal_t>;
@@ -1376,7 +1521,7 @@ MDSPAN_TEMPLATE_REQUIRES(
          ::std::size_t ext_y,
          class Layout_y,
          class Accessor_y,
-         /* requires */ (impl::always_unique_mapping_v<Layout_A, extents<SizeType_A, numRows_A, numCols_A>>)
+         /* requires */ (impl::triangle_accessible_mapping_v<Layout_A, extents<SizeType_A, numRows_A, numCols_A>>)
 )
 void triangular_matrix_vector_product(
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
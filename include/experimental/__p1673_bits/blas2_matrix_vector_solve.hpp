@@ -226,7 +226,10 @@ void triangular_matrix_vector_solve(
   mdspan<ElementType_X, extents<SizeType_X, ext_X>, Layout_X, Accessor_X> x,
   BinaryDivideOp divide)
 {
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::is_layout_blas_packed_v<Layout_A>) {
+    impl::packed_triangular_matrix_vector_solve<Triangle, DiagonalStorage>(A, b, x, divide);
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     trsv_lower_triangular_left_side(A, d, b, x, divide);
   }
   else {
@@ -257,6 +260,19 @@ void triangular_matrix_vector_solve(
   mdspan<ElementType_B, extents<SizeType_B, ext_B>, Layout_B, Accessor_B> b,
   mdspan<ElementType_X, extents<SizeType_X, ext_X>, Layout_X, Accessor_X> x)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_vector_product_dispatch_to_blas<decltype(A), decltype(b), decltype(x)>()) {
+    if (impl::triangular_matrix_vector_blas<true>(A, t, d, b, x)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::is_trsv_blockable_v<decltype(A), decltype(b), decltype(x)>) {
+    impl::blocked_trsv<Triangle, DiagonalStorage>(A, b, x);
+    return;
+  }
+
   auto divide = [](const auto& x, const auto& y) { return x / y; };
   triangular_matrix_vector_solve(std::forward<impl::inline_exec_t>(exec), A, t, d, b, x, divide);
 }
@@ -0,0 +1,500 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS3_BATCHED_MATRIX_PRODUCT_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS3_BATCHED_MATRIX_PRODUCT_HPP_
+
+#include "blocked_gemm.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+// Batched matrix_product: overloads of matrix_product for rank-3
+// mdspan, whose leftmost extent is the batch index.  For each batch
+// index b, they compute the product of the matrices A[b,:,:] and
+// B[b,:,:], as a loop over submdspan slices calling the rank-2
+// matrix_product would, but without the per-call overhead.
+//
+// If all the operands are "batch-major," that is, stride(0) == 1
+// (e.g., layout_left), then the same element of consecutive matrices
+// is contiguous.  The kernel then computes a block of batches at once,
+// with the batch index innermost, so that each vector lane holds a
+// different matrix.  This is what makes products of many 4 x 4 or
+// 8 x 8 matrices fast: a single small product has too little work
+// to fill the vector registers.
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+
+template <class Exec, class A_t, class B_t, class C_t, class = void>
+struct is_custom_batched_matrix_product_avail : std::false_type {};
+
+template <class Exec, class A_t, class B_t, class C_t>
+struct is_custom_batched_matrix_product_avail<
+  Exec, A_t, B_t, C_t,
+  std::enable_if_t<
+    std::is_void_v<
+      decltype(
+	       matrix_product
+	       (std::declval<Exec>(),
+		std::declval<A_t>(),
+		std::declval<B_t>(),
+		std::declval<C_t>()))
+      >
+    && ! impl::is_inline_exec_v<Exec>
+    >
+  >
+  : std::true_type{};
+
+template <class Exec, class A_t, class B_t, class E_t, class C_t, class = void>
+struct is_custom_batched_matrix_product_with_update_avail : std::false_type {};
+
+template <class Exec, class A_t, class B_t, class E_t, class C_t>
+struct is_custom_batched_matrix_product_with_update_avail<
+  Exec, A_t, B_t, E_t, C_t,
+  std::enable_if_t<
+    std::is_void_v<
+      decltype(
+	       matrix_product
+	       (std::declval<Exec>(),
+		std::declval<A_t>(),
+		std::declval<B_t>(),
+		std::declval<E_t>(),
+		std::declval<C_t>()))
+      >
+    && ! impl::is_inline_exec_v<Exec>
+    >
+  >
+  : std::true_type{};
+
+namespace impl {
+
+template<class T>
+struct batched_gemm_blocking {
+  // Number of batches that the batch-major kernel computes at once:
+  // one 64-byte cache line of each element.
+  static constexpr ::std::ptrdiff_t lanes =
+    sizeof(T) >= 64 ? 1 : ::std::ptrdiff_t(64 / sizeof(T));
+  // Number of columns of C that the batch-major kernel computes at
+  // once, so that it loads each element of A once per nj columns.
+  static constexpr ::std::ptrdiff_t nj = 4;
+  // Smallest number of multiply-adds per matrix for which the
+  // general path hands each matrix to blocked_gemm.
+  static constexpr ::std::size_t min_blocked_work = 8 * 8 * 8;
+};
+
+// Are the elements with consecutive batch indices contiguous?
+template<class MDSpan>
+bool is_batch_major(const MDSpan& A)
+{
+  if constexpr (MDSpan::mapping_type::is_always_strided()) {
+    return A.stride(0) == 1;
+  }
+  else {
+    return false;
+  }
+}
+
+// Can each matrix of a batched product go through blocked_gemm?
+template<class A_t, class B_t, class C_t>
+inline constexpr bool is_gemm_packable_batched_product_v =
+  is_gemm_peelable_product_v<
+    mdspan<typename A_t::element_type,
+           extents<typename A_t::index_type, dynamic_extent, dynamic_extent>,
+           layout_stride, typename A_t::accessor_type>,
+    mdspan<typename B_t::element_type,
+           extents<typename B_t::index_type, dynamic_extent, dynamic_extent>,
+           layout_stride, typename B_t::accessor_type>,
+    mdspan<typename C_t::element_type,
+           extents<typename C_t::index_type, dynamic_extent, dynamic_extent>,
+           layout_stride, typename C_t::accessor_type>> &&
+  A_t::mapping_type::is_always_strided() &&
+  B_t::mapping_type::is_always_strided() &&
+  C_t::mapping_type::is_always_strided();
+
+// The matrix A[b,:,:], for blocked_gemm.
+template<class ElementType, class Extents, class Layout, class Accessor>
+strided_matrix_view<ElementType>
+make_batch_matrix_view(const mdspan<ElementType, Extents, Layout, Accessor>& A,
+                       typename Extents::index_type b)
+{
+  strided_matrix_view<ElementType> view;
+  view.data = A.data_handle();
+  view.extent0 = static_cast<::std::ptrdiff_t>(A.extent(1));
+  view.extent1 = static_cast<::std::ptrdiff_t>(A.extent(2));
+  if (view.extent0 != 0 && view.extent1 != 0) {
+    view.data += A.mapping()(b, 0, 0);
+    view.stride0 = static_cast<::std::ptrdiff_t>(A.stride(1));
+    view.stride1 = static_cast<::std::ptrdiff_t>(A.stride(2));
+  }
+  view.conjugated = extractConj<mdspan<ElementType, Extents, Layout, Accessor>>();
+  return view;
+}
+
+namespace batched_matrix_product_detail {
+
+// For batches [b0, b0 + Lanes), rows i, and columns [j0, j0 + NumCols)
+// of C, set C[b,i,j] = start(b,i,j) + sum over k of A[b,i,k] * B[b,k,j].
+// All the operands are batch-major, so the elements for consecutive
+// b have consecutive offsets.  Computing the offsets from the strides,
+// rather than through the mappings, lets the compiler vectorize the
+// loops over the lanes.
+template<::std::ptrdiff_t Lanes, ::std::ptrdiff_t NumCols,
+         class A_t, class B_t, class C_t, class Start>
+void lane_block(A_t A, B_t B, C_t C, const Start& start,
+                typename C_t::index_type b0,
+                typename C_t::index_type i,
+                typename C_t::index_type j0)
+{
+  using index_type = typename C_t::index_type;
+  using value_type = typename C_t::value_type;
+
+  value_type sum[NumCols][Lanes];
+  for (::std::ptrdiff_t c = 0; c < NumCols; ++c) {
+    for (::std::ptrdiff_t l = 0; l < Lanes; ++l) {
+      sum[c][l] = start(b0 + index_type(l), i, j0 + index_type(c));
+    }
+  }
+  const ::std::size_t num_terms = A.extent(2);
+  if (num_terms != 0) {
+    const auto A_ptr = A.data_handle();
+    const auto B_ptr = B.data_handle();
+    const ::std::size_t A_offset = A.mapping()(b0, i, 0);
+    const ::std::size_t A_stride_k = A.stride(2);
+    const ::std::size_t B_offset = B.mapping()(b0, 0, j0);
+    const ::std::size_t B_stride_k = B.stride(1);
+    const ::std::size_t B_stride_j = B.stride(2);
+    for (::std::size_t k = 0; k < num_terms; ++k) {
+      for (::std::ptrdiff_t c = 0; c < NumCols; ++c) {
+        for (::std::ptrdiff_t l = 0; l < Lanes; ++l) {
+          sum[c][l] +=
+            A.accessor().access(A_ptr, A_offset + k * A_stride_k + l) *
+            B.accessor().access(B_ptr, B_offset + k * B_stride_k + c * B_stride_j + l);
+        }
+      }
+    }
+  }
+  const auto C_ptr = C.data_handle();
+  const ::std::size_t C_offset = C.mapping()(b0, i, j0);
+  const ::std::size_t C_stride_j = C.stride(2);
+  for (::std::ptrdiff_t c = 0; c < NumCols; ++c) {
+    for (::std::ptrdiff_t l = 0; l < Lanes; ++l) {
+      C.accessor().access(C_ptr, C_offset + c * C_stride_j + l) = sum[c][l];
+    }
+  }
+}
+
+// C[b,i,j] = start(b,i,j) + sum over k of A[b,i,k] * B[b,k,j],
+// one matrix at a time.
+template<class A_t, class B_t, class C_t, class Start>
+void one_batch(A_t A, B_t B, C_t C, const Start& start,
+               typename C_t::index_type b)
+{
+  using index_type = typename C_t::index_type;
+  using value_type = typename C_t::value_type;
+
+  for (index_type j = 0; j < C.extent(2); ++j) {
+    for (index_type i = 0; i < C.extent(1); ++i) {
+      value_type sum = start(b, i, j);
+      for (index_type k = 0; k < A.extent(2); ++k) {
+        sum += A(b,i,k) * B(b,k,j);
+      }
+      C(b,i,j) = sum;
+    }
+  }
+}
+
+} // end namespace batched_matrix_product_detail
+
+// Number of multiply-adds in each matrix product of the batch.
+template<class A_t, class C_t>
+::std::size_t batched_matrix_product_work(const A_t& A, const C_t& C)
+{
+  return ::std::size_t(C.extent(1)) * ::std::size_t(C.extent(2)) *
+    ::std::max(::std::size_t(A.extent(2)), ::std::size_t(1));
+}
+
+// start function for the overwriting batched product.
+template<class T>
+struct batched_matrix_product_zero {
+  template<class Index>
+  constexpr T operator()(Index, Index, Index) const { return T{}; }
+};
+
+// For each b in [b_begin, b_end), and each (i,j), set
+//
+//   C[b,i,j] = start(b,i,j) + A[b,i,0] * B[b,0,j] + ...
+//
+// If start reads E[b,i,j], E may be C.  batch_major says whether all
+// the operands (including E) are batch-major.  The parallel
+// implementations call this on independent ranges of batches.
+template<class A_t, class B_t, class C_t, class Start>
+void batched_matrix_product(A_t A, B_t B, C_t C, const Start& start,
+                            typename C_t::index_type b_begin,
+                            typename C_t::index_type b_end,
+                            bool batch_major)
+{
+  using index_type = typename C_t::index_type;
+  using value_type = typename C_t::value_type;
+  using blocking = batched_gemm_blocking<value_type>;
+  constexpr index_type lanes = blocking::lanes;
+  constexpr index_type nj = blocking::nj;
+
+  // Matrices big enough to pay for packing go to blocked_gemm, unless
+  // the batch-major kernel can take them.
+  if constexpr (is_gemm_packable_batched_product_v<A_t, B_t, C_t>) {
+    if (! batch_major &&
+        batched_matrix_product_work(A, C) >= blocking::min_blocked_work) {
+      constexpr bool overwrite = std::is_same_v<Start, batched_matrix_product_zero<value_type>>;
+      for (index_type b = b_begin; b < b_end; ++b) {
+        if constexpr (! overwrite) {
+          for (index_type j = 0; j < C.extent(2); ++j) {
+            for (index_type i = 0; i < C.extent(1); ++i) {
+              C(b,i,j) = start(b, i, j);
+            }
+          }
+        }
+        blocked_gemm(extractScalingFactor(A) * extractScalingFactor(B),
+                     make_batch_matrix_view(A, b).as_const(),
+                     make_batch_matrix_view(B, b).as_const(),
+                     overwrite ? value_type{} : value_type{1},
+                     make_batch_matrix_view(C, b));
+      }
+      return;
+    }
+  }
+
+  index_type b = b_begin;
+  if constexpr (A_t::mapping_type::is_always_strided() &&
+                B_t::mapping_type::is_always_strided() &&
+                C_t::mapping_type::is_always_strided()) {
+    if (batch_major) {
+      for (; b + lanes <= b_end; b += lanes) {
+        for (index_type i = 0; i < C.extent(1); ++i) {
+          index_type j = 0;
+          for (; j + nj <= C.extent(2); j += nj) {
+            batched_matrix_product_detail::lane_block<lanes, nj>(A, B, C, start, b, i, j);
+          }
+          for (; j < C.extent(2); ++j) {
+            batched_matrix_product_detail::lane_block<lanes, 1>(A, B, C, start, b, i, j);
+          }
+        }
+      }
+    }
+  }
+  for (; b < b_end; ++b) {
+    batched_matrix_product_detail::one_batch(A, B, C, start, b);
+  }
+}
+
+template<class A_t, class B_t, class C_t>
+void check_batched_matrix_product_extents(const A_t& A, const B_t& B, const C_t& C)
+{
+  assert(A.extent(0) == C.extent(0));
+  assert(B.extent(0) == C.extent(0));
+  assert(A.extent(1) == C.extent(1));
+  assert(A.extent(2) == B.extent(1));
+  assert(B.extent(2) == C.extent(2));
+}
+
+} // end namespace impl
+
+// Overwriting batched matrix-matrix product
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numBatch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numBatch_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numBatch_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void matrix_product(
+  impl::inline_exec_t&& /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numBatch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, numBatch_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_C, extents<SizeType_C, numBatch_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  impl::check_batched_matrix_product_extents(A, B, C);
+  using index_type = typename decltype(C)::index_type;
+
+  impl::batched_matrix_product(A, B, C,
+    impl::batched_matrix_product_zero<ElementType_C>{},
+    index_type(0), C.extent(0),
+    impl::is_batch_major(A) && impl::is_batch_major(B) && impl::is_batch_major(C));
+}
+
+template<class ExecutionPolicy,
+         class ElementType_A,
+         class SizeType_A, ::std::size_t numBatch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numBatch_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numBatch_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void matrix_product(
+  ExecutionPolicy&& exec,
+  mdspan<ElementType_A, extents<SizeType_A, numBatch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, numBatch_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_C, extents<SizeType_C, numBatch_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  constexpr bool use_custom = is_custom_batched_matrix_product_avail<
+    decltype(impl::map_execpolicy_with_check(exec)), decltype(A), decltype(B), decltype(C)>::value;
+
+  if constexpr (use_custom) {
+    matrix_product(impl::map_execpolicy_with_check(exec), A, B, C);
+  } else {
+    matrix_product(impl::inline_exec_t{}, A, B, C);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numBatch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numBatch_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numBatch_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void matrix_product(
+  mdspan<ElementType_A, extents<SizeType_A, numBatch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, numBatch_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_C, extents<SizeType_C, numBatch_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  matrix_product(impl::default_exec_t{}, A, B, C);
+}
+
+// Updating batched matrix-matrix product
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numBatch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numBatch_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_E,
+         class SizeType_E, ::std::size_t numBatch_E, ::std::size_t numRows_E, ::std::size_t numCols_E,
+         class Layout_E,
+         class Accessor_E,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numBatch_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void matrix_product(
+  impl::inline_exec_t&& /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numBatch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, numBatch_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_E, extents<SizeType_E, numBatch_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, numBatch_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  impl::check_batched_matrix_product_extents(A, B, C);
+  assert(E.extent(0) == C.extent(0));
+  assert(E.extent(1) == C.extent(1));
+  assert(E.extent(2) == C.extent(2));
+  using index_type = typename decltype(C)::index_type;
+
+  impl::batched_matrix_product(A, B, C,
+    [&] (auto b, auto i, auto j) { return ElementType_C(E(b,i,j)); },
+    index_type(0), C.extent(0),
+    impl::is_batch_major(A) && impl::is_batch_major(B) &&
+    impl::is_batch_major(E) && impl::is_batch_major(C));
+}
+
+template<class ExecutionPolicy,
+         class ElementType_A,
+         class SizeType_A, ::std::size_t numBatch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numBatch_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_E,
+         class SizeType_E, ::std::size_t numBatch_E, ::std::size_t numRows_E, ::std::size_t numCols_E,
+         class Layout_E,
+         class Accessor_E,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numBatch_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void matrix_product(
+  ExecutionPolicy&& exec,
+  mdspan<ElementType_A, extents<SizeType_A, numBatch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, numBatch_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_E, extents<SizeType_E, numBatch_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, numBatch_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  constexpr bool use_custom = is_custom_batched_matrix_product_with_update_avail<
+    decltype(impl::map_execpolicy_with_check(exec)),
+    decltype(A), decltype(B), decltype(E), decltype(C)>::value;
+
+  if constexpr (use_custom) {
+    matrix_product(impl::map_execpolicy_with_check(exec), A, B, E, C);
+  } else {
+    matrix_product(impl::inline_exec_t{}, A, B, E, C);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numBatch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numBatch_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_E,
+         class SizeType_E, ::std::size_t numBatch_E, ::std::size_t numRows_E, ::std::size_t numCols_E,
+         class Layout_E,
+         class Accessor_E,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numBatch_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void matrix_product(
+  mdspan<ElementType_A, extents<SizeType_A, numBatch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, numBatch_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_E, extents<SizeType_E, numBatch_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, numBatch_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  matrix_product(impl::default_exec_t{}, A, B, E, C);
+}
+
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS3_BATCHED_MATRIX_PRODUCT_HPP_
@@ -26,318 +26,6 @@ namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
 inline namespace __p1673_version_0 {
 namespace linalg {
 
-// FIXME (mfh 2022/06/17) Temporarily disable calling the BLAS,
-// to get PR testing workflow running with mdspan tag.
-#if 0
-#ifdef LINALG_ENABLE_BLAS
-
-// NOTE: I'm only exposing these extern declarations in a header file
-// so that we can keep this a header-only library, for ease of testing
-// and installation.  Exposing them in a real production
-// implementation is really bad form.  This is because users may
-// declare their own extern declarations of BLAS functions, and yours
-// will collide with theirs at build time.
-
-// NOTE: I'm assuming a particular BLAS ABI mangling here.  Typical
-// BLAS C++ wrappers need to account for a variety of manglings that
-// don't necessarily match the system's Fortran compiler (if it has
-// one).  Lowercase with trailing underscore is a common pattern.
-// Watch out for BLAS functions that return something, esp. a complex
-// number.
-
-extern "C" void
-dgemm_ (const char TRANSA[], const char TRANSB[],
-        const int* pM, const int* pN, const int* pK,
-        const double* pALPHA,
-        const double* A, const int* pLDA,
-        const double* B, const int* pLDB,
-        const double* pBETA,
-        double* C, const int* pLDC);
-
-extern "C" void
-sgemm_ (const char TRANSA[], const char TRANSB[],
-        const int* pM, const int* pN, const int* pK,
-        const float* pALPHA,
-        const float* A, const int* pLDA,
-        const float* B, const int* pLDB,
-        const float* pBETA,
-        float* C, const int* pLDC);
-
-extern "C" void
-cgemm_ (const char TRANSA[], const char TRANSB[],
-        const int* pM, const int* pN, const int* pK,
-        const void* pALPHA,
-        const void* A, const int* pLDA,
-        const void* B, const int* pLDB,
-        const void* pBETA,
-        void* C, const int* pLDC);
-
-extern "C" void
-zgemm_ (const char TRANSA[], const char TRANSB[],
-        const int* pM, const int* pN, const int* pK,
-        const void* pALPHA,
-        const void* A, const int* pLDA,
-        const void* B, const int* pLDB,
-        const void* pBETA,
-        void* C, const int* pLDC);
-
-template<class Scalar>
-struct BlasGemm {
-  // static void
-  // gemm (const char TRANSA[], const char TRANSB[],
-  //       const int M, const int N, const int K,
-  //       const Scalar ALPHA,
-  //       const Scalar* A, const int LDA,
-  //       const Scalar* B, const int LDB,
-  //       const Scalar BETA,
-  //       Scalar* C, const int LDC);
-};
-
-template<>
-struct BlasGemm<double> {
-  static void
-  gemm (const char TRANSA[], const char TRANSB[],
-        const int M, const int N, const int K,
-        const double ALPHA,
-        const double* A, const int LDA,
-        const double* B, const int LDB,
-        const double BETA,
-        double* C, const int LDC)
-  {
-    dgemm_ (TRANSA, TRANSB, &M, &N, &K,
-            &ALPHA, A, &LDA, B, &LDB, &BETA, C, &LDC);
-  }
-};
-
-template<>
-struct BlasGemm<float> {
-  static void
-  gemm (const char TRANSA[], const char TRANSB[],
-        const int M, const int N, const int K,
-        const float ALPHA,
-        const float* A, const int LDA,
-        const float* B, const int LDB,
-        const float BETA,
-        float* C, const int LDC)
-  {
-    sgemm_ (TRANSA, TRANSB, &M, &N, &K,
-            &ALPHA, A, &LDA, B, &LDB, &BETA, C, &LDC);
-  }
-};
-
-template<>
-struct BlasGemm<std::complex<double>> {
-  static void
-  gemm (const char TRANSA[], const char TRANSB[],
-        const int M, const int N, const int K,
-        const std::complex<double> ALPHA,
-        const std::complex<double>* A, const int LDA,
-        const std::complex<double>* B, const int LDB,
-        const std::complex<double> BETA,
-        std::complex<double>* C, const int LDC)
-  {
-    zgemm_ (TRANSA, TRANSB, &M, &N, &K,
-            &ALPHA, A, &LDA, B, &LDB, &BETA, C, &LDC);
-  }
-};
-
-template<>
-struct BlasGemm<std::complex<float>> {
-  static void
-  gemm (const char TRANSA[], const char TRANSB[],
-        const int M, const int N, const int K,
-        const std::complex<float> ALPHA,
-        const std::complex<float>* A, const int LDA,
-        const std::complex<float>* B, const int LDB,
-        const std::complex<float> BETA,
-        std::complex<float>* C, const int LDC)
-  {
-    cgemm_ (TRANSA, TRANSB, &M, &N, &K,
-            &ALPHA, A, &LDA, B, &LDB, &BETA, C, &LDC);
-  }
-};
-
-template<class in_matrix_t>
-constexpr bool valid_input_blas_accessor()
-{
-  using elt_type = typename in_matrix_t::element_type;
-  using val_type = typename in_matrix_t::value_type;
-  using acc_type = typename in_matrix_t::accessor_type;
-
-  using def_acc_type = default_accessor<elt_type>;
-  using conj_def_acc_type = conjugated_accessor<def_acc_type>;
-  using scal_def_acc_type = scaled_accessor<val_type, def_acc_type>;
-  using scal_conj_acc_type = scaled_accessor<val_type, conj_def_acc_type>;
-  using conj_scal_acc_type = conjugated_accessor<scal_def_acc_type>;
-
-  // The two matrices' accessor types need not be the same.
-  // Input matrices may be scaled or transposed.
-  return std::is_same_v<acc_type, def_acc_type> ||
-    std::is_same_v<acc_type, conj_def_acc_type> ||
-    std::is_same_v<acc_type, scal_def_acc_type> ||
-    std::is_same_v<acc_type, scal_conj_acc_type> ||
-    std::is_same_v<acc_type, conj_scal_acc_type>;
-}
-
-template<class inout_matrix_t>
-constexpr bool valid_output_blas_accessor ()
-{
-  using element_type = typename inout_matrix_t::element_type;
-  using accessor_type = typename inout_matrix_t::accessor_type;
-
-  return std::is_same_v<accessor_type,
-                        default_accessor<element_type>>;
-}
-
-template<class in_matrix_t>
-constexpr bool valid_input_blas_layout()
-{
-  // transposed(A) transforms
-  //
-  // * layout_left into layout_right,
-  // * layout_right into layout_left,
-  // * layout_stride into layout_stride,
-  // * layout_blas_general<column_major_t> into layout_blas_general<row_major_t>, and
-  // * layout_blas_general<row_major_t> into layout_blas_general<column_major_t>.
-  //
-  // Thus, layout_transpose would never occur with a valid BLAS layout.
-  //
-  // For now, we only support column-major layouts.
-  using layout_type = typename in_matrix_t::layout_type;
-  return std::is_same_v<layout_type, layout_left>;
-}
-
-template<class inout_matrix_t>
-constexpr bool valid_output_blas_layout()
-{
-  using layout_type = typename inout_matrix_t::layout_type;
-  return std::is_same_v<layout_type, layout_left>;
-}
-
-template<class in_matrix_1_t,
-         class in_matrix_2_t,
-         class out_matrix_t>
-constexpr bool
-valid_blas_element_types()
-{
-  using element_type = typename out_matrix_t::element_type;
-  constexpr bool elt_types_same =
-    std::is_same_v<element_type,
-                   typename in_matrix_1_t::element_type> &&
-    std::is_same_v<element_type,
-                   typename in_matrix_2_t::element_type>;
-  constexpr bool elt_type_ok =
-    std::is_same_v<element_type, double> ||
-    std::is_same_v<element_type, float> ||
-    std::is_same_v<element_type, std::complex<double>> ||
-    std::is_same_v<element_type, std::complex<float>>;
-  return elt_types_same && elt_type_ok;
-}
-
-template<class in_matrix_1_t,
-         class in_matrix_2_t,
-         class out_matrix_t>
-constexpr bool
-matrix_product_dispatch_to_blas()
-{
-  // The accessor types need not be the same.
-  // Input matrices may be scaled or transposed.
-  constexpr bool in1_acc_type_ok =
-    valid_input_blas_accessor<in_matrix_1_t>();
-  constexpr bool in2_acc_type_ok =
-    valid_input_blas_accessor<in_matrix_2_t>();
-  constexpr bool out_acc_type_ok =
-    valid_output_blas_accessor<out_matrix_t>();
-
-  constexpr bool in1_layout_ok = valid_input_blas_layout<in_matrix_1_t>();
-  constexpr bool in2_layout_ok = valid_input_blas_layout<in_matrix_2_t>();
-  constexpr bool out_layout_ok = valid_output_blas_layout<out_matrix_t>();
-
-  // If both dimensions are run time, then it's likely that they are
-  // appropriate for the BLAS.  Compile-time dimensions are probably
-  // small, and BLAS implementations aren't optimized for that case.
-  return out_matrix_t::rank_dynamic() == 2 &&
-    valid_blas_element_types<in_matrix_1_t, in_matrix_2_t, out_matrix_t>() &&
-    in1_acc_type_ok && in2_acc_type_ok && out_acc_type_ok &&
-    in1_layout_ok && in2_layout_ok && out_layout_ok;
-}
-
-template<class Accessor, class ValueType>
-static constexpr bool is_compatible_scaled_accessor_v = false;
-
-template<class ScalingFactor, class NestedAccessor, class ValueType>
-static constexpr bool is_compatible_scaled_accessor_v<
-  scaled_accessor<ScalingFactor, NestedAccessor>, ValueType> =
-    std::is_same_v<typename scaled_accessor<ScalingFactor, NestedAccessor>::value_type, ValueType>;
-
-template<class Accessor>
-static constexpr bool is_conjugated_accessor_v = false;
-
-template<class NestedAccessor>
-static constexpr bool is_conjugated_accessor_v<conjugated_accessor<NestedAccessor>> = true;
-
-template<class in_matrix_t>
-typename in_matrix_t::value_type
-extractScalingFactor(in_matrix_t A,
-		     const typename in_matrix_t::value_type defaultValue)
-{
-  using acc_t = typename in_matrix_t::accessor_type;
-  using val_t = typename in_matrix_t::value_type;
-
-  if constexpr (is_compatible_scaled_accessor_v<acc_t, val_t>) {
-    return A.accessor.scale_factor();
-  } else if constexpr (is_conjugated_accessor_v<acc_t>) {
-    // conjugated(scaled(alpha, A)) means that both alpha and A are conjugated.
-    using nested_acc_t = decltype(A.accessor().nested_accessor());
-    if constexpr (is_compatible_scaled_accessor_v<nested_acc_t>) {
-      return impl::conj_if_needed(extractScalingFactor(A.accessor.nested_accessor()));
-    } else {
-      return defaultValue;
-    }
-  } else {
-    return defaultValue;
-  }
-}
-
-template<class in_matrix_t>
-constexpr bool extractTrans()
-{
-  using layout_type = typename in_matrix_t::layout_type;
-  using valid_trans_layout_0 = layout_transpose<layout_left>;
-  // using valid_trans_layout_1 =
-  //   layout_transpose<layout_blas_general<column_major_t>>;
-
-  constexpr bool A_trans =
-    std::is_same_v<layout_type, valid_trans_layout_0>;
-  /* || std::is_same_v<layout_type, valid_trans_layout_1>; */
-  return A_trans;
-}
-
-template<class Accessor>
-constexpr bool extractConjImpl(Accessor a)
-{
-  using elt_t = typename Accessor::element_type;
-
-  using def_acc_t = default_accessor<elt_t>;
-  using conj_def_acc_t = conjugated_accessor<def_acc_t>;
-  if constexpr (std::is_same_v<Accessor, def_acc_t>) {
-    return false;
-  } else if constexpr (std::is_same_v<Accessor, conj_def_acc_t>) {
-    return true;
-  } else {
-    return false;
-  }
-}
-
-template<class in_matrix_t>
-constexpr bool extractConj(in_matrix_t A)
-{
-  return extractConjImpl(A.accessor());
-}
-
-#endif // LINALG_ENABLE_BLAS
-#endif // 0
-
 template <class Exec, class A_t, class B_t, class C_t, class = void>
 struct is_custom_matrix_product_avail : std::false_type {};
 
@@ -685,60 +373,31 @@ template<class ElementType_A,
          class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
          class Layout_C,
          class Accessor_C>
-void matrix_product(
+constexpr void matrix_product(
   impl::inline_exec_t&& /* exec */,
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
   mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
   mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
 {
-// FIXME (mfh 2022/06/17) Temporarily disable calling the BLAS,
-// to get PR testing workflow running with mdspan tag.
-#if 0
+  if constexpr (impl::use_unrolled_matrix_product_v<decltype(A), decltype(B), decltype(C)>) {
+    impl::unrolled_matrix_product(A, B, C, [] (auto, auto) { return ElementType_C{}; });
+    return;
+  }
 #ifdef LINALG_ENABLE_BLAS
-  using in_matrix_1_t = typename mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A>;
-  using in_matrix_2_t = typename mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B>;
-  using out_matrix_t = typename mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C>;
-
-  constexpr bool blas_able =
-    matrix_product_dispatch_to_blas<in_matrix_1_t, in_matrix_2_t, out_matrix_t>();
-  if constexpr (blas_able) {
-    // Classic BLAS assumes that all matrices' element_type are the
-    // same.  Mixed-precision (X) BLAS would let us generalize.
-    using element_type = typename out_matrix_t::element_type;
-
-    constexpr bool A_trans = extractTrans<in_matrix_1_t>();
-    const bool A_conj = extractConj(A);
-    const char TRANSA = A_trans ? (A_conj ? 'C' : 'T') : 'N';
-
-    constexpr bool B_trans = extractTrans<in_matrix_2_t>();
-    const bool B_conj = extractConj(B);
-    const char TRANSB = B_trans ? (B_conj ? 'C' : 'T') : 'N';
-
-    const int M = C.extent(0);
-    const int N = C.extent(1);
-    const int K = A.extent(1);
-
-    // We assume here that any extracted scaling factor would commute
-    // with the matrix-matrix multiply.  That's a valid assumption for
-    // any element_type that the BLAS library knows how to handle.
-    const element_type alpha_A = extractScalingFactor(A, 1.0);
-    const element_type alpha_B = extractScalingFactor(B, 1.0);
-    const element_type alpha = alpha_A * alpha_B;
-    const element_type beta {};
-
-    static_assert(A.is_strided() && B.is_strided() && C.is_strided());
-    const int LDA = A_trans ? A.stride(0) : A.stride(1);
-    const int LDB = B_trans ? B.stride(0) : B.stride(1);
-    const int LDC = C.stride(1) == 0 ? 1 : int(C.stride(1));
-    BlasGemm<element_type>::gemm(&TRANSA, &TRANSB, M, N, K,
-                                 alpha, A.data_handle(), LDA,
-                                 B.data_handle(), LDB,
-                                 beta, C.data_handle(), LDC);
-  }
-  else
+  if constexpr (impl::matrix_product_dispatch_to_blas<decltype(A), decltype(B), decltype(C)>()) {
+    if (impl::matrix_product_blas(A, B, ElementType_C{}, C)) {
+      return;
+    }
+  }
 #endif // LINALG_ENABLE_BLAS
-#endif // 0
-  {
+  if constexpr (impl::is_gemm_peelable_product_v<decltype(A), decltype(B), decltype(C)>) {
+    impl::blocked_gemm(impl::extractScalingFactor(A) * impl::extractScalingFactor(B),
+                       impl::make_strided_matrix_view(A).as_const(),
+                       impl::make_strided_matrix_view(B).as_const(),
+                       ElementType_C{},
+                       impl::make_strided_matrix_view(C));
+  }
+  else {
     using size_type = ::std::common_type_t<SizeType_A, SizeType_B, SizeType_C>;
 
     for (size_type i = 0; i < C.extent(0); ++i) {
@@ -793,12 +452,19 @@ template<class ElementType_A,
          class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
          class Layout_C,
          class Accessor_C>
-void matrix_product(
+constexpr void matrix_product(
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
   mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
   mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
 {
-  matrix_product(impl::default_exec_t{}, A, B, C);
+  // Small matrices of compile-time size skip the execution policy
+  // mapping, so that this can be used in constant expressions.
+  if constexpr (impl::use_unrolled_matrix_product_v<decltype(A), decltype(B), decltype(C)>) {
+    matrix_product(impl::inline_exec_t{}, A, B, C);
+  }
+  else {
+    matrix_product(impl::default_exec_t{}, A, B, C);
+  }
 }
 
 
@@ -820,20 +486,58 @@ template<class ElementType_A,
          class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
          class Layout_C,
          class Accessor_C>
-void matrix_product(
+constexpr void matrix_product(
   impl::inline_exec_t&& /* exec */,
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
   mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
   mdspan<ElementType_E, extents<SizeType_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
   mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
 {
+  if constexpr (impl::use_unrolled_matrix_product_v<decltype(A), decltype(B), decltype(C)> &&
+                impl::all_static_extents_v<decltype(E)>) {
+    impl::unrolled_matrix_product(A, B, C, [&] (auto i, auto j) { return E(i,j); });
+    return;
+  }
   using size_type = ::std::common_type_t<SizeType_A, SizeType_B, SizeType_E, SizeType_C>;
 
-  for (size_type i = 0; i < C.extent(0); ++i) {
+#ifdef LINALG_ENABLE_BLAS
+  constexpr bool blas_able =
+    impl::matrix_product_dispatch_to_blas<decltype(A), decltype(B), decltype(C)>();
+#else
+  constexpr bool blas_able = false;
+#endif // LINALG_ENABLE_BLAS
+  constexpr bool packable =
+    impl::is_gemm_peelable_product_v<decltype(A), decltype(B), decltype(C)>;
+
+  if constexpr (blas_able || packable) {
+    // E may alias C, so copy it first, then accumulate (beta = 1).
     for (size_type j = 0; j < C.extent(1); ++j) {
-      C(i,j) = E(i,j);
-      for (size_type k = 0; k < A.extent(1); ++k) {
-        C(i,j) += A(i,k) * B(k,j);
+      for (size_type i = 0; i < C.extent(0); ++i) {
+        C(i,j) = E(i,j);
+      }
+    }
+  }
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (blas_able) {
+    if (impl::matrix_product_blas(A, B, ElementType_C{1}, C)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+  if constexpr (packable) {
+    impl::blocked_gemm(impl::extractScalingFactor(A) * impl::extractScalingFactor(B),
+                       impl::make_strided_matrix_view(A).as_const(),
+                       impl::make_strided_matrix_view(B).as_const(),
+                       ElementType_C{1},
+                       impl::make_strided_matrix_view(C));
+  }
+  else {
+    for (size_type i = 0; i < C.extent(0); ++i) {
+      for (size_type j = 0; j < C.extent(1); ++j) {
+        C(i,j) = E(i,j);
+        for (size_type k = 0; k < A.extent(1); ++k) {
+          C(i,j) += A(i,k) * B(k,j);
+        }
       }
     }
   }
@@ -890,13 +594,19 @@ template<class ElementType_A,
          class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
          class Layout_C,
          class Accessor_C>
-void matrix_product(
+constexpr void matrix_product(
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
   mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
   mdspan<ElementType_E, extents<SizeType_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
   mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
 {
-  matrix_product(impl::default_exec_t{}, A, B, E, C);
+  if constexpr (impl::use_unrolled_matrix_product_v<decltype(A), decltype(B), decltype(C)> &&
+                impl::all_static_extents_v<decltype(E)>) {
+    matrix_product(impl::inline_exec_t{}, A, B, E, C);
+  }
+  else {
+    matrix_product(impl::default_exec_t{}, A, B, E, C);
+  }
 }
 
 
@@ -1611,7 +1321,11 @@ void symmetric_matrix_product(
 {
   using size_type = ::std::common_type_t<SizeType_A, SizeType_B, SizeType_C>;
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::is_symm_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    impl::blocked_symm_product<false, Triangle, left_side_t>(
+      A, B, C, 0, ::std::ptrdiff_t(C.extent(1)));
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (size_type j = 0; j < C.extent(1); ++j) {
       for (size_type i = 0; i < C.extent(0); ++i) {
         C(i,j) = ElementType_C{};
@@ -1661,7 +1375,7 @@ void symmetric_matrix_product(
     decltype(A), Triangle, decltype(B), decltype(C)>::value;
 
   if constexpr (use_custom) {
-    symmetric_matrix_left_product(impl::map_execpolicy_with_check(exec), A, t, B, C);
+    symmetric_matrix_product(impl::map_execpolicy_with_check(exec), A, t, B, C);
   } else {
     symmetric_matrix_product(impl::inline_exec_t{}, A, t, B, C);
   }
@@ -1714,7 +1428,11 @@ void symmetric_matrix_product(
 {
   using size_type = ::std::common_type_t<SizeType_A, SizeType_B, SizeType_C>;
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::is_symm_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    impl::blocked_symm_product<false, Triangle, right_side_t>(
+      A, B, C, 0, ::std::ptrdiff_t(C.extent(0)));
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (size_type j = 0; j < C.extent(1); ++j) {
       for (size_type i = 0; i < C.extent(0); ++i) {
         C(i,j) = ElementType_C{};
@@ -1764,7 +1482,7 @@ void symmetric_matrix_product(
     decltype(A), Triangle, decltype(B), decltype(C)>::value;
 
   if constexpr(use_custom) {
-    symmetric_matrix_right_product(impl::map_execpolicy_with_check(exec), A, t, B, C);
+    symmetric_matrix_product(impl::map_execpolicy_with_check(exec), B, A, t, C);
   } else {
     symmetric_matrix_product(impl::inline_exec_t{}, B, A, t, C);
   }
@@ -1822,7 +1540,11 @@ void symmetric_matrix_product(
 {
   using size_type = ::std::common_type_t<SizeType_A, SizeType_B, SizeType_C>;
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::is_symm_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    impl::blocked_symm_product<false, Triangle, left_side_t>(
+      A, B, E, C, 0, ::std::ptrdiff_t(C.extent(1)));
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (size_type j = 0; j < C.extent(1); ++j) {
       for (size_type i = 0; i < C.extent(0); ++i) {
         C(i,j) = E(i,j);
@@ -1876,7 +1598,7 @@ void symmetric_matrix_product(
     decltype(impl::map_execpolicy_with_check(exec)), decltype(A), Triangle, decltype(B), decltype(E), decltype(C)>::value;
 
   if constexpr (use_custom) {
-    symmetric_matrix_left_product(impl::map_execpolicy_with_check(exec), A, t, B, E, C);
+    symmetric_matrix_product(impl::map_execpolicy_with_check(exec), A, t, B, E, C);
   } else {
     symmetric_matrix_product(impl::inline_exec_t{}, A, t, B, E, C);
   }
@@ -1939,7 +1661,11 @@ void symmetric_matrix_product(
 {
   using size_type = ::std::common_type_t<SizeType_A, SizeType_B, SizeType_C>;
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::is_symm_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    impl::blocked_symm_product<false, Triangle, right_side_t>(
+      A, B, E, C, 0, ::std::ptrdiff_t(C.extent(0)));
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (size_type j = 0; j < C.extent(1); ++j) {
       for (size_type i = 0; i < C.extent(0); ++i) {
         C(i,j) = E(i,j);
@@ -1993,7 +1719,7 @@ void symmetric_matrix_product(
     decltype(impl::map_execpolicy_with_check(exec)), decltype(A), Triangle, decltype(B), decltype(E), decltype(C)>::value;
 
   if constexpr (use_custom) {
-    symmetric_matrix_right_product(impl::map_execpolicy_with_check(exec), A, t, B, E, C);
+    symmetric_matrix_product(impl::map_execpolicy_with_check(exec), B, A, t, E, C);
   } else {
     symmetric_matrix_product(impl::inline_exec_t{}, B, A, t, E, C);
   }
@@ -2051,7 +1777,11 @@ void hermitian_matrix_product(
 {
   using size_type = ::std::common_type_t<SizeType_A, SizeType_B, SizeType_C>;
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::is_symm_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    impl::blocked_symm_product<true, Triangle, left_side_t>(
+      A, B, C, 0, ::std::ptrdiff_t(C.extent(1)));
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (size_type j = 0; j < C.extent(1); ++j) {
       for (size_type i = 0; i < C.extent(0); ++i) {
         C(i,j) = ElementType_C{};
@@ -2107,7 +1837,7 @@ void hermitian_matrix_product(
     decltype(A), Triangle, decltype(B), decltype(C)>::value;
 
   if constexpr (use_custom) {
-    hermitian_matrix_left_product(impl::map_execpolicy_with_check(exec), A, t, B, C);
+    hermitian_matrix_product(impl::map_execpolicy_with_check(exec), A, t, B, C);
   } else {
     hermitian_matrix_product(impl::inline_exec_t{}, A, t, B, C);
   }
@@ -2159,7 +1889,11 @@ void hermitian_matrix_product(
 {
   using size_type = ::std::common_type_t<SizeType_A, SizeType_B, SizeType_C>;
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::is_symm_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    impl::blocked_symm_product<true, Triangle, right_side_t>(
+      A, B, C, 0, ::std::ptrdiff_t(C.extent(0)));
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (size_type j = 0; j < C.extent(1); ++j) {
       for (size_type i = 0; i < C.extent(0); ++i) {
         C(i,j) = ElementType_C{};
@@ -2215,7 +1949,7 @@ void hermitian_matrix_product(
     decltype(A), Triangle, decltype(B), decltype(C)>::value;
 
   if constexpr (use_custom) {
-    hermitian_matrix_right_product(impl::map_execpolicy_with_check(exec), A, t, B, C);
+    hermitian_matrix_product(impl::map_execpolicy_with_check(exec), B, A, t, C);
   } else {
     hermitian_matrix_product(impl::inline_exec_t{}, B, A, t, C);
   }
@@ -2273,7 +2007,11 @@ void hermitian_matrix_product(
 {
   using size_type = ::std::common_type_t<SizeType_A, SizeType_B, SizeType_C>;
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::is_symm_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    impl::blocked_symm_product<true, Triangle, left_side_t>(
+      A, B, E, C, 0, ::std::ptrdiff_t(C.extent(1)));
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (size_type j = 0; j < C.extent(1); ++j) {
       for (size_type i = 0; i < C.extent(0); ++i) {
         C(i,j) = E(i,j);
@@ -2333,7 +2071,7 @@ void hermitian_matrix_product(
     decltype(impl::map_execpolicy_with_check(exec)), decltype(A), Triangle, decltype(B), decltype(E), decltype(C)>::value;
 
   if constexpr (use_custom) {
-    hermitian_matrix_left_product(impl::map_execpolicy_with_check(exec), A, t, B, E, C);
+    hermitian_matrix_product(impl::map_execpolicy_with_check(exec), A, t, B, E, C);
   } else {
     hermitian_matrix_product(impl::inline_exec_t{}, A, t, B, E, C);
   }
@@ -2396,7 +2134,11 @@ void hermitian_matrix_product(
 {
   using size_type = ::std::common_type_t<SizeType_A, SizeType_B, SizeType_C>;
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::is_symm_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    impl::blocked_symm_product<true, Triangle, right_side_t>(
+      A, B, E, C, 0, ::std::ptrdiff_t(C.extent(0)));
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (size_type j = 0; j < C.extent(1); ++j) {
       for (size_type i = 0; i < C.extent(0); ++i) {
         C(i,j) = E(i,j);
@@ -2456,7 +2198,7 @@ void hermitian_matrix_product(
     decltype(impl::map_execpolicy_with_check(exec)), decltype(A), Triangle, decltype(B), decltype(E), decltype(C)>::value;
 
   if constexpr (use_custom) {
-    hermitian_matrix_right_product(impl::map_execpolicy_with_check(exec), A, t, B, E, C);
+    hermitian_matrix_product(impl::map_execpolicy_with_check(exec), B, A, t, E, C);
   } else {
     hermitian_matrix_product(impl::inline_exec_t{}, B, A, t, E, C);
   }
@@ -172,19 +172,25 @@ void symmetric_matrix_rank_2k_update(
   mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
   Triangle /* t */)
 {
-  constexpr bool lower_tri =
-    std::is_same_v<Triangle, lower_triangle_t>;
-  using size_type = ::std::common_type_t<SizeType_A, SizeType_B, SizeType_C>;
-
-  for (size_type j = 0; j < C.extent(1); ++j) {
-    const size_type i_lower = lower_tri ? j : size_type(0);
-    const size_type i_upper = lower_tri ? C.extent(0) : j+1;
-    for (size_type i = i_lower; i < i_upper; ++i) {
+  if constexpr (impl::is_syr2k_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    impl::blocked_syr2k_tiles<false, Triangle>(A, B,
+      impl::rank_update_beta<ElementType_C>(), C, 0, impl::syrk_num_tiles(C));
+  }
+  else {
+    constexpr bool lower_tri =
+      std::is_same_v<Triangle, lower_triangle_t>;
+    using size_type = ::std::common_type_t<SizeType_A, SizeType_B, SizeType_C>;
+
+    for (size_type j = 0; j < C.extent(1); ++j) {
+      const size_type i_lower = lower_tri ? j : size_type(0);
+      const size_type i_upper = lower_tri ? C.extent(0) : j+1;
+      for (size_type i = i_lower; i < i_upper; ++i) {
 #if defined(LINALG_FIX_RANK_UPDATES)
-      C(i,j) = ElementType_C{};
+        C(i,j) = ElementType_C{};
 #endif
-      for (size_type k = 0; k < A.extent(1); ++k) {
-        C(i,j) += A(i,k)*B(j,k) + B(i,k)*A(j,k);
+        for (size_type k = 0; k < A.extent(1); ++k) {
+          C(i,j) += A(i,k)*B(j,k) + B(i,k)*A(j,k);
+        }
       }
     }
   }
@@ -277,17 +283,23 @@ void symmetric_matrix_rank_2k_update(
   mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
   Triangle /* t */)
 {
-  constexpr bool lower_tri =
-    std::is_same_v<Triangle, lower_triangle_t>;
-  using size_type = ::std::common_type_t<SizeType_A, SizeType_B, SizeType_C>;
-
-  for (size_type j = 0; j < C.extent(1); ++j) {
-    const size_type i_lower = lower_tri ? j : size_type(0);
-    const size_type i_upper = lower_tri ? C.extent(0) : j+1;
-    for (size_type i = i_lower; i < i_upper; ++i) {
-      C(i,j) = E(i,j);
-      for (size_type k = 0; k < A.extent(1); ++k) {
-        C(i,j) += A(i,k)*B(j,k) + B(i,k)*A(j,k);
+  if constexpr (impl::is_syr2k_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    impl::blocked_syr2k_tiles_from<false, Triangle>(A, B, E, C,
+      0, impl::syrk_num_tiles(C));
+  }
+  else {
+    constexpr bool lower_tri =
+      std::is_same_v<Triangle, lower_triangle_t>;
+    using size_type = ::std::common_type_t<SizeType_A, SizeType_B, SizeType_C>;
+
+    for (size_type j = 0; j < C.extent(1); ++j) {
+      const size_type i_lower = lower_tri ? j : size_type(0);
+      const size_type i_upper = lower_tri ? C.extent(0) : j+1;
+      for (size_type i = i_lower; i < i_upper; ++i) {
+        C(i,j) = E(i,j);
+        for (size_type k = 0; k < A.extent(1); ++k) {
+          C(i,j) += A(i,k)*B(j,k) + B(i,k)*A(j,k);
+        }
       }
     }
   }
@@ -381,22 +393,28 @@ void hermitian_matrix_rank_2k_update(
   mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
   Triangle /* t */)
 {
-  constexpr bool lower_tri =
-    std::is_same_v<Triangle, lower_triangle_t>;
-  using size_type = ::std::common_type_t<SizeType_A, SizeType_B, SizeType_C>;
-
-  for (size_type j = 0; j < C.extent(1); ++j) {
-    const size_type i_lower = lower_tri ? j : size_type(0);
-    const size_type i_upper = lower_tri ? C.extent(0) : j+1;
+  if constexpr (impl::is_syr2k_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    impl::blocked_syr2k_tiles<true, Triangle>(A, B,
+      impl::rank_update_beta<ElementType_C>(), C, 0, impl::syrk_num_tiles(C));
+  }
+  else {
+    constexpr bool lower_tri =
+      std::is_same_v<Triangle, lower_triangle_t>;
+    using size_type = ::std::common_type_t<SizeType_A, SizeType_B, SizeType_C>;
+
+    for (size_type j = 0; j < C.extent(1); ++j) {
+      const size_type i_lower = lower_tri ? j : size_type(0);
+      const size_type i_upper = lower_tri ? C.extent(0) : j+1;
 #if !defined(LINALG_FIX_RANK_UPDATES)
-    C(j,j) = impl::real_if_needed(C(j,j));
+      C(j,j) = impl::real_if_needed(C(j,j));
 #endif
-    for (size_type i = i_lower; i < i_upper; ++i) {
+      for (size_type i = i_lower; i < i_upper; ++i) {
 #if defined(LINALG_FIX_RANK_UPDATES)
-      C(i,j) = ElementType_C{};
+        C(i,j) = ElementType_C{};
 #endif
-      for (size_type k = 0; k < A.extent(1); ++k) {
-        C(i,j) += A(i,k) * impl::conj_if_needed(B(j,k)) + B(i,k) * impl::conj_if_needed(A(j,k));
+        for (size_type k = 0; k < A.extent(1); ++k) {
+          C(i,j) += A(i,k) * impl::conj_if_needed(B(j,k)) + B(i,k) * impl::conj_if_needed(A(j,k));
+        }
       }
     }
   }
@@ -489,17 +507,23 @@ void hermitian_matrix_rank_2k_update(
   mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
   Triangle /* t */)
 {
-  constexpr bool lower_tri =
-    std::is_same_v<Triangle, lower_triangle_t>;
-  using size_type = ::std::common_type_t<SizeType_A, SizeType_B, SizeType_C>;
-
-  for (size_type j = 0; j < C.extent(1); ++j) {
-    const size_type i_lower = lower_tri ? j : size_type(0);
-    const size_type i_upper = lower_tri ? C.extent(0) : j+1;
-    for (size_type i = i_lower; i < i_upper; ++i) {
-      C(i,j) = (i==j)?impl::real_if_needed(E(i,j)):E(i,j);
-      for (size_type k = 0; k < A.extent(1); ++k) {
-        C(i,j) += A(i,k) * impl::conj_if_needed(B(j,k)) + B(i,k) * impl::conj_if_needed(A(j,k));
+  if constexpr (impl::is_syr2k_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    impl::blocked_syr2k_tiles_from<true, Triangle>(A, B, E, C,
+      0, impl::syrk_num_tiles(C));
+  }
+  else {
+    constexpr bool lower_tri =
+      std::is_same_v<Triangle, lower_triangle_t>;
+    using size_type = ::std::common_type_t<SizeType_A, SizeType_B, SizeType_C>;
+
+    for (size_type j = 0; j < C.extent(1); ++j) {
+      const size_type i_lower = lower_tri ? j : size_type(0);
+      const size_type i_upper = lower_tri ? C.extent(0) : j+1;
+      for (size_type i = i_lower; i < i_upper; ++i) {
+        C(i,j) = (i==j)?impl::real_if_needed(E(i,j)):E(i,j);
+        for (size_type k = 0; k < A.extent(1); ++k) {
+          C(i,j) += A(i,k) * impl::conj_if_needed(B(j,k)) + B(i,k) * impl::conj_if_needed(A(j,k));
+        }
       }
     }
   }
@@ -268,19 +268,25 @@ void symmetric_matrix_rank_k_update(
   mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
   Triangle /* t */)
 {
-  constexpr bool lower_tri =
-    std::is_same_v<Triangle, lower_triangle_t>;
-  using size_type = std::common_type_t<SizeType_A, SizeType_C>;
-
-  for (size_type j = 0; j < C.extent(1); ++j) {
-    const size_type i_lower = lower_tri ? j : size_type(0);
-    const size_type i_upper = lower_tri ? C.extent(0) : j+1;
-    for (size_type i = i_lower; i < i_upper; ++i) {
+  if constexpr (impl::is_syrk_blockable_v<decltype(A), decltype(C), ScaleFactorType>) {
+    impl::blocked_syrk_tiles<false, Triangle>(ElementType_C(alpha), A,
+      impl::rank_update_beta<ElementType_C>(), C, 0, impl::syrk_num_tiles(C));
+  }
+  else {
+    constexpr bool lower_tri =
+      std::is_same_v<Triangle, lower_triangle_t>;
+    using size_type = std::common_type_t<SizeType_A, SizeType_C>;
+
+    for (size_type j = 0; j < C.extent(1); ++j) {
+      const size_type i_lower = lower_tri ? j : size_type(0);
+      const size_type i_upper = lower_tri ? C.extent(0) : j+1;
+      for (size_type i = i_lower; i < i_upper; ++i) {
 #if defined(LINALG_FIX_RANK_UPDATES)
-      C(i, j) = ElementType_C{};
+        C(i, j) = ElementType_C{};
 #endif
-      for (size_type k = 0; k < A.extent(1); ++k) {
-          C(i, j) += alpha * A(i, k) * A(j, k);
+        for (size_type k = 0; k < A.extent(1); ++k) {
+            C(i, j) += alpha * A(i, k) * A(j, k);
+        }
       }
     }
   }
@@ -379,19 +385,25 @@ void symmetric_matrix_rank_k_update(
   mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
   Triangle /* t */)
 {
-  constexpr bool lower_tri =
-    std::is_same_v<Triangle, lower_triangle_t>;
-  using size_type = std::common_type_t<SizeType_A, SizeType_C>;
-
-  for (size_type j = 0; j < C.extent(1); ++j) {
-    const size_type i_lower = lower_tri ? j : size_type(0);
-    const size_type i_upper = lower_tri ? C.extent(0) : j+1;
-    for (size_type i = i_lower; i < i_upper; ++i) {
+  if constexpr (impl::is_syrk_blockable_v<decltype(A), decltype(C)>) {
+    impl::blocked_syrk_tiles<false, Triangle>(ElementType_C(1), A,
+      impl::rank_update_beta<ElementType_C>(), C, 0, impl::syrk_num_tiles(C));
+  }
+  else {
+    constexpr bool lower_tri =
+      std::is_same_v<Triangle, lower_triangle_t>;
+    using size_type = std::common_type_t<SizeType_A, SizeType_C>;
+
+    for (size_type j = 0; j < C.extent(1); ++j) {
+      const size_type i_lower = lower_tri ? j : size_type(0);
+      const size_type i_upper = lower_tri ? C.extent(0) : j+1;
+      for (size_type i = i_lower; i < i_upper; ++i) {
 #if defined(LINALG_FIX_RANK_UPDATES)
-      C(i, j) = ElementType_C{};
+        C(i, j) = ElementType_C{};
 #endif
-      for (size_type k = 0; k < A.extent(1); ++k) {
-          C(i, j) += A(i, k) * A(j, k);
+        for (size_type k = 0; k < A.extent(1); ++k) {
+            C(i, j) += A(i, k) * A(j, k);
+        }
       }
     }
   }
@@ -493,17 +505,23 @@ void symmetric_matrix_rank_k_update(
   mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
   Triangle /* t */)
 {
-  constexpr bool lower_tri =
-    std::is_same_v<Triangle, lower_triangle_t>;
-  using size_type = std::common_type_t<SizeType_A, SizeType_C>;
-
-  for (size_type j = 0; j < C.extent(1); ++j) {
-    const size_type i_lower = lower_tri ? j : size_type(0);
-    const size_type i_upper = lower_tri ? C.extent(0) : j+1;
-    for (size_type i = i_lower; i < i_upper; ++i) {
-      C(i, j) = E(i, j);
-      for (size_type k = 0; k < A.extent(1); ++k) {
-          C(i, j) += alpha * A(i, k) * A(j, k);
+  if constexpr (impl::is_syrk_blockable_v<decltype(A), decltype(C), ScaleFactorType>) {
+    impl::blocked_syrk_tiles_from<false, Triangle>(ElementType_C(alpha), A, E, C,
+      0, impl::syrk_num_tiles(C));
+  }
+  else {
+    constexpr bool lower_tri =
+      std::is_same_v<Triangle, lower_triangle_t>;
+    using size_type = std::common_type_t<SizeType_A, SizeType_C>;
+
+    for (size_type j = 0; j < C.extent(1); ++j) {
+      const size_type i_lower = lower_tri ? j : size_type(0);
+      const size_type i_upper = lower_tri ? C.extent(0) : j+1;
+      for (size_type i = i_lower; i < i_upper; ++i) {
+        C(i, j) = E(i, j);
+        for (size_type k = 0; k < A.extent(1); ++k) {
+            C(i, j) += alpha * A(i, k) * A(j, k);
+        }
       }
     }
   }
@@ -611,17 +629,23 @@ void symmetric_matrix_rank_k_update(
   mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
   Triangle /* t */)
 {
-  constexpr bool lower_tri =
-    std::is_same_v<Triangle, lower_triangle_t>;
-  using size_type = std::common_type_t<SizeType_A, SizeType_C>;
-
-  for (size_type j = 0; j < C.extent(1); ++j) {
-    const size_type i_lower = lower_tri ? j : size_type(0);
-    const size_type i_upper = lower_tri ? C.extent(0) : j+1;
-    for (size_type i = i_lower; i < i_upper; ++i) {
-      C(i, j) = E(i, j);
-      for (size_type k = 0; k < A.extent(1); ++k) {
-          C(i, j) += A(i, k) * A(j, k);
+  if constexpr (impl::is_syrk_blockable_v<decltype(A), decltype(C)>) {
+    impl::blocked_syrk_tiles_from<false, Triangle>(ElementType_C(1), A, E, C,
+      0, impl::syrk_num_tiles(C));
+  }
+  else {
+    constexpr bool lower_tri =
+      std::is_same_v<Triangle, lower_triangle_t>;
+    using size_type = std::common_type_t<SizeType_A, SizeType_C>;
+
+    for (size_type j = 0; j < C.extent(1); ++j) {
+      const size_type i_lower = lower_tri ? j : size_type(0);
+      const size_type i_upper = lower_tri ? C.extent(0) : j+1;
+      for (size_type i = i_lower; i < i_upper; ++i) {
+        C(i, j) = E(i, j);
+        for (size_type k = 0; k < A.extent(1); ++k) {
+            C(i, j) += A(i, k) * A(j, k);
+        }
       }
     }
   }
@@ -724,24 +748,30 @@ void hermitian_matrix_rank_k_update(
   mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
   Triangle /* t */)
 {
-  using size_type = std::common_type_t<SizeType_A, SizeType_C>;
+  if constexpr (impl::is_syrk_blockable_v<decltype(A), decltype(C), ScaleFactorType>) {
+    impl::blocked_syrk_tiles<true, Triangle>(ElementType_C(alpha), A,
+      impl::rank_update_beta<ElementType_C>(), C, 0, impl::syrk_num_tiles(C));
+  }
+  else {
+    using size_type = std::common_type_t<SizeType_A, SizeType_C>;
 
-  constexpr bool lower_tri =
-    std::is_same_v<Triangle, lower_triangle_t>;
-  using size_type = std::common_type_t<SizeType_A, SizeType_C>;
+    constexpr bool lower_tri =
+      std::is_same_v<Triangle, lower_triangle_t>;
+    using size_type = std::common_type_t<SizeType_A, SizeType_C>;
 
-  for (size_type j = 0; j < C.extent(1); ++j) {
-    const size_type i_lower = lower_tri ? j : size_type(0);
-    const size_type i_upper = lower_tri ? C.extent(0) : j+1;
+    for (size_type j = 0; j < C.extent(1); ++j) {
+      const size_type i_lower = lower_tri ? j : size_type(0);
+      const size_type i_upper = lower_tri ? C.extent(0) : j+1;
 #if !defined(LINALG_FIX_RANK_UPDATES)
-    C(j, j) = impl::real_if_needed(C(j, j));
+      C(j, j) = impl::real_if_needed(C(j, j));
 #endif
-    for (size_type i = i_lower; i < i_upper; ++i) {
+      for (size_type i = i_lower; i < i_upper; ++i) {
 #if defined(LINALG_FIX_RANK_UPDATES)
-      C(i, j) = ElementType_C{};
+        C(i, j) = ElementType_C{};
 #endif
-      for (size_type k = 0; k < A.extent(1); ++k) {
-          C(i, j) += alpha * A(i, k) * impl::conj_if_needed(A(j, k));
+        for (size_type k = 0; k < A.extent(1); ++k) {
+            C(i, j) += alpha * A(i, k) * impl::conj_if_needed(A(j, k));
+        }
       }
     }
   }
@@ -838,24 +868,30 @@ void hermitian_matrix_rank_k_update(
   mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
   Triangle /* t */)
 {
-  using size_type = std::common_type_t<SizeType_A, SizeType_C>;
+  if constexpr (impl::is_syrk_blockable_v<decltype(A), decltype(C)>) {
+    impl::blocked_syrk_tiles<true, Triangle>(ElementType_C(1), A,
+      impl::rank_update_beta<ElementType_C>(), C, 0, impl::syrk_num_tiles(C));
+  }
+  else {
+    using size_type = std::common_type_t<SizeType_A, SizeType_C>;
 
-  constexpr bool lower_tri =
-    std::is_same_v<Triangle, lower_triangle_t>;
-  using size_type = std::common_type_t<SizeType_A, SizeType_C>;
+    constexpr bool lower_tri =
+      std::is_same_v<Triangle, lower_triangle_t>;
+    using size_type = std::common_type_t<SizeType_A, SizeType_C>;
 
-  for (size_type j = 0; j < C.extent(1); ++j) {
+    for (size_type j = 0; j < C.extent(1); ++j) {
 #if !defined(LINALG_FIX_RANK_UPDATES)
-    C(j, j) = impl::real_if_needed(C(j, j));
+      C(j, j) = impl::real_if_needed(C(j, j));
 #endif
-    const size_type i_lower = lower_tri ? j : size_type(0);
-    const size_type i_upper = lower_tri ? C.extent(0) : j+1;
-    for (size_type i = i_lower; i < i_upper; ++i) {
+      const size_type i_lower = lower_tri ? j : size_type(0);
+      const size_type i_upper = lower_tri ? C.extent(0) : j+1;
+      for (size_type i = i_lower; i < i_upper; ++i) {
 #if defined(LINALG_FIX_RANK_UPDATES)
-      C(i, j) = ElementType_C{};
+        C(i, j) = ElementType_C{};
 #endif
-      for (size_type k = 0; k < A.extent(1); ++k) {
-          C(i, j) += A(i, k) * impl::conj_if_needed(A(j, k));
+        for (size_type k = 0; k < A.extent(1); ++k) {
+            C(i, j) += A(i, k) * impl::conj_if_needed(A(j, k));
+        }
       }
     }
   }
@@ -956,19 +992,25 @@ void hermitian_matrix_rank_k_update(
   mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
   Triangle /* t */)
 {
-  using size_type = std::common_type_t<SizeType_A, SizeType_C>;
-
-  constexpr bool lower_tri =
-    std::is_same_v<Triangle, lower_triangle_t>;
-  using size_type = std::common_type_t<SizeType_A, SizeType_C>;
-
-  for (size_type j = 0; j < C.extent(1); ++j) {
-    const size_type i_lower = lower_tri ? j : size_type(0);
-    const size_type i_upper = lower_tri ? C.extent(0) : j+1;
-    for (size_type i = i_lower; i < i_upper; ++i) {
-      C(i, j) = (i==j)?impl::real_if_needed(E(i, j)):E(i, j);
-      for (size_type k = 0; k < A.extent(1); ++k) {
-          C(i, j) += alpha * A(i, k) * impl::conj_if_needed(A(j, k));
+  if constexpr (impl::is_syrk_blockable_v<decltype(A), decltype(C), ScaleFactorType>) {
+    impl::blocked_syrk_tiles_from<true, Triangle>(ElementType_C(alpha), A, E, C,
+      0, impl::syrk_num_tiles(C));
+  }
+  else {
+    using size_type = std::common_type_t<SizeType_A, SizeType_C>;
+
+    constexpr bool lower_tri =
+      std::is_same_v<Triangle, lower_triangle_t>;
+    using size_type = std::common_type_t<SizeType_A, SizeType_C>;
+
+    for (size_type j = 0; j < C.extent(1); ++j) {
+      const size_type i_lower = lower_tri ? j : size_type(0);
+      const size_type i_upper = lower_tri ? C.extent(0) : j+1;
+      for (size_type i = i_lower; i < i_upper; ++i) {
+        C(i, j) = (i==j)?impl::real_if_needed(E(i, j)):E(i, j);
+        for (size_type k = 0; k < A.extent(1); ++k) {
+            C(i, j) += alpha * A(i, k) * impl::conj_if_needed(A(j, k));
+        }
       }
     }
   }
@@ -1078,19 +1120,25 @@ void hermitian_matrix_rank_k_update(
   mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
   Triangle /* t */)
 {
-  using size_type = std::common_type_t<SizeType_A, SizeType_C>;
-
-  constexpr bool lower_tri =
-    std::is_same_v<Triangle, lower_triangle_t>;
-  using size_type = std::common_type_t<SizeType_A, SizeType_C>;
-
-  for (size_type j = 0; j < C.extent(1); ++j) {
-    const size_type i_lower = lower_tri ? j : size_type(0);
-    const size_type i_upper = lower_tri ? C.extent(0) : j+1;
-    for (size_type i = i_lower; i < i_upper; ++i) {
-      C(i, j) = (i==j)?impl::real_if_needed(E(i, j)):E(i, j);
-      for (size_type k = 0; k < A.extent(1); ++k) {
-          C(i, j) += A(i, k) * impl::conj_if_needed(A(j, k));
+  if constexpr (impl::is_syrk_blockable_v<decltype(A), decltype(C)>) {
+    impl::blocked_syrk_tiles_from<true, Triangle>(ElementType_C(1), A, E, C,
+      0, impl::syrk_num_tiles(C));
+  }
+  else {
+    using size_type = std::common_type_t<SizeType_A, SizeType_C>;
+
+    constexpr bool lower_tri =
+      std::is_same_v<Triangle, lower_triangle_t>;
+    using size_type = std::common_type_t<SizeType_A, SizeType_C>;
+
+    for (size_type j = 0; j < C.extent(1); ++j) {
+      const size_type i_lower = lower_tri ? j : size_type(0);
+      const size_type i_upper = lower_tri ? C.extent(0) : j+1;
+      for (size_type i = i_lower; i < i_upper; ++i) {
+        C(i, j) = (i==j)?impl::real_if_needed(E(i, j)):E(i, j);
+        for (size_type k = 0; k < A.extent(1); ++k) {
+            C(i, j) += A(i, k) * impl::conj_if_needed(A(j, k));
+        }
       }
     }
   }
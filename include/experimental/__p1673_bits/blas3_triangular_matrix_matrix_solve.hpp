@@ -269,7 +269,13 @@ void triangular_matrix_matrix_left_solve(
   P1673_MATRIX_PARAMETER( B ),
   P1673_MATRIX_PARAMETER( X ))
 {
-  if (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::is_trsm_blockable_v<decltype(A), decltype(B), decltype(X)>) {
+    impl::blocked_trsm_left<Triangle, DiagonalStorage>(
+      impl::make_strided_matrix_view(A).as_const(),
+      impl::make_strided_matrix_view(B).as_const(),
+      impl::make_strided_matrix_view(X));
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     trsm_lower_triangular_left_side (A, d, B, X);
   }
   else {
@@ -338,7 +344,13 @@ void triangular_matrix_matrix_right_solve(
   P1673_MATRIX_PARAMETER( B ),
   P1673_MATRIX_PARAMETER( X ))
 {
-  if (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::is_trsm_blockable_v<decltype(A), decltype(B), decltype(X)>) {
+    impl::blocked_trsm_right<Triangle, DiagonalStorage>(
+      impl::make_strided_matrix_view(A).as_const(),
+      impl::make_strided_matrix_view(B).as_const(),
+      impl::make_strided_matrix_view(X));
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     trsm_lower_triangular_right_side (A, d, B, X);
   }
   else {
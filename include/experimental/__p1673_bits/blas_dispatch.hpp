@@ -0,0 +1,1339 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS_DISPATCH_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS_DISPATCH_HPP_
+
+#include <mdspan/mdspan.hpp>
+#include <algorithm>
+#include <climits>
+#include <complex>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+namespace impl {
+
+// Compile-time description of an accessor built out of any nesting
+// of scaled_accessor and conjugated_accessor around default_accessor.
+// Such an mdspan's elements are
+//
+//   extractScalingFactor(A) * (conj_if_needed)(A.data_handle()[offset]),
+//
+// where conjugation happens iff is_conjugated is true.  This lets
+// algorithms run on the raw data and apply the scaling factor and
+// conjugation once, instead of on every element access.
+template<class Accessor>
+struct accessor_unwrap_traits {
+  static constexpr bool is_valid = false;
+  static constexpr bool is_conjugated = false;
+  using element_type = void;
+};
+
+template<class ElementType>
+struct accessor_unwrap_traits<default_accessor<ElementType>> {
+  static constexpr bool is_valid = true;
+  static constexpr bool is_conjugated = false;
+  using element_type = ElementType;
+
+  template<class ValueType>
+  static constexpr ValueType scaling_factor(const default_accessor<ElementType>&) {
+    return ValueType(1);
+  }
+};
+
+template<class NestedAccessor>
+struct accessor_unwrap_traits<conjugated_accessor<NestedAccessor>> {
+private:
+  using nested_traits = accessor_unwrap_traits<NestedAccessor>;
+public:
+  static constexpr bool is_valid = nested_traits::is_valid;
+  using element_type = typename nested_traits::element_type;
+  // Conjugating a real number does nothing.
+  static constexpr bool is_conjugated =
+    nested_traits::is_conjugated != is_complex_v<std::remove_cv_t<element_type>>;
+
+  // conjugated(scaled(alpha, A)) means that both alpha and A are conjugated.
+  template<class ValueType>
+  static constexpr ValueType scaling_factor(const conjugated_accessor<NestedAccessor>& acc) {
+    return conj_if_needed(nested_traits::template scaling_factor<ValueType>(acc.nested_accessor()));
+  }
+};
+
+template<class ScalingFactor, class NestedAccessor>
+struct accessor_unwrap_traits<scaled_accessor<ScalingFactor, NestedAccessor>> {
+private:
+  using nested_traits = accessor_unwrap_traits<NestedAccessor>;
+public:
+  static constexpr bool is_valid = nested_traits::is_valid;
+  static constexpr bool is_conjugated = nested_traits::is_conjugated;
+  using element_type = typename nested_traits::element_type;
+
+  template<class ValueType>
+  static constexpr ValueType scaling_factor(const scaled_accessor<ScalingFactor, NestedAccessor>& acc) {
+    return ValueType(acc.scaling_factor()) *
+      nested_traits::template scaling_factor<ValueType>(acc.nested_accessor());
+  }
+};
+
+// The product of all scaling factors applied by in_matrix_t's accessor.
+template<class in_matrix_t>
+typename in_matrix_t::value_type
+extractScalingFactor(const in_matrix_t& A)
+{
+  using acc_t = typename in_matrix_t::accessor_type;
+  using val_t = typename in_matrix_t::value_type;
+  return accessor_unwrap_traits<acc_t>::template scaling_factor<val_t>(A.accessor());
+}
+
+// Whether in_matrix_t's accessor conjugates the stored elements.
+template<class in_matrix_t>
+constexpr bool extractConj()
+{
+  return accessor_unwrap_traits<typename in_matrix_t::accessor_type>::is_conjugated;
+}
+
+#ifdef LINALG_ENABLE_BLAS
+
+// NOTE: I'm only exposing these extern declarations in a header file
+// so that we can keep this a header-only library, for ease of testing
+// and installation.  Exposing them in a real production
+// implementation is really bad form.  This is because users may
+// declare their own extern declarations of BLAS functions, and yours
+// will collide with theirs at build time.
+
+// NOTE: I'm assuming a particular BLAS ABI mangling here.  Typical
+// BLAS C++ wrappers need to account for a variety of manglings that
+// don't necessarily match the system's Fortran compiler (if it has
+// one).  Lowercase with trailing underscore is a common pattern.
+// Watch out for BLAS functions that return something, esp. a complex
+// number.
+
+extern "C" void
+dgemm_ (const char TRANSA[], const char TRANSB[],
+        const int* pM, const int* pN, const int* pK,
+        const double* pALPHA,
+        const double* A, const int* pLDA,
+        const double* B, const int* pLDB,
+        const double* pBETA,
+        double* C, const int* pLDC);
+
+extern "C" void
+sgemm_ (const char TRANSA[], const char TRANSB[],
+        const int* pM, const int* pN, const int* pK,
+        const float* pALPHA,
+        const float* A, const int* pLDA,
+        const float* B, const int* pLDB,
+        const float* pBETA,
+        float* C, const int* pLDC);
+
+extern "C" void
+cgemm_ (const char TRANSA[], const char TRANSB[],
+        const int* pM, const int* pN, const int* pK,
+        const void* pALPHA,
+        const void* A, const int* pLDA,
+        const void* B, const int* pLDB,
+        const void* pBETA,
+        void* C, const int* pLDC);
+
+extern "C" void
+zgemm_ (const char TRANSA[], const char TRANSB[],
+        const int* pM, const int* pN, const int* pK,
+        const void* pALPHA,
+        const void* A, const int* pLDA,
+        const void* B, const int* pLDB,
+        const void* pBETA,
+        void* C, const int* pLDC);
+
+template<class Scalar>
+struct BlasGemm {
+  // static void
+  // gemm (const char TRANSA[], const char TRANSB[],
+  //       const int M, const int N, const int K,
+  //       const Scalar ALPHA,
+  //       const Scalar* A, const int LDA,
+  //       const Scalar* B, const int LDB,
+  //       const Scalar BETA,
+  //       Scalar* C, const int LDC);
+};
+
+template<>
+struct BlasGemm<double> {
+  static void
+  gemm (const char TRANSA[], const char TRANSB[],
+        const int M, const int N, const int K,
+        const double ALPHA,
+        const double* A, const int LDA,
+        const double* B, const int LDB,
+        const double BETA,
+        double* C, const int LDC)
+  {
+    dgemm_ (TRANSA, TRANSB, &M, &N, &K,
+            &ALPHA, A, &LDA, B, &LDB, &BETA, C, &LDC);
+  }
+};
+
+template<>
+struct BlasGemm<float> {
+  static void
+  gemm (const char TRANSA[], const char TRANSB[],
+        const int M, const int N, const int K,
+        const float ALPHA,
+        const float* A, const int LDA,
+        const float* B, const int LDB,
+        const float BETA,
+        float* C, const int LDC)
+  {
+    sgemm_ (TRANSA, TRANSB, &M, &N, &K,
+            &ALPHA, A, &LDA, B, &LDB, &BETA, C, &LDC);
+  }
+};
+
+template<>
+struct BlasGemm<std::complex<double>> {
+  static void
+  gemm (const char TRANSA[], const char TRANSB[],
+        const int M, const int N, const int K,
+        const std::complex<double> ALPHA,
+        const std::complex<double>* A, const int LDA,
+        const std::complex<double>* B, const int LDB,
+        const std::complex<double> BETA,
+        std::complex<double>* C, const int LDC)
+  {
+    zgemm_ (TRANSA, TRANSB, &M, &N, &K,
+            &ALPHA, A, &LDA, B, &LDB, &BETA, C, &LDC);
+  }
+};
+
+template<>
+struct BlasGemm<std::complex<float>> {
+  static void
+  gemm (const char TRANSA[], const char TRANSB[],
+        const int M, const int N, const int K,
+        const std::complex<float> ALPHA,
+        const std::complex<float>* A, const int LDA,
+        const std::complex<float>* B, const int LDB,
+        const std::complex<float> BETA,
+        std::complex<float>* C, const int LDC)
+  {
+    cgemm_ (TRANSA, TRANSB, &M, &N, &K,
+            &ALPHA, A, &LDA, B, &LDB, &BETA, C, &LDC);
+  }
+};
+
+template<class T>
+inline constexpr bool is_blas_element_type_v =
+  std::is_same_v<T, double> ||
+  std::is_same_v<T, float> ||
+  std::is_same_v<T, std::complex<double>> ||
+  std::is_same_v<T, std::complex<float>>;
+
+// Input matrices may be scaled and/or conjugated, in any nesting,
+// as long as the result's value_type matches the stored data, so
+// that the BLAS computes in the same precision as the generic code.
+template<class in_matrix_t>
+constexpr bool valid_input_blas_accessor()
+{
+  using traits = accessor_unwrap_traits<typename in_matrix_t::accessor_type>;
+  if constexpr (traits::is_valid) {
+    using stored_type = std::remove_cv_t<typename traits::element_type>;
+    return is_blas_element_type_v<stored_type> &&
+      std::is_same_v<stored_type, typename in_matrix_t::value_type>;
+  }
+  else {
+    return false;
+  }
+}
+
+template<class inout_matrix_t>
+constexpr bool valid_output_blas_accessor ()
+{
+  using element_type = typename inout_matrix_t::element_type;
+  using accessor_type = typename inout_matrix_t::accessor_type;
+
+  return ! std::is_const_v<element_type> &&
+    is_blas_element_type_v<element_type> &&
+    std::is_same_v<accessor_type, default_accessor<element_type>>;
+}
+
+// transposed(A) transforms
+//
+// * layout_left into layout_right,
+// * layout_right into layout_left,
+// * layout_stride into layout_stride, and
+// * anything else L into layout_transpose<L>.
+//
+// The BLAS can take any of these, as long as one of the two strides
+// is one.  Whether that is true can only be known at run time for
+// layout_stride, so here we only require a strided layout.
+template<class matrix_t>
+constexpr bool valid_blas_layout()
+{
+  using mapping_type = typename matrix_t::mapping_type;
+  return matrix_t::rank() == 2 && mapping_type::is_always_strided();
+}
+
+template<class in_matrix_1_t,
+         class in_matrix_2_t,
+         class out_matrix_t>
+constexpr bool
+valid_blas_element_types()
+{
+  using element_type = typename out_matrix_t::value_type;
+  return
+    std::is_same_v<element_type, typename in_matrix_1_t::value_type> &&
+    std::is_same_v<element_type, typename in_matrix_2_t::value_type>;
+}
+
+template<class in_matrix_1_t,
+         class in_matrix_2_t,
+         class out_matrix_t>
+constexpr bool
+matrix_product_dispatch_to_blas()
+{
+  // The accessor types need not be the same.
+  // Input matrices may be scaled or transposed.
+  constexpr bool in1_acc_type_ok =
+    valid_input_blas_accessor<in_matrix_1_t>();
+  constexpr bool in2_acc_type_ok =
+    valid_input_blas_accessor<in_matrix_2_t>();
+  constexpr bool out_acc_type_ok =
+    valid_output_blas_accessor<out_matrix_t>();
+
+  constexpr bool in1_layout_ok = valid_blas_layout<in_matrix_1_t>();
+  constexpr bool in2_layout_ok = valid_blas_layout<in_matrix_2_t>();
+  constexpr bool out_layout_ok = valid_blas_layout<out_matrix_t>();
+
+  // If both dimensions are run time, then it's likely that they are
+  // appropriate for the BLAS.  Compile-time dimensions are probably
+  // small, and BLAS implementations aren't optimized for that case.
+  return out_matrix_t::rank_dynamic() == 2 &&
+    in1_acc_type_ok && in2_acc_type_ok && out_acc_type_ok &&
+    valid_blas_element_types<in_matrix_1_t, in_matrix_2_t, out_matrix_t>() &&
+    in1_layout_ok && in2_layout_ok && out_layout_ok;
+}
+
+// Column-major view of a strided matrix, as the BLAS wants it.
+// If is_transposed is true, then the matrix is the transpose of the
+// column-major matrix stored at data with leading dimension ld.
+template<class T>
+struct blas_matrix_operand {
+  T* data = nullptr;
+  int ld = 1;
+  bool is_transposed = false;
+};
+
+// Returns false if the matrix's strides or extents cannot be given
+// to the BLAS (e.g., neither stride is one, or they overflow int).
+template<class matrix_t>
+bool make_blas_operand(const matrix_t& A,
+                       blas_matrix_operand<std::remove_pointer_t<typename matrix_t::data_handle_type>>& op)
+{
+  const auto num_rows = static_cast<::std::ptrdiff_t>(A.extent(0));
+  const auto num_cols = static_cast<::std::ptrdiff_t>(A.extent(1));
+  if (num_rows == 0 || num_cols == 0 ||
+      num_rows > INT_MAX || num_cols > INT_MAX) {
+    return false;
+  }
+  const auto stride0 = static_cast<::std::ptrdiff_t>(A.stride(0));
+  const auto stride1 = static_cast<::std::ptrdiff_t>(A.stride(1));
+
+  // A stride along an extent of one is arbitrary.
+  ::std::ptrdiff_t ld = 0;
+  if (stride0 == 1 || num_rows == 1) {
+    ld = num_cols == 1 ? num_rows : stride1;
+    op.is_transposed = false;
+    if (ld < num_rows) {
+      return false;
+    }
+  }
+  else if (stride1 == 1 || num_cols == 1) {
+    ld = stride0;
+    op.is_transposed = true;
+    if (ld < num_cols) {
+      return false;
+    }
+  }
+  else {
+    return false;
+  }
+  if (ld > INT_MAX) {
+    return false;
+  }
+  op.ld = static_cast<int>(ld);
+  op.data = A.data_handle() + A.mapping()(0, 0);
+  return true;
+}
+
+// BLAS TRANS argument for an operand with the given storage and
+// conjugation, or '\0' if the BLAS cannot express it (it has no
+// "conjugate, but don't transpose" option).
+inline char blas_trans_char(bool is_transposed, bool is_conjugated)
+{
+  if (! is_transposed) {
+    return is_conjugated ? '\0' : 'N';
+  }
+  return is_conjugated ? 'C' : 'T';
+}
+
+// C = alpha * A * B + beta * C via xGEMM, where alpha is the product
+// of A's and B's scaling factors.  Returns false without touching C
+// if the operands cannot be expressed as a BLAS call at run time; the
+// caller must then fall back to the generic implementation.
+template<class in_matrix_1_t,
+         class in_matrix_2_t,
+         class out_matrix_t>
+bool matrix_product_blas(const in_matrix_1_t& A,
+                         const in_matrix_2_t& B,
+                         const typename out_matrix_t::value_type beta,
+                         const out_matrix_t& C)
+{
+  using element_type = typename out_matrix_t::value_type;
+
+  if (A.extent(1) > INT_MAX) {
+    return false;
+  }
+  blas_matrix_operand<std::remove_pointer_t<typename in_matrix_1_t::data_handle_type>> A_op;
+  blas_matrix_operand<std::remove_pointer_t<typename in_matrix_2_t::data_handle_type>> B_op;
+  blas_matrix_operand<element_type> C_op;
+  if (! make_blas_operand(A, A_op) ||
+      ! make_blas_operand(B, B_op) ||
+      ! make_blas_operand(C, C_op)) {
+    return false;
+  }
+
+  // We assume here that any extracted scaling factor would commute
+  // with the matrix-matrix multiply.  That's a valid assumption for
+  // any element_type that the BLAS library knows how to handle.
+  const element_type alpha = extractScalingFactor(A) * extractScalingFactor(B);
+  const int M = static_cast<int>(C.extent(0));
+  const int N = static_cast<int>(C.extent(1));
+  const int K = static_cast<int>(A.extent(1));
+
+  if (! C_op.is_transposed) {
+    const char TRANSA = blas_trans_char(A_op.is_transposed, extractConj<in_matrix_1_t>());
+    const char TRANSB = blas_trans_char(B_op.is_transposed, extractConj<in_matrix_2_t>());
+    if (TRANSA == '\0' || TRANSB == '\0') {
+      return false;
+    }
+    BlasGemm<element_type>::gemm(&TRANSA, &TRANSB, M, N, K,
+                                 alpha, A_op.data, A_op.ld,
+                                 B_op.data, B_op.ld,
+                                 beta, C_op.data, C_op.ld);
+  }
+  else {
+    // C is row major, so compute C^T = B^T * A^T in column-major
+    // terms.  Transposing an operand flips its storage order.
+    const char TRANSA = blas_trans_char(! A_op.is_transposed, extractConj<in_matrix_1_t>());
+    const char TRANSB = blas_trans_char(! B_op.is_transposed, extractConj<in_matrix_2_t>());
+    if (TRANSA == '\0' || TRANSB == '\0') {
+      return false;
+    }
+    BlasGemm<element_type>::gemm(&TRANSB, &TRANSA, N, M, K,
+                                 alpha, B_op.data, B_op.ld,
+                                 A_op.data, A_op.ld,
+                                 beta, C_op.data, C_op.ld);
+  }
+  return true;
+}
+
+// BLAS 2 extern declarations.  The notes above about ABI mangling
+// apply here as well.
+
+extern "C" void
+dgemv_ (const char TRANS[], const int* pM, const int* pN,
+        const double* pALPHA, const double* A, const int* pLDA,
+        const double* X, const int* pINCX,
+        const double* pBETA, double* Y, const int* pINCY);
+extern "C" void
+sgemv_ (const char TRANS[], const int* pM, const int* pN,
+        const float* pALPHA, const float* A, const int* pLDA,
+        const float* X, const int* pINCX,
+        const float* pBETA, float* Y, const int* pINCY);
+extern "C" void
+cgemv_ (const char TRANS[], const int* pM, const int* pN,
+        const void* pALPHA, const void* A, const int* pLDA,
+        const void* X, const int* pINCX,
+        const void* pBETA, void* Y, const int* pINCY);
+extern "C" void
+zgemv_ (const char TRANS[], const int* pM, const int* pN,
+        const void* pALPHA, const void* A, const int* pLDA,
+        const void* X, const int* pINCX,
+        const void* pBETA, void* Y, const int* pINCY);
+
+extern "C" void
+dsymv_ (const char UPLO[], const int* pN,
+        const double* pALPHA, const double* A, const int* pLDA,
+        const double* X, const int* pINCX,
+        const double* pBETA, double* Y, const int* pINCY);
+extern "C" void
+ssymv_ (const char UPLO[], const int* pN,
+        const float* pALPHA, const float* A, const int* pLDA,
+        const float* X, const int* pINCX,
+        const float* pBETA, float* Y, const int* pINCY);
+extern "C" void
+chemv_ (const char UPLO[], const int* pN,
+        const void* pALPHA, const void* A, const int* pLDA,
+        const void* X, const int* pINCX,
+        const void* pBETA, void* Y, const int* pINCY);
+extern "C" void
+zhemv_ (const char UPLO[], const int* pN,
+        const void* pALPHA, const void* A, const int* pLDA,
+        const void* X, const int* pINCX,
+        const void* pBETA, void* Y, const int* pINCY);
+
+extern "C" void
+dtrmv_ (const char UPLO[], const char TRANS[], const char DIAG[],
+        const int* pN, const double* A, const int* pLDA,
+        double* X, const int* pINCX);
+extern "C" void
+strmv_ (const char UPLO[], const char TRANS[], const char DIAG[],
+        const int* pN, const float* A, const int* pLDA,
+        float* X, const int* pINCX);
+extern "C" void
+ctrmv_ (const char UPLO[], const char TRANS[], const char DIAG[],
+        const int* pN, const void* A, const int* pLDA,
+        void* X, const int* pINCX);
+extern "C" void
+ztrmv_ (const char UPLO[], const char TRANS[], const char DIAG[],
+        const int* pN, const void* A, const int* pLDA,
+        void* X, const int* pINCX);
+
+extern "C" void
+dtrsv_ (const char UPLO[], const char TRANS[], const char DIAG[],
+        const int* pN, const double* A, const int* pLDA,
+        double* X, const int* pINCX);
+extern "C" void
+strsv_ (const char UPLO[], const char TRANS[], const char DIAG[],
+        const int* pN, const float* A, const int* pLDA,
+        float* X, const int* pINCX);
+extern "C" void
+ctrsv_ (const char UPLO[], const char TRANS[], const char DIAG[],
+        const int* pN, const void* A, const int* pLDA,
+        void* X, const int* pINCX);
+extern "C" void
+ztrsv_ (const char UPLO[], const char TRANS[], const char DIAG[],
+        const int* pN, const void* A, const int* pLDA,
+        void* X, const int* pINCX);
+
+extern "C" void
+dger_ (const int* pM, const int* pN, const double* pALPHA,
+       const double* X, const int* pINCX,
+       const double* Y, const int* pINCY,
+       double* A, const int* pLDA);
+extern "C" void
+sger_ (const int* pM, const int* pN, const float* pALPHA,
+       const float* X, const int* pINCX,
+       const float* Y, const int* pINCY,
+       float* A, const int* pLDA);
+extern "C" void
+cgeru_ (const int* pM, const int* pN, const void* pALPHA,
+        const void* X, const int* pINCX,
+        const void* Y, const int* pINCY,
+        void* A, const int* pLDA);
+extern "C" void
+zgeru_ (const int* pM, const int* pN, const void* pALPHA,
+        const void* X, const int* pINCX,
+        const void* Y, const int* pINCY,
+        void* A, const int* pLDA);
+extern "C" void
+cgerc_ (const int* pM, const int* pN, const void* pALPHA,
+        const void* X, const int* pINCX,
+        const void* Y, const int* pINCY,
+        void* A, const int* pLDA);
+extern "C" void
+zgerc_ (const int* pM, const int* pN, const void* pALPHA,
+        const void* X, const int* pINCX,
+        const void* Y, const int* pINCY,
+        void* A, const int* pLDA);
+
+extern "C" void
+dsyr_ (const char UPLO[], const int* pN, const double* pALPHA,
+       const double* X, const int* pINCX,
+       double* A, const int* pLDA);
+extern "C" void
+ssyr_ (const char UPLO[], const int* pN, const float* pALPHA,
+       const float* X, const int* pINCX,
+       float* A, const int* pLDA);
+extern "C" void
+cher_ (const char UPLO[], const int* pN, const float* pALPHA,
+       const void* X, const int* pINCX,
+       void* A, const int* pLDA);
+extern "C" void
+zher_ (const char UPLO[], const int* pN, const double* pALPHA,
+       const void* X, const int* pINCX,
+       void* A, const int* pLDA);
+
+// Type-generic BLAS 2 wrappers.  For real element types, the
+// Hermitian and conjugated routines are the symmetric and
+// nonconjugated ones, just as conj_if_needed does nothing for reals.
+template<class Scalar>
+struct BlasLevel2 {};
+
+template<>
+struct BlasLevel2<double> {
+  using real_type = double;
+
+  static void
+  gemv (const char TRANS, const int M, const int N,
+        const double ALPHA, const double* A, const int LDA,
+        const double* X, const int INCX,
+        const double BETA, double* Y, const int INCY)
+  {
+    dgemv_ (&TRANS, &M, &N, &ALPHA, A, &LDA, X, &INCX, &BETA, Y, &INCY);
+  }
+  static void
+  hemv (const char UPLO, const int N,
+        const double ALPHA, const double* A, const int LDA,
+        const double* X, const int INCX,
+        const double BETA, double* Y, const int INCY)
+  {
+    dsymv_ (&UPLO, &N, &ALPHA, A, &LDA, X, &INCX, &BETA, Y, &INCY);
+  }
+  static void
+  trmv (const char UPLO, const char TRANS, const char DIAG, const int N,
+        const double* A, const int LDA, double* X, const int INCX)
+  {
+    dtrmv_ (&UPLO, &TRANS, &DIAG, &N, A, &LDA, X, &INCX);
+  }
+  static void
+  trsv (const char UPLO, const char TRANS, const char DIAG, const int N,
+        const double* A, const int LDA, double* X, const int INCX)
+  {
+    dtrsv_ (&UPLO, &TRANS, &DIAG, &N, A, &LDA, X, &INCX);
+  }
+  static void
+  geru (const int M, const int N, const double ALPHA,
+        const double* X, const int INCX, const double* Y, const int INCY,
+        double* A, const int LDA)
+  {
+    dger_ (&M, &N, &ALPHA, X, &INCX, Y, &INCY, A, &LDA);
+  }
+  static void
+  gerc (const int M, const int N, const double ALPHA,
+        const double* X, const int INCX, const double* Y, const int INCY,
+        double* A, const int LDA)
+  {
+    dger_ (&M, &N, &ALPHA, X, &INCX, Y, &INCY, A, &LDA);
+  }
+  static void
+  her (const char UPLO, const int N, const double ALPHA,
+       const double* X, const int INCX, double* A, const int LDA)
+  {
+    dsyr_ (&UPLO, &N, &ALPHA, X, &INCX, A, &LDA);
+  }
+};
+
+template<>
+struct BlasLevel2<float> {
+  using real_type = float;
+
+  static void
+  gemv (const char TRANS, const int M, const int N,
+        const float ALPHA, const float* A, const int LDA,
+        const float* X, const int INCX,
+        const float BETA, float* Y, const int INCY)
+  {
+    sgemv_ (&TRANS, &M, &N, &ALPHA, A, &LDA, X, &INCX, &BETA, Y, &INCY);
+  }
+  static void
+  hemv (const char UPLO, const int N,
+        const float ALPHA, const float* A, const int LDA,
+        const float* X, const int INCX,
+        const float BETA, float* Y, const int INCY)
+  {
+    ssymv_ (&UPLO, &N, &ALPHA, A, &LDA, X, &INCX, &BETA, Y, &INCY);
+  }
+  static void
+  trmv (const char UPLO, const char TRANS, const char DIAG, const int N,
+        const float* A, const int LDA, float* X, const int INCX)
+  {
+    strmv_ (&UPLO, &TRANS, &DIAG, &N, A, &LDA, X, &INCX);
+  }
+  static void
+  trsv (const char UPLO, const char TRANS, const char DIAG, const int N,
+        const float* A, const int LDA, float* X, const int INCX)
+  {
+    strsv_ (&UPLO, &TRANS, &DIAG, &N, A, &LDA, X, &INCX);
+  }
+  static void
+  geru (const int M, const int N, const float ALPHA,
+        const float* X, const int INCX, const float* Y, const int INCY,
+        float* A, const int LDA)
+  {
+    sger_ (&M, &N, &ALPHA, X, &INCX, Y, &INCY, A, &LDA);
+  }
+  static void
+  gerc (const int M, const int N, const float ALPHA,
+        const float* X, const int INCX, const float* Y, const int INCY,
+        float* A, const int LDA)
+  {
+    sger_ (&M, &N, &ALPHA, X, &INCX, Y, &INCY, A, &LDA);
+  }
+  static void
+  her (const char UPLO, const int N, const float ALPHA,
+       const float* X, const int INCX, float* A, const int LDA)
+  {
+    ssyr_ (&UPLO, &N, &ALPHA, X, &INCX, A, &LDA);
+  }
+};
+
+template<>
+struct BlasLevel2<std::complex<double>> {
+  using scalar_type = std::complex<double>;
+  using real_type = double;
+
+  static void
+  gemv (const char TRANS, const int M, const int N,
+        const scalar_type ALPHA, const scalar_type* A, const int LDA,
+        const scalar_type* X, const int INCX,
+        const scalar_type BETA, scalar_type* Y, const int INCY)
+  {
+    zgemv_ (&TRANS, &M, &N, &ALPHA, A, &LDA, X, &INCX, &BETA, Y, &INCY);
+  }
+  static void
+  hemv (const char UPLO, const int N,
+        const scalar_type ALPHA, const scalar_type* A, const int LDA,
+        const scalar_type* X, const int INCX,
+        const scalar_type BETA, scalar_type* Y, const int INCY)
+  {
+    zhemv_ (&UPLO, &N, &ALPHA, A, &LDA, X, &INCX, &BETA, Y, &INCY);
+  }
+  static void
+  trmv (const char UPLO, const char TRANS, const char DIAG, const int N,
+        const scalar_type* A, const int LDA, scalar_type* X, const int INCX)
+  {
+    ztrmv_ (&UPLO, &TRANS, &DIAG, &N, A, &LDA, X, &INCX);
+  }
+  static void
+  trsv (const char UPLO, const char TRANS, const char DIAG, const int N,
+        const scalar_type* A, const int LDA, scalar_type* X, const int INCX)
+  {
+    ztrsv_ (&UPLO, &TRANS, &DIAG, &N, A, &LDA, X, &INCX);
+  }
+  static void
+  geru (const int M, const int N, const scalar_type ALPHA,
+        const scalar_type* X, const int INCX, const scalar_type* Y, const int INCY,
+        scalar_type* A, const int LDA)
+  {
+    zgeru_ (&M, &N, &ALPHA, X, &INCX, Y, &INCY, A, &LDA);
+  }
+  static void
+  gerc (const int M, const int N, const scalar_type ALPHA,
+        const scalar_type* X, const int INCX, const scalar_type* Y, const int INCY,
+        scalar_type* A, const int LDA)
+  {
+    zgerc_ (&M, &N, &ALPHA, X, &INCX, Y, &INCY, A, &LDA);
+  }
+  static void
+  her (const char UPLO, const int N, const real_type ALPHA,
+       const scalar_type* X, const int INCX, scalar_type* A, const int LDA)
+  {
+    zher_ (&UPLO, &N, &ALPHA, X, &INCX, A, &LDA);
+  }
+};
+
+template<>
+struct BlasLevel2<std::complex<float>> {
+  using scalar_type = std::complex<float>;
+  using real_type = float;
+
+  static void
+  gemv (const char TRANS, const int M, const int N,
+        const scalar_type ALPHA, const scalar_type* A, const int LDA,
+        const scalar_type* X, const int INCX,
+        const scalar_type BETA, scalar_type* Y, const int INCY)
+  {
+    cgemv_ (&TRANS, &M, &N, &ALPHA, A, &LDA, X, &INCX, &BETA, Y, &INCY);
+  }
+  static void
+  hemv (const char UPLO, const int N,
+        const scalar_type ALPHA, const scalar_type* A, const int LDA,
+        const scalar_type* X, const int INCX,
+        const scalar_type BETA, scalar_type* Y, const int INCY)
+  {
+    chemv_ (&UPLO, &N, &ALPHA, A, &LDA, X, &INCX, &BETA, Y, &INCY);
+  }
+  static void
+  trmv (const char UPLO, const char TRANS, const char DIAG, const int N,
+        const scalar_type* A, const int LDA, scalar_type* X, const int INCX)
+  {
+    ctrmv_ (&UPLO, &TRANS, &DIAG, &N, A, &LDA, X, &INCX);
+  }
+  static void
+  trsv (const char UPLO, const char TRANS, const char DIAG, const int N,
+        const scalar_type* A, const int LDA, scalar_type* X, const int INCX)
+  {
+    ctrsv_ (&UPLO, &TRANS, &DIAG, &N, A, &LDA, X, &INCX);
+  }
+  static void
+  geru (const int M, const int N, const scalar_type ALPHA,
+        const scalar_type* X, const int INCX, const scalar_type* Y, const int INCY,
+        scalar_type* A, const int LDA)
+  {
+    cgeru_ (&M, &N, &ALPHA, X, &INCX, Y, &INCY, A, &LDA);
+  }
+  static void
+  gerc (const int M, const int N, const scalar_type ALPHA,
+        const scalar_type* X, const int INCX, const scalar_type* Y, const int INCY,
+        scalar_type* A, const int LDA)
+  {
+    cgerc_ (&M, &N, &ALPHA, X, &INCX, Y, &INCY, A, &LDA);
+  }
+  static void
+  her (const char UPLO, const int N, const real_type ALPHA,
+       const scalar_type* X, const int INCX, scalar_type* A, const int LDA)
+  {
+    cher_ (&UPLO, &N, &ALPHA, X, &INCX, A, &LDA);
+  }
+};
+
+template<class in_vector_t>
+constexpr bool valid_input_blas_vector()
+{
+  using mapping_type = typename in_vector_t::mapping_type;
+  return in_vector_t::rank() == 1 && mapping_type::is_always_strided() &&
+    valid_input_blas_accessor<in_vector_t>();
+}
+
+template<class out_vector_t>
+constexpr bool valid_output_blas_vector()
+{
+  using mapping_type = typename out_vector_t::mapping_type;
+  return out_vector_t::rank() == 1 && mapping_type::is_always_strided() &&
+    valid_output_blas_accessor<out_vector_t>();
+}
+
+// As with matrix_product, only matrices with two run-time extents
+// go to the BLAS.
+template<class in_matrix_t>
+constexpr bool valid_input_blas_matrix()
+{
+  return in_matrix_t::rank() == 2 && in_matrix_t::rank_dynamic() == 2 &&
+    valid_blas_layout<in_matrix_t>() && valid_input_blas_accessor<in_matrix_t>();
+}
+
+template<class out_matrix_t>
+constexpr bool valid_output_blas_matrix()
+{
+  return out_matrix_t::rank() == 2 && out_matrix_t::rank_dynamic() == 2 &&
+    valid_blas_layout<out_matrix_t>() && valid_output_blas_accessor<out_matrix_t>();
+}
+
+// matrix_vector_product, hermitian_matrix_vector_product,
+// triangular_matrix_vector_product, and
+// triangular_matrix_vector_solve (with in_vector_t = b and
+// out_vector_t = x).  The BLAS can conjugate A, but not x; for the
+// triangular algorithms, x is copied into the output first, so it
+// may be conjugated.
+template<class in_matrix_t,
+         class in_vector_t,
+         class out_vector_t>
+constexpr bool
+matrix_vector_product_dispatch_to_blas()
+{
+  return valid_input_blas_matrix<in_matrix_t>() &&
+    valid_input_blas_vector<in_vector_t>() &&
+    valid_output_blas_vector<out_vector_t>() &&
+    valid_blas_element_types<in_matrix_t, in_vector_t, out_vector_t>();
+}
+
+// The BLAS has no complex symmetric matrix-vector product.
+template<class in_matrix_t,
+         class in_vector_t,
+         class out_vector_t>
+constexpr bool
+symmetric_matrix_vector_product_dispatch_to_blas()
+{
+  return matrix_vector_product_dispatch_to_blas<in_matrix_t, in_vector_t, out_vector_t>() &&
+    ! is_complex_v<typename out_vector_t::value_type>;
+}
+
+// matrix_rank_1_update; x and y may both be scaled and conjugated.
+template<class in_vector_1_t,
+         class in_vector_2_t,
+         class inout_matrix_t>
+constexpr bool
+matrix_rank_1_update_dispatch_to_blas()
+{
+  return valid_input_blas_vector<in_vector_1_t>() &&
+    valid_input_blas_vector<in_vector_2_t>() &&
+    valid_output_blas_matrix<inout_matrix_t>() &&
+    valid_blas_element_types<in_vector_1_t, in_vector_2_t, inout_matrix_t>();
+}
+
+// hermitian_matrix_rank_1_update, and the symmetric one for real
+// element types (the BLAS has no complex symmetric rank-1 update).
+template<class ScaleFactorType,
+         class in_vector_t,
+         class inout_matrix_t,
+         bool Hermitian>
+constexpr bool
+symmetric_or_hermitian_matrix_rank_1_update_dispatch_to_blas()
+{
+  using value_type = typename inout_matrix_t::value_type;
+  return valid_input_blas_vector<in_vector_t>() &&
+    valid_output_blas_matrix<inout_matrix_t>() &&
+    std::is_same_v<typename in_vector_t::value_type, value_type> &&
+    std::is_convertible_v<ScaleFactorType, value_type> &&
+    (Hermitian || ! is_complex_v<value_type>);
+}
+
+template<class ScaleFactorType,
+         class in_vector_t,
+         class inout_matrix_t>
+constexpr bool
+symmetric_matrix_rank_1_update_dispatch_to_blas()
+{
+  return symmetric_or_hermitian_matrix_rank_1_update_dispatch_to_blas<
+    ScaleFactorType, in_vector_t, inout_matrix_t, false>();
+}
+
+template<class ScaleFactorType,
+         class in_vector_t,
+         class inout_matrix_t>
+constexpr bool
+hermitian_matrix_rank_1_update_dispatch_to_blas()
+{
+  return symmetric_or_hermitian_matrix_rank_1_update_dispatch_to_blas<
+    ScaleFactorType, in_vector_t, inout_matrix_t, true>();
+}
+
+// BLAS view of a strided vector.
+template<class T>
+struct blas_vector_operand {
+  T* data = nullptr;
+  int inc = 1;
+};
+
+// Returns false if the vector is empty or its stride cannot be given
+// to the BLAS.
+template<class vector_t>
+bool make_blas_vector_operand(const vector_t& x,
+                              blas_vector_operand<std::remove_pointer_t<typename vector_t::data_handle_type>>& op)
+{
+  const auto n = static_cast<::std::ptrdiff_t>(x.extent(0));
+  if (n == 0 || n > INT_MAX) {
+    return false;
+  }
+  const auto stride = n == 1 ? ::std::ptrdiff_t(1) : static_cast<::std::ptrdiff_t>(x.stride(0));
+  if (stride < 1 || stride > INT_MAX) {
+    return false;
+  }
+  op.inc = static_cast<int>(stride);
+  op.data = x.data_handle() + x.mapping()(0);
+  return true;
+}
+
+// BLAS UPLO argument for Triangle of a matrix with the given
+// storage.  Transposing a matrix flips the triangle that it stores.
+template<class Triangle>
+char blas_uplo_char(bool is_transposed)
+{
+  constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+  return lower != is_transposed ? 'L' : 'U';
+}
+
+// For all the BLAS 2 functions below: return false without touching
+// the output if the operands cannot be expressed as a BLAS call at
+// run time; the caller must then fall back to the generic
+// implementation.  Otherwise, call init_output() (e.g., to copy the
+// vector to update into the output), then the BLAS.
+
+// y = alpha * A * x + beta * y via xGEMV, where alpha is the product
+// of A's and x's scaling factors.
+template<class in_matrix_t,
+         class in_vector_t,
+         class out_vector_t,
+         class InitOutput>
+bool matrix_vector_product_blas(const in_matrix_t& A,
+                                const in_vector_t& x,
+                                const typename out_vector_t::value_type beta,
+                                const out_vector_t& y,
+                                InitOutput&& init_output)
+{
+  using element_type = typename out_vector_t::value_type;
+
+  if (extractConj<in_vector_t>()) {
+    return false;
+  }
+  blas_matrix_operand<std::remove_pointer_t<typename in_matrix_t::data_handle_type>> A_op;
+  blas_vector_operand<std::remove_pointer_t<typename in_vector_t::data_handle_type>> x_op;
+  blas_vector_operand<element_type> y_op;
+  if (! make_blas_operand(A, A_op) ||
+      ! make_blas_vector_operand(x, x_op) ||
+      ! make_blas_vector_operand(y, y_op)) {
+    return false;
+  }
+  const char TRANS = blas_trans_char(A_op.is_transposed, extractConj<in_matrix_t>());
+  if (TRANS == '\0') {
+    return false;
+  }
+
+  const element_type alpha = extractScalingFactor(A) * extractScalingFactor(x);
+  // The BLAS wants the extents of the column-major matrix that it sees.
+  const int M = static_cast<int>(A_op.is_transposed ? A.extent(1) : A.extent(0));
+  const int N = static_cast<int>(A_op.is_transposed ? A.extent(0) : A.extent(1));
+  init_output();
+  BlasLevel2<element_type>::gemv(TRANS, M, N, alpha, A_op.data, A_op.ld,
+                                 x_op.data, x_op.inc, beta, y_op.data, y_op.inc);
+  return true;
+}
+
+// y = alpha * A * x + beta * y via xSYMV (real) or xHEMV (complex),
+// where A is symmetric resp. Hermitian and only the Triangle t of A
+// is accessed.
+//
+// The BLAS reads a Hermitian matrix from the triangle of column-major
+// storage.  Row-major storage of a Hermitian A is column-major
+// storage of conj(A), so the BLAS can only take that if A's accessor
+// conjugates.  Likewise, the BLAS cannot scale A by a complex number
+// and keep it Hermitian, so A's scaling factor must be real.
+template<class in_matrix_t,
+         class Triangle,
+         class in_vector_t,
+         class out_vector_t,
+         class InitOutput>
+bool hermitian_matrix_vector_product_blas(const in_matrix_t& A,
+                                          Triangle /* t */,
+                                          const in_vector_t& x,
+                                          const typename out_vector_t::value_type beta,
+                                          const out_vector_t& y,
+                                          InitOutput&& init_output)
+{
+  using element_type = typename out_vector_t::value_type;
+
+  if (extractConj<in_vector_t>()) {
+    return false;
+  }
+  blas_matrix_operand<std::remove_pointer_t<typename in_matrix_t::data_handle_type>> A_op;
+  blas_vector_operand<std::remove_pointer_t<typename in_vector_t::data_handle_type>> x_op;
+  blas_vector_operand<element_type> y_op;
+  if (! make_blas_operand(A, A_op) ||
+      ! make_blas_vector_operand(x, x_op) ||
+      ! make_blas_vector_operand(y, y_op)) {
+    return false;
+  }
+  const element_type alpha_A = extractScalingFactor(A);
+  if constexpr (is_complex_v<element_type>) {
+    if (A_op.is_transposed != extractConj<in_matrix_t>() ||
+        imag_if_needed(alpha_A) != 0) {
+      return false;
+    }
+  }
+
+  const element_type alpha = alpha_A * extractScalingFactor(x);
+  const char UPLO = blas_uplo_char<Triangle>(A_op.is_transposed);
+  const int N = static_cast<int>(A.extent(0));
+  init_output();
+  BlasLevel2<element_type>::hemv(UPLO, N, alpha, A_op.data, A_op.ld,
+                                 x_op.data, x_op.inc, beta, y_op.data, y_op.inc);
+  return true;
+}
+
+// For real element types, a symmetric matrix is Hermitian.
+template<class in_matrix_t,
+         class Triangle,
+         class in_vector_t,
+         class out_vector_t,
+         class InitOutput>
+bool symmetric_matrix_vector_product_blas(const in_matrix_t& A,
+                                          Triangle t,
+                                          const in_vector_t& x,
+                                          const typename out_vector_t::value_type beta,
+                                          const out_vector_t& y,
+                                          InitOutput&& init_output)
+{
+  static_assert(! is_complex_v<typename out_vector_t::value_type>);
+  return hermitian_matrix_vector_product_blas(A, t, x, beta, y,
+                                              std::forward<InitOutput>(init_output));
+}
+
+// y = A * x (Solve == false, via xTRMV) or y = A \ x (Solve == true,
+// via xTRSV), where A is triangular.  The BLAS works in place, so
+// this first copies x into y through x's accessor.  y may alias x.
+//
+// A scaling factor alpha of A is applied to (or divided out of) y
+// afterwards.  That is not possible with an implicit unit diagonal,
+// unless alpha is one.
+template<bool Solve,
+         class in_matrix_t,
+         class Triangle,
+         class DiagonalStorage,
+         class in_vector_t,
+         class out_vector_t>
+bool triangular_matrix_vector_blas(const in_matrix_t& A,
+                                   Triangle /* t */,
+                                   DiagonalStorage /* d */,
+                                   const in_vector_t& x,
+                                   const out_vector_t& y)
+{
+  using element_type = typename out_vector_t::value_type;
+  constexpr bool explicit_diagonal =
+    std::is_same_v<DiagonalStorage, explicit_diagonal_t>;
+
+  blas_matrix_operand<std::remove_pointer_t<typename in_matrix_t::data_handle_type>> A_op;
+  blas_vector_operand<element_type> y_op;
+  if (! make_blas_operand(A, A_op) ||
+      ! make_blas_vector_operand(y, y_op)) {
+    return false;
+  }
+  const char TRANS = blas_trans_char(A_op.is_transposed, extractConj<in_matrix_t>());
+  if (TRANS == '\0') {
+    return false;
+  }
+  const element_type alpha = extractScalingFactor(A);
+  if constexpr (explicit_diagonal) {
+    // Leave division by zero to the generic implementation.
+    if (Solve && alpha == element_type{}) {
+      return false;
+    }
+  }
+  else {
+    if (alpha != element_type(1)) {
+      return false;
+    }
+  }
+
+  const char UPLO = blas_uplo_char<Triangle>(A_op.is_transposed);
+  const char DIAG = explicit_diagonal ? 'N' : 'U';
+  const int N = static_cast<int>(A.extent(0));
+  for (::std::size_t i = 0; i < y.extent(0); ++i) {
+    y(i) = x(i);
+  }
+  if constexpr (Solve) {
+    BlasLevel2<element_type>::trsv(UPLO, TRANS, DIAG, N, A_op.data, A_op.ld,
+                                   y_op.data, y_op.inc);
+  }
+  else {
+    BlasLevel2<element_type>::trmv(UPLO, TRANS, DIAG, N, A_op.data, A_op.ld,
+                                   y_op.data, y_op.inc);
+  }
+  if (alpha != element_type(1)) {
+    for (::std::size_t i = 0; i < y.extent(0); ++i) {
+      if constexpr (Solve) {
+        y(i) /= alpha;
+      }
+      else {
+        y(i) *= alpha;
+      }
+    }
+  }
+  return true;
+}
+
+// z = y + A * x, with A triangular.  xTRMV works in place, so this
+// needs a temporary copy of x.
+template<class in_matrix_t,
+         class Triangle,
+         class DiagonalStorage,
+         class in_vector_1_t,
+         class in_vector_2_t,
+         class out_vector_t>
+bool triangular_matrix_vector_product_blas(const in_matrix_t& A,
+                                           Triangle t,
+                                           DiagonalStorage d,
+                                           const in_vector_1_t& x,
+                                           const in_vector_2_t& y,
+                                           const out_vector_t& z)
+{
+  using element_type = typename out_vector_t::value_type;
+  using tmp_vector_t = mdspan<element_type, dextents<::std::size_t, 1>>;
+
+  std::vector<element_type> tmp_storage(x.extent(0));
+  tmp_vector_t tmp(tmp_storage.data(), x.extent(0));
+  if (! triangular_matrix_vector_blas<false>(A, t, d, x, tmp)) {
+    return false;
+  }
+  for (::std::size_t i = 0; i < z.extent(0); ++i) {
+    z(i) = y(i) + tmp(i);
+  }
+  return true;
+}
+
+// A = A + alpha * x * y^T via xGER, xGERU or xGERC, where alpha is
+// the product of x's and y's scaling factors.  xGERC takes care of a
+// conjugated y.  If A is row major, this updates A^T with y * x^T
+// instead, so x may be conjugated but y may not.
+template<class in_vector_1_t,
+         class in_vector_2_t,
+         class inout_matrix_t,
+         class InitOutput>
+bool matrix_rank_1_update_blas(const in_vector_1_t& x,
+                               const in_vector_2_t& y,
+                               const inout_matrix_t& A,
+                               InitOutput&& init_output)
+{
+  using element_type = typename inout_matrix_t::value_type;
+  constexpr bool conj_x = extractConj<in_vector_1_t>();
+  constexpr bool conj_y = extractConj<in_vector_2_t>();
+
+  blas_vector_operand<std::remove_pointer_t<typename in_vector_1_t::data_handle_type>> x_op;
+  blas_vector_operand<std::remove_pointer_t<typename in_vector_2_t::data_handle_type>> y_op;
+  blas_matrix_operand<element_type> A_op;
+  if (! make_blas_vector_operand(x, x_op) ||
+      ! make_blas_vector_operand(y, y_op) ||
+      ! make_blas_operand(A, A_op)) {
+    return false;
+  }
+  if (A_op.is_transposed ? conj_y : conj_x) {
+    return false;
+  }
+
+  const element_type alpha = extractScalingFactor(x) * extractScalingFactor(y);
+  const int M = static_cast<int>(A.extent(0));
+  const int N = static_cast<int>(A.extent(1));
+  init_output();
+  if (! A_op.is_transposed) {
+    if (conj_y) {
+      BlasLevel2<element_type>::gerc(M, N, alpha, x_op.data, x_op.inc,
+                                     y_op.data, y_op.inc, A_op.data, A_op.ld);
+    }
+    else {
+      BlasLevel2<element_type>::geru(M, N, alpha, x_op.data, x_op.inc,
+                                     y_op.data, y_op.inc, A_op.data, A_op.ld);
+    }
+  }
+  else {
+    if (conj_x) {
+      BlasLevel2<element_type>::gerc(N, M, alpha, y_op.data, y_op.inc,
+                                     x_op.data, x_op.inc, A_op.data, A_op.ld);
+    }
+    else {
+      BlasLevel2<element_type>::geru(N, M, alpha, y_op.data, y_op.inc,
+                                     x_op.data, x_op.inc, A_op.data, A_op.ld);
+    }
+  }
+  return true;
+}
+
+// A = A + alpha * x * x^H on the Triangle t of A via xSYR (real) or
+// xHER (complex), with x's scaling factor folded into alpha.  xHER
+// takes a real alpha, and the same storage restriction as in
+// hermitian_matrix_vector_product_blas applies: a row-major A can
+// only be updated if x is conjugated, since A^T = conj(A).
+template<class ScaleFactorType,
+         class in_vector_t,
+         class inout_matrix_t,
+         class Triangle,
+         class InitOutput>
+bool hermitian_matrix_rank_1_update_blas(const ScaleFactorType& alpha,
+                                         const in_vector_t& x,
+                                         const inout_matrix_t& A,
+                                         Triangle /* t */,
+                                         InitOutput&& init_output)
+{
+  using element_type = typename inout_matrix_t::value_type;
+  using real_type = typename BlasLevel2<element_type>::real_type;
+
+  blas_vector_operand<std::remove_pointer_t<typename in_vector_t::data_handle_type>> x_op;
+  blas_matrix_operand<element_type> A_op;
+  if (! make_blas_vector_operand(x, x_op) ||
+      ! make_blas_operand(A, A_op)) {
+    return false;
+  }
+  const element_type alpha_x = extractScalingFactor(x);
+  const element_type alpha_total = element_type(alpha) * alpha_x * conj_if_needed(alpha_x);
+  if constexpr (is_complex_v<element_type>) {
+    if (A_op.is_transposed != extractConj<in_vector_t>() ||
+        imag_if_needed(element_type(alpha)) != 0) {
+      return false;
+    }
+  }
+
+  const char UPLO = blas_uplo_char<Triangle>(A_op.is_transposed);
+  const int N = static_cast<int>(A.extent(0));
+  init_output();
+  BlasLevel2<element_type>::her(UPLO, N, real_type(real_if_needed(alpha_total)),
+                                x_op.data, x_op.inc, A_op.data, A_op.ld);
+  return true;
+}
+
+// For real element types, a symmetric rank-1 update is Hermitian.
+template<class ScaleFactorType,
+         class in_vector_t,
+         class inout_matrix_t,
+         class Triangle,
+         class InitOutput>
+bool symmetric_matrix_rank_1_update_blas(const ScaleFactorType& alpha,
+                                         const in_vector_t& x,
+                                         const inout_matrix_t& A,
+                                         Triangle t,
+                                         InitOutput&& init_output)
+{
+  static_assert(! is_complex_v<typename inout_matrix_t::value_type>);
+  return hermitian_matrix_rank_1_update_blas(alpha, x, A, t,
+                                             std::forward<InitOutput>(init_output));
+}
+
+// Initializers for the overwriting and updating forms of the rank-1
+// updates, for use as init_output above.  Triangle = void means all
+// of A.
+
+template<class Triangle>
+std::pair<::std::size_t, ::std::size_t>
+blas_triangle_row_range(const ::std::size_t j, const ::std::size_t num_rows)
+{
+  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+    return {j, num_rows};
+  }
+  else if constexpr (std::is_same_v<Triangle, upper_triangle_t>) {
+    return {0, std::min(j + 1, num_rows)};
+  }
+  else {
+    return {0, num_rows};
+  }
+}
+
+// A = 0 on the Triangle of A.
+template<class Triangle, class inout_matrix_t>
+void blas_zero_triangle(const inout_matrix_t& A)
+{
+  for (::std::size_t j = 0; j < A.extent(1); ++j) {
+    const auto [i_begin, i_end] = blas_triangle_row_range<Triangle>(j, A.extent(0));
+    for (::std::size_t i = i_begin; i < i_end; ++i) {
+      A(i,j) = typename inout_matrix_t::value_type{};
+    }
+  }
+}
+
+// A = E on the Triangle of A.  E may alias A.
+template<class Triangle, class in_matrix_t, class inout_matrix_t>
+void blas_copy_triangle(const in_matrix_t& E, const inout_matrix_t& A)
+{
+  for (::std::size_t j = 0; j < A.extent(1); ++j) {
+    const auto [i_begin, i_end] = blas_triangle_row_range<Triangle>(j, A.extent(0));
+    for (::std::size_t i = i_begin; i < i_end; ++i) {
+      A(i,j) = E(i,j);
+    }
+  }
+}
+
+#endif // LINALG_ENABLE_BLAS
+
+} // end namespace impl
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS_DISPATCH_HPP_
@@ -0,0 +1,619 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_GEMM_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_GEMM_HPP_
+
+#include <mdspan/mdspan.hpp>
+#include "fixed_size_kernels.hpp"
+#include <algorithm>
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+namespace impl {
+
+// Cache-blocked, packed matrix-matrix multiply in the style of
+// GotoBLAS / BLIS.  The algorithms in blas3_matrix_product.hpp (and
+// the other BLAS 3 algorithms that reduce to GEMM) use it for
+// mdspan whose accessor is default_accessor and whose layout is
+// strided.  Everything else goes through the generic loops.
+//
+// matrix_product also uses it for input matrices whose accessors
+// nest scaled_accessor and conjugated_accessor around
+// default_accessor.  The engine reads the stored elements, conjugates
+// them as it packs them, and multiplies by the scaling factors once
+// per element of C, instead of once per multiply-add.
+//
+// If C has only a few columns, as when one matrix is applied to a
+// small block of vectors, the engine reads A in place instead of
+// packing it (see narrow_gemm_sum).
+//
+// The engine works on raw strided views, so that callers can split
+// a problem into independent pieces (e.g., for parallel execution)
+// without building new mdspan types.
+
+// Element (i,j) of a strided_matrix_view lives at
+// data[i * stride0 + j * stride1].  If conjugated is true, the
+// engine uses the complex conjugates of the elements as it packs
+// them; operator() still returns the stored elements.
+template<class T>
+struct strided_matrix_view {
+  T* data = nullptr;
+  ::std::ptrdiff_t extent0 = 0;
+  ::std::ptrdiff_t extent1 = 0;
+  ::std::ptrdiff_t stride0 = 0;
+  ::std::ptrdiff_t stride1 = 0;
+  bool conjugated = false;
+
+  T& operator()(::std::ptrdiff_t i, ::std::ptrdiff_t j) const {
+    return data[i * stride0 + j * stride1];
+  }
+
+  // View of rows [row_begin, row_begin + num_rows) and columns
+  // [col_begin, col_begin + num_cols).
+  strided_matrix_view block(::std::ptrdiff_t row_begin,
+                            ::std::ptrdiff_t col_begin,
+                            ::std::ptrdiff_t num_rows,
+                            ::std::ptrdiff_t num_cols) const
+  {
+    return {data + row_begin * stride0 + col_begin * stride1,
+            num_rows, num_cols, stride0, stride1, conjugated};
+  }
+
+  strided_matrix_view<const T> as_const() const {
+    return {data, extent0, extent1, stride0, stride1, conjugated};
+  }
+
+  strided_matrix_view transposed() const {
+    return {data, extent1, extent0, stride1, stride0, conjugated};
+  }
+
+  // Whether going down a column takes steps no longer than going
+  // along a row, so that loops over the matrix should walk columns.
+  bool columns_contiguous() const {
+    return (stride0 < 0 ? -stride0 : stride0) <= (stride1 < 0 ? -stride1 : stride1);
+  }
+};
+
+template<class T>
+inline constexpr bool is_character_type_v =
+  std::is_same_v<T, char> ||
+  std::is_same_v<T, signed char> ||
+  std::is_same_v<T, unsigned char> ||
+#if defined(__cpp_char8_t)
+  std::is_same_v<T, char8_t> ||
+#endif
+  std::is_same_v<T, wchar_t> ||
+  std::is_same_v<T, char16_t> ||
+  std::is_same_v<T, char32_t>;
+
+// Element types for which the packed engine is valid: floating-point
+// and integer types, and std::complex thereof.  The generic loops
+// promote bool and the character types to int before they add, so
+// sums in those types would differ; they take the generic loops.
+template<class T>
+inline constexpr bool is_gemm_packable_value_v =
+  std::is_floating_point_v<T> ||
+  (std::is_integral_v<T> && ! std::is_same_v<T, bool> && ! is_character_type_v<T>) ||
+  is_complex_v<T>;
+
+// Blocking parameters.  MR x NR is the register tile computed by the
+// micro-kernel; an MR-row panel of A occupies one vector register
+// per column of the tile for the common AVX2 / NEON widths.  A
+// KC x NR sliver of packed B stays in L1, an MC x KC block of packed
+// A stays in L2, and a KC x NC panel of packed B stays in L3.
+template<class T>
+struct gemm_blocking {
+  static constexpr ::std::ptrdiff_t mr =
+    sizeof(T) >= 32 ? 2 : static_cast<::std::ptrdiff_t>(64 / sizeof(T));
+  static constexpr ::std::ptrdiff_t nr = 4;
+  static constexpr ::std::ptrdiff_t kc = 256;
+  static constexpr ::std::ptrdiff_t mc = 16 * mr;
+  static constexpr ::std::ptrdiff_t nc = 4096;
+  // C with at most this many columns goes through narrow_gemm_sum.
+  static constexpr ::std::ptrdiff_t narrow_n = 4 * nr;
+};
+
+// Is the mdspan type one whose elements the engine can address
+// directly through data_handle() and stride()?
+template<class MDSpan>
+struct is_gemm_packable_matrix : std::false_type {};
+
+template<class ElementType, class Extents, class Layout>
+struct is_gemm_packable_matrix<
+  mdspan<ElementType, Extents, Layout, default_accessor<ElementType>>>
+  : std::bool_constant<
+      Extents::rank() == 2 &&
+      is_gemm_packable_value_v<std::remove_const_t<ElementType>> &&
+      Layout::template mapping<Extents>::is_always_strided()>
+{};
+
+template<class MDSpan>
+inline constexpr bool is_gemm_packable_matrix_v =
+  is_gemm_packable_matrix<MDSpan>::value;
+
+// Can C = A * B go through the packed engine?  Classic GEMM
+// assumes that all matrices have the same value_type.
+template<class A_t, class B_t, class C_t>
+inline constexpr bool is_gemm_packable_product_v =
+  is_gemm_packable_matrix_v<A_t> &&
+  is_gemm_packable_matrix_v<B_t> &&
+  is_gemm_packable_matrix_v<C_t> &&
+  ! std::is_const_v<typename C_t::element_type> &&
+  std::is_same_v<typename A_t::value_type, typename C_t::value_type> &&
+  std::is_same_v<typename B_t::value_type, typename C_t::value_type>;
+
+// Is the mdspan type an input matrix that the engine can read once
+// its accessor's scaled_accessor and conjugated_accessor wrappers
+// are peeled off?  The stored elements must have the mdspan's
+// value_type, so that the engine computes in the same precision as
+// the generic loops.
+template<class MDSpan>
+struct is_gemm_peelable_matrix : std::false_type {};
+
+template<class ElementType, class Extents, class Layout, class Accessor>
+struct is_gemm_peelable_matrix<mdspan<ElementType, Extents, Layout, Accessor>> {
+private:
+  using traits = accessor_unwrap_traits<Accessor>;
+  using value_type = std::remove_cv_t<ElementType>;
+
+  static constexpr bool stores_value_type() {
+    if constexpr (traits::is_valid) {
+      return std::is_same_v<std::remove_cv_t<typename traits::element_type>, value_type>;
+    }
+    else {
+      return false;
+    }
+  }
+public:
+  static constexpr bool value =
+    Extents::rank() == 2 &&
+    is_gemm_packable_value_v<value_type> &&
+    Layout::template mapping<Extents>::is_always_strided() &&
+    stores_value_type();
+};
+
+template<class MDSpan>
+inline constexpr bool is_gemm_peelable_matrix_v =
+  is_gemm_peelable_matrix<MDSpan>::value;
+
+// Can C = A * B go through the packed engine, with A's and B's
+// scaling factors (see extractScalingFactor) multiplied into alpha?
+template<class A_t, class B_t, class C_t>
+inline constexpr bool is_gemm_peelable_product_v =
+  is_gemm_peelable_matrix_v<A_t> &&
+  is_gemm_peelable_matrix_v<B_t> &&
+  is_gemm_packable_matrix_v<C_t> &&
+  ! std::is_const_v<typename C_t::element_type> &&
+  std::is_same_v<typename A_t::value_type, typename C_t::value_type> &&
+  std::is_same_v<typename B_t::value_type, typename C_t::value_type>;
+
+template<class ElementType, class Extents, class Layout, class Accessor>
+strided_matrix_view<ElementType>
+make_strided_matrix_view(const mdspan<ElementType, Extents, Layout, Accessor>& A)
+{
+  strided_matrix_view<ElementType> view;
+  view.data = A.data_handle();
+  view.extent0 = static_cast<::std::ptrdiff_t>(A.extent(0));
+  view.extent1 = static_cast<::std::ptrdiff_t>(A.extent(1));
+  if (view.extent0 != 0 && view.extent1 != 0) {
+    view.data += A.mapping()(0, 0);
+    view.stride0 = static_cast<::std::ptrdiff_t>(A.stride(0));
+    view.stride1 = static_cast<::std::ptrdiff_t>(A.stride(1));
+  }
+  view.conjugated = extractConj<mdspan<ElementType, Extents, Layout, Accessor>>();
+  return view;
+}
+
+namespace blocked_gemm_detail {
+
+template<bool Conjugate, class T>
+T packed_value(const T& value)
+{
+  if constexpr (Conjugate) {
+    return conj_if_needed(value);
+  }
+  else {
+    return value;
+  }
+}
+
+// Copy rows [0, mc) and columns [0, kc) of A into MR-row panels.
+// Within a panel, the MR entries of each column are contiguous.
+// Rows past mc are zero-filled so that the micro-kernel never needs
+// a remainder case on its inner loop.
+template<bool Conjugate, class T>
+void pack_a(strided_matrix_view<const T> A,
+            ::std::ptrdiff_t mc, ::std::ptrdiff_t kc, T* buffer)
+{
+  constexpr ::std::ptrdiff_t mr = gemm_blocking<T>::mr;
+  for (::std::ptrdiff_t ir = 0; ir < mc; ir += mr) {
+    const ::std::ptrdiff_t m_panel = ::std::min(mr, mc - ir);
+    for (::std::ptrdiff_t p = 0; p < kc; ++p) {
+      const T* A_col = A.data + ir * A.stride0 + p * A.stride1;
+      ::std::ptrdiff_t i = 0;
+      for (; i < m_panel; ++i) {
+        buffer[i] = packed_value<Conjugate>(A_col[i * A.stride0]);
+      }
+      for (; i < mr; ++i) {
+        buffer[i] = T{};
+      }
+      buffer += mr;
+    }
+  }
+}
+
+// Copy rows [0, kc) and columns [0, nc) of B into NR-column panels.
+// Within a panel, the NR entries of each row are contiguous.
+template<bool Conjugate, class T>
+void pack_b(strided_matrix_view<const T> B,
+            ::std::ptrdiff_t kc, ::std::ptrdiff_t nc, T* buffer)
+{
+  constexpr ::std::ptrdiff_t nr = gemm_blocking<T>::nr;
+  for (::std::ptrdiff_t jr = 0; jr < nc; jr += nr) {
+    const ::std::ptrdiff_t n_panel = ::std::min(nr, nc - jr);
+    for (::std::ptrdiff_t p = 0; p < kc; ++p) {
+      const T* B_row = B.data + p * B.stride0 + jr * B.stride1;
+      ::std::ptrdiff_t j = 0;
+      for (; j < n_panel; ++j) {
+        buffer[j] = packed_value<Conjugate>(B_row[j * B.stride1]);
+      }
+      for (; j < nr; ++j) {
+        buffer[j] = T{};
+      }
+      buffer += nr;
+    }
+  }
+}
+
+// pack_a or pack_b, conjugating if the view says so.  Conjugating a
+// real number does nothing, so only complex views pay for the test.
+template<class T>
+void pack_a(strided_matrix_view<const T> A,
+            ::std::ptrdiff_t mc, ::std::ptrdiff_t kc, T* buffer)
+{
+  if (is_complex_v<T> && A.conjugated) {
+    pack_a<is_complex_v<T>>(A, mc, kc, buffer);
+  }
+  else {
+    pack_a<false>(A, mc, kc, buffer);
+  }
+}
+
+template<class T>
+void pack_b(strided_matrix_view<const T> B,
+            ::std::ptrdiff_t kc, ::std::ptrdiff_t nc, T* buffer)
+{
+  if (is_complex_v<T> && B.conjugated) {
+    pack_b<is_complex_v<T>>(B, kc, nc, buffer);
+  }
+  else {
+    pack_b<false>(B, kc, nc, buffer);
+  }
+}
+
+// C(0:m, 0:n) = beta * C + alpha * A_panel * B_panel, where the
+// panels are packed by pack_a resp. pack_b.  beta == 0 means
+// "overwrite," so C may hold uninitialized values (including NaN).
+template<class T>
+void micro_kernel(::std::ptrdiff_t kc,
+                  const T* A_panel, const T* B_panel,
+                  const T& alpha, const T& beta,
+                  strided_matrix_view<T> C,
+                  ::std::ptrdiff_t m, ::std::ptrdiff_t n)
+{
+  constexpr ::std::ptrdiff_t mr = gemm_blocking<T>::mr;
+  constexpr ::std::ptrdiff_t nr = gemm_blocking<T>::nr;
+
+  T acc[nr][mr] = {};
+  for (::std::ptrdiff_t p = 0; p < kc; ++p) {
+    for (::std::ptrdiff_t j = 0; j < nr; ++j) {
+      const T b = B_panel[j];
+      for (::std::ptrdiff_t i = 0; i < mr; ++i) {
+        acc[j][i] += A_panel[i] * b;
+      }
+    }
+    A_panel += mr;
+    B_panel += nr;
+  }
+
+  if (beta == T{}) {
+    for (::std::ptrdiff_t j = 0; j < n; ++j) {
+      for (::std::ptrdiff_t i = 0; i < m; ++i) {
+        C(i,j) = alpha * acc[j][i];
+      }
+    }
+  }
+  else {
+    for (::std::ptrdiff_t j = 0; j < n; ++j) {
+      for (::std::ptrdiff_t i = 0; i < m; ++i) {
+        C(i,j) = beta * C(i,j) + alpha * acc[j][i];
+      }
+    }
+  }
+}
+
+template<class T>
+void scale_matrix(const T& beta, strided_matrix_view<T> C)
+{
+  for (::std::ptrdiff_t j = 0; j < C.extent1; ++j) {
+    for (::std::ptrdiff_t i = 0; i < C.extent0; ++i) {
+      C(i,j) = beta == T{} ? T{} : beta * C(i,j);
+    }
+  }
+}
+
+// C(0:TM, 0:NV) = beta * C + alpha * A * B_panel, where A is TM x kc
+// and read in place, and B_panel is packed by pack_b.  The TM x NV
+// sums stay in registers.  Each entry of C accumulates its products
+// in the same order as in micro_kernel, so the two give the same
+// results.
+template<bool ConjA, bool UnitStride, ::std::ptrdiff_t TM, ::std::ptrdiff_t NV, class T>
+void narrow_kernel(::std::ptrdiff_t kc,
+                   strided_matrix_view<const T> A,
+                   const T* B_panel,
+                   const T& alpha, const T& beta,
+                   strided_matrix_view<T> C)
+{
+  constexpr ::std::ptrdiff_t nr = gemm_blocking<T>::nr;
+  const ::std::ptrdiff_t stride0 = UnitStride ? 1 : A.stride0;
+
+  T acc[NV][TM] = {};
+  for (::std::ptrdiff_t p = 0; p < kc; ++p) {
+    const T* A_col = A.data + p * A.stride1;
+    for (::std::ptrdiff_t j = 0; j < NV; ++j) {
+      const T b = B_panel[j];
+      for (::std::ptrdiff_t i = 0; i < TM; ++i) {
+        acc[j][i] += packed_value<ConjA>(A_col[i * stride0]) * b;
+      }
+    }
+    B_panel += nr;
+  }
+
+  if (beta == T{}) {
+    for (::std::ptrdiff_t j = 0; j < NV; ++j) {
+      for (::std::ptrdiff_t i = 0; i < TM; ++i) {
+        C(i,j) = alpha * acc[j][i];
+      }
+    }
+  }
+  else {
+    for (::std::ptrdiff_t j = 0; j < NV; ++j) {
+      for (::std::ptrdiff_t i = 0; i < TM; ++i) {
+        C(i,j) = beta * C(i,j) + alpha * acc[j][i];
+      }
+    }
+  }
+}
+
+// C = beta * C + alpha * A * B, with A: M x kc, C: M x N for N at
+// most narrow_n, and B packed by pack_b.  Each tile of TM rows of A
+// stays in L1 while the kernel runs through all of B's NR-column
+// panels, so A comes from memory only once.
+template<bool ConjA, bool UnitStride, ::std::ptrdiff_t TM, class T>
+void narrow_block(::std::ptrdiff_t kc,
+                  strided_matrix_view<const T> A,
+                  const T* B_packed,
+                  const T& alpha, const T& beta,
+                  strided_matrix_view<T> C)
+{
+  constexpr ::std::ptrdiff_t nr = gemm_blocking<T>::nr;
+  auto row_tile = [&] (::std::ptrdiff_t i, auto num_rows) {
+    constexpr ::std::ptrdiff_t rows = decltype(num_rows)::value;
+    for (::std::ptrdiff_t jr = 0; jr < C.extent1; jr += nr) {
+      const ::std::ptrdiff_t n = ::std::min(nr, C.extent1 - jr);
+      unrolled_for<nr>([&] (auto c) {
+        constexpr ::std::ptrdiff_t NV = decltype(c)::value + 1;
+        if (n == NV) {
+          narrow_kernel<ConjA, UnitStride, rows, NV>(kc, A.block(i, 0, rows, kc),
+            B_packed + jr * kc, alpha, beta, C.block(i, jr, rows, NV));
+        }
+      });
+    }
+  };
+
+  ::std::ptrdiff_t i = 0;
+  for (; i + TM <= C.extent0; i += TM) {
+    row_tile(i, ::std::integral_constant<::std::ptrdiff_t, TM>{});
+  }
+  for (; i < C.extent0; ++i) {
+    row_tile(i, ::std::integral_constant<::std::ptrdiff_t, 1>{});
+  }
+}
+
+// gemm_sum for C with at most narrow_n columns, as when one matrix
+// is applied to a small block of vectors.  Packing A would cost about
+// as much as the products themselves, so this packs only B and reads
+// A in place, in the direction of its storage: tiles of MR rows if
+// A's columns are contiguous, else tiles of NR rows.  The sums of
+// each entry of C are the same as gemm_sum's.
+template<::std::size_t NumTerms, class T>
+void narrow_gemm_sum(const ::std::array<T, NumTerms>& alpha,
+                     const ::std::array<strided_matrix_view<const T>, NumTerms>& A,
+                     const ::std::array<strided_matrix_view<const T>, NumTerms>& B,
+                     const T& beta,
+                     strided_matrix_view<T> C,
+                     ::std::ptrdiff_t K_max)
+{
+  using blocking = gemm_blocking<T>;
+  constexpr ::std::ptrdiff_t mr = blocking::mr;
+  constexpr ::std::ptrdiff_t nr = blocking::nr;
+
+  const ::std::ptrdiff_t M = C.extent0;
+  const ::std::ptrdiff_t N = C.extent1;
+  ::std::vector<T> B_packed(::std::min(blocking::kc, K_max) * ((N + nr - 1) / nr * nr));
+  bool first_pass = true;
+
+  for (::std::size_t t = 0; t < NumTerms; ++t) {
+    if (alpha[t] == T{}) {
+      continue;
+    }
+    const ::std::ptrdiff_t K = A[t].extent1;
+    for (::std::ptrdiff_t pc = 0; pc < K; pc += blocking::kc) {
+      const ::std::ptrdiff_t kc = ::std::min(blocking::kc, K - pc);
+      const T beta_pass = first_pass ? beta : T{1};
+      first_pass = false;
+      pack_b(B[t].block(pc, 0, kc, N), kc, N, B_packed.data());
+
+      const auto A_block = A[t].block(0, pc, M, kc);
+      auto sweep = [&] (auto conjugate) {
+        constexpr bool ConjA = decltype(conjugate)::value;
+        if (A_block.stride0 == 1) {
+          narrow_block<ConjA, true, mr>(kc, A_block, B_packed.data(), alpha[t], beta_pass, C);
+        }
+        else if (A_block.columns_contiguous()) {
+          narrow_block<ConjA, false, mr>(kc, A_block, B_packed.data(), alpha[t], beta_pass, C);
+        }
+        else {
+          narrow_block<ConjA, false, nr>(kc, A_block, B_packed.data(), alpha[t], beta_pass, C);
+        }
+      };
+      if (is_complex_v<T> && A_block.conjugated) {
+        sweep(::std::bool_constant<is_complex_v<T>>{});
+      }
+      else {
+        sweep(::std::false_type{});
+      }
+    }
+  }
+}
+
+// C = beta * C + sum over t of alpha[t] * A[t] * B[t].  The products
+// share one pass over C: for each NC-column panel of C, the engine
+// runs through the K dimension of each product in turn, as if the
+// products were one GEMM with the A[t] side by side and the B[t]
+// stacked.  Terms with zero alpha are skipped.
+template<::std::size_t NumTerms, class T>
+void gemm_sum(const ::std::array<T, NumTerms>& alpha,
+              const ::std::array<strided_matrix_view<const T>, NumTerms>& A,
+              const ::std::array<strided_matrix_view<const T>, NumTerms>& B,
+              const T& beta,
+              strided_matrix_view<T> C)
+{
+  using blocking = gemm_blocking<T>;
+  constexpr ::std::ptrdiff_t mr = blocking::mr;
+  constexpr ::std::ptrdiff_t nr = blocking::nr;
+
+  const ::std::ptrdiff_t M = C.extent0;
+  const ::std::ptrdiff_t N = C.extent1;
+  if (M == 0 || N == 0) {
+    return;
+  }
+  ::std::ptrdiff_t K_max = 0;
+  for (::std::size_t t = 0; t < NumTerms; ++t) {
+    if (alpha[t] != T{}) {
+      K_max = ::std::max(K_max, A[t].extent1);
+    }
+  }
+  if (K_max == 0) {
+    if (beta != T{1}) {
+      scale_matrix(beta, C);
+    }
+    return;
+  }
+  if (N <= blocking::narrow_n) {
+    narrow_gemm_sum(alpha, A, B, beta, C, K_max);
+    return;
+  }
+
+  const ::std::ptrdiff_t mc_max = ::std::min(blocking::mc, (M + mr - 1) / mr * mr);
+  const ::std::ptrdiff_t nc_max = ::std::min(blocking::nc, (N + nr - 1) / nr * nr);
+  const ::std::ptrdiff_t kc_max = ::std::min(blocking::kc, K_max);
+  ::std::vector<T> A_packed(mc_max * kc_max);
+  ::std::vector<T> B_packed(kc_max * nc_max);
+
+  for (::std::ptrdiff_t jc = 0; jc < N; jc += blocking::nc) {
+    const ::std::ptrdiff_t nc = ::std::min(blocking::nc, N - jc);
+    // Only the first pass over k applies the caller's beta;
+    // subsequent passes accumulate into C.
+    bool first_pass = true;
+
+    for (::std::size_t t = 0; t < NumTerms; ++t) {
+      if (alpha[t] == T{}) {
+        continue;
+      }
+      const ::std::ptrdiff_t K = A[t].extent1;
+      for (::std::ptrdiff_t pc = 0; pc < K; pc += blocking::kc) {
+        const ::std::ptrdiff_t kc = ::std::min(blocking::kc, K - pc);
+        const T beta_pass = first_pass ? beta : T{1};
+        first_pass = false;
+        pack_b(B[t].block(pc, jc, kc, nc), kc, nc, B_packed.data());
+
+        for (::std::ptrdiff_t ic = 0; ic < M; ic += blocking::mc) {
+          const ::std::ptrdiff_t mc = ::std::min(blocking::mc, M - ic);
+          pack_a(A[t].block(ic, pc, mc, kc), mc, kc, A_packed.data());
+
+          for (::std::ptrdiff_t jr = 0; jr < nc; jr += nr) {
+            const ::std::ptrdiff_t n = ::std::min(nr, nc - jr);
+            const T* B_panel = B_packed.data() + jr * kc;
+            for (::std::ptrdiff_t ir = 0; ir < mc; ir += mr) {
+              const ::std::ptrdiff_t m = ::std::min(mr, mc - ir);
+              micro_kernel(kc, A_packed.data() + ir * kc, B_panel,
+                alpha[t], beta_pass, C.block(ic + ir, jc + jr, m, n), m, n);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+} // end namespace blocked_gemm_detail
+
+// C = beta * C + alpha * A * B, with A: M x K, B: K x N, C: M x N.
+// If beta is zero, C is overwritten and its input values are not read.
+// C must not alias A or B.
+template<class T>
+void blocked_gemm(const T& alpha,
+                  strided_matrix_view<const T> A,
+                  strided_matrix_view<const T> B,
+                  const T& beta,
+                  strided_matrix_view<T> C)
+{
+  blocked_gemm_detail::gemm_sum<1>({alpha}, {A}, {B}, beta, C);
+}
+
+// C = beta * C + alpha1 * A1 * B1 + alpha2 * A2 * B2, fused into one
+// pass over C.  A1 and A2 have the same number of rows, B1 and B2 the
+// same number of columns, and their inner dimensions may differ.
+template<class T>
+void blocked_gemm_sum(const T& alpha1,
+                      strided_matrix_view<const T> A1,
+                      strided_matrix_view<const T> B1,
+                      const T& alpha2,
+                      strided_matrix_view<const T> A2,
+                      strided_matrix_view<const T> B2,
+                      const T& beta,
+                      strided_matrix_view<T> C)
+{
+  blocked_gemm_detail::gemm_sum<2>({alpha1, alpha2}, {A1, A2}, {B1, B2}, beta, C);
+}
+
+} // end namespace impl
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_GEMM_HPP_
@@ -0,0 +1,324 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_GEMV_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_GEMV_HPP_
+
+#include "blocked_gemm.hpp"
+#include "fixed_size_kernels.hpp"
+#include "simd_reductions.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+namespace impl {
+
+// Blocked matrix-vector product (GEMV).  matrix_vector_product uses
+// it for strided matrices and vectors whose accessors are
+// default_accessor, possibly wrapped in scaled_accessor and
+// conjugated_accessor, all of the same value_type.
+//
+// The engine walks A in the order of its storage.  If A's columns
+// are contiguous (layout_left), it sweeps down RT columns at a time
+// and adds each column times its x entry into a block of y, as a
+// sequence of fused AXPYs.  If A's rows are contiguous
+// (layout_right), it takes the dot products of RT rows at a time
+// with x.  Either way, every load of x (or of the partial sums of y)
+// serves RT entries of A, and the RT sums are independent, so they
+// do not wait on each other's floating-point latency.
+//
+// The partial sums live in a block of MB entries of y, which stays
+// in L1 while the column sweep streams through A.  The row sweep
+// also cuts x into blocks of NB entries, so that the part of x that
+// the rows reuse stays in L1.  x is first copied into a contiguous
+// buffer, multiplied by the scaling factors and conjugated as
+// needed, so that the inner loops see neither.
+//
+// Like the packed matrix_product engine, this reorders the sums, so
+// results may differ from the generic loops' in the last bits.
+
+template<class T>
+struct gemv_blocking {
+  // Entries of the partial sums of y, and of x in the row sweep.
+  static constexpr ::std::ptrdiff_t mb =
+    ::std::max(::std::ptrdiff_t(4096 / sizeof(T)), ::std::ptrdiff_t(1));
+  static constexpr ::std::ptrdiff_t nb = mb;
+  // Columns (column sweep) or rows (row sweep) per register tile.
+  static constexpr ::std::size_t rt = 4;
+};
+
+// A strided vector; the rank-1 counterpart of strided_matrix_view.
+template<class T>
+struct strided_vector_view {
+  T* data = nullptr;
+  ::std::ptrdiff_t extent = 0;
+  ::std::ptrdiff_t stride = 0;
+  bool conjugated = false;
+
+  T& operator()(::std::ptrdiff_t i) const {
+    return data[i * stride];
+  }
+
+  // View of entries [begin, begin + count).
+  strided_vector_view block(::std::ptrdiff_t begin, ::std::ptrdiff_t count) const {
+    return {data + begin * stride, count, stride, conjugated};
+  }
+
+  strided_vector_view<const T> as_const() const {
+    return {data, extent, stride, conjugated};
+  }
+};
+
+template<class ElementType, class Extents, class Layout, class Accessor>
+strided_vector_view<ElementType>
+make_strided_vector_view(const mdspan<ElementType, Extents, Layout, Accessor>& x)
+{
+  strided_vector_view<ElementType> view;
+  view.data = x.data_handle();
+  view.extent = static_cast<::std::ptrdiff_t>(x.extent(0));
+  if (view.extent != 0) {
+    view.data += x.mapping()(0);
+    view.stride = static_cast<::std::ptrdiff_t>(x.stride(0));
+  }
+  view.conjugated = extractConj<mdspan<ElementType, Extents, Layout, Accessor>>();
+  return view;
+}
+
+// Can y = A * x go through the engine?  A's and x's scaling factors
+// and conjugations are peeled off as for matrix_product.  y is
+// written through data_handle().
+template<class A_t, class x_t, class y_t>
+inline constexpr bool is_gemv_blockable_v =
+  is_gemm_peelable_matrix_v<A_t> &&
+  is_simd_peelable_vector_v<x_t> &&
+  is_simd_reducible_vector_v<y_t> &&
+  ! std::is_const_v<typename y_t::element_type> &&
+  std::is_same_v<typename A_t::value_type, typename y_t::value_type> &&
+  std::is_same_v<typename x_t::value_type, typename y_t::value_type>;
+
+namespace blocked_gemv_detail {
+
+// acc[i] += A(i,:) * x, column by column.
+template<bool ConjA, bool UnitStride, class T>
+void column_sweep(strided_matrix_view<const T> A, const T* x, T* acc)
+{
+  constexpr ::std::size_t rt = gemv_blocking<T>::rt;
+  const ::std::ptrdiff_t m = A.extent0;
+  const ::std::ptrdiff_t n = A.extent1;
+  const ::std::ptrdiff_t stride = UnitStride ? 1 : A.stride0;
+  using blocked_gemm_detail::packed_value;
+
+  ::std::ptrdiff_t j = 0;
+  for (; j + ::std::ptrdiff_t(rt) <= n; j += rt) {
+    T x_reg[rt];
+    const T* A_col[rt];
+    unrolled_for<rt>([&] (auto c) {
+      x_reg[c] = x[j + ::std::ptrdiff_t(c)];
+      A_col[c] = A.data + (j + ::std::ptrdiff_t(c)) * A.stride1;
+    });
+    for (::std::ptrdiff_t i = 0; i < m; ++i) {
+      T sum = acc[i];
+      unrolled_for<rt>([&] (auto c) {
+        sum += packed_value<ConjA>(A_col[c][i * stride]) * x_reg[c];
+      });
+      acc[i] = sum;
+    }
+  }
+  for (; j < n; ++j) {
+    const T x_j = x[j];
+    const T* A_col = A.data + j * A.stride1;
+    for (::std::ptrdiff_t i = 0; i < m; ++i) {
+      acc[i] += packed_value<ConjA>(A_col[i * stride]) * x_j;
+    }
+  }
+}
+
+// acc[i] += A(i,:) * x, row by row.
+template<bool ConjA, bool UnitStride, class T>
+void row_sweep(strided_matrix_view<const T> A, const T* x, T* acc)
+{
+  constexpr ::std::size_t rt = gemv_blocking<T>::rt;
+  const ::std::ptrdiff_t m = A.extent0;
+  const ::std::ptrdiff_t n = A.extent1;
+  const ::std::ptrdiff_t stride = UnitStride ? 1 : A.stride1;
+  using blocked_gemm_detail::packed_value;
+
+  ::std::ptrdiff_t i = 0;
+  for (; i + ::std::ptrdiff_t(rt) <= m; i += rt) {
+    T sum[rt] = {};
+    const T* A_row[rt];
+    unrolled_for<rt>([&] (auto r) { A_row[r] = A.data + (i + ::std::ptrdiff_t(r)) * A.stride0; });
+    for (::std::ptrdiff_t j = 0; j < n; ++j) {
+      const T x_j = x[j];
+      unrolled_for<rt>([&] (auto r) {
+        sum[r] += packed_value<ConjA>(A_row[r][j * stride]) * x_j;
+      });
+    }
+    unrolled_for<rt>([&] (auto r) { acc[i + ::std::ptrdiff_t(r)] += sum[r]; });
+  }
+  for (; i < m; ++i) {
+    T sum{};
+    const T* A_row = A.data + i * A.stride0;
+    for (::std::ptrdiff_t j = 0; j < n; ++j) {
+      sum += packed_value<ConjA>(A_row[j * stride]) * x[j];
+    }
+    acc[i] += sum;
+  }
+}
+
+template<bool ConjA, class T>
+void accumulate(strided_matrix_view<const T> A, const T* x, T* acc)
+{
+  constexpr ::std::ptrdiff_t nb = gemv_blocking<T>::nb;
+  if (A.columns_contiguous()) {
+    if (A.stride0 == 1) {
+      column_sweep<ConjA, true>(A, x, acc);
+    }
+    else {
+      column_sweep<ConjA, false>(A, x, acc);
+    }
+  }
+  else {
+    for (::std::ptrdiff_t j0 = 0; j0 < A.extent1; j0 += nb) {
+      const auto A_block = A.block(0, j0, A.extent0, ::std::min(nb, A.extent1 - j0));
+      if (A.stride1 == 1) {
+        row_sweep<ConjA, true>(A_block, x + j0, acc);
+      }
+      else {
+        row_sweep<ConjA, false>(A_block, x + j0, acc);
+      }
+    }
+  }
+}
+
+} // end namespace blocked_gemv_detail
+
+// alpha * x, conjugated if x is, in a contiguous buffer.
+template<class T>
+::std::vector<T> pack_gemv_x(const T& alpha, strided_vector_view<const T> x)
+{
+  ::std::vector<T> x_packed(x.extent);
+  for (::std::ptrdiff_t j = 0; j < x.extent; ++j) {
+    x_packed[j] = alpha * (x.conjugated ? T(conj_if_needed(x(j))) : x(j));
+  }
+  return x_packed;
+}
+
+// acc[i] += (A * x_packed)[i] for i in [0, A.extent0), where x_packed
+// comes from pack_gemv_x.
+template<class T>
+void gemv_accumulate(strided_matrix_view<const T> A, const T* x_packed, T* acc)
+{
+  if (A.extent0 == 0 || A.extent1 == 0) {
+    return;
+  }
+  if (is_complex_v<T> && A.conjugated) {
+    blocked_gemv_detail::accumulate<true>(A, x_packed, acc);
+  }
+  else {
+    blocked_gemv_detail::accumulate<false>(A, x_packed, acc);
+  }
+}
+
+// y(i) = start(i) + alpha * (A * x)(i).  start(i) is read after
+// everything else in row i, so it may read y(i).  y must not overlap
+// A or x.
+template<class T, class Start>
+void blocked_gemv(const T& alpha,
+                  strided_matrix_view<const T> A,
+                  strided_vector_view<const T> x,
+                  strided_vector_view<T> y,
+                  const Start& start)
+{
+  constexpr ::std::ptrdiff_t mb = gemv_blocking<T>::mb;
+  const ::std::ptrdiff_t m = A.extent0;
+  if (m == 0) {
+    return;
+  }
+  const ::std::vector<T> x_packed = pack_gemv_x(alpha, x);
+  ::std::vector<T> acc(::std::min(mb, m));
+  for (::std::ptrdiff_t i0 = 0; i0 < m; i0 += mb) {
+    const ::std::ptrdiff_t ib = ::std::min(mb, m - i0);
+    ::std::fill(acc.begin(), acc.begin() + ib, T{});
+    gemv_accumulate(A.block(i0, 0, ib, A.extent1), x_packed.data(), acc.data());
+    for (::std::ptrdiff_t i = 0; i < ib; ++i) {
+      y(i0 + i) = static_cast<T>(start(i0 + i)) + acc[i];
+    }
+  }
+}
+
+// The mdspan interface of blocked_gemv, for rows [row_begin, row_end)
+// of y: y(i) = start(i) + (A * x)(i), with A's and x's scaling
+// factors and conjugations peeled off.  The parallel overloads call
+// this on disjoint ranges of rows.
+template<class A_t, class x_t, class y_t, class Start>
+void blocked_gemv_rows(A_t A, x_t x, y_t y, const Start& start,
+                       ::std::ptrdiff_t row_begin, ::std::ptrdiff_t row_end)
+{
+  using T = typename y_t::value_type;
+  const T alpha = extractScalingFactor(A) * extractScalingFactor(x);
+  const auto A_view = make_strided_matrix_view(A).as_const();
+  const ::std::ptrdiff_t count = row_end - row_begin;
+  blocked_gemv(alpha, A_view.block(row_begin, 0, count, A_view.extent1),
+    make_strided_vector_view(x).as_const(),
+    make_strided_vector_view(y).block(row_begin, count),
+    [&] (::std::ptrdiff_t i) { return start(row_begin + i); });
+}
+
+// A * x restricted to columns [col_begin, col_end) of A, as a
+// vector of A.extent(0) partial sums.  The parallel overloads sum
+// these over disjoint ranges of columns when A has too few rows to
+// split.
+template<class A_t, class x_t>
+::std::vector<typename A_t::value_type>
+gemv_column_partial(A_t A, x_t x, ::std::ptrdiff_t col_begin, ::std::ptrdiff_t col_end)
+{
+  using T = typename A_t::value_type;
+  const T alpha = extractScalingFactor(A) * extractScalingFactor(x);
+  const auto A_view = make_strided_matrix_view(A).as_const();
+  const ::std::ptrdiff_t count = col_end - col_begin;
+  const ::std::vector<T> x_packed =
+    pack_gemv_x(alpha, make_strided_vector_view(x).as_const().block(col_begin, count));
+  ::std::vector<T> partial(A_view.extent0);
+  gemv_accumulate(A_view.block(0, col_begin, A_view.extent0, count),
+    x_packed.data(), partial.data());
+  return partial;
+}
+
+// Should a parallel y = A * x split A's columns (and add up per-chunk
+// partial results) instead of its rows?  Only if A is wider than it is
+// tall, and its rows make fewer than 16 chunks of row_min_chunk rows,
+// too few to keep the workers busy.
+inline bool gemv_split_columns(::std::ptrdiff_t num_rows, ::std::ptrdiff_t num_cols,
+                               ::std::size_t row_min_chunk)
+{
+  return num_rows < num_cols &&
+    ::std::size_t(num_rows) < 16 * row_min_chunk;
+}
+
+} // end namespace impl
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_GEMV_HPP_
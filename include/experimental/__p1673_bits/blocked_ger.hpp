@@ -0,0 +1,229 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_GER_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_GER_HPP_
+
+#include "blocked_gemv.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+namespace impl {
+
+// Blocked rank-1 update (GER and GERC).  matrix_rank_1_update and
+// matrix_rank_1_update_c use it for strided matrices whose accessor
+// is default_accessor, and for vectors that the blocked GEMV engine
+// takes as x, so conjugated(y) peels off like a scaling factor.
+//
+// x and y are first copied into contiguous buffers, with their
+// scaling factors and conjugations applied.  The engine then walks A
+// in the order of its storage: if A's rows are contiguous, it
+// updates A's transpose with the roles of x and y swapped, so that
+// it always goes down contiguous columns.  It takes RT columns at a
+// time, so that each load of x serves RT entries of A, with the RT
+// entries of y in registers, and cuts the columns into blocks of MB
+// rows, so that the block of x stays in L1.  For float and double,
+// unit-stride columns go through a vector kernel.  Each entry of A
+// still gets one product x(i) * y(j) added to its start value, but
+// the vector kernel may fuse the multiply and add, and a scaling
+// factor of x or y may round differently, so results may differ from
+// the generic loops' in the last bits.
+//
+// Every column of A is independent, so the parallel overloads split
+// A's columns (or its rows, if they are contiguous) among threads.
+
+// Can A = E + x * y^T (or A = x * y^T) go through the engine?
+template<class x_t, class y_t, class A_t>
+inline constexpr bool is_ger_blockable_v =
+  is_simd_peelable_vector_v<x_t> &&
+  is_simd_peelable_vector_v<y_t> &&
+  is_gemm_packable_matrix_v<A_t> &&
+  ! std::is_const_v<typename A_t::element_type> &&
+  std::is_same_v<typename x_t::value_type, typename A_t::value_type> &&
+  std::is_same_v<typename y_t::value_type, typename A_t::value_type>;
+
+// A rank-1 update's operands, with x and y packed and A (and E)
+// transposed if needed, so that A's columns are its contiguous
+// direction.  The update is A(i,j) = E(i,j) + x[i] * y[j].
+// transposed says whether A and E were transposed, and so x and y
+// swapped.
+template<class T>
+struct ger_operands {
+  ::std::vector<T> x;
+  ::std::vector<T> y;
+  strided_matrix_view<const T> E;
+  strided_matrix_view<T> A;
+  bool transposed = false;
+};
+
+template<class x_t, class y_t, class A_t, class T>
+ger_operands<T> make_ger_operands(x_t x, y_t y, strided_matrix_view<const T> E, A_t A)
+{
+  ger_operands<T> op;
+  op.x = pack_gemv_x(T(extractScalingFactor(x)), make_strided_vector_view(x).as_const());
+  op.y = pack_gemv_x(T(extractScalingFactor(y)), make_strided_vector_view(y).as_const());
+  op.E = E;
+  op.A = make_strided_matrix_view(A);
+  if (! op.A.columns_contiguous()) {
+    op.A = op.A.transposed();
+    op.E = op.E.transposed();
+    op.x.swap(op.y);
+    op.transposed = true;
+  }
+  return op;
+}
+
+namespace blocked_ger_detail {
+
+#if defined(LINALG_HAS_SIMD_REDUCTIONS)
+// Rows [i_begin, i_end) of W unit-stride columns: A_col[c][i] =
+// E_col[c][i] + x[i] * y_col[c], or x[i] * y_col[c] if Overwrite.
+// Each vector of x is loaded once for the W columns, and the W
+// entries of y stay in vector registers.
+template<bool Overwrite, ::std::size_t W>
+struct ger_columns_kernel {
+  template<::std::size_t Bytes, class T>
+  [[gnu::always_inline]] static inline void
+  run(T* const* A_col, const T* const* E_col, const T* y_col, const T* x,
+      ::std::ptrdiff_t i_begin, ::std::ptrdiff_t i_end)
+  {
+    using V = simd_vector_t<T, Bytes>;
+    constexpr ::std::ptrdiff_t L = Bytes / sizeof(T);
+    V y_c[W];
+    unrolled_for<W>([&] (auto c) { y_c[c] = V{} + y_col[c]; });
+    V x_i, a;
+    ::std::ptrdiff_t i = i_begin;
+    for (; i + L <= i_end; i += L) {
+      simd_load(x_i, x + i);
+      unrolled_for<W>([&] (auto c) {
+        if constexpr (Overwrite) {
+          a = x_i * y_c[c];
+        }
+        else {
+          simd_load(a, E_col[c] + i);
+          a += x_i * y_c[c];
+        }
+        __builtin_memcpy(A_col[c] + i, &a, sizeof(V));
+      });
+    }
+    for (; i < i_end; ++i) {
+      unrolled_for<W>([&] (auto c) {
+        if constexpr (Overwrite) {
+          A_col[c][i] = x[i] * y_col[c];
+        }
+        else {
+          A_col[c][i] = E_col[c][i] + x[i] * y_col[c];
+        }
+      });
+    }
+  }
+};
+#endif // LINALG_HAS_SIMD_REDUCTIONS
+
+// Columns [j_begin, j_end) of op.A, rows [i_begin, i_end).  If
+// Overwrite, E is not read, and A(i,j) = x[i] * y[j].
+template<bool Overwrite, bool UnitStride, class T>
+void update_block(const ger_operands<T>& op,
+                  ::std::ptrdiff_t i_begin, ::std::ptrdiff_t i_end,
+                  ::std::ptrdiff_t j_begin, ::std::ptrdiff_t j_end)
+{
+  constexpr ::std::size_t rt = gemv_blocking<T>::rt;
+  const ::std::ptrdiff_t A_stride = UnitStride ? 1 : op.A.stride0;
+  const ::std::ptrdiff_t E_stride = UnitStride ? 1 : op.E.stride0;
+  const T* x = op.x.data();
+
+  auto columns = [&] (auto width, ::std::ptrdiff_t j) {
+    constexpr ::std::size_t w = decltype(width)::value;
+    T y_reg[w];
+    T* A_col[w];
+    const T* E_col[w];
+    unrolled_for<w>([&] (auto c) {
+      y_reg[c] = op.y[j + ::std::ptrdiff_t(c)];
+      A_col[c] = op.A.data + (j + ::std::ptrdiff_t(c)) * op.A.stride1;
+      E_col[c] = op.E.data + (j + ::std::ptrdiff_t(c)) * op.E.stride1;
+    });
+#if defined(LINALG_HAS_SIMD_REDUCTIONS)
+    if constexpr (UnitStride && is_simd_reduction_value_v<T>) {
+      simd_reduce<ger_columns_kernel<Overwrite, w>>(A_col, E_col, y_reg, x, i_begin, i_end);
+      return;
+    }
+#endif
+    for (::std::ptrdiff_t i = i_begin; i < i_end; ++i) {
+      const T x_i = x[i];
+      unrolled_for<w>([&] (auto c) {
+        if constexpr (Overwrite) {
+          A_col[c][i * A_stride] = x_i * y_reg[c];
+        }
+        else {
+          A_col[c][i * A_stride] = E_col[c][i * E_stride] + x_i * y_reg[c];
+        }
+      });
+    }
+  };
+  ::std::ptrdiff_t j = j_begin;
+  for (; j + ::std::ptrdiff_t(rt) <= j_end; j += rt) {
+    columns(::std::integral_constant<::std::size_t, rt>{}, j);
+  }
+  for (; j < j_end; ++j) {
+    columns(::std::integral_constant<::std::size_t, 1>{}, j);
+  }
+}
+
+} // end namespace blocked_ger_detail
+
+// Update columns [j_begin, j_end) of op.A.  If Overwrite, set them to
+// x * y^T without reading op.E.
+template<bool Overwrite, class T>
+void ger_update_columns(const ger_operands<T>& op,
+                        ::std::ptrdiff_t j_begin, ::std::ptrdiff_t j_end)
+{
+  constexpr ::std::ptrdiff_t mb = gemv_blocking<T>::mb;
+  const ::std::ptrdiff_t m = op.A.extent0;
+  const bool unit_stride = op.A.stride0 == 1 && (Overwrite || op.E.stride0 == 1);
+  for (::std::ptrdiff_t i0 = 0; i0 < m; i0 += mb) {
+    const ::std::ptrdiff_t i1 = ::std::min(i0 + mb, m);
+    if (unit_stride) {
+      blocked_ger_detail::update_block<Overwrite, true>(op, i0, i1, j_begin, j_end);
+    }
+    else {
+      blocked_ger_detail::update_block<Overwrite, false>(op, i0, i1, j_begin, j_end);
+    }
+  }
+}
+
+// A = E + x * y^T, or A = x * y^T if Overwrite (E is then not read).
+// E may be A itself, but must not otherwise overlap it.
+template<bool Overwrite, class x_t, class y_t, class A_t, class T>
+void blocked_ger(x_t x, y_t y, strided_matrix_view<const T> E, A_t A)
+{
+  const ger_operands<T> op = make_ger_operands(x, y, E, A);
+  ger_update_columns<Overwrite>(op, 0, op.A.extent1);
+}
+
+} // end namespace impl
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_GER_HPP_
@@ -0,0 +1,263 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_SYMM_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_SYMM_HPP_
+
+#include "blocked_gemm.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+namespace impl {
+
+// Blocked symmetric and Hermitian matrix-matrix product (SYMM and
+// HEMM).  symmetric_matrix_product and hermitian_matrix_product use
+// it for the same mdspan that the packed matrix_product engine takes.
+// For a left product with A's lower triangle stored, block row I of
+// C = A * B is
+//
+//   C_I = A(I, 0:I) * B(0:I, :) + D_I * B(I, :) + A(I+1:n, I)^T * B(I+1:n, :),
+//
+// where D_I is A's diagonal block I, expanded from its lower
+// triangle into a full matrix, and ^T is the conjugate transpose if
+// A is Hermitian.  The first and last terms read A's stored triangle
+// in place, and go to blocked_gemm.  Only the diagonal blocks, about
+// nb / n of A, are copied, each once.
+//
+// A's upper triangle is the lower triangle of A^T, which is A if A
+// is symmetric and conj(A) if A is Hermitian.  A right product
+// C = B * A is the left product C^T = A^T * B^T.  Both reduce to the
+// above by transposing and conjugating views.
+//
+// The columns of C (for a left product) are independent, so callers
+// can compute blocks of columns in parallel.
+
+template<class T>
+struct symm_blocking {
+  // Rows in each diagonal block; one block of the GEMM engine.
+  static constexpr ::std::ptrdiff_t nb = gemm_blocking<T>::mc;
+};
+
+// Can C = A * B, with symmetric or Hermitian A, go through the
+// blocked engine?  B's scaling factor and conjugation are peeled off
+// as for matrix_product.  A's are not: conjugating a Hermitian
+// matrix's stored triangle by a complex scaling factor does not
+// conjugate the factor.
+template<class A_t, class B_t, class C_t>
+inline constexpr bool is_symm_blockable_v =
+  is_gemm_packable_matrix_v<A_t> &&
+  is_gemm_peelable_product_v<A_t, B_t, C_t>;
+
+namespace blocked_symm_detail {
+
+// D = the full matrix whose lower triangle is L's, and whose strict
+// upper triangle is its transpose (conjugate transpose if
+// Hermitian).  A Hermitian matrix's diagonal is real.
+template<bool Hermitian, class T>
+void expand_diagonal_block(strided_matrix_view<const T> L, strided_matrix_view<T> D)
+{
+  const bool conjugate = is_complex_v<T> && L.conjugated;
+  auto stored = [&] (::std::ptrdiff_t i, ::std::ptrdiff_t j) {
+    return conjugate ? T(conj_if_needed(L(i,j))) : L(i,j);
+  };
+  const ::std::ptrdiff_t n = L.extent0;
+  for (::std::ptrdiff_t j = 0; j < n; ++j) {
+    for (::std::ptrdiff_t i = 0; i < j; ++i) {
+      if constexpr (Hermitian) {
+        D(i,j) = T(conj_if_needed(stored(j,i)));
+      }
+      else {
+        D(i,j) = stored(j,i);
+      }
+    }
+    if constexpr (Hermitian) {
+      D(j,j) = T(real_if_needed(stored(j,j)));
+    }
+    else {
+      D(j,j) = stored(j,j);
+    }
+    for (::std::ptrdiff_t i = j + 1; i < n; ++i) {
+      D(i,j) = stored(i,j);
+    }
+  }
+}
+
+// C = beta * C + alpha * A * B, where A is the symmetric (or
+// Hermitian) matrix whose lower triangle L stores.
+template<bool Hermitian, class T>
+void left_lower(const T& alpha,
+                strided_matrix_view<const T> L,
+                strided_matrix_view<const T> B,
+                const T& beta,
+                strided_matrix_view<T> C)
+{
+  constexpr ::std::ptrdiff_t nb = symm_blocking<T>::nb;
+  const ::std::ptrdiff_t n = L.extent0;
+  const ::std::ptrdiff_t num_cols = C.extent1;
+
+  const ::std::ptrdiff_t nb_max = ::std::min(nb, n);
+  ::std::vector<T> D_storage(nb_max * nb_max);
+
+  for (::std::ptrdiff_t i0 = 0; i0 < n; i0 += nb) {
+    const ::std::ptrdiff_t ib = ::std::min(nb, n - i0);
+    const ::std::ptrdiff_t i1 = i0 + ib;
+    const auto C_I = C.block(i0, 0, ib, num_cols);
+
+    // Only the first term applies the caller's beta.
+    T beta_I = beta;
+    if (i0 > 0) {
+      blocked_gemm(alpha, L.block(i0, 0, ib, i0), B.block(0, 0, i0, num_cols), beta_I, C_I);
+      beta_I = T(1);
+    }
+
+    const strided_matrix_view<T> D{D_storage.data(), ib, ib, 1, ib};
+    expand_diagonal_block<Hermitian>(L.block(i0, i0, ib, ib), D);
+    blocked_gemm(alpha, D.as_const(), B.block(i0, 0, ib, num_cols), beta_I, C_I);
+
+    if (i1 < n) {
+      auto L_below = L.block(i1, i0, n - i1, ib).transposed();
+      L_below.conjugated = L_below.conjugated != Hermitian;
+      blocked_gemm(alpha, L_below, B.block(i1, 0, n - i1, num_cols), T(1), C_I);
+    }
+  }
+}
+
+// The stored triangle of A, as a lower triangle.
+template<bool Hermitian, class Triangle, class T>
+strided_matrix_view<const T> lower_triangle_view(strided_matrix_view<const T> A)
+{
+  if constexpr (std::is_same_v<Triangle, upper_triangle_t>) {
+    auto L = A.transposed();
+    L.conjugated = L.conjugated != Hermitian;
+    return L;
+  }
+  else {
+    return A;
+  }
+}
+
+} // end namespace blocked_symm_detail
+
+// C = beta * C + alpha * A * B, where A is symmetric (or Hermitian)
+// and Triangle says which of its triangles is stored.  If beta is
+// zero, C is overwritten and its input values are not read.  C must
+// not overlap A or B.
+template<bool Hermitian, class Triangle, class T>
+void blocked_symm_left(const T& alpha,
+                       strided_matrix_view<const T> A,
+                       strided_matrix_view<const T> B,
+                       const T& beta,
+                       strided_matrix_view<T> C)
+{
+  if (C.extent0 == 0 || C.extent1 == 0) {
+    return;
+  }
+  blocked_symm_detail::left_lower<Hermitian>(alpha,
+    blocked_symm_detail::lower_triangle_view<Hermitian, Triangle>(A), B, beta, C);
+}
+
+// C = beta * C + alpha * B * A, where A is symmetric (or Hermitian).
+template<bool Hermitian, class Triangle, class T>
+void blocked_symm_right(const T& alpha,
+                        strided_matrix_view<const T> A,
+                        strided_matrix_view<const T> B,
+                        const T& beta,
+                        strided_matrix_view<T> C)
+{
+  if (C.extent0 == 0 || C.extent1 == 0) {
+    return;
+  }
+  auto L = blocked_symm_detail::lower_triangle_view<Hermitian, Triangle>(A);
+  L.conjugated = L.conjugated != Hermitian;
+  blocked_symm_detail::left_lower<Hermitian>(alpha, L,
+    B.transposed(), beta, C.transposed());
+}
+
+// C = beta * C + A * B (if Side is left_side_t) or beta * C + B * A
+// (if right_side_t), where A is symmetric (Hermitian if Hermitian is
+// true), for columns [begin, end) of C (left) or rows [begin, end)
+// (right).  Those parts of C depend only on the same parts of B, so
+// the parallel overloads call this on disjoint ranges.
+template<bool Hermitian, class Triangle, class Side,
+         class A_t, class B_t, class C_t>
+void blocked_symm_range(A_t A, B_t B, C_t C,
+                        const typename C_t::value_type& beta,
+                        ::std::ptrdiff_t begin, ::std::ptrdiff_t end)
+{
+  const auto A_view = make_strided_matrix_view(A).as_const();
+  const auto B_view = make_strided_matrix_view(B).as_const();
+  const auto C_view = make_strided_matrix_view(C);
+  const ::std::ptrdiff_t count = end - begin;
+  if constexpr (std::is_same_v<Side, left_side_t>) {
+    blocked_symm_left<Hermitian, Triangle>(extractScalingFactor(B), A_view,
+      B_view.block(0, begin, B_view.extent0, count), beta,
+      C_view.block(0, begin, C_view.extent0, count));
+  }
+  else {
+    blocked_symm_right<Hermitian, Triangle>(extractScalingFactor(B), A_view,
+      B_view.block(begin, 0, count, B_view.extent1), beta,
+      C_view.block(begin, 0, count, C_view.extent1));
+  }
+}
+
+// The overwriting symmetric_matrix_product and
+// hermitian_matrix_product, C = A * B or B * A, for the same part of
+// C as blocked_symm_range.
+template<bool Hermitian, class Triangle, class Side,
+         class A_t, class B_t, class C_t>
+void blocked_symm_product(A_t A, B_t B, C_t C,
+                          ::std::ptrdiff_t begin, ::std::ptrdiff_t end)
+{
+  blocked_symm_range<Hermitian, Triangle, Side>(A, B, C,
+    typename C_t::value_type{}, begin, end);
+}
+
+// As above, for the updating overloads: C = E + A * B or E + B * A.
+// E may alias C, so this copies E's part first, then accumulates.
+template<bool Hermitian, class Triangle, class Side,
+         class A_t, class B_t, class E_t, class C_t>
+void blocked_symm_product(A_t A, B_t B, E_t E, C_t C,
+                          ::std::ptrdiff_t begin, ::std::ptrdiff_t end)
+{
+  using index_type = typename C_t::index_type;
+  const bool left = std::is_same_v<Side, left_side_t>;
+  const index_type i_begin = left ? index_type(0) : index_type(begin);
+  const index_type i_end = left ? C.extent(0) : index_type(end);
+  const index_type j_begin = left ? index_type(begin) : index_type(0);
+  const index_type j_end = left ? index_type(end) : C.extent(1);
+  for (index_type j = j_begin; j < j_end; ++j) {
+    for (index_type i = i_begin; i < i_end; ++i) {
+      C(i,j) = E(i,j);
+    }
+  }
+  blocked_symm_range<Hermitian, Triangle, Side>(A, B, C,
+    typename C_t::value_type(1), begin, end);
+}
+
+} // end namespace impl
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_SYMM_HPP_
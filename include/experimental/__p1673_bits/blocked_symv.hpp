@@ -0,0 +1,333 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_SYMV_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_SYMV_HPP_
+
+#include "blocked_gemv.hpp"
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+namespace impl {
+
+// Blocked symmetric and Hermitian matrix-vector product (SYMV and
+// HEMV).  symmetric_matrix_vector_product and
+// hermitian_matrix_vector_product use it for strided matrices whose
+// accessor is default_accessor, and for the vectors that the blocked
+// GEMV engine takes.
+//
+// The engine reads each stored element A(i,j) of the triangle once,
+// and uses it both for y(i) += A(i,j) * x(j) and for
+// y(j) += A(j,i) * x(i).  It walks the triangle RT columns at a time,
+// down the part of the columns below (or above) their diagonal block.
+// Each row of that part loads x(i) and y(i) once for RT entries of A,
+// and the RT sums for y(j) stay in registers until the columns are
+// done.  If A's rows are contiguous, the engine walks A's transpose
+// instead, whose stored triangle is the other one, so that it always
+// goes down contiguous columns.  For float and double, contiguous
+// columns are walked with the vector kernels of simd_reductions.hpp.
+//
+// The triangle's column groups are independent but for the sums they
+// add to y, so the parallel overloads give each task a range of
+// groups and its own partial y, and add the partial results in a
+// fixed order.
+//
+// The sums are ordered differently than in the generic loops, so the
+// results may differ in the last bits.
+
+// Can y = A * x, for symmetric or Hermitian A, go through the engine?
+// x's scaling factor and conjugation are peeled off as for GEMV.
+template<class A_t, class x_t, class y_t>
+inline constexpr bool is_symv_blockable_v =
+  is_gemm_packable_matrix_v<A_t> &&
+  is_simd_peelable_vector_v<x_t> &&
+  is_simd_reducible_vector_v<y_t> &&
+  ! std::is_const_v<typename y_t::element_type> &&
+  std::is_same_v<typename A_t::value_type, typename y_t::value_type> &&
+  std::is_same_v<typename x_t::value_type, typename y_t::value_type>;
+
+namespace blocked_symv_detail {
+
+template<bool Hermitian, class T>
+T mirrored_value(const T& a)
+{
+  if constexpr (Hermitian) {
+    return conj_if_needed(a);
+  }
+  else {
+    return a;
+  }
+}
+
+// v[0] + ... + v[Count - 1], added as a balanced tree.
+template<::std::size_t Count, class T>
+T pairwise_sum(const T* v)
+{
+  if constexpr (Count == 1) {
+    return v[0];
+  }
+  else {
+    return pairwise_sum<Count / 2>(v) + pairwise_sum<Count - Count / 2>(v + Count / 2);
+  }
+}
+
+#if defined(LINALG_HAS_SIMD_REDUCTIONS)
+// acc[i] += sum over c of A_col[c][i] * x_col[c], and
+// sum[c] += sum over i of A_col[c][i] * x[i], for i in
+// [i_begin, i_end), with real T and contiguous columns.  This is the
+// part of fixed_width_column_group below (or above) the diagonal
+// block.  Each vector of rows loads x and acc once for its W columns,
+// and the W sums stay in vector registers; see simd_reductions.hpp
+// for how simd_reduce picks the vector width.
+template<::std::size_t W>
+struct symv_rows_kernel {
+  template<::std::size_t Bytes, class T>
+  [[gnu::always_inline]] static inline void
+  run(const T* const* A_col, const T* x_col, const T* x, T* acc,
+      ::std::ptrdiff_t i_begin, ::std::ptrdiff_t i_end, T* sum)
+  {
+    using V = simd_vector_t<T, Bytes>;
+    constexpr ::std::ptrdiff_t L = Bytes / sizeof(T);
+    V x_c[W];
+    V sum_c[W] = {};
+    unrolled_for<W>([&] (auto c) { x_c[c] = V{} + x_col[c]; });
+    V x_i, y_i, a;
+    ::std::ptrdiff_t i = i_begin;
+    for (; i + L <= i_end; i += L) {
+      simd_load(x_i, x + i);
+      simd_load(y_i, acc + i);
+      unrolled_for<W>([&] (auto c) {
+        simd_load(a, A_col[c] + i);
+        y_i += a * x_c[c];
+        sum_c[c] += a * x_i;
+      });
+      __builtin_memcpy(acc + i, &y_i, sizeof(V));
+    }
+    unrolled_for<W>([&] (auto c) { sum[c] += simd_sum<T>(sum_c[c]); });
+    for (; i < i_end; ++i) {
+      unrolled_for<W>([&] (auto c) {
+        acc[i] += A_col[c][i] * x_col[c];
+        sum[c] += A_col[c][i] * x[i];
+      });
+    }
+  }
+};
+#endif // LINALG_HAS_SIMD_REDUCTIONS
+
+// acc += the contributions of the stored triangle's entries in
+// columns [j0, j0 + W) of A, which is n x n.  Lower selects the
+// stored triangle; ConjA says to use the conjugates of the stored
+// elements.
+template<bool Hermitian, bool Lower, bool ConjA, bool UnitStride, ::std::size_t W, class T>
+void fixed_width_column_group(strided_matrix_view<const T> A, const T* x, T* acc, ::std::ptrdiff_t j0)
+{
+  using blocked_gemm_detail::packed_value;
+  const ::std::ptrdiff_t n = A.extent0;
+  const ::std::ptrdiff_t stride = UnitStride ? 1 : A.stride0;
+  constexpr ::std::ptrdiff_t w = W;
+
+  // The W x W block on the diagonal.
+  for (::std::ptrdiff_t c = 0; c < w; ++c) {
+    const ::std::ptrdiff_t j = j0 + c;
+    const T* A_col = A.data + j * A.stride1;
+    const T a_jj = packed_value<ConjA>(A_col[j * stride]);
+    if constexpr (Hermitian) {
+      acc[j] += real_if_needed(a_jj) * x[j];
+    }
+    else {
+      acc[j] += a_jj * x[j];
+    }
+    const ::std::ptrdiff_t r_begin = Lower ? c + 1 : 0;
+    const ::std::ptrdiff_t r_end = Lower ? w : c;
+    for (::std::ptrdiff_t r = r_begin; r < r_end; ++r) {
+      const ::std::ptrdiff_t i = j0 + r;
+      const T a = packed_value<ConjA>(A_col[i * stride]);
+      acc[i] += a * x[j];
+      acc[j] += mirrored_value<Hermitian>(a) * x[i];
+    }
+  }
+
+  // The rest of the columns' part of the triangle.  Real elements in
+  // contiguous columns go through symv_rows_kernel.  Otherwise, the
+  // loop takes two rows at a time: each row's W products are summed
+  // before they go into acc[i], and even and odd rows keep separate
+  // sums for y(j), so that no chain of dependent additions gets longer
+  // than one per row.
+  T x_reg[W];
+  T sum_even[W] = {};
+  T sum_odd[W] = {};
+  const T* A_col[W];
+  unrolled_for<W>([&] (auto c) {
+    x_reg[c] = x[j0 + ::std::ptrdiff_t(c)];
+    A_col[c] = A.data + (j0 + ::std::ptrdiff_t(c)) * A.stride1;
+  });
+  const ::std::ptrdiff_t i_begin = Lower ? j0 + w : 0;
+  const ::std::ptrdiff_t i_end = Lower ? n : j0;
+#if defined(LINALG_HAS_SIMD_REDUCTIONS)
+  if constexpr (UnitStride && is_simd_reduction_value_v<T>) {
+    simd_reduce<symv_rows_kernel<W>>(A_col, x_reg, x, acc, i_begin, i_end, sum_even);
+    unrolled_for<W>([&] (auto c) { acc[j0 + ::std::ptrdiff_t(c)] += sum_even[c]; });
+    return;
+  }
+#endif
+  auto row = [&] (::std::ptrdiff_t i, T* sum) {
+    const T x_i = x[i];
+    T prod[W];
+    unrolled_for<W>([&] (auto c) {
+      const T a = packed_value<ConjA>(A_col[c][i * stride]);
+      prod[c] = a * x_reg[c];
+      sum[c] += mirrored_value<Hermitian>(a) * x_i;
+    });
+    acc[i] += pairwise_sum<W>(prod);
+  };
+  ::std::ptrdiff_t i = i_begin;
+  for (; i + 1 < i_end; i += 2) {
+    row(i, sum_even);
+    row(i + 1, sum_odd);
+  }
+  if (i < i_end) {
+    row(i, sum_even);
+  }
+  unrolled_for<W>([&] (auto c) {
+    acc[j0 + ::std::ptrdiff_t(c)] += sum_even[c] + sum_odd[c];
+  });
+}
+
+// fixed_width_column_group for the group of RT columns with index g,
+// or fewer if it is the last group.
+template<bool Hermitian, bool Lower, bool ConjA, bool UnitStride, class T>
+void column_group(strided_matrix_view<const T> A, const T* x, T* acc, ::std::ptrdiff_t g)
+{
+  constexpr ::std::size_t rt = gemv_blocking<T>::rt;
+  const ::std::ptrdiff_t j0 = g * ::std::ptrdiff_t(rt);
+  const ::std::ptrdiff_t w = ::std::min(::std::ptrdiff_t(rt), A.extent0 - j0);
+  unrolled_for<rt>([&] (auto c) {
+    if (w == ::std::ptrdiff_t(decltype(c)::value + 1)) {
+      fixed_width_column_group<Hermitian, Lower, ConjA, UnitStride, decltype(c)::value + 1>(
+        A, x, acc, j0);
+    }
+  });
+}
+
+} // end namespace blocked_symv_detail
+
+// Number of groups of RT columns in an n x n matrix.  The engine
+// pairs group g with group (num_groups - 1 - g); for a triangle, the
+// two together have about the same number of entries for every g.
+// Parallel overloads split the pairs into chunks of equal work.
+template<class T>
+::std::ptrdiff_t symv_num_pairs(::std::ptrdiff_t n)
+{
+  constexpr ::std::ptrdiff_t rt = gemv_blocking<T>::rt;
+  const ::std::ptrdiff_t num_groups = (n + rt - 1) / rt;
+  return (num_groups + 1) / 2;
+}
+
+// The contribution to A * x of the column groups in pairs
+// [pair_begin, pair_end), as a vector of A.extent(0) partial sums.
+// A is symmetric (Hermitian == false) or Hermitian, and stores the
+// Triangle triangle.
+template<bool Hermitian, class Triangle, class A_t, class x_t>
+::std::vector<typename A_t::value_type>
+symv_partial(A_t A, x_t x, ::std::ptrdiff_t pair_begin, ::std::ptrdiff_t pair_end)
+{
+  using T = typename A_t::value_type;
+  constexpr ::std::ptrdiff_t rt = gemv_blocking<T>::rt;
+  const ::std::ptrdiff_t n = A.extent(0);
+  const ::std::vector<T> x_packed =
+    pack_gemv_x(extractScalingFactor(x), make_strided_vector_view(x).as_const());
+  ::std::vector<T> acc(n);
+
+  // Walk down columns: if A's rows are contiguous, A's transpose
+  // stores the other triangle, and for Hermitian A it equals A's
+  // conjugate.
+  auto A_view = make_strided_matrix_view(A).as_const();
+  bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+  if (! A_view.columns_contiguous()) {
+    A_view = A_view.transposed();
+    lower = ! lower;
+    A_view.conjugated = A_view.conjugated != Hermitian;
+  }
+
+  auto sweep = [&] (auto lower_c, auto conj_c, auto unit_c) {
+    constexpr bool Lower = decltype(lower_c)::value;
+    constexpr bool ConjA = decltype(conj_c)::value;
+    constexpr bool UnitStride = decltype(unit_c)::value;
+    const ::std::ptrdiff_t num_groups = (n + rt - 1) / rt;
+    for (::std::ptrdiff_t p = pair_begin; p < pair_end; ++p) {
+      blocked_symv_detail::column_group<Hermitian, Lower, ConjA, UnitStride>(
+        A_view, x_packed.data(), acc.data(), p);
+      if (num_groups - 1 - p != p) {
+        blocked_symv_detail::column_group<Hermitian, Lower, ConjA, UnitStride>(
+          A_view, x_packed.data(), acc.data(), num_groups - 1 - p);
+      }
+    }
+  };
+  auto with_stride = [&] (auto lower_c, auto conj_c) {
+    if (A_view.stride0 == 1) {
+      sweep(lower_c, conj_c, ::std::true_type{});
+    }
+    else {
+      sweep(lower_c, conj_c, ::std::false_type{});
+    }
+  };
+  auto with_conj = [&] (auto lower_c) {
+    if (is_complex_v<T> && A_view.conjugated) {
+      with_stride(lower_c, ::std::bool_constant<is_complex_v<T>>{});
+    }
+    else {
+      with_stride(lower_c, ::std::false_type{});
+    }
+  };
+  if (n != 0) {
+    if (lower) {
+      with_conj(::std::true_type{});
+    }
+    else {
+      with_conj(::std::false_type{});
+    }
+  }
+  return acc;
+}
+
+// y(i) = start(i) + (A * x)(i), for A symmetric (Hermitian == false)
+// or Hermitian, storing the Triangle triangle.  start(i) is read
+// after A * x is done, so it may read y(i).  y must not overlap A or x.
+template<bool Hermitian, class Triangle, class A_t, class x_t, class y_t, class Start>
+void blocked_symv(A_t A, x_t x, y_t y, const Start& start)
+{
+  using T = typename y_t::value_type;
+  const ::std::ptrdiff_t n = A.extent(0);
+  const ::std::vector<T> acc =
+    symv_partial<Hermitian, Triangle>(A, x, 0, symv_num_pairs<T>(n));
+  for (::std::ptrdiff_t i = 0; i < n; ++i) {
+    y(i) = static_cast<T>(start(i)) + acc[i];
+  }
+}
+
+} // end namespace impl
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_SYMV_HPP_
@@ -0,0 +1,283 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_SYR2_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_SYR2_HPP_
+
+#include "blocked_ger.hpp"
+#include "blocked_symv.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+namespace impl {
+
+// Blocked symmetric and Hermitian rank-2 update (SYR2 and HER2).
+// symmetric_matrix_rank_2_update and hermitian_matrix_rank_2_update
+// use it, in all their overloads, for the matrices and vectors that
+// the blocked rank-1 update takes.  It sets each entry of one
+// triangle of A to
+//
+//   A(i,j) = E(i,j) + (x(i) * y(j)^* + y(i) * x(j)^*),
+//
+// where ^* conjugates if A is Hermitian (in which case only the real
+// part of E's diagonal counts), and E is A itself for the updates
+// without E.  The overwriting updates drop E.
+//
+// As in blocked_ger, x and y are packed first, and the engine walks
+// down A's columns; if A's rows are contiguous, it updates A's
+// transpose instead, which stores the other triangle and, if A is
+// Hermitian, takes the conjugates of x and y.  It takes the columns
+// in the same groups of RT as blocked_symv.  A group's W x W block on
+// the diagonal goes entry by entry; in the rest of the group's
+// columns, each load of x(i) and y(i) serves all W columns, and for
+// float and double with unit stride, a vector kernel does W columns
+// of rows at a time.  Each entry is read and written once.
+//
+// The engine visits the column groups in blocked_symv's pairs, which
+// have about the same number of entries each, so the parallel
+// overloads split the pairs into chunks of equal work.  The sums are
+// ordered as in the generic loops, except that the updating
+// overloads with E add the two products before adding E, and the
+// vector kernel may fuse a multiply and an add.
+
+// Can A's triangle = E + x * y^* + y * x^* go through the engine?
+template<class x_t, class y_t, class A_t>
+inline constexpr bool is_syr2_blockable_v = is_ger_blockable_v<x_t, y_t, A_t>;
+
+// A rank-2 update's operands: the rank-1 update's, which may swap x
+// and y since x * y^* + y * x^* does not change if they do.  lower
+// says which triangle of A the engine updates.
+template<class T>
+struct syr2_operands : ger_operands<T> {
+  bool lower = true;
+};
+
+template<bool Hermitian, class Triangle, class x_t, class y_t, class A_t, class T>
+syr2_operands<T> make_syr2_operands(x_t x, y_t y, strided_matrix_view<const T> E, A_t A)
+{
+  syr2_operands<T> op{make_ger_operands(x, y, E, A)};
+  op.lower = std::is_same_v<Triangle, lower_triangle_t>;
+  if (op.transposed) {
+    op.lower = ! op.lower;
+    if constexpr (Hermitian && is_complex_v<T>) {
+      for (auto& x_i : op.x) {
+        x_i = conj_if_needed(x_i);
+      }
+      for (auto& y_i : op.y) {
+        y_i = conj_if_needed(y_i);
+      }
+    }
+  }
+  return op;
+}
+
+namespace blocked_syr2_detail {
+
+#if defined(LINALG_HAS_SIMD_REDUCTIONS)
+// Rows [i_begin, i_end) of W unit-stride columns of real A:
+// A_col[c][i] = E_col[c][i] + (x[i] * y_col[c] + y[i] * x_col[c]),
+// without E_col if Overwrite.  Each vector of x and y is loaded once
+// for the W columns.
+template<bool Overwrite, ::std::size_t W>
+struct syr2_columns_kernel {
+  template<::std::size_t Bytes, class T>
+  [[gnu::always_inline]] static inline void
+  run(T* const* A_col, const T* const* E_col, const T* x_col, const T* y_col,
+      const T* x, const T* y, ::std::ptrdiff_t i_begin, ::std::ptrdiff_t i_end)
+  {
+    using V = simd_vector_t<T, Bytes>;
+    constexpr ::std::ptrdiff_t L = Bytes / sizeof(T);
+    V x_c[W], y_c[W];
+    unrolled_for<W>([&] (auto c) {
+      x_c[c] = V{} + x_col[c];
+      y_c[c] = V{} + y_col[c];
+    });
+    V x_i, y_i, a;
+    ::std::ptrdiff_t i = i_begin;
+    for (; i + L <= i_end; i += L) {
+      simd_load(x_i, x + i);
+      simd_load(y_i, y + i);
+      unrolled_for<W>([&] (auto c) {
+        if constexpr (Overwrite) {
+          a = x_i * y_c[c] + y_i * x_c[c];
+        }
+        else {
+          simd_load(a, E_col[c] + i);
+          a += x_i * y_c[c] + y_i * x_c[c];
+        }
+        __builtin_memcpy(A_col[c] + i, &a, sizeof(V));
+      });
+    }
+    for (; i < i_end; ++i) {
+      unrolled_for<W>([&] (auto c) {
+        const T term = x[i] * y_col[c] + y[i] * x_col[c];
+        if constexpr (Overwrite) {
+          A_col[c][i] = term;
+        }
+        else {
+          A_col[c][i] = E_col[c][i] + term;
+        }
+      });
+    }
+  }
+};
+#endif // LINALG_HAS_SIMD_REDUCTIONS
+
+// Update the stored triangle's entries in columns [j0, j0 + W) of A.
+template<bool Hermitian, bool Overwrite, bool Lower, bool UnitStride, ::std::size_t W, class T>
+void fixed_width_column_group(const syr2_operands<T>& op, ::std::ptrdiff_t j0)
+{
+  const ::std::ptrdiff_t n = op.A.extent0;
+  const ::std::ptrdiff_t A_stride = UnitStride ? 1 : op.A.stride0;
+  const ::std::ptrdiff_t E_stride = UnitStride ? 1 : op.E.stride0;
+  constexpr ::std::ptrdiff_t w = W;
+  const T* x = op.x.data();
+  const T* y = op.y.data();
+
+  // x(j)^* and y(j)^* for the group's columns.
+  T x_col[W];
+  T y_col[W];
+  T* A_col[W];
+  const T* E_col[W];
+  unrolled_for<W>([&] (auto c) {
+    const ::std::ptrdiff_t j = j0 + ::std::ptrdiff_t(c);
+    x_col[c] = Hermitian ? T(conj_if_needed(x[j])) : x[j];
+    y_col[c] = Hermitian ? T(conj_if_needed(y[j])) : y[j];
+    A_col[c] = op.A.data + j * op.A.stride1;
+    E_col[c] = op.E.data + j * op.E.stride1;
+  });
+
+  // The W x W block on the diagonal.
+  for (::std::ptrdiff_t c = 0; c < w; ++c) {
+    const ::std::ptrdiff_t r_begin = Lower ? c : 0;
+    const ::std::ptrdiff_t r_end = Lower ? w : c + 1;
+    for (::std::ptrdiff_t r = r_begin; r < r_end; ++r) {
+      const ::std::ptrdiff_t i = j0 + r;
+      const T term = x[i] * y_col[c] + y[i] * x_col[c];
+      if constexpr (Overwrite) {
+        A_col[c][i * A_stride] = term;
+      }
+      else {
+        const T E_ij = E_col[c][i * E_stride];
+        A_col[c][i * A_stride] = (Hermitian && r == c ? T(real_if_needed(E_ij)) : E_ij) + term;
+      }
+    }
+  }
+
+  // The rest of the group's columns.
+  const ::std::ptrdiff_t i_begin = Lower ? j0 + w : 0;
+  const ::std::ptrdiff_t i_end = Lower ? n : j0;
+#if defined(LINALG_HAS_SIMD_REDUCTIONS)
+  if constexpr (UnitStride && is_simd_reduction_value_v<T>) {
+    simd_reduce<syr2_columns_kernel<Overwrite, W>>(A_col, E_col, x_col, y_col, x, y,
+                                                   i_begin, i_end);
+    return;
+  }
+#endif
+  for (::std::ptrdiff_t i = i_begin; i < i_end; ++i) {
+    const T x_i = x[i];
+    const T y_i = y[i];
+    unrolled_for<W>([&] (auto c) {
+      const T term = x_i * y_col[c] + y_i * x_col[c];
+      if constexpr (Overwrite) {
+        A_col[c][i * A_stride] = term;
+      }
+      else {
+        A_col[c][i * A_stride] = E_col[c][i * E_stride] + term;
+      }
+    });
+  }
+}
+
+// fixed_width_column_group for the group of RT columns with index g,
+// or fewer if it is the last group.
+template<bool Hermitian, bool Overwrite, bool Lower, bool UnitStride, class T>
+void column_group(const syr2_operands<T>& op, ::std::ptrdiff_t g)
+{
+  constexpr ::std::size_t rt = gemv_blocking<T>::rt;
+  const ::std::ptrdiff_t j0 = g * ::std::ptrdiff_t(rt);
+  const ::std::ptrdiff_t w = ::std::min(::std::ptrdiff_t(rt), op.A.extent0 - j0);
+  unrolled_for<rt>([&] (auto c) {
+    if (w == ::std::ptrdiff_t(decltype(c)::value + 1)) {
+      fixed_width_column_group<Hermitian, Overwrite, Lower, UnitStride, decltype(c)::value + 1>(
+        op, j0);
+    }
+  });
+}
+
+} // end namespace blocked_syr2_detail
+
+// Update the column groups in pairs [pair_begin, pair_end) (see
+// symv_num_pairs) of op.A's triangle.  If Overwrite, op.E is not
+// read.
+template<bool Hermitian, bool Overwrite, class T>
+void syr2_update_pairs(const syr2_operands<T>& op,
+                       ::std::ptrdiff_t pair_begin, ::std::ptrdiff_t pair_end)
+{
+  constexpr ::std::ptrdiff_t rt = gemv_blocking<T>::rt;
+  const ::std::ptrdiff_t num_groups = (op.A.extent0 + rt - 1) / rt;
+
+  auto sweep = [&] (auto lower_c, auto unit_c) {
+    constexpr bool Lower = decltype(lower_c)::value;
+    constexpr bool UnitStride = decltype(unit_c)::value;
+    for (::std::ptrdiff_t p = pair_begin; p < pair_end; ++p) {
+      blocked_syr2_detail::column_group<Hermitian, Overwrite, Lower, UnitStride>(op, p);
+      if (num_groups - 1 - p != p) {
+        blocked_syr2_detail::column_group<Hermitian, Overwrite, Lower, UnitStride>(
+          op, num_groups - 1 - p);
+      }
+    }
+  };
+  auto with_stride = [&] (auto lower_c) {
+    if (op.A.stride0 == 1 && (Overwrite || op.E.stride0 == 1)) {
+      sweep(lower_c, ::std::true_type{});
+    }
+    else {
+      sweep(lower_c, ::std::false_type{});
+    }
+  };
+  if (op.lower) {
+    with_stride(::std::true_type{});
+  }
+  else {
+    with_stride(::std::false_type{});
+  }
+}
+
+// A's Triangle triangle = E + x * y^* + y * x^* (without E if
+// Overwrite), for A symmetric (Hermitian == false) or Hermitian.  E
+// may be A itself, but must not otherwise overlap it.
+template<bool Hermitian, bool Overwrite, class Triangle, class x_t, class y_t, class A_t, class T>
+void blocked_syr2(x_t x, y_t y, strided_matrix_view<const T> E, A_t A)
+{
+  const syr2_operands<T> op = make_syr2_operands<Hermitian, Triangle>(x, y, E, A);
+  syr2_update_pairs<Hermitian, Overwrite>(op, 0, symv_num_pairs<T>(op.A.extent0));
+}
+
+} // end namespace impl
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_SYR2_HPP_
@@ -0,0 +1,392 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_SYRK_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_SYRK_HPP_
+
+#include "blocked_gemm.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+namespace impl {
+
+// Blocked symmetric and Hermitian rank-k update (SYRK and HERK).
+// symmetric_matrix_rank_k_update and hermitian_matrix_rank_k_update
+// use it for the same mdspan that the packed matrix_product engine
+// takes.  It updates one triangle of
+//
+//   C = beta * C + alpha * A * A^T,
+//
+// where ^T is the conjugate transpose if C is Hermitian, and reads
+// and writes nothing in the other triangle.
+//
+// The triangle is cut into NT x NT tiles.  Each tile below the
+// diagonal is a product A(I, :) * A(J, :)^T that goes to blocked_gemm.
+// Each diagonal tile splits recursively into two smaller diagonal
+// tiles and the square between them, until the diagonal tiles have
+// ND (one register tile) rows.  Those go through blocked_gemm into a
+// small scratch tile, whose triangle is then added to C, so only
+// about ND / n of the work computes elements outside the triangle.
+//
+// Tiles are independent, and all but the diagonal ones do the same
+// amount of work, so the parallel overloads split the list of tiles
+// into contiguous chunks instead of splitting the (unbalanced)
+// columns.  Serial and parallel updates do the same arithmetic.
+//
+// The rank-2k updates (SYR2K and HER2K),
+//
+//   C = beta * C + alpha1 * A * B^T + alpha2 * B * A^T,
+//
+// use the same tiles.  Each tile's two products go to
+// blocked_gemm_sum, which runs them back to back through the same
+// packing buffers while the tile of C is still in cache, and applies
+// beta only once.
+//
+// The upper triangle of C is the lower triangle of C^T, and
+// C^T = beta * C^T + alpha * conj(A) * conj(A)^T if C is Hermitian,
+// so everything reduces to the lower triangle by transposing and
+// conjugating views.
+
+template<class T>
+struct syrk_blocking {
+  // Rows and columns of each tile; one block of the GEMM engine.
+  static constexpr ::std::ptrdiff_t nt = gemm_blocking<T>::mc;
+  // Rows in the diagonal tiles at the bottom of the recursion.
+  static constexpr ::std::ptrdiff_t nd = gemm_blocking<T>::mr;
+};
+
+// Can C's triangle = C's triangle + alpha * A * A^T go through the
+// blocked engine?  A's scaling factor and conjugation are peeled off
+// as for matrix_product.
+template<class A_t, class C_t, class ScaleFactorType = typename C_t::value_type>
+inline constexpr bool is_syrk_blockable_v =
+  is_gemm_peelable_product_v<A_t, A_t, C_t> &&
+  std::is_convertible_v<ScaleFactorType, typename C_t::value_type>;
+
+// beta for the rank-k and rank-2k updates without E: they overwrite
+// C if LINALG_FIX_RANK_UPDATES is defined, and update it otherwise.
+template<class T>
+constexpr T rank_update_beta()
+{
+#if defined(LINALG_FIX_RANK_UPDATES)
+  return T{};
+#else
+  return T(1);
+#endif
+}
+
+// A tile of an n x n matrix's lower triangle.  Tiles are numbered by
+// rows: (0,0), (1,0), (1,1), (2,0), ...
+struct triangle_tile {
+  ::std::ptrdiff_t row0;
+  ::std::ptrdiff_t col0;
+  ::std::ptrdiff_t num_rows;
+  ::std::ptrdiff_t num_cols;
+
+  bool on_diagonal() const { return row0 == col0; }
+};
+
+inline ::std::ptrdiff_t num_triangle_tiles(::std::ptrdiff_t n, ::std::ptrdiff_t nt)
+{
+  const ::std::ptrdiff_t q = (n + nt - 1) / nt;
+  return q * (q + 1) / 2;
+}
+
+inline triangle_tile get_triangle_tile(::std::ptrdiff_t n, ::std::ptrdiff_t nt,
+                                       ::std::ptrdiff_t tile)
+{
+  // Tile row I starts at tile number I * (I + 1) / 2.
+  ::std::ptrdiff_t I = 0;
+  while ((I + 1) * (I + 2) / 2 <= tile) {
+    ++I;
+  }
+  const ::std::ptrdiff_t J = tile - I * (I + 1) / 2;
+  return {I * nt, J * nt, ::std::min(nt, n - I * nt), ::std::min(nt, n - J * nt)};
+}
+
+namespace blocked_syrk_detail {
+
+// X^T: the (conjugate, if Hermitian) transpose.
+template<bool Hermitian, class T>
+strided_matrix_view<const T> adjoint(strided_matrix_view<const T> X)
+{
+  auto X_t = X.transposed();
+  X_t.conjugated = X_t.conjugated != Hermitian;
+  return X_t;
+}
+
+// C = beta * C + P, on C's lower triangle only, where C is the
+// diagonal block of the full result starting at row and column i0.
+// product(i0, j0, beta, C_block) sets C_block = beta * C_block + the
+// block of the full product P starting at (i0, j0).
+template<bool Hermitian, class T, class Product>
+void lower_diagonal(const Product& product, ::std::ptrdiff_t i0,
+                    const T& beta, strided_matrix_view<T> C)
+{
+  constexpr ::std::ptrdiff_t nd = syrk_blocking<T>::nd;
+  const ::std::ptrdiff_t n = C.extent0;
+  if (n <= nd) {
+    ::std::array<T, nd * nd> S_storage;
+    const strided_matrix_view<T> S{S_storage.data(), n, n, 1, n};
+    product(i0, i0, T{}, S);
+    for (::std::ptrdiff_t j = 0; j < n; ++j) {
+      for (::std::ptrdiff_t i = j; i < n; ++i) {
+        C(i,j) = beta == T{} ? S(i,j) : beta * C(i,j) + S(i,j);
+      }
+      if constexpr (Hermitian) {
+        C(j,j) = T(real_if_needed(C(j,j)));
+      }
+    }
+    return;
+  }
+  const ::std::ptrdiff_t n1 = (n / 2 + nd - 1) / nd * nd;
+  lower_diagonal<Hermitian>(product, i0, beta, C.block(0, 0, n1, n1));
+  product(i0 + n1, i0, beta, C.block(n1, 0, n - n1, n1));
+  lower_diagonal<Hermitian>(product, i0 + n1, beta, C.block(n1, n1, n - n1, n - n1));
+}
+
+// The part of C = beta * C + P in tile of C's lower triangle.
+template<bool Hermitian, class T, class Product>
+void lower_tile(const Product& product, const T& beta,
+                strided_matrix_view<T> C, const triangle_tile& tile)
+{
+  const auto C_tile = C.block(tile.row0, tile.col0, tile.num_rows, tile.num_cols);
+  if (tile.on_diagonal()) {
+    lower_diagonal<Hermitian>(product, tile.row0, beta, C_tile);
+  }
+  else {
+    product(tile.row0, tile.col0, beta, C_tile);
+  }
+}
+
+// C as its lower triangle sees it.
+template<class Triangle, class T>
+strided_matrix_view<T> lower_frame(strided_matrix_view<T> C)
+{
+  if constexpr (std::is_same_v<Triangle, upper_triangle_t>) {
+    return C.transposed();
+  }
+  else {
+    return C;
+  }
+}
+
+// X as seen from the lower triangle's frame.
+template<bool Hermitian, class Triangle, class T>
+strided_matrix_view<const T> lower_frame_input(strided_matrix_view<const T> X)
+{
+  if constexpr (Hermitian && std::is_same_v<Triangle, upper_triangle_t>) {
+    X.conjugated = ! X.conjugated;
+  }
+  return X;
+}
+
+} // end namespace blocked_syrk_detail
+
+// Number of tiles in the triangle of the mdspan C.
+template<class C_t>
+::std::ptrdiff_t syrk_num_tiles(const C_t& C)
+{
+  using T = typename C_t::value_type;
+  return num_triangle_tiles(::std::ptrdiff_t(C.extent(0)), syrk_blocking<T>::nt);
+}
+
+// Tile number tile of the update of Triangle of C, where
+// C = beta * C + alpha * A * A^T.  If beta is zero, the tile is
+// overwritten and its input values are not read.  C must not overlap
+// A.  If C is Hermitian, the imaginary parts of its diagonal are set
+// to zero.
+template<bool Hermitian, class Triangle, class T>
+void blocked_syrk_tile(const T& alpha,
+                       strided_matrix_view<const T> A,
+                       const T& beta,
+                       strided_matrix_view<T> C,
+                       ::std::ptrdiff_t tile)
+{
+  const auto A_lower = blocked_syrk_detail::lower_frame_input<Hermitian, Triangle>(A);
+  const ::std::ptrdiff_t K = A.extent1;
+  auto product = [&] (::std::ptrdiff_t i0, ::std::ptrdiff_t j0, const T& beta_block,
+                      strided_matrix_view<T> C_block) {
+    blocked_gemm(alpha, A_lower.block(i0, 0, C_block.extent0, K),
+      blocked_syrk_detail::adjoint<Hermitian>(A_lower.block(j0, 0, C_block.extent1, K)),
+      beta_block, C_block);
+  };
+  blocked_syrk_detail::lower_tile<Hermitian>(product, beta,
+    blocked_syrk_detail::lower_frame<Triangle>(C),
+    get_triangle_tile(C.extent0, syrk_blocking<T>::nt, tile));
+}
+
+// Set C = E on the part of Triangle in tile number tile (of the
+// tiling with NT x NT tiles), and if Hermitian, take the real part
+// of C's diagonal.
+template<bool Hermitian, class Triangle, class E_t, class C_t>
+void copy_triangle_tile(E_t E, C_t C, ::std::ptrdiff_t nt, ::std::ptrdiff_t tile)
+{
+  using index_type = typename C_t::index_type;
+  using value_type = typename C_t::value_type;
+  constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+  const triangle_tile t = get_triangle_tile(::std::ptrdiff_t(C.extent(0)), nt, tile);
+  for (::std::ptrdiff_t q = t.col0; q < t.col0 + t.num_cols; ++q) {
+    for (::std::ptrdiff_t p = ::std::max(q, t.row0); p < t.row0 + t.num_rows; ++p) {
+      // (p, q) is in the lower frame.
+      const index_type i = index_type(lower ? p : q);
+      const index_type j = index_type(lower ? q : p);
+      if constexpr (Hermitian) {
+        C(i,j) = i == j ? value_type(real_if_needed(E(i,j))) : value_type(E(i,j));
+      }
+      else {
+        C(i,j) = E(i,j);
+      }
+    }
+  }
+}
+
+// The rank-k updates, for tiles [tile_begin, tile_end) of C's
+// triangle: C = beta * C + alpha * A * A^T, with A's scaling factor
+// and conjugation peeled off.  The parallel overloads call this on
+// disjoint ranges of tiles.
+template<bool Hermitian, class Triangle, class A_t, class C_t>
+void blocked_syrk_tiles(const typename C_t::value_type& alpha, A_t A,
+                        const typename C_t::value_type& beta, C_t C,
+                             ::std::ptrdiff_t tile_begin, ::std::ptrdiff_t tile_end)
+{
+  using T = typename C_t::value_type;
+  const T s = extractScalingFactor(A);
+  const T alpha_A = Hermitian ? alpha * s * T(conj_if_needed(s)) : alpha * s * s;
+  const auto A_view = make_strided_matrix_view(A).as_const();
+  const auto C_view = make_strided_matrix_view(C);
+  for (::std::ptrdiff_t tile = tile_begin; tile < tile_end; ++tile) {
+    blocked_syrk_tile<Hermitian, Triangle>(alpha_A, A_view, beta, C_view, tile);
+  }
+}
+
+// As above, for the updating overloads: C = E + alpha * A * A^T.
+// E may be C.
+template<bool Hermitian, class Triangle, class A_t, class E_t, class C_t>
+void blocked_syrk_tiles_from(const typename C_t::value_type& alpha, A_t A, E_t E, C_t C,
+                             ::std::ptrdiff_t tile_begin, ::std::ptrdiff_t tile_end)
+{
+  using T = typename C_t::value_type;
+  for (::std::ptrdiff_t tile = tile_begin; tile < tile_end; ++tile) {
+    copy_triangle_tile<Hermitian, Triangle>(E, C, syrk_blocking<T>::nt, tile);
+    blocked_syrk_tiles<Hermitian, Triangle>(alpha, A, T(1), C, tile, tile + 1);
+  }
+}
+
+// Can C's triangle = C's triangle + A * B^T + B * A^T go through the
+// blocked engine?  A's and B's scaling factors and conjugations are
+// peeled off as for matrix_product.
+template<class A_t, class B_t, class C_t>
+inline constexpr bool is_syr2k_blockable_v =
+  is_gemm_peelable_product_v<A_t, B_t, C_t>;
+
+// Tile number tile of the update of Triangle of C, where
+// C = beta * C + alpha_AB * A * B^T + alpha_BA * B * A^T.  If beta is
+// zero, the tile is overwritten and its input values are not read.
+// C must not overlap A or B.  If C is Hermitian, the imaginary parts
+// of its diagonal are set to zero.
+template<bool Hermitian, class Triangle, class T>
+void blocked_syr2k_tile(const T& alpha_AB,
+                        strided_matrix_view<const T> A,
+                        const T& alpha_BA,
+                        strided_matrix_view<const T> B,
+                        const T& beta,
+                        strided_matrix_view<T> C,
+                        ::std::ptrdiff_t tile)
+{
+  const auto A_lower = blocked_syrk_detail::lower_frame_input<Hermitian, Triangle>(A);
+  const auto B_lower = blocked_syrk_detail::lower_frame_input<Hermitian, Triangle>(B);
+  // In the upper triangle's frame, C^T = beta * C^T + alpha_BA * A * B^T
+  // + alpha_AB * B * A^T if C is symmetric, and
+  // conj(alpha_AB) * conj(A) * conj(B)^T + ... if C is Hermitian.
+  T alpha_1 = alpha_AB;
+  T alpha_2 = alpha_BA;
+  if constexpr (std::is_same_v<Triangle, upper_triangle_t>) {
+    if constexpr (Hermitian) {
+      alpha_1 = T(conj_if_needed(alpha_AB));
+      alpha_2 = T(conj_if_needed(alpha_BA));
+    }
+    else {
+      alpha_1 = alpha_BA;
+      alpha_2 = alpha_AB;
+    }
+  }
+  const ::std::ptrdiff_t K = A.extent1;
+  auto product = [&] (::std::ptrdiff_t i0, ::std::ptrdiff_t j0, const T& beta_block,
+                      strided_matrix_view<T> C_block) {
+    const ::std::ptrdiff_t m = C_block.extent0;
+    const ::std::ptrdiff_t n = C_block.extent1;
+    blocked_gemm_sum(
+      alpha_1, A_lower.block(i0, 0, m, K),
+      blocked_syrk_detail::adjoint<Hermitian>(B_lower.block(j0, 0, n, K)),
+      alpha_2, B_lower.block(i0, 0, m, K),
+      blocked_syrk_detail::adjoint<Hermitian>(A_lower.block(j0, 0, n, K)),
+      beta_block, C_block);
+  };
+  blocked_syrk_detail::lower_tile<Hermitian>(product, beta,
+    blocked_syrk_detail::lower_frame<Triangle>(C),
+    get_triangle_tile(C.extent0, syrk_blocking<T>::nt, tile));
+}
+
+// The rank-2k updates, for tiles [tile_begin, tile_end) of C's
+// triangle: C = beta * C + A * B^T + B * A^T, with A's and B's
+// scaling factors and conjugations peeled off.
+template<bool Hermitian, class Triangle, class A_t, class B_t, class C_t>
+void blocked_syr2k_tiles(A_t A, B_t B,
+                         const typename C_t::value_type& beta, C_t C,
+                         ::std::ptrdiff_t tile_begin, ::std::ptrdiff_t tile_end)
+{
+  using T = typename C_t::value_type;
+  const T s_A = extractScalingFactor(A);
+  const T s_B = extractScalingFactor(B);
+  const T alpha_AB = Hermitian ? s_A * T(conj_if_needed(s_B)) : s_A * s_B;
+  const T alpha_BA = Hermitian ? s_B * T(conj_if_needed(s_A)) : s_B * s_A;
+  const auto A_view = make_strided_matrix_view(A).as_const();
+  const auto B_view = make_strided_matrix_view(B).as_const();
+  const auto C_view = make_strided_matrix_view(C);
+  for (::std::ptrdiff_t tile = tile_begin; tile < tile_end; ++tile) {
+    blocked_syr2k_tile<Hermitian, Triangle>(alpha_AB, A_view, alpha_BA, B_view,
+      beta, C_view, tile);
+  }
+}
+
+// As above, for the updating overloads: C = E + A * B^T + B * A^T.
+// E may be C.
+template<bool Hermitian, class Triangle, class A_t, class B_t, class E_t, class C_t>
+void blocked_syr2k_tiles_from(A_t A, B_t B, E_t E, C_t C,
+                              ::std::ptrdiff_t tile_begin, ::std::ptrdiff_t tile_end)
+{
+  using T = typename C_t::value_type;
+  for (::std::ptrdiff_t tile = tile_begin; tile < tile_end; ++tile) {
+    copy_triangle_tile<Hermitian, Triangle>(E, C, syrk_blocking<T>::nt, tile);
+    blocked_syr2k_tiles<Hermitian, Triangle>(A, B, T(1), C, tile, tile + 1);
+  }
+}
+
+} // end namespace impl
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_SYRK_HPP_
@@ -0,0 +1,206 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_TRSM_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_TRSM_HPP_
+
+#include "blocked_gemm.hpp"
+#include <cstddef>
+#include <type_traits>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+namespace impl {
+
+// Recursive, blocked triangular solve with multiple right-hand sides
+// (TRSM).  The triangular_matrix_matrix_{left,right}_solve algorithms
+// use it for the same mdspan that the packed matrix_product engine
+// takes.  Splitting A into
+//
+//   [A11  0 ]        [A11 A12]
+//   [A21 A22]   or   [ 0  A22]
+//
+// reduces the solve to two half-size solves and one matrix product,
+// e.g., X2 := X2 - A21 * X1, which goes to blocked_gemm.  The
+// recursion stops at diagonal blocks of at most nb rows, which a
+// substitution kernel solves a few right-hand sides at a time.  The
+// matrix products do all but about nb / n of the arithmetic.
+//
+// The columns of X (for a left solve) are independent, so callers
+// can solve blocks of columns in parallel.
+
+template<class T>
+struct trsm_blocking {
+  // Largest diagonal block that the substitution kernel solves.
+  static constexpr ::std::ptrdiff_t nb = 32;
+  // Number of right-hand sides that the kernel solves at once, so
+  // that it loads each element of A once per nu columns of X.
+  static constexpr ::std::ptrdiff_t nu = 4;
+};
+
+// Can a triangular solve with these matrices go through the blocked
+// engine?  Besides what blocked_gemm needs, the element type must
+// support exact division.
+template<class A_t, class B_t, class X_t>
+inline constexpr bool is_trsm_blockable_v =
+  is_gemm_packable_product_v<A_t, B_t, X_t> &&
+  (std::is_floating_point_v<typename X_t::value_type> ||
+   is_complex_v<typename X_t::value_type>);
+
+namespace blocked_trsm_detail {
+
+// X := B, unless they are the same matrix.
+template<class T>
+void copy_matrix(strided_matrix_view<const T> B, strided_matrix_view<T> X)
+{
+  if (B.data == X.data && B.stride0 == X.stride0 && B.stride1 == X.stride1) {
+    return;
+  }
+  if (X.stride0 <= X.stride1) {
+    for (::std::ptrdiff_t j = 0; j < X.extent1; ++j) {
+      for (::std::ptrdiff_t i = 0; i < X.extent0; ++i) {
+        X(i,j) = B(i,j);
+      }
+    }
+  }
+  else {
+    for (::std::ptrdiff_t i = 0; i < X.extent0; ++i) {
+      for (::std::ptrdiff_t j = 0; j < X.extent1; ++j) {
+        X(i,j) = B(i,j);
+      }
+    }
+  }
+}
+
+// Overwrite columns [k, k + NumCols) of X with the solution of
+// A X = X, for a diagonal block A, by column-oriented substitution.
+template<::std::ptrdiff_t NumCols, class Triangle, class DiagonalStorage, class T>
+void substitute_columns(strided_matrix_view<const T> A,
+                        strided_matrix_view<T> X,
+                        ::std::ptrdiff_t k)
+{
+  constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+  constexpr bool explicit_diagonal =
+    std::is_same_v<DiagonalStorage, explicit_diagonal_t>;
+  const ::std::ptrdiff_t n = A.extent0;
+
+  for (::std::ptrdiff_t step = 0; step < n; ++step) {
+    const ::std::ptrdiff_t j = lower ? step : n - 1 - step;
+    T x[NumCols];
+    for (::std::ptrdiff_t c = 0; c < NumCols; ++c) {
+      x[c] = X(j, k + c);
+      if constexpr (explicit_diagonal) {
+        x[c] = x[c] / A(j,j);
+        X(j, k + c) = x[c];
+      }
+    }
+    const ::std::ptrdiff_t i_begin = lower ? j + 1 : 0;
+    const ::std::ptrdiff_t i_end = lower ? n : j;
+    for (::std::ptrdiff_t i = i_begin; i < i_end; ++i) {
+      const T A_ij = A(i,j);
+      for (::std::ptrdiff_t c = 0; c < NumCols; ++c) {
+        X(i, k + c) -= A_ij * x[c];
+      }
+    }
+  }
+}
+
+template<class Triangle, class DiagonalStorage, class T>
+void substitute(strided_matrix_view<const T> A, strided_matrix_view<T> X)
+{
+  constexpr ::std::ptrdiff_t nu = trsm_blocking<T>::nu;
+  ::std::ptrdiff_t k = 0;
+  for (; k + nu <= X.extent1; k += nu) {
+    substitute_columns<nu, Triangle, DiagonalStorage>(A, X, k);
+  }
+  for (; k < X.extent1; ++k) {
+    substitute_columns<1, Triangle, DiagonalStorage>(A, X, k);
+  }
+}
+
+// Overwrite X with the solution of A X = X.
+template<class Triangle, class DiagonalStorage, class T>
+void left_solve_in_place(strided_matrix_view<const T> A, strided_matrix_view<T> X)
+{
+  constexpr ::std::ptrdiff_t nb = trsm_blocking<T>::nb;
+  const ::std::ptrdiff_t n = A.extent0;
+  const ::std::ptrdiff_t num_rhs = X.extent1;
+  if (n <= nb) {
+    substitute<Triangle, DiagonalStorage>(A, X);
+    return;
+  }
+
+  // Split at a multiple of nb, so that the diagonal blocks at the
+  // bottom of the recursion are full size.
+  const ::std::ptrdiff_t n1 = (n / 2 + nb - 1) / nb * nb;
+  const ::std::ptrdiff_t n2 = n - n1;
+  const auto A11 = A.block(0, 0, n1, n1);
+  const auto A22 = A.block(n1, n1, n2, n2);
+  const auto X1 = X.block(0, 0, n1, num_rhs);
+  const auto X2 = X.block(n1, 0, n2, num_rhs);
+
+  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+    left_solve_in_place<Triangle, DiagonalStorage>(A11, X1);
+    blocked_gemm(T(-1), A.block(n1, 0, n2, n1), X1.as_const(), T(1), X2);
+    left_solve_in_place<Triangle, DiagonalStorage>(A22, X2);
+  }
+  else {
+    left_solve_in_place<Triangle, DiagonalStorage>(A22, X2);
+    blocked_gemm(T(-1), A.block(0, n1, n1, n2), X2.as_const(), T(1), X1);
+    left_solve_in_place<Triangle, DiagonalStorage>(A11, X1);
+  }
+}
+
+} // end namespace blocked_trsm_detail
+
+// Solve A X = B for X, where A is triangular.  X may be B itself,
+// but must not otherwise overlap A or B.
+template<class Triangle, class DiagonalStorage, class T>
+void blocked_trsm_left(strided_matrix_view<const T> A,
+                       strided_matrix_view<const T> B,
+                       strided_matrix_view<T> X)
+{
+  if (X.extent0 == 0 || X.extent1 == 0) {
+    return;
+  }
+  blocked_trsm_detail::copy_matrix(B, X);
+  blocked_trsm_detail::left_solve_in_place<Triangle, DiagonalStorage>(A, X);
+}
+
+// Solve X A = B for X, where A is triangular.  Since X A = B if and
+// only if A^T X^T = B^T, this is a left solve with the transposes,
+// for which A's other triangle holds the nonzeros.
+template<class Triangle, class DiagonalStorage, class T>
+void blocked_trsm_right(strided_matrix_view<const T> A,
+                        strided_matrix_view<const T> B,
+                        strided_matrix_view<T> X)
+{
+  using transposed_triangle = std::conditional_t<
+    std::is_same_v<Triangle, lower_triangle_t>, upper_triangle_t, lower_triangle_t>;
+  blocked_trsm_left<transposed_triangle, DiagonalStorage>(
+    A.transposed(), B.transposed(), X.transposed());
+}
+
+} // end namespace impl
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_TRSM_HPP_
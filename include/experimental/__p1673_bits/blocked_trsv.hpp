@@ -0,0 +1,207 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_TRSV_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_TRSV_HPP_
+
+#include "blocked_gemv.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+namespace impl {
+
+// Blocked triangular solve with one right-hand side (TRSV).
+// triangular_matrix_vector_solve uses it for the matrices that the
+// blocked GEMV engine takes without scaling or conjugation, and for
+// its vectors.  It cuts A into diagonal blocks of NB rows.
+// Substitution solves each diagonal block, which stays in L1, and
+// the rest of A enters the solution through blocked GEMV updates:
+//
+// * If A's columns are contiguous, after solving block k the engine
+//   subtracts the block's columns below (or above) the diagonal
+//   block, times the block's part of x, from the rest of b (a
+//   "right-looking" update, which streams down A's columns).
+//
+// * If A's rows are contiguous, before solving block k it subtracts
+//   the block's rows left (or right) of the diagonal block, times the
+//   part of x solved so far, from the block's part of b (a
+//   "left-looking" update, which takes dot products along A's rows).
+//
+// Either way the engine reads each element of the triangle once, in
+// the order of its storage.  The parallel overloads always use the
+// right-looking form and split each update's rows among threads.
+//
+// Like the GEMV engine, this reorders the sums, so results may
+// differ from the generic loops' in the last bits.
+
+template<class T>
+struct trsv_blocking {
+  // Rows of the diagonal blocks that substitution solves.
+  static constexpr ::std::ptrdiff_t nb = 64;
+};
+
+// Can x = A \ b go through the engine?  b's scaling factor and
+// conjugation are peeled off as for GEMV's x.  Besides, the element
+// type must support exact division, as for is_trsm_blockable_v.
+template<class A_t, class b_t, class x_t>
+inline constexpr bool is_trsv_blockable_v =
+  is_gemm_packable_matrix_v<A_t> &&
+  is_simd_peelable_vector_v<b_t> &&
+  is_simd_reducible_vector_v<x_t> &&
+  ! std::is_const_v<typename x_t::element_type> &&
+  std::is_same_v<typename A_t::value_type, typename x_t::value_type> &&
+  std::is_same_v<typename b_t::value_type, typename x_t::value_type> &&
+  (std::is_floating_point_v<typename x_t::value_type> ||
+   is_complex_v<typename x_t::value_type>);
+
+namespace blocked_trsv_detail {
+
+// Overwrite w with the solution of A w = w, for a diagonal block A.
+// The loops follow A's storage: by columns (saxpy form) if its
+// columns are contiguous, else by rows (dot form).
+template<class Triangle, class DiagonalStorage, class T>
+void substitute(strided_matrix_view<const T> A, T* w)
+{
+  constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+  constexpr bool explicit_diagonal =
+    std::is_same_v<DiagonalStorage, explicit_diagonal_t>;
+  const ::std::ptrdiff_t n = A.extent0;
+
+  if (A.columns_contiguous()) {
+    for (::std::ptrdiff_t step = 0; step < n; ++step) {
+      const ::std::ptrdiff_t j = lower ? step : n - 1 - step;
+      if constexpr (explicit_diagonal) {
+        w[j] = w[j] / A(j,j);
+      }
+      const T w_j = w[j];
+      const ::std::ptrdiff_t i_begin = lower ? j + 1 : 0;
+      const ::std::ptrdiff_t i_end = lower ? n : j;
+      for (::std::ptrdiff_t i = i_begin; i < i_end; ++i) {
+        w[i] -= A(i,j) * w_j;
+      }
+    }
+  }
+  else {
+    for (::std::ptrdiff_t step = 0; step < n; ++step) {
+      const ::std::ptrdiff_t i = lower ? step : n - 1 - step;
+      const ::std::ptrdiff_t j_begin = lower ? 0 : i + 1;
+      const ::std::ptrdiff_t j_end = lower ? i : n;
+      T sum = w[i];
+      for (::std::ptrdiff_t j = j_begin; j < j_end; ++j) {
+        sum -= A(i,j) * w[j];
+      }
+      if constexpr (explicit_diagonal) {
+        w[i] = sum / A(i,i);
+      }
+      else {
+        w[i] = sum;
+      }
+    }
+  }
+}
+
+} // end namespace blocked_trsv_detail
+
+// Overwrite w with the solution of A w = w, where A is n x n and
+// triangular.  update(A_block, x_packed, acc) must do what
+// gemv_accumulate does; the parallel overloads pass one that splits
+// A_block's rows among threads.  w_neg is scratch space for n
+// entries.  If right_looking is false, the engine uses the
+// left-looking form.
+template<class Triangle, class DiagonalStorage, class T, class Update>
+void trsv_in_place(strided_matrix_view<const T> A, T* w, T* w_neg,
+                   bool right_looking, const Update& update)
+{
+  constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+  constexpr ::std::ptrdiff_t nb = trsv_blocking<T>::nb;
+  const ::std::ptrdiff_t n = A.extent0;
+  const ::std::ptrdiff_t num_blocks = (n + nb - 1) / nb;
+
+  // Blocks start at multiples of nb for either triangle, so that
+  // only the last one is short.
+  for (::std::ptrdiff_t step = 0; step < num_blocks; ++step) {
+    const ::std::ptrdiff_t k = lower ? step : num_blocks - 1 - step;
+    const ::std::ptrdiff_t k0 = k * nb;
+    const ::std::ptrdiff_t kb = ::std::min(nb, n - k0);
+    const ::std::ptrdiff_t k1 = k0 + kb;
+    // Rows and columns solved before this block.
+    const ::std::ptrdiff_t done_begin = lower ? 0 : k1;
+    const ::std::ptrdiff_t done_end = lower ? k0 : n;
+
+    if (! right_looking && done_begin < done_end) {
+      update(A.block(k0, done_begin, kb, done_end - done_begin),
+             w_neg + done_begin, w + k0);
+    }
+    blocked_trsv_detail::substitute<Triangle, DiagonalStorage>(
+      A.block(k0, k0, kb, kb), w + k0);
+    for (::std::ptrdiff_t i = k0; i < k1; ++i) {
+      w_neg[i] = -w[i];
+    }
+    if (right_looking) {
+      // Rows not yet solved.
+      const ::std::ptrdiff_t rest_begin = lower ? k1 : 0;
+      const ::std::ptrdiff_t rest_end = lower ? n : k0;
+      if (rest_begin < rest_end) {
+        update(A.block(rest_begin, k0, rest_end - rest_begin, kb),
+               w_neg + k0, w + rest_begin);
+      }
+    }
+  }
+}
+
+// The mdspan interface of trsv_in_place: solve A x = b for x, where A
+// is triangular.  x may be b itself.
+template<class Triangle, class DiagonalStorage, class A_t, class b_t, class x_t, class Update>
+void blocked_trsv(A_t A, b_t b, x_t x, bool right_looking, const Update& update)
+{
+  using T = typename x_t::value_type;
+  const ::std::ptrdiff_t n = A.extent(0);
+  ::std::vector<T> w =
+    pack_gemv_x(extractScalingFactor(b), make_strided_vector_view(b).as_const());
+  ::std::vector<T> w_neg(n);
+  trsv_in_place<Triangle, DiagonalStorage>(make_strided_matrix_view(A).as_const(),
+    w.data(), w_neg.data(), right_looking, update);
+  for (::std::ptrdiff_t i = 0; i < n; ++i) {
+    x(i) = w[i];
+  }
+}
+
+// Serial blocked_trsv, in the form that suits A's layout.
+template<class Triangle, class DiagonalStorage, class A_t, class b_t, class x_t>
+void blocked_trsv(A_t A, b_t b, x_t x)
+{
+  using T = typename x_t::value_type;
+  blocked_trsv<Triangle, DiagonalStorage>(A, b, x,
+    make_strided_matrix_view(A).columns_contiguous(),
+    [] (strided_matrix_view<const T> A_block, const T* x_packed, T* acc) {
+      gemv_accumulate(A_block, x_packed, acc);
+    });
+}
+
+} // end namespace impl
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLOCKED_TRSV_HPP_
@@ -0,0 +1,166 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_FIXED_SIZE_KERNELS_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_FIXED_SIZE_KERNELS_HPP_
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// Fully unrolled kernels for dot, matrix_vector_product, and
+// matrix_product on operands whose extents are all known at compile
+// time, as for the 3 x 3 to 8 x 8 matrices of small physics kernels.
+// The kernels load each input element once into a local array,
+// compute every output element as straight-line code, and then store
+// the results, so the compiler can keep the operands in registers.
+// They are constexpr, so the algorithms' overloads without an
+// execution policy can be used in constant expressions.
+//
+// Each output element accumulates its terms in the same order as
+// the algorithms' generic loops, so the results do not change.
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+namespace impl {
+
+// Largest number of multiply-adds for which the algorithms use the
+// unrolled kernels.  Past this, the code grows faster than it speeds
+// up, and the blocked kernels do better.
+inline constexpr ::std::size_t max_unrolled_fmas = 512;
+
+// Do all these mdspan types have only compile-time extents?
+template<class... MDSpans>
+inline constexpr bool all_static_extents_v = ((MDSpans::rank_dynamic() == 0) && ...);
+
+template<class MDSpan>
+inline constexpr ::std::size_t static_size_v = [] {
+  ::std::size_t size = 1;
+  for (::std::size_t r = 0; r < MDSpan::rank(); ++r) {
+    size *= MDSpan::static_extent(r);
+  }
+  return size;
+}();
+
+template<class F, ::std::size_t... I>
+constexpr void unrolled_for_impl(F& f, ::std::index_sequence<I...>)
+{
+  (f(::std::integral_constant<::std::size_t, I>{}), ...);
+}
+
+// Call f(std::integral_constant<std::size_t, I>{}) for I = 0, 1, ...,
+// N - 1, in that order.
+template<::std::size_t N, class F>
+constexpr void unrolled_for(F&& f)
+{
+  unrolled_for_impl(f, ::std::make_index_sequence<N>{});
+}
+
+// dot
+
+template<class v1_t, class v2_t>
+inline constexpr bool use_unrolled_dot_v =
+  all_static_extents_v<v1_t, v2_t> &&
+  v1_t::static_extent(0) <= max_unrolled_fmas;
+
+template<class v1_t, class v2_t, class Scalar>
+constexpr Scalar unrolled_dot(v1_t v1, v2_t v2, Scalar init)
+{
+  static_assert(v1_t::static_extent(0) == v2_t::static_extent(0));
+  unrolled_for<v1_t::static_extent(0)>([&] (auto k) {
+    init += v1(k) * v2(k);
+  });
+  return init;
+}
+
+// matrix_vector_product
+
+template<class A_t, class x_t, class y_t>
+inline constexpr bool use_unrolled_matrix_vector_product_v =
+  all_static_extents_v<A_t, x_t, y_t> &&
+  static_size_v<A_t> <= max_unrolled_fmas;
+
+// y(i) = start(i) + A(i,0) * x(0) + ... + A(i,N-1) * x(N-1).
+// If start reads another vector, it may be y.
+template<class A_t, class x_t, class y_t, class Start>
+constexpr void unrolled_matrix_vector_product(A_t A, x_t x, y_t y, const Start& start)
+{
+  constexpr ::std::size_t num_rows = A_t::static_extent(0);
+  constexpr ::std::size_t num_cols = A_t::static_extent(1);
+  static_assert(x_t::static_extent(0) == num_cols);
+  static_assert(y_t::static_extent(0) == num_rows);
+
+  ::std::array<typename x_t::value_type, num_cols> x_reg{};
+  unrolled_for<num_cols>([&] (auto j) { x_reg[j] = x(j); });
+  ::std::array<typename y_t::value_type, num_rows> y_reg{};
+  unrolled_for<num_rows>([&] (auto i) {
+    auto sum = static_cast<typename y_t::value_type>(start(i));
+    unrolled_for<num_cols>([&] (auto j) { sum += A(i,j) * x_reg[j]; });
+    y_reg[i] = sum;
+  });
+  unrolled_for<num_rows>([&] (auto i) { y(i) = y_reg[i]; });
+}
+
+// matrix_product
+
+template<class A_t, class B_t, class C_t>
+inline constexpr bool use_unrolled_matrix_product_v =
+  all_static_extents_v<A_t, B_t, C_t> &&
+  static_size_v<A_t> * C_t::static_extent(1) <= max_unrolled_fmas;
+
+// C(i,j) = start(i,j) + A(i,0) * B(0,j) + ... + A(i,K-1) * B(K-1,j).
+// If start reads another matrix, it may be C.
+template<class A_t, class B_t, class C_t, class Start>
+constexpr void unrolled_matrix_product(A_t A, B_t B, C_t C, const Start& start)
+{
+  constexpr ::std::size_t num_rows = C_t::static_extent(0);
+  constexpr ::std::size_t num_cols = C_t::static_extent(1);
+  constexpr ::std::size_t num_terms = A_t::static_extent(1);
+  static_assert(A_t::static_extent(0) == num_rows);
+  static_assert(B_t::static_extent(0) == num_terms);
+  static_assert(B_t::static_extent(1) == num_cols);
+  using value_type = typename C_t::value_type;
+
+  ::std::array<::std::array<typename B_t::value_type, num_cols>, num_terms> B_reg{};
+  unrolled_for<num_terms>([&] (auto k) {
+    unrolled_for<num_cols>([&] (auto j) { B_reg[k][j] = B(k,j); });
+  });
+  ::std::array<::std::array<value_type, num_cols>, num_rows> C_reg{};
+  unrolled_for<num_rows>([&] (auto i) {
+    ::std::array<typename A_t::value_type, num_terms> A_row{};
+    unrolled_for<num_terms>([&] (auto k) { A_row[k] = A(i,k); });
+    unrolled_for<num_cols>([&] (auto j) {
+      auto sum = static_cast<value_type>(start(i, j));
+      unrolled_for<num_terms>([&] (auto k) { sum += A_row[k] * B_reg[k][j]; });
+      C_reg[i][j] = sum;
+    });
+  });
+  unrolled_for<num_rows>([&] (auto i) {
+    unrolled_for<num_cols>([&] (auto j) { C(i,j) = C_reg[i][j]; });
+  });
+}
+
+} // end namespace impl
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_FIXED_SIZE_KERNELS_HPP_
@@ -0,0 +1,321 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_FLAT_KERNELS_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_FLAT_KERNELS_HPP_
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+// Kernels for copy, swap_elements, scale, and add on operands whose
+// elements the algorithms can address through data_handle() and
+// stride(), that is, with default_accessor and a strided layout.
+//
+// * If every operand stores its elements without gaps, in the same
+//   order (e.g., all layout_left, or all layout_right, or
+//   layout_stride with the same strides as one of these), the
+//   algorithm is a loop over one flat array.  copy of trivially
+//   copyable elements of the same type is a memmove.  swap_elements
+//   and add of float, double, or their std::complex go through
+//   vector kernels; complex elements are pairs of reals for these.
+//
+// * Otherwise, for matrices, the loops follow the storage order of
+//   the operand written.  If some operand is stored in the other
+//   order (e.g., a layout_right copy of a layout_left matrix), they
+//   go in square tiles, found by halving the longer side, so that
+//   each tile of every operand stays in cache.
+//
+// The kernels compute each element as the generic loops do, so the
+// results do not change.
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+namespace impl {
+
+// Is the mdspan type one whose elements the kernels can address
+// directly?
+template<class MDSpan>
+struct is_flat_operand : std::false_type {};
+
+template<class ElementType, class Extents, class Layout>
+struct is_flat_operand<mdspan<ElementType, Extents, Layout, default_accessor<ElementType>>>
+  : std::bool_constant<
+      (Extents::rank() == 1 || Extents::rank() == 2) &&
+      Layout::template mapping<Extents>::is_always_strided()>
+{};
+
+template<class... MDSpans>
+inline constexpr bool are_flat_operands_v = (is_flat_operand<MDSpans>::value && ...);
+
+// Orders in which A's elements lie without gaps, starting at
+// data_handle(), as a mask of flat_column_major and flat_row_major.
+// Vectors (with unit stride) and matrices with at most one row or
+// column count as both.
+inline constexpr unsigned flat_column_major = 1;
+inline constexpr unsigned flat_row_major = 2;
+
+template<class MDSpan>
+unsigned flat_orders(const MDSpan& A)
+{
+  if constexpr (MDSpan::rank() == 1) {
+    return A.extent(0) <= 1 || A.stride(0) == 1 ? flat_column_major | flat_row_major : 0u;
+  }
+  else {
+    const auto m = A.extent(0);
+    const auto n = A.extent(1);
+    unsigned orders = 0;
+    if ((m <= 1 || A.stride(0) == 1) && (n <= 1 || A.stride(1) == ::std::size_t(m))) {
+      orders |= flat_column_major;
+    }
+    if ((n <= 1 || A.stride(1) == 1) && (m <= 1 || A.stride(0) == ::std::size_t(n))) {
+      orders |= flat_row_major;
+    }
+    return orders;
+  }
+}
+
+// Do all the operands lie without gaps in a common order?
+template<class... MDSpans>
+bool is_flat(const MDSpans&... A)
+{
+  return (flat_orders(A) & ...) != 0u;
+}
+
+// The real type of which T is (a pair of) elements for the vector
+// kernels, or void.
+template<class T>
+struct flat_real { using type = void; };
+
+template<>
+struct flat_real<float> { using type = float; };
+
+template<>
+struct flat_real<double> { using type = double; };
+
+template<class R>
+struct flat_real<::std::complex<R>> { using type = typename flat_real<R>::type; };
+
+template<class T>
+using flat_real_t = typename flat_real<T>::type;
+
+namespace flat_kernels_detail {
+
+#if defined(LINALG_HAS_SIMD_REDUCTIONS)
+// z[k] = x[k] + y[k] for k in [0, n).
+struct add_kernel {
+  template<::std::size_t Bytes, class T>
+  [[gnu::always_inline]] static inline void
+  run(const T* x, const T* y, T* z, ::std::size_t n)
+  {
+    using V = simd_vector_t<T, Bytes>;
+    constexpr ::std::size_t L = Bytes / sizeof(T);
+    V a, b;
+    ::std::size_t k = 0;
+    for (; k + L <= n; k += L) {
+      simd_load(a, x + k);
+      simd_load(b, y + k);
+      a += b;
+      __builtin_memcpy(z + k, &a, sizeof(V));
+    }
+    for (; k < n; ++k) {
+      z[k] = x[k] + y[k];
+    }
+  }
+};
+
+// Exchange x[k] and y[k] for k in [0, n).
+struct swap_kernel {
+  template<::std::size_t Bytes, class T>
+  [[gnu::always_inline]] static inline void
+  run(T* x, T* y, ::std::size_t n)
+  {
+    using V = simd_vector_t<T, Bytes>;
+    constexpr ::std::size_t L = Bytes / sizeof(T);
+    V a, b;
+    ::std::size_t k = 0;
+    for (; k + L <= n; k += L) {
+      simd_load(a, x + k);
+      simd_load(b, y + k);
+      __builtin_memcpy(x + k, &b, sizeof(V));
+      __builtin_memcpy(y + k, &a, sizeof(V));
+    }
+    for (; k < n; ++k) {
+      const T t = x[k];
+      x[k] = y[k];
+      y[k] = t;
+    }
+  }
+};
+#endif // LINALG_HAS_SIMD_REDUCTIONS
+
+// The number of reals in n elements of T, if flat_real_t<T> is real.
+template<class T>
+constexpr ::std::size_t num_reals(::std::size_t n)
+{
+  return n * (sizeof(T) / sizeof(flat_real_t<T>));
+}
+
+} // end namespace flat_kernels_detail
+
+// y[k] = x[k] for k in [0, n).
+template<class T_x, class T_y>
+void flat_copy(const T_x* x, T_y* y, ::std::size_t n)
+{
+  if constexpr (std::is_same_v<std::remove_const_t<T_x>, T_y> &&
+                std::is_trivially_copyable_v<T_y>) {
+    if (n != 0) {
+      ::std::memmove(y, x, n * sizeof(T_y));
+    }
+  }
+  else {
+    for (::std::size_t k = 0; k < n; ++k) {
+      y[k] = x[k];
+    }
+  }
+}
+
+// swap(x[k], y[k]) for k in [0, n).
+template<class T_x, class T_y>
+void flat_swap(T_x* x, T_y* y, ::std::size_t n)
+{
+#if defined(LINALG_HAS_SIMD_REDUCTIONS)
+  if constexpr (std::is_same_v<T_x, T_y> && ! std::is_void_v<flat_real_t<T_x>>) {
+    using R = flat_real_t<T_x>;
+    simd_reduce<flat_kernels_detail::swap_kernel>(reinterpret_cast<R*>(x),
+      reinterpret_cast<R*>(y), flat_kernels_detail::num_reals<T_x>(n));
+    return;
+  }
+#endif
+  using ::std::swap;
+  for (::std::size_t k = 0; k < n; ++k) {
+    swap(x[k], y[k]);
+  }
+}
+
+// x[k] *= alpha for k in [0, n).
+template<class Scalar, class T>
+void flat_scale(const Scalar& alpha, T* x, ::std::size_t n)
+{
+  for (::std::size_t k = 0; k < n; ++k) {
+    x[k] *= alpha;
+  }
+}
+
+// z[k] = x[k] + y[k] for k in [0, n).
+template<class T_x, class T_y, class T_z>
+void flat_add(const T_x* x, const T_y* y, T_z* z, ::std::size_t n)
+{
+#if defined(LINALG_HAS_SIMD_REDUCTIONS)
+  if constexpr (std::is_same_v<std::remove_const_t<T_x>, T_z> &&
+                std::is_same_v<std::remove_const_t<T_y>, T_z> &&
+                ! std::is_void_v<flat_real_t<T_z>>) {
+    using R = flat_real_t<T_z>;
+    simd_reduce<flat_kernels_detail::add_kernel>(reinterpret_cast<const R*>(x),
+      reinterpret_cast<const R*>(y), reinterpret_cast<R*>(z),
+      flat_kernels_detail::num_reals<T_z>(n));
+    return;
+  }
+#endif
+  for (::std::size_t k = 0; k < n; ++k) {
+    z[k] = x[k] + y[k];
+  }
+}
+
+// Largest side of the tiles of strided_for_each.  A tile of each
+// operand takes at most a few kilobytes for the usual element types.
+inline constexpr ::std::size_t flat_tile = 32;
+
+namespace flat_kernels_detail {
+
+template<class IndexType, class F>
+void for_each_in_tiles(IndexType i0, IndexType i1, IndexType j0, IndexType j1,
+                       bool column_major, const F& f)
+{
+  const IndexType m = i1 - i0;
+  const IndexType n = j1 - j0;
+  if (m > IndexType(flat_tile) && m >= n) {
+    const IndexType i_mid = i0 + m / 2;
+    for_each_in_tiles(i0, i_mid, j0, j1, column_major, f);
+    for_each_in_tiles(i_mid, i1, j0, j1, column_major, f);
+  }
+  else if (n > IndexType(flat_tile)) {
+    const IndexType j_mid = j0 + n / 2;
+    for_each_in_tiles(i0, i1, j0, j_mid, column_major, f);
+    for_each_in_tiles(i0, i1, j_mid, j1, column_major, f);
+  }
+  else if (column_major) {
+    for (IndexType j = j0; j < j1; ++j) {
+      for (IndexType i = i0; i < i1; ++i) {
+        f(i, j);
+      }
+    }
+  }
+  else {
+    for (IndexType i = i0; i < i1; ++i) {
+      for (IndexType j = j0; j < j1; ++j) {
+        f(i, j);
+      }
+    }
+  }
+}
+
+} // end namespace flat_kernels_detail
+
+// Call f(i,j) for every index (i,j) of the matrix out, which the
+// algorithm writes, reading the matrices in.  The loops follow out's
+// storage order, and go in tiles if some matrix in is stored in the
+// other order.
+template<class F, class Out, class... In>
+void strided_for_each(const F& f, const Out& out, const In&... in)
+{
+  using index_type = typename Out::index_type;
+  auto column_major = [] (const auto& A) { return A.stride(0) <= A.stride(1); };
+  const bool out_column_major = column_major(out);
+  const bool tiled = ((column_major(in) != out_column_major) || ...);
+  if (tiled) {
+    flat_kernels_detail::for_each_in_tiles(index_type(0), out.extent(0),
+      index_type(0), out.extent(1), out_column_major, f);
+  }
+  else if (out_column_major) {
+    for (index_type j = 0; j < out.extent(1); ++j) {
+      for (index_type i = 0; i < out.extent(0); ++i) {
+        f(i, j);
+      }
+    }
+  }
+  else {
+    for (index_type i = 0; i < out.extent(0); ++i) {
+      for (index_type j = 0; j < out.extent(1); ++j) {
+        f(i, j);
+      }
+    }
+  }
+}
+
+} // end namespace impl
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_FLAT_KERNELS_HPP_
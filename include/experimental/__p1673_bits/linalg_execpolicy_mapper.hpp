@@ -56,13 +56,16 @@ inline constexpr bool is_custom_linalg_execution_policy_v =
 // This helps disambiguate ExecutionPolicy from otherwise
 // unconstrained template parameters like ScaleFactorType in
 // algorithms like symmetric_matrix_rank_k_update.
+//
+// T may be a reference type, as it is when an algorithm deduces
+// ExecutionPolicy&& from a named policy object.
 template<class T>
 inline constexpr bool is_linalg_execution_policy_v =
   (
 #ifdef LINALG_HAS_EXECUTION
-    std::is_execution_policy_v<T> ||
+    std::is_execution_policy_v<std::remove_cv_t<std::remove_reference_t<T>>> ||
 #endif
-    is_custom_linalg_execution_policy_v<T>
+    is_custom_linalg_execution_policy_v<std::remove_cv_t<std::remove_reference_t<T>>>
   );
 
 // value is true if and only if T is _not_ inline_exec, and if T is
@@ -77,10 +80,34 @@ inline constexpr bool is_linalg_execution_policy_v =
 // algorithms like symmetric_matrix_rank_k_update.
 template<class T>
 inline constexpr bool is_linalg_execution_policy_other_than_inline_v =
-  ! is_inline_exec_v<T> &&
+  ! is_inline_exec_v<std::remove_cv_t<std::remove_reference_t<T>>> &&
   is_linalg_execution_policy_v<T>;
 
 } // namespace impl
+
+// Custom execution policy that runs algorithms on this
+// implementation's own pool of std::thread workers (see
+// thread_pool.hpp).  It needs neither Kokkos nor TBB.  Algorithms
+// without a thread_pool_exec overload run inline.
+struct thread_pool_exec {};
+
+namespace impl {
+template<>
+inline constexpr bool is_custom_linalg_execution_policy_v<thread_pool_exec> = true;
+} // namespace impl
+
+#ifdef LINALG_ENABLE_TBB
+// Custom execution policy that runs algorithms with Intel TBB's
+// parallel_for and parallel_deterministic_reduce (see tbb_exec.hpp).
+// Algorithms without a tbb_exec overload run on thread_pool_exec.
+struct tbb_exec {};
+
+namespace impl {
+template<>
+inline constexpr bool is_custom_linalg_execution_policy_v<tbb_exec> = true;
+} // namespace impl
+#endif
+
 } // namespace linalg
 } // inline namespace __p1673_version_0
 } // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
@@ -102,6 +129,31 @@ namespace linalg {
 template<class T>
 auto execpolicy_mapper(T) { return impl::inline_exec_t(); }
 
+#ifdef LINALG_ENABLE_TBB
+inline auto execpolicy_mapper(tbb_exec) { return thread_pool_exec(); }
+#endif
+
+#if defined(LINALG_HAS_EXECUTION) && ! defined(LINALG_ENABLE_KOKKOS)
+// Without Kokkos, the parallel Standard execution policies run on
+// TBB if it is enabled, else on the native thread pool.  The Kokkos
+// TPL provides its own mapping.
+#ifdef LINALG_ENABLE_TBB
+inline auto execpolicy_mapper(std::execution::parallel_policy) {
+  return tbb_exec();
+}
+inline auto execpolicy_mapper(std::execution::parallel_unsequenced_policy) {
+  return tbb_exec();
+}
+#else
+inline auto execpolicy_mapper(std::execution::parallel_policy) {
+  return thread_pool_exec();
+}
+inline auto execpolicy_mapper(std::execution::parallel_unsequenced_policy) {
+  return thread_pool_exec();
+}
+#endif // LINALG_ENABLE_TBB
+#endif
+
 namespace impl {
 
 // std::remove_cvref_t is a C++20 feature.
@@ -20,33 +20,385 @@
 
 #include <mdspan/mdspan.hpp>
 #include "layout_triangle.hpp"
+#include "conj_if_needed.hpp"
+#include "real_if_needed.hpp"
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
 
 namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
 namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
 inline namespace __p1673_version_0 {
 namespace linalg {
 
-// TODO declarations need extents-see-returns-below defined
+// Layout of a square matrix that stores only one triangle, packed
+// column by column (column_major_t) or row by row (row_major_t),
+// like the BLAS' packed formats.  Both (i,j) and (j,i) map to the
+// same element, so the mapping is not unique.
+template<class Triangle, class StorageOrder>
+class layout_blas_packed {
+public:
+  static_assert(std::is_same_v<Triangle, upper_triangle_t> ||
+                std::is_same_v<Triangle, lower_triangle_t>,
+                "Triangle must be upper_triangle_t or lower_triangle_t.");
+  static_assert(std::is_same_v<StorageOrder, column_major_t> ||
+                std::is_same_v<StorageOrder, row_major_t>,
+                "StorageOrder must be column_major_t or row_major_t.");
 
-#if 0
-template<class EltType,
-         class Extents,
-         class Layout,
-         class Accessor,
-         class Triangle,
-         class StorageOrder>
+  using triangle_type = Triangle;
+  using storage_order_type = StorageOrder;
+
+  template<class Extents>
+  struct mapping {
+  public:
+    using extents_type = Extents;
+    using index_type = typename extents_type::index_type;
+    using size_type = typename extents_type::size_type;
+    using rank_type = typename extents_type::rank_type;
+    using layout_type = layout_blas_packed;
+
+    static_assert(extents_type::rank() == 2,
+                  "layout_blas_packed only works with rank-2 extents.");
+    static_assert(extents_type::static_extent(0) == dynamic_extent ||
+                  extents_type::static_extent(1) == dynamic_extent ||
+                  extents_type::static_extent(0) == extents_type::static_extent(1),
+                  "layout_blas_packed requires square extents.");
+
+  private:
+    // Whether each column (for column_major_t) or row (for
+    // row_major_t) of the stored triangle ends with the diagonal.
+    static constexpr bool diagonal_last =
+      std::is_same_v<StorageOrder, column_major_t> ==
+      std::is_same_v<Triangle, upper_triangle_t>;
+
+    static constexpr bool static_size_at_most_one =
+      (extents_type::static_extent(0) != dynamic_extent &&
+       extents_type::static_extent(0) < 2) ||
+      (extents_type::static_extent(1) != dynamic_extent &&
+       extents_type::static_extent(1) < 2);
+
+  public:
+    constexpr mapping() noexcept = default;
+    constexpr mapping(const mapping&) noexcept = default;
+    constexpr mapping(const extents_type& e) noexcept : extents_(e)
+    {}
+
+    MDSPAN_TEMPLATE_REQUIRES(
+      class OtherExtents,
+      /* requires */ (std::is_constructible_v<extents_type, OtherExtents>)
+    )
+#if defined(__cpp_conditional_explicit)
+    explicit(! std::is_convertible_v<OtherExtents, extents_type>)
+#endif
+    constexpr mapping(const mapping<OtherExtents>& other) noexcept
+      : extents_(other.extents())
+    {}
+
+    constexpr mapping& operator=(const mapping&) noexcept = default;
+
+    constexpr const extents_type& extents() const noexcept
+    {
+      return extents_;
+    }
+
+    constexpr index_type required_span_size() const noexcept
+    {
+      const index_type n = extents_.extent(0);
+      return n * (n + 1) / 2;
+    }
+
+    MDSPAN_TEMPLATE_REQUIRES(
+      class IndexType0,
+      class IndexType1,
+      /* requires */ (
+        std::is_convertible_v<IndexType0, index_type> &&
+        std::is_convertible_v<IndexType1, index_type>
+      )
+    )
+    constexpr index_type operator() (IndexType0 ind0, IndexType1 ind1) const noexcept
+    {
+      index_type i = static_cast<index_type>(ind0);
+      index_type j = static_cast<index_type>(ind1);
+      // Elements outside the stored triangle map to their transposes.
+      if (std::is_same_v<Triangle, upper_triangle_t> ? i > j : i < j) {
+        std::swap(i, j);
+      }
+      // k indexes the stored column (or row), and r the element in it.
+      const index_type k = std::is_same_v<StorageOrder, column_major_t> ? j : i;
+      const index_type r = std::is_same_v<StorageOrder, column_major_t> ? i : j;
+      if constexpr (diagonal_last) {
+        return k * (k + 1) / 2 + r;
+      }
+      else {
+        const index_type n = extents_.extent(0);
+        return k * (2 * n - k - 1) / 2 + r;
+      }
+    }
+
+    static constexpr bool is_always_unique() noexcept
+    {
+      return static_size_at_most_one;
+    }
+    static constexpr bool is_always_exhaustive() noexcept
+    {
+      return true;
+    }
+    static constexpr bool is_always_strided() noexcept
+    {
+      return static_size_at_most_one;
+    }
+
+    constexpr bool is_unique() const noexcept
+    {
+      return extents_.extent(0) < 2;
+    }
+    constexpr bool is_exhaustive() const noexcept
+    {
+      return true;
+    }
+    constexpr bool is_strided() const noexcept
+    {
+      return extents_.extent(0) < 2;
+    }
+
+    constexpr index_type stride(rank_type r) const noexcept
+    {
+      assert(is_strided());
+      assert(r < extents_type::rank());
+      return index_type(1);
+    }
+
+    template<class OtherExtents>
+    friend constexpr bool
+    operator==(const mapping& lhs, const mapping<OtherExtents>& rhs) noexcept
+    {
+      return lhs.extents() == rhs.extents();
+    }
+
+  private:
+    extents_type extents_{};
+  };
+};
+
+// View the first num_rows * (num_rows + 1) / 2 elements of the
+// contiguous vector m as a num_rows x num_rows packed matrix.
+MDSPAN_TEMPLATE_REQUIRES(
+  class EltType,
+  class Extents,
+  class Layout,
+  class Accessor,
+  class Triangle,
+  class StorageOrder,
+  /* requires */ (Extents::rank() == 1 &&
+                  (std::is_same_v<Layout, layout_left> ||
+                   std::is_same_v<Layout, layout_right>))
+)
 constexpr mdspan<EltType,
-  <i>extents-see-returns-below</i>,
-  layout_blas_packed<
-    Triangle,
-    StorageOrder>,
+  extents<typename Extents::index_type, dynamic_extent, dynamic_extent>,
+  layout_blas_packed<Triangle, StorageOrder>,
   Accessor>
 packed(
   const mdspan<EltType, Extents, Layout, Accessor>& m,
   typename mdspan<EltType, Extents, Layout, Accessor>::index_type num_rows,
   Triangle,
-  StorageOrder);
-#endif // 0
+  StorageOrder)
+{
+  using index_type = typename Extents::index_type;
+  using extents_type = extents<index_type, dynamic_extent, dynamic_extent>;
+  using mapping_type = typename layout_blas_packed<Triangle, StorageOrder>::template mapping<extents_type>;
+  const mapping_type mapping{extents_type(num_rows, num_rows)};
+  assert(mapping.required_span_size() <= m.extent(0));
+  return {m.data_handle(), mapping, m.accessor()};
+}
+
+namespace impl {
+
+template<class Layout>
+inline constexpr bool is_layout_blas_packed_v = false;
+
+template<class Triangle, class StorageOrder>
+inline constexpr bool is_layout_blas_packed_v<layout_blas_packed<Triangle, StorageOrder>> = true;
+
+// The kernels below walk packed storage in order, one stored column
+// (column_major_t) or row (row_major_t) at a time, instead of
+// computing each element's offset from its indices.  Stored column
+// (or row) k holds the elements whose column (or row) index is k,
+// in increasing order of the other index; it starts or ends with the
+// diagonal element.
+template<class Layout>
+struct packed_storage;
+
+template<class Triangle, class StorageOrder>
+struct packed_storage<layout_blas_packed<Triangle, StorageOrder>> {
+  static constexpr bool column_major = std::is_same_v<StorageOrder, column_major_t>;
+  static constexpr bool upper = std::is_same_v<Triangle, upper_triangle_t>;
+  static constexpr bool diagonal_last = column_major == upper;
+
+  // Offset of the first element of stored column (or row) k.
+  template<class IndexType>
+  static constexpr IndexType start(IndexType n, IndexType k)
+  {
+    return diagonal_last ? k * (k + 1) / 2 : k * (2 * n - k + 1) / 2;
+  }
+};
+
+template<class Triangle, class Layout>
+constexpr void check_packed_triangle()
+{
+  static_assert(std::is_same_v<Triangle, typename Layout::triangle_type>,
+    "The Triangle argument must match the layout_blas_packed's Triangle.");
+}
+
+// Call f(i, j, A(i,j)) for each element of the stored triangle of A,
+// in storage order.
+template<class Triangle, class A_t, class F>
+void packed_for_each_stored_element(A_t A, F f)
+{
+  using storage = packed_storage<typename A_t::layout_type>;
+  using index_type = typename A_t::index_type;
+  check_packed_triangle<Triangle, typename A_t::layout_type>();
+
+  const index_type n = A.extent(0);
+  const auto& acc = A.accessor();
+  const auto p = A.data_handle();
+  index_type offset = 0;
+  for (index_type k = 0; k < n; ++k) {
+    const index_type r_begin = storage::diagonal_last ? index_type(0) : k;
+    const index_type r_end = storage::diagonal_last ? k + 1 : n;
+    for (index_type r = r_begin; r < r_end; ++r, ++offset) {
+      if constexpr (storage::column_major) {
+        f(r, k, acc.access(p, offset));
+      }
+      else {
+        f(k, r, acc.access(p, offset));
+      }
+    }
+  }
+}
+
+// z := z + A * x, where A is symmetric (Hermitian == false) or
+// Hermitian, and stores the Triangle triangle.  Each stored element
+// contributes to two entries of z, so one pass over A suffices.
+template<bool Hermitian, class Triangle, class A_t, class X_t, class Z_t>
+void packed_symmetric_matrix_vector_product(A_t A, X_t x, Z_t z)
+{
+  using storage = packed_storage<typename A_t::layout_type>;
+  using index_type = typename A_t::index_type;
+  using value_type_A = typename A_t::value_type;
+  using sum_type = decltype(std::declval<value_type_A>() * x(0));
+  check_packed_triangle<Triangle, typename A_t::layout_type>();
+
+  auto conj_if_hermitian = [] (const value_type_A& a) {
+    if constexpr (Hermitian) {
+      return conj_if_needed(a);
+    }
+    else {
+      return a;
+    }
+  };
+  auto diagonal = [] (const value_type_A& a) {
+    if constexpr (Hermitian) {
+      return real_if_needed(a);
+    }
+    else {
+      return a;
+    }
+  };
+
+  const index_type n = A.extent(0);
+  const auto& acc = A.accessor();
+  const auto p = A.data_handle();
+  index_type offset = 0;
+  for (index_type k = 0; k < n; ++k) {
+    const index_type r_begin = storage::diagonal_last ? index_type(0) : k + 1;
+    const index_type r_end = storage::diagonal_last ? k : n;
+    const auto x_k = x(k);
+    sum_type sum{};
+    if constexpr (! storage::diagonal_last) {
+      sum += diagonal(acc.access(p, offset)) * x_k;
+      ++offset;
+    }
+    for (index_type r = r_begin; r < r_end; ++r, ++offset) {
+      const value_type_A a = acc.access(p, offset);
+      if constexpr (storage::column_major) {
+        // a is A(r,k).
+        z(r) += a * x_k;
+        sum += conj_if_hermitian(a) * x(r);
+      }
+      else {
+        // a is A(k,r).
+        z(r) += conj_if_hermitian(a) * x_k;
+        sum += a * x(r);
+      }
+    }
+    if constexpr (storage::diagonal_last) {
+      sum += diagonal(acc.access(p, offset)) * x_k;
+      ++offset;
+    }
+    z(k) += sum;
+  }
+}
+
+// Solve A x = b for x, where A is triangular and stores the Triangle
+// triangle.  Column-major storage gives a column-oriented solve, and
+// row-major storage a dot-product-oriented solve, so that both read
+// A in storage order.
+template<class Triangle, class DiagonalStorage, class A_t, class B_t, class X_t, class BinaryDivideOp>
+void packed_triangular_matrix_vector_solve(A_t A, B_t b, X_t x, BinaryDivideOp divide)
+{
+  using storage = packed_storage<typename A_t::layout_type>;
+  using index_type = typename A_t::index_type;
+  constexpr bool explicit_diagonal =
+    std::is_same_v<DiagonalStorage, explicit_diagonal_t>;
+  check_packed_triangle<Triangle, typename A_t::layout_type>();
+
+  const index_type n = A.extent(0);
+  const auto& acc = A.accessor();
+  const auto p = A.data_handle();
+
+  if constexpr (storage::column_major) {
+    for (index_type i = 0; i < n; ++i) {
+      x(i) = b(i);
+    }
+  }
+  // Lower triangular solves go forward; upper ones go backward.
+  for (index_type step = 0; step < n; ++step) {
+    const index_type k = storage::upper ? n - 1 - step : step;
+    const index_type start = storage::start(n, k);
+    const index_type diagonal_offset = storage::diagonal_last ? start + k : start;
+    const index_type r_begin = storage::diagonal_last ? index_type(0) : k + 1;
+    const index_type r_end = storage::diagonal_last ? k : n;
+    const index_type r_offset = storage::diagonal_last ? start : start + 1;
+
+    if constexpr (storage::column_major) {
+      // Column k of A holds A(r,k) for the rows r that x(k) updates.
+      if constexpr (explicit_diagonal) {
+        x(k) = divide(x(k), acc.access(p, diagonal_offset));
+      }
+      const auto x_k = x(k);
+      for (index_type r = r_begin; r < r_end; ++r) {
+        x(r) -= acc.access(p, r_offset + (r - r_begin)) * x_k;
+      }
+    }
+    else {
+      // Row k of A holds A(k,r) for the entries x(r) already solved.
+      using sum_type = decltype(b(k) - acc.access(p, 0) * x(k));
+      sum_type t(b(k));
+      for (index_type r = r_begin; r < r_end; ++r) {
+        t = t - acc.access(p, r_offset + (r - r_begin)) * x(r);
+      }
+      if constexpr (explicit_diagonal) {
+        x(k) = divide(t, acc.access(p, diagonal_offset));
+      }
+      else {
+        x(k) = t;
+      }
+    }
+  }
+}
+
+} // end namespace impl
 
 } // end namespace linalg
 } // end inline namespace __p1673_version_0
@@ -0,0 +1,581 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_SIMD_REDUCTIONS_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_SIMD_REDUCTIONS_HPP_
+
+#include <mdspan/mdspan.hpp>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+// Vectorized kernels for the BLAS 1 reductions dot, vector_abs_sum,
+// vector_idx_abs_max, and vector_sum_of_squares, on contiguous
+// vectors of float or double (and, for vector_abs_sum, complex
+// thereof) with default_accessor.  dot also takes vectors whose
+// accessors nest scaled_accessor and conjugated_accessor around
+// default_accessor; it multiplies the sum by the scaling factors
+// once, instead of scaling every element.  The algorithms' generic loops
+// carry a single accumulator, so they run at the latency of one
+// floating-point add per element, and the accessor indirection keeps
+// compilers from vectorizing them.  These kernels keep several
+// independent vector accumulators instead.
+//
+// The kernels use the GCC / Clang vector extensions, so the same
+// source compiles to SSE2 or NEON, AVX2, or AVX-512 depending on the
+// target of the function that instantiates it.  On x86, the widest
+// instruction set that the running processor supports is chosen once,
+// at run time, so a binary built for the baseline architecture still
+// uses AVX2 or AVX-512 where available.  Other compilers use the
+// algorithms' generic loops.
+//
+// Summing in several accumulators reorders the floating-point
+// additions, so results may differ from the generic loops' in the
+// last bits, as they would from an optimized BLAS.
+// vector_idx_abs_max's result does not change: it is still the first
+// index of the largest magnitude.
+
+#if defined(__GNUC__) && ! defined(__NVCOMPILER) && ! defined(__CUDA_ARCH__)
+#  define LINALG_HAS_SIMD_REDUCTIONS 1
+#endif
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+namespace impl {
+
+// Value types for which the kernels are valid.
+template<class T>
+inline constexpr bool is_simd_reduction_value_v =
+#if defined(LINALG_HAS_SIMD_REDUCTIONS)
+  std::is_same_v<T, float> || std::is_same_v<T, double>;
+#else
+  false;
+#endif
+
+// Is the rank-1 mdspan type one whose elements the kernels can
+// address directly through data_handle()?  Whether the elements are
+// actually contiguous is a run-time property (see
+// is_contiguous_vector).
+template<class Vector>
+struct is_simd_reducible_vector : std::false_type {};
+
+template<class ElementType, class Extents, class Layout>
+struct is_simd_reducible_vector<
+  mdspan<ElementType, Extents, Layout, default_accessor<ElementType>>>
+  : std::bool_constant<
+      Extents::rank() == 1 &&
+      Layout::template mapping<Extents>::is_always_strided()>
+{};
+
+template<class Vector>
+inline constexpr bool is_simd_reducible_vector_v =
+  is_simd_reducible_vector<Vector>::value;
+
+// Is the rank-1 mdspan type one whose stored elements the kernels
+// can address, once scaled_accessor and conjugated_accessor are
+// peeled off its accessor (see accessor_unwrap_traits)?  The stored
+// elements must have the mdspan's value_type.  Conjugating the real
+// values that the kernels take does nothing.
+template<class Vector>
+struct is_simd_peelable_vector : std::false_type {};
+
+template<class ElementType, class Extents, class Layout, class Accessor>
+struct is_simd_peelable_vector<mdspan<ElementType, Extents, Layout, Accessor>> {
+private:
+  using traits = accessor_unwrap_traits<Accessor>;
+
+  static constexpr bool stores_value_type() {
+    if constexpr (traits::is_valid) {
+      return std::is_same_v<std::remove_cv_t<typename traits::element_type>,
+                            std::remove_cv_t<ElementType>>;
+    }
+    else {
+      return false;
+    }
+  }
+public:
+  static constexpr bool value =
+    Extents::rank() == 1 &&
+    Layout::template mapping<Extents>::is_always_strided() &&
+    stores_value_type();
+};
+
+template<class Vector>
+inline constexpr bool is_simd_peelable_vector_v =
+  is_simd_peelable_vector<Vector>::value;
+
+template<class Vector>
+bool is_contiguous_vector(const Vector& v)
+{
+  return v.extent(0) <= 1 || v.stride(0) == 1;
+}
+
+#if defined(LINALG_HAS_SIMD_REDUCTIONS)
+
+// Vector of Bytes / sizeof(T) elements of type T.
+template<class T, ::std::size_t Bytes>
+struct simd_vector {
+  typedef T type __attribute__((vector_size(Bytes)));
+};
+
+template<class T, ::std::size_t Bytes>
+using simd_vector_t = typename simd_vector<T, Bytes>::type;
+
+template<class T, ::std::size_t Bytes>
+using simd_mask_t = decltype(simd_vector_t<T, Bytes>{} < simd_vector_t<T, Bytes>{});
+
+// The helpers take vectors by reference.  Passing or returning a
+// vector wider than the baseline instruction set by value from a
+// function without a target attribute has no stable calling
+// convention, and GCC warns about it (-Wpsabi).
+
+template<class V, class T>
+[[gnu::always_inline]] inline void simd_load(V& v, const T* x)
+{
+  __builtin_memcpy(&v, x, sizeof(V));
+}
+
+template<class V, class T>
+[[gnu::always_inline]] inline void simd_load_abs(V& v, const T* x)
+{
+  __builtin_memcpy(&v, x, sizeof(V));
+  v = v < V{} ? -v : v;
+}
+
+template<class T, class V>
+[[gnu::always_inline]] inline T simd_sum(const V& v)
+{
+  T sum{};
+  for (::std::size_t l = 0; l < sizeof(V) / sizeof(T); ++l) {
+    sum += v[l];
+  }
+  return sum;
+}
+
+template<class T, class V>
+[[gnu::always_inline]] inline T simd_max(const V& v)
+{
+  T result = v[0];
+  for (::std::size_t l = 1; l < sizeof(V) / sizeof(T); ++l) {
+    result = result < v[l] ? v[l] : result;
+  }
+  return result;
+}
+
+template<class T>
+T scalar_abs(T x)
+{
+  return x < T{} ? -x : x;
+}
+
+// Each kernel is a struct with a static member function template
+// run<Bytes>, that processes the input with vectors of Bytes bytes.
+// simd_reduce instantiates it for the chosen instruction set.  The
+// sums use simd_accumulators independent vectors, to hide the
+// latency of floating-point addition.  The main loops unroll over
+// the accumulators with unrolled_for (see fixed_size_kernels.hpp),
+// so that they index the arrays of accumulators with constants, and
+// the compiler keeps the accumulators in registers.
+inline constexpr ::std::size_t simd_accumulators = 4;
+
+// Sum of x[k] * y[k] for k in [0, n).
+struct simd_dot_kernel {
+  template<::std::size_t Bytes, class T>
+  [[gnu::always_inline]] static inline T run(const T* x, const T* y, ::std::size_t n)
+  {
+    using V = simd_vector_t<T, Bytes>;
+    constexpr ::std::size_t L = Bytes / sizeof(T);
+    constexpr ::std::size_t A = simd_accumulators;
+    V sum[A] = {};
+    V x_k, y_k;
+    ::std::size_t k = 0;
+    for (; k + A * L <= n; k += A * L) {
+      unrolled_for<A>([&] (auto a) {
+        simd_load(x_k, x + k + a * L);
+        simd_load(y_k, y + k + a * L);
+        sum[a] += x_k * y_k;
+      });
+    }
+    for (; k + L <= n; k += L) {
+      simd_load(x_k, x + k);
+      simd_load(y_k, y + k);
+      sum[0] += x_k * y_k;
+    }
+    for (::std::size_t a = 1; a < A; ++a) {
+      sum[0] += sum[a];
+    }
+    T result = simd_sum<T>(sum[0]);
+    for (; k < n; ++k) {
+      result += x[k] * y[k];
+    }
+    return result;
+  }
+};
+
+// Sum of |x[k]| for k in [0, n).
+struct simd_abs_sum_kernel {
+  template<::std::size_t Bytes, class T>
+  [[gnu::always_inline]] static inline T run(const T* x, ::std::size_t n)
+  {
+    using V = simd_vector_t<T, Bytes>;
+    constexpr ::std::size_t L = Bytes / sizeof(T);
+    constexpr ::std::size_t A = simd_accumulators;
+    V sum[A] = {};
+    V a_k;
+    ::std::size_t k = 0;
+    for (; k + A * L <= n; k += A * L) {
+      unrolled_for<A>([&] (auto a) {
+        simd_load_abs(a_k, x + k + a * L);
+        sum[a] += a_k;
+      });
+    }
+    for (; k + L <= n; k += L) {
+      simd_load_abs(a_k, x + k);
+      sum[0] += a_k;
+    }
+    for (::std::size_t a = 1; a < A; ++a) {
+      sum[0] += sum[a];
+    }
+    T result = simd_sum<T>(sum[0]);
+    for (; k < n; ++k) {
+      result += scalar_abs(x[k]);
+    }
+    return result;
+  }
+};
+
+// First index of the largest |x[k]| for k in [0, n), with n > 0.
+// Like the generic loop, this only replaces the current maximum with
+// a strictly larger value, so NaN is never chosen unless it is x[0].
+struct simd_idx_abs_max_kernel {
+  template<::std::size_t Bytes, class T>
+  [[gnu::always_inline]] static inline ::std::size_t run(const T* x, ::std::size_t n)
+  {
+    using V = simd_vector_t<T, Bytes>;
+    using I = simd_mask_t<T, Bytes>;
+    constexpr ::std::size_t L = Bytes / sizeof(T);
+    constexpr ::std::size_t A = 2;
+
+    // Every lane starts with |x[0]| at index 0, so that a NaN there
+    // wins everywhere, as in the generic loop.
+    const T first = scalar_abs(x[0]);
+    V max[A];
+    I idx[A] = {};
+    I next[A];
+    for (::std::size_t a = 0; a < A; ++a) {
+      max[a] = V{} + first;
+      for (::std::size_t l = 0; l < L; ++l) {
+        next[a][l] = a * L + l;
+      }
+    }
+
+    V a_k;
+    ::std::size_t k = 0;
+    for (; k + A * L <= n; k += A * L) {
+      unrolled_for<A>([&] (auto a) {
+        simd_load_abs(a_k, x + k + a * L);
+        const I greater = max[a] < a_k;
+        max[a] = greater ? a_k : max[a];
+        idx[a] = greater ? next[a] : idx[a];
+        next[a] += A * L;
+      });
+    }
+
+    // Each lane holds the first index of its largest value.  Of the
+    // lanes' candidates, take the largest value, then the first index.
+    T max_val = first;
+    ::std::size_t max_idx = 0;
+    for (::std::size_t a = 0; a < A; ++a) {
+      for (::std::size_t l = 0; l < L; ++l) {
+        const T val = max[a][l];
+        const auto i = static_cast<::std::size_t>(idx[a][l]);
+        if (max_val < val || (val == max_val && i < max_idx)) {
+          max_val = val;
+          max_idx = i;
+        }
+      }
+    }
+    for (; k < n; ++k) {
+      if (max_val < scalar_abs(x[k])) {
+        max_val = scalar_abs(x[k]);
+        max_idx = k;
+      }
+    }
+    return max_idx;
+  }
+};
+
+template<class T>
+struct simd_sum_of_squares_t {
+  T sum_of_squares;
+  T max_abs;
+};
+
+// Unscaled sum of x[k]^2, and the largest |x[k]|, for k in [0, n).
+// Callers must check that neither overflowed or underflowed.
+struct simd_sum_of_squares_kernel {
+  template<::std::size_t Bytes, class T>
+  [[gnu::always_inline]] static inline simd_sum_of_squares_t<T>
+  run(const T* x, ::std::size_t n)
+  {
+    using V = simd_vector_t<T, Bytes>;
+    constexpr ::std::size_t L = Bytes / sizeof(T);
+    constexpr ::std::size_t A = simd_accumulators;
+    V sum[A] = {};
+    V max[A] = {};
+    V a_k;
+    ::std::size_t k = 0;
+    for (; k + A * L <= n; k += A * L) {
+      unrolled_for<A>([&] (auto a) {
+        simd_load_abs(a_k, x + k + a * L);
+        sum[a] += a_k * a_k;
+        max[a] = max[a] < a_k ? a_k : max[a];
+      });
+    }
+    for (; k + L <= n; k += L) {
+      simd_load_abs(a_k, x + k);
+      sum[0] += a_k * a_k;
+      max[0] = max[0] < a_k ? a_k : max[0];
+    }
+    for (::std::size_t a = 1; a < A; ++a) {
+      sum[0] += sum[a];
+    }
+    for (::std::size_t a = 1; a < A; ++a) {
+      max[0] = max[0] < max[a] ? max[a] : max[0];
+    }
+    simd_sum_of_squares_t<T> result{simd_sum<T>(sum[0]), simd_max<T>(max[0])};
+    for (; k < n; ++k) {
+      const T a = scalar_abs(x[k]);
+      result.sum_of_squares += a * a;
+      result.max_abs = result.max_abs < a ? a : result.max_abs;
+    }
+    return result;
+  }
+};
+
+// Instruction sets for which simd_reduce instantiates the kernels.
+enum class simd_isa { baseline, avx2, avx512 };
+
+inline simd_isa detected_simd_isa()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  static const simd_isa isa = [] {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+      return simd_isa::avx512;
+    }
+    else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+      return simd_isa::avx2;
+    }
+    return simd_isa::baseline;
+  }();
+  return isa;
+#else
+  return simd_isa::baseline;
+#endif
+}
+
+// The kernels' run functions are always_inline, so each of these
+// compiles its own copy for its target.
+template<class Kernel, class... Args>
+auto simd_reduce_baseline(Args... args)
+{
+  return Kernel::template run<16>(args...);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+template<class Kernel, class... Args>
+[[gnu::target("avx2,fma")]] auto simd_reduce_avx2(Args... args)
+{
+  return Kernel::template run<32>(args...);
+}
+
+template<class Kernel, class... Args>
+[[gnu::target("avx512f")]] auto simd_reduce_avx512(Args... args)
+{
+  return Kernel::template run<64>(args...);
+}
+#endif
+
+template<class Kernel, class... Args>
+auto simd_reduce(Args... args)
+{
+#if defined(__x86_64__) || defined(__i386__)
+  switch (detected_simd_isa()) {
+  case simd_isa::avx512:
+    return simd_reduce_avx512<Kernel>(args...);
+  case simd_isa::avx2:
+    return simd_reduce_avx2<Kernel>(args...);
+  default:
+    break;
+  }
+#endif
+  return simd_reduce_baseline<Kernel>(args...);
+}
+
+#endif // LINALG_HAS_SIMD_REDUCTIONS
+
+// The algorithms call these only if the corresponding use_simd_*_v
+// is true, and is_contiguous_vector holds for each argument.
+
+// dot(v1, v2, init), if both vectors and init have the same real
+// value type.  simd_dot returns the dot product of the stored
+// elements; the caller multiplies it by the scaling factors.
+template<class v1_t, class v2_t, class Scalar>
+inline constexpr bool use_simd_dot_v =
+  is_simd_peelable_vector_v<v1_t> && is_simd_peelable_vector_v<v2_t> &&
+  is_simd_reduction_value_v<Scalar> &&
+  std::is_same_v<typename v1_t::value_type, Scalar> &&
+  std::is_same_v<typename v2_t::value_type, Scalar>;
+
+template<class v1_t, class v2_t>
+auto simd_dot(v1_t v1, v2_t v2)
+{
+#if defined(LINALG_HAS_SIMD_REDUCTIONS)
+  using T = typename v1_t::value_type;
+  return simd_reduce<simd_dot_kernel>(static_cast<const T*>(v1.data_handle()),
+                                      static_cast<const T*>(v2.data_handle()),
+                                      static_cast<::std::size_t>(v1.extent(0)));
+#else
+  return typename v1_t::value_type{};
+#endif
+}
+
+// vector_abs_sum(v, init), for real v of the same value type as
+// init, or complex v whose real part has init's type.  The latter
+// is the sum of the absolute values of the 2 * v.extent(0) real
+// numbers, which std::complex stores in sequence.
+template<class v_t, class = void>
+struct simd_real_value { using type = typename v_t::value_type; };
+
+template<class v_t>
+struct simd_real_value<v_t, std::enable_if_t<is_complex_v<typename v_t::value_type>>> {
+  using type = typename v_t::value_type::value_type;
+};
+
+template<class v_t, class Scalar>
+inline constexpr bool use_simd_abs_sum_v =
+  is_simd_reducible_vector_v<v_t> &&
+  is_simd_reduction_value_v<Scalar> &&
+  std::is_same_v<typename simd_real_value<v_t>::type, Scalar> &&
+  (std::is_same_v<typename v_t::value_type, Scalar> ||
+   std::is_same_v<typename v_t::value_type, ::std::complex<Scalar>>);
+
+template<class v_t>
+auto simd_abs_sum(v_t v)
+{
+  using T = typename simd_real_value<v_t>::type;
+#if defined(LINALG_HAS_SIMD_REDUCTIONS)
+  constexpr ::std::size_t factor = sizeof(typename v_t::value_type) / sizeof(T);
+  return simd_reduce<simd_abs_sum_kernel>(
+    reinterpret_cast<const T*>(v.data_handle()),
+    factor * static_cast<::std::size_t>(v.extent(0)));
+#else
+  return T{};
+#endif
+}
+
+// vector_idx_abs_max(v) for real v.  The kernel keeps indices in
+// integer lanes as wide as the elements, which bounds the length.
+template<class v_t>
+inline constexpr bool use_simd_idx_abs_max_v =
+  is_simd_reducible_vector_v<v_t> &&
+  is_simd_reduction_value_v<typename v_t::value_type>;
+
+template<class v_t>
+bool simd_idx_abs_max_fits(const v_t& v)
+{
+  using T = typename v_t::value_type;
+  using index_type = ::std::conditional_t<sizeof(T) == 4, ::std::int32_t, ::std::int64_t>;
+  return static_cast<::std::size_t>(v.extent(0)) <=
+    static_cast<::std::size_t>(::std::numeric_limits<index_type>::max());
+}
+
+template<class v_t>
+typename v_t::size_type simd_idx_abs_max(v_t v)
+{
+#if defined(LINALG_HAS_SIMD_REDUCTIONS)
+  using T = typename v_t::value_type;
+  return static_cast<typename v_t::size_type>(
+    simd_reduce<simd_idx_abs_max_kernel>(static_cast<const T*>(v.data_handle()),
+                                         static_cast<::std::size_t>(v.extent(0))));
+#else
+  return 0;
+#endif
+}
+
+// vector_sum_of_squares(v, init) for real v of the same value type
+// as init.  The kernel sums unscaled squares, which is exact enough
+// unless the largest magnitude is so small that its square is
+// subnormal, or the sum overflows.  In those cases, and if v
+// contains Inf or NaN, simd_sum_of_squares returns false, and the
+// caller must use the generic scaled loop.
+template<class v_t, class Scalar>
+inline constexpr bool use_simd_sum_of_squares_v =
+  is_simd_reducible_vector_v<v_t> &&
+  is_simd_reduction_value_v<Scalar> &&
+  std::is_same_v<typename v_t::value_type, Scalar>;
+
+template<class v_t, class Result>
+bool simd_sum_of_squares(v_t v, Result& result)
+{
+#if defined(LINALG_HAS_SIMD_REDUCTIONS)
+  using T = typename v_t::value_type;
+  const auto [sum, max_abs] = simd_reduce<simd_sum_of_squares_kernel>(
+    static_cast<const T*>(v.data_handle()), static_cast<::std::size_t>(v.extent(0)));
+  // The running maximum skips NaN, but the sum carries it, so test
+  // the sum before taking zero max_abs to mean all zeros.
+  if (! (sum <= ::std::numeric_limits<T>::max())) {
+    return false;
+  }
+  if (max_abs == T{}) {
+    return true; // all zeros, which do not change result
+  }
+  using std::sqrt;
+  if (! (max_abs >= sqrt(::std::numeric_limits<T>::min()))) {
+    return false;
+  }
+  // scale^2 * ssq + sum == new_scale^2 * new_ssq, with new_scale
+  // the larger of scale and max_abs.
+  const T scale = result.scaling_factor;
+  if (scale < max_abs) {
+    const T quotient = scale / max_abs;
+    result.scaled_sum_of_squares =
+      result.scaled_sum_of_squares * quotient * quotient + (sum / max_abs) / max_abs;
+    result.scaling_factor = max_abs;
+  }
+  else {
+    result.scaled_sum_of_squares += (sum / scale) / scale;
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+} // end namespace impl
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_SIMD_REDUCTIONS_HPP_
@@ -0,0 +1,1648 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_TBB_EXEC_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_TBB_EXEC_HPP_
+
+#include "thread_pool_exec.hpp"
+#include <tbb/blocked_range.h>
+#include <tbb/blocked_range2d.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+// Overloads of the algorithms for tbb_exec.  The BLAS 3 kernels run
+// tbb::parallel_for over two-dimensional blocked ranges of the output
+// matrix.  The reductions use tbb::parallel_deterministic_reduce,
+// whose split of the input depends only on its size and grain size,
+// so their results do not depend on the number of threads.
+//
+// As with thread_pool_exec, operations that the external BLAS can
+// take still go to the BLAS.  Algorithms that have no tbb_exec
+// overload here run on thread_pool_exec (see execpolicy_mapper).
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+namespace impl {
+
+// C = beta * C + alpha * A * B, with a parallel_for over the tiles
+// of C.
+template<class T>
+void tbb_blocked_gemm(const T& alpha,
+                      strided_matrix_view<const T> A,
+                      strided_matrix_view<const T> B,
+                      const T& beta,
+                      strided_matrix_view<T> C)
+{
+  using tiling = gemm_tiling<T>;
+  const tbb::blocked_range2d<::std::ptrdiff_t> tiles(
+    0, tiling::num_tile_rows(C.extent0), 1,
+    0, tiling::num_tile_cols(C.extent1), 1);
+
+  tbb::parallel_for(tiles, [&] (const tbb::blocked_range2d<::std::ptrdiff_t>& r) {
+    for (::std::ptrdiff_t tile_col = r.cols().begin(); tile_col < r.cols().end(); ++tile_col) {
+      for (::std::ptrdiff_t tile_row = r.rows().begin(); tile_row < r.rows().end(); ++tile_row) {
+        blocked_gemm_tile(alpha, A, B, beta, C, tile_row, tile_col);
+      }
+    }
+  });
+}
+
+// update_block on all of C, with a parallel_for over its blocks.
+template<class Triangle, class C_t, class Start, class Term>
+void tbb_update_blocks(C_t C, ::std::size_t num_terms,
+                       const Start& start, const Term& term)
+{
+  using index_type = typename C_t::index_type;
+  constexpr ::std::size_t row_grain = 64;
+  const ::std::size_t col_grain =
+    parallel_min_chunk(row_grain * ::std::max(num_terms, ::std::size_t(1)));
+  const tbb::blocked_range2d<index_type> blocks(
+    index_type(0), C.extent(0), row_grain,
+    index_type(0), C.extent(1), col_grain);
+
+  tbb::parallel_for(blocks, [&] (const tbb::blocked_range2d<index_type>& r) {
+    update_block<Triangle>(C, r.rows().begin(), r.rows().end(),
+                           r.cols().begin(), r.cols().end(),
+                           num_terms, start, term);
+  });
+}
+
+// Return combine(init, r), where r is the combination of
+// reduce(begin_k, end_k) over contiguous chunks [begin_k, end_k)
+// covering [0, n).  identity must satisfy combine(identity, x) == x.
+template<class T, class Index, class Reduce, class Combine>
+T tbb_reduce_ranges(Index n, ::std::size_t grain_size, T init, const T& identity,
+                    const Reduce& reduce, const Combine& combine)
+{
+  const T total = tbb::parallel_deterministic_reduce(
+    tbb::blocked_range<Index>(Index(0), n, grain_size), identity,
+    [&] (const tbb::blocked_range<Index>& r, T partial) {
+      return r.empty() ? partial : combine(partial, reduce(r.begin(), r.end()));
+    },
+    combine);
+  return combine(init, total);
+}
+
+// y(i) = start(i) + (A * x)(i) with blocked_gemv, with a
+// parallel_for over chunks of rows.  If A has too few rows for that,
+// chunks of columns compute partial results, which a deterministic
+// reduction adds up.
+template<class A_t, class x_t, class y_t, class Start>
+void tbb_blocked_gemv(A_t A, x_t x, y_t y, const Start& start)
+{
+  using T = typename y_t::value_type;
+  const ::std::ptrdiff_t num_rows = A.extent(0);
+  const ::std::ptrdiff_t num_cols = A.extent(1);
+  const ::std::size_t row_grain = parallel_min_chunk(::std::size_t(num_cols));
+  if (gemv_split_columns(num_rows, num_cols, row_grain)) {
+    const ::std::vector<T> zero(num_rows);
+    const ::std::vector<T> sum = tbb_reduce_ranges(num_cols,
+      parallel_min_chunk(::std::size_t(num_rows)), zero, zero,
+      [&] (::std::ptrdiff_t begin, ::std::ptrdiff_t end) {
+        return gemv_column_partial(A, x, begin, end);
+      },
+      [] (::std::vector<T> total, const ::std::vector<T>& partial) {
+        for (::std::size_t i = 0; i < total.size(); ++i) {
+          total[i] += partial[i];
+        }
+        return total;
+      });
+    for (::std::ptrdiff_t i = 0; i < num_rows; ++i) {
+      y(i) = static_cast<T>(start(i)) + sum[i];
+    }
+  }
+  else {
+    const tbb::blocked_range<::std::ptrdiff_t> rows(0, num_rows, row_grain);
+    tbb::parallel_for(rows, [&] (const tbb::blocked_range<::std::ptrdiff_t>& r) {
+        blocked_gemv_rows(A, x, y, start, r.begin(), r.end());
+      });
+  }
+}
+
+// acc += A * x_packed with gemv_accumulate, with a parallel_for over
+// chunks of A's rows.  The parallel triangular_matrix_vector_solve
+// does its updates with this.
+template<class T>
+void tbb_gemv_accumulate(strided_matrix_view<const T> A, const T* x_packed, T* acc)
+{
+  const tbb::blocked_range<::std::ptrdiff_t> rows(0, A.extent0,
+    parallel_min_chunk(::std::size_t(A.extent1)));
+  tbb::parallel_for(rows, [&] (const tbb::blocked_range<::std::ptrdiff_t>& r) {
+      gemv_accumulate(A.block(r.begin(), 0, r.end() - r.begin(), A.extent1),
+        x_packed, acc + r.begin());
+    });
+}
+
+// y(i) = start(i) + (A * x)(i) with blocked_symv.  Chunks of the
+// engine's pairs of column groups compute partial results, which a
+// deterministic reduction adds up.
+template<bool Hermitian, class Triangle, class A_t, class x_t, class y_t, class Start>
+void tbb_blocked_symv(A_t A, x_t x, y_t y, const Start& start)
+{
+  using T = typename y_t::value_type;
+  const ::std::ptrdiff_t n = A.extent(0);
+  const ::std::vector<T> zero(n);
+  const ::std::vector<T> sum = tbb_reduce_ranges(symv_num_pairs<T>(n),
+    parallel_min_chunk(gemv_blocking<T>::rt * ::std::size_t(n)), zero, zero,
+    [&] (::std::ptrdiff_t begin, ::std::ptrdiff_t end) {
+      return symv_partial<Hermitian, Triangle>(A, x, begin, end);
+    },
+    [] (::std::vector<T> total, const ::std::vector<T>& partial) {
+      for (::std::size_t i = 0; i < total.size(); ++i) {
+        total[i] += partial[i];
+      }
+      return total;
+    });
+  for (::std::ptrdiff_t i = 0; i < n; ++i) {
+    y(i) = static_cast<T>(start(i)) + sum[i];
+  }
+}
+
+} // end namespace impl
+
+// dot
+
+template<class ElementType1,
+         class SizeType1, ::std::size_t ext1,
+         class Layout1,
+         class Accessor1,
+         class ElementType2,
+         class SizeType2, ::std::size_t ext2,
+         class Layout2,
+         class Accessor2,
+         class Scalar>
+Scalar dot(
+  tbb_exec /* exec */,
+  mdspan<ElementType1, extents<SizeType1, ext1>, Layout1, Accessor1> v1,
+  mdspan<ElementType2, extents<SizeType2, ext2>, Layout2, Accessor2> v2,
+  Scalar init)
+{
+  static_assert(v1.static_extent(0) == dynamic_extent ||
+                v2.static_extent(0) == dynamic_extent ||
+                v1.static_extent(0) == v2.static_extent(0));
+
+  using size_type = std::common_type_t<SizeType1, SizeType2>;
+  return impl::tbb_reduce_ranges(size_type(v1.extent(0)),
+    impl::parallel_min_chunk(1), init, Scalar{},
+    [&] (size_type begin, size_type end) {
+      Scalar sum{};
+      for (size_type k = begin; k < end; ++k) {
+        sum += v1(k) * v2(k);
+      }
+      return sum;
+    },
+    [] (const Scalar& x, const Scalar& y) { return x + y; });
+}
+
+// vector_abs_sum
+
+template<class ElementType,
+         class SizeType, ::std::size_t ext0,
+         class Layout,
+         class Accessor,
+         class Scalar>
+Scalar vector_abs_sum(
+  tbb_exec /* exec */,
+  mdspan<ElementType, extents<SizeType, ext0>, Layout, Accessor> v,
+  Scalar init)
+{
+  using value_type = typename decltype(v)::value_type;
+  return impl::tbb_reduce_ranges(v.extent(0),
+    impl::parallel_min_chunk(1), init, Scalar{},
+    [&] (SizeType begin, SizeType end) {
+      Scalar sum{};
+      for (SizeType i = begin; i < end; ++i) {
+        if constexpr (std::is_arithmetic_v<value_type>) {
+          sum += impl::abs_if_needed(v(i));
+        }
+        else {
+          sum += impl::abs_if_needed(impl::real_if_needed(v(i)));
+          sum += impl::abs_if_needed(impl::imag_if_needed(v(i)));
+        }
+      }
+      return sum;
+    },
+    [] (const Scalar& x, const Scalar& y) { return x + y; });
+}
+
+// vector_sum_of_squares and vector_two_norm
+
+template<class ElementType,
+         class SizeType, ::std::size_t ext0,
+         class Layout,
+         class Accessor,
+         class Scalar>
+sum_of_squares_result<Scalar> vector_sum_of_squares(
+  tbb_exec /* exec */,
+  mdspan<ElementType, extents<SizeType, ext0>, Layout, Accessor> x,
+  sum_of_squares_result<Scalar> init)
+{
+  if (x.extent(0) == 0) {
+    return init;
+  }
+  using value_type = typename decltype(x)::value_type;
+  if constexpr (impl::use_blue_sum_of_squares_v<value_type, Scalar>) {
+    const auto ssq = impl::tbb_reduce_ranges(x.extent(0),
+      impl::parallel_min_chunk(1), impl::blue_sum_of_squares<Scalar>{}, impl::blue_sum_of_squares<Scalar>{},
+      [&] (SizeType begin, SizeType end) {
+        return impl::blue_sum_of_squares_of_range<Scalar>(x, begin, end);
+      },
+      impl::blue_sum_of_squares<Scalar>::merged);
+    return combine_sum_of_squares(init, ssq.result());
+  }
+  return impl::tbb_reduce_ranges(x.extent(0),
+    impl::parallel_min_chunk(1), init, sum_of_squares_result<Scalar>{},
+    [&] (SizeType begin, SizeType end) {
+      Scalar scale{};
+      Scalar ssq{};
+      for (SizeType i = begin; i < end; ++i) {
+        impl::accumulate_sum_of_squares(scale, ssq, x(i));
+      }
+      return sum_of_squares_result<Scalar>{scale, ssq};
+    },
+    combine_sum_of_squares<Scalar>);
+}
+
+template<class ElementType,
+         class SizeType, ::std::size_t ext0,
+         class Layout,
+         class Accessor,
+         class Scalar>
+Scalar vector_two_norm(
+  tbb_exec exec,
+  mdspan<ElementType, extents<SizeType, ext0>, Layout, Accessor> x,
+  Scalar init)
+{
+  using std::sqrt;
+  using value_type = typename decltype(x)::value_type;
+  if constexpr (impl::is_complex_v<value_type> && impl::use_blue_norm_v<value_type, Scalar>) {
+    const auto ssq = impl::tbb_reduce_ranges(x.extent(0),
+      impl::parallel_min_chunk(1), impl::blue_sum_of_squares<Scalar>{}, impl::blue_sum_of_squares<Scalar>{},
+      [&] (SizeType begin, SizeType end) {
+        return impl::blue_sum_of_squares_of_range<Scalar>(x, begin, end);
+      },
+      impl::blue_sum_of_squares<Scalar>::merged).result();
+    return init + ssq.scaling_factor * sqrt(ssq.scaled_sum_of_squares);
+  }
+
+  sum_of_squares_result<Scalar> ssq_init;
+  ssq_init.scaling_factor = Scalar{};
+  ssq_init.scaled_sum_of_squares = 1.0;
+
+  auto ssq_res = vector_sum_of_squares(exec, x, ssq_init);
+  return init + ssq_res.scaling_factor * sqrt(ssq_res.scaled_sum_of_squares);
+}
+
+// matrix_frob_norm, matrix_one_norm, and matrix_inf_norm
+
+template<class ElementType,
+         class SizeType, ::std::size_t numRows, ::std::size_t numCols,
+         class Layout,
+         class Accessor,
+         class Scalar>
+Scalar matrix_frob_norm(
+  tbb_exec /* exec */,
+  mdspan<ElementType, extents<SizeType, numRows, numCols>, Layout, Accessor> A,
+  Scalar init)
+{
+  using std::abs;
+  using std::sqrt;
+
+  auto result = init;
+  if (A.extent(0) == 0 || A.extent(1) == 0) {
+    return result;
+  }
+  else if (A.extent(0) == SizeType(1) && A.extent(1) == SizeType(1)) {
+    result += abs(A(0, 0));
+    return result;
+  }
+
+  using value_type = typename decltype(A)::value_type;
+  if constexpr (impl::use_blue_norm_v<value_type, Scalar>) {
+    const auto ssq = impl::tbb_reduce_ranges(A.extent(0),
+      impl::parallel_min_chunk(A.extent(1)), impl::blue_sum_of_squares<Scalar>{}, impl::blue_sum_of_squares<Scalar>{},
+      [&] (SizeType begin, SizeType end) {
+        return impl::blue_sum_of_squares_of_rows<Scalar>(A, begin, end);
+      },
+      impl::blue_sum_of_squares<Scalar>::merged).result();
+    result += ssq.scaling_factor * sqrt(ssq.scaled_sum_of_squares);
+    return result;
+  }
+
+  const auto ssq = impl::tbb_reduce_ranges(A.extent(0),
+    impl::parallel_min_chunk(A.extent(1)),
+    sum_of_squares_result<Scalar>{Scalar(0.0), Scalar(1.0)},
+    sum_of_squares_result<Scalar>{},
+    [&] (SizeType begin, SizeType end) {
+      Scalar scale{};
+      Scalar ssq{};
+      for (SizeType i = begin; i < end; ++i) {
+        for (SizeType j = 0; j < A.extent(1); ++j) {
+          impl::accumulate_sum_of_squares(scale, ssq, A(i,j));
+        }
+      }
+      return sum_of_squares_result<Scalar>{scale, ssq};
+    },
+    combine_sum_of_squares<Scalar>);
+  result += ssq.scaling_factor * sqrt(ssq.scaled_sum_of_squares);
+  return result;
+}
+
+template<class ElementType,
+         class SizeType, ::std::size_t numRows, ::std::size_t numCols,
+         class Layout,
+         class Accessor,
+         class Scalar>
+Scalar matrix_one_norm(
+  tbb_exec /* exec */,
+  mdspan<ElementType, extents<SizeType, numRows, numCols>, Layout, Accessor> A,
+  Scalar init)
+{
+  using std::abs;
+  using std::max;
+
+  auto result = init;
+  if (A.extent(0) == 0 || A.extent(1) == 0) {
+    return result;
+  }
+  else if (A.extent(0) == SizeType(1) && A.extent(1) == SizeType(1)) {
+    result += abs(A(0, 0));
+    return result;
+  }
+
+  return impl::tbb_reduce_ranges(A.extent(1),
+    impl::parallel_min_chunk(A.extent(0)), result, init,
+    [&] (SizeType begin, SizeType end) {
+      auto chunk_result = init;
+      for (SizeType j = begin; j < end; ++j) {
+        auto col_sum = init;
+        for (SizeType i = 0; i < A.extent(0); ++i) {
+          col_sum += abs(A(i,j));
+        }
+        chunk_result = max(col_sum, chunk_result);
+      }
+      return chunk_result;
+    },
+    [] (const Scalar& x, const Scalar& y) { return max(y, x); });
+}
+
+template<class ElementType,
+         class SizeType, ::std::size_t numRows, ::std::size_t numCols,
+         class Layout,
+         class Accessor,
+         class Scalar>
+Scalar matrix_inf_norm(
+  tbb_exec /* exec */,
+  mdspan<ElementType, extents<SizeType, numRows, numCols>, Layout, Accessor> A,
+  Scalar init)
+{
+  using std::abs;
+  using std::max;
+
+  auto result = init;
+  if (A.extent(0) == 0 || A.extent(1) == 0) {
+    return result;
+  }
+  else if (A.extent(0) == SizeType(1) && A.extent(1) == SizeType(1)) {
+    result += abs(A(0, 0));
+    return result;
+  }
+
+  return impl::tbb_reduce_ranges(A.extent(0),
+    impl::parallel_min_chunk(A.extent(1)), result, init,
+    [&] (SizeType begin, SizeType end) {
+      auto chunk_result = init;
+      for (SizeType i = begin; i < end; ++i) {
+        auto row_sum = init;
+        for (SizeType j = 0; j < A.extent(1); ++j) {
+          row_sum += abs(A(i,j));
+        }
+        chunk_result = max(row_sum, chunk_result);
+      }
+      return chunk_result;
+    },
+    [] (const Scalar& x, const Scalar& y) { return max(y, x); });
+}
+
+// matrix_vector_product.  Element types or layouts that the blocked
+// engine does not take run inline.
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_x,
+         class SizeType_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y>
+void matrix_vector_product(
+  tbb_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y)
+{
+  if constexpr (impl::is_gemv_blockable_v<decltype(A), decltype(x), decltype(y)>) {
+    impl::tbb_blocked_gemv(A, x, y, [] (auto) { return ElementType_y{}; });
+  }
+  else {
+    matrix_vector_product(impl::inline_exec_t{}, A, x, y);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_x,
+         class SizeType_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y,
+         class ElementType_z,
+         class SizeType_z, ::std::size_t ext_z,
+         class Layout_z,
+         class Accessor_z>
+void matrix_vector_product(
+  tbb_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y,
+  mdspan<ElementType_z, extents<SizeType_z, ext_z>, Layout_z, Accessor_z> z)
+{
+  if constexpr (impl::is_gemv_blockable_v<decltype(A), decltype(x), decltype(z)>) {
+    impl::tbb_blocked_gemv(A, x, z, [&] (auto i) { return y(i); });
+  }
+  else {
+    matrix_vector_product(impl::inline_exec_t{}, A, x, y, z);
+  }
+}
+
+// symmetric_matrix_vector_product and hermitian_matrix_vector_product.
+// Element types or layouts that the blocked engine does not take run
+// inline.
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class ElementType_x,
+         class SizeType_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y>
+void symmetric_matrix_vector_product(
+  tbb_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y)
+{
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::symmetric_matrix_vector_product_dispatch_to_blas<decltype(A), decltype(x), decltype(y)>()) {
+    if (impl::symmetric_matrix_vector_product_blas(A, t, x, ElementType_y{}, y, [] {})) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::is_symv_blockable_v<decltype(A), decltype(x), decltype(y)>) {
+    impl::tbb_blocked_symv<false, Triangle>(A, x, y, [] (auto) { return ElementType_y{}; });
+  }
+  else {
+    symmetric_matrix_vector_product(impl::inline_exec_t{}, A, t, x, y);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class ElementType_x,
+         class SizeType_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y,
+         class ElementType_z,
+         class SizeType_z, ::std::size_t ext_z,
+         class Layout_z,
+         class Accessor_z>
+void symmetric_matrix_vector_product(
+  tbb_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y,
+  mdspan<ElementType_z, extents<SizeType_z, ext_z>, Layout_z, Accessor_z> z)
+{
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::symmetric_matrix_vector_product_dispatch_to_blas<decltype(A), decltype(x), decltype(z)>()) {
+    if (impl::symmetric_matrix_vector_product_blas(A, t, x, ElementType_z(1), z, [&] { linalg::copy(y, z); })) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::is_symv_blockable_v<decltype(A), decltype(x), decltype(z)>) {
+    impl::tbb_blocked_symv<false, Triangle>(A, x, z, [&] (auto i) { return y(i); });
+  }
+  else {
+    symmetric_matrix_vector_product(impl::inline_exec_t{}, A, t, x, y, z);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class ElementType_x,
+         class SizeType_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y>
+void hermitian_matrix_vector_product(
+  tbb_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y)
+{
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_vector_product_dispatch_to_blas<decltype(A), decltype(x), decltype(y)>()) {
+    if (impl::hermitian_matrix_vector_product_blas(A, t, x, ElementType_y{}, y, [] {})) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::is_symv_blockable_v<decltype(A), decltype(x), decltype(y)>) {
+    impl::tbb_blocked_symv<true, Triangle>(A, x, y, [] (auto) { return ElementType_y{}; });
+  }
+  else {
+    hermitian_matrix_vector_product(impl::inline_exec_t{}, A, t, x, y);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class ElementType_x,
+         class SizeType_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y,
+         class ElementType_z,
+         class SizeType_z, ::std::size_t ext_z,
+         class Layout_z,
+         class Accessor_z>
+void hermitian_matrix_vector_product(
+  tbb_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y,
+  mdspan<ElementType_z, extents<SizeType_z, ext_z>, Layout_z, Accessor_z> z)
+{
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_vector_product_dispatch_to_blas<decltype(A), decltype(x), decltype(z)>()) {
+    if (impl::hermitian_matrix_vector_product_blas(A, t, x, ElementType_z(1), z, [&] { linalg::copy(y, z); })) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::is_symv_blockable_v<decltype(A), decltype(x), decltype(z)>) {
+    impl::tbb_blocked_symv<true, Triangle>(A, x, z, [&] (auto i) { return y(i); });
+  }
+  else {
+    hermitian_matrix_vector_product(impl::inline_exec_t{}, A, t, x, y, z);
+  }
+}
+
+// triangular_matrix_vector_solve.  Element types or layouts that the
+// blocked engine does not take run inline.
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class DiagonalStorage,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t ext_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_X,
+         class SizeType_X, ::std::size_t ext_X,
+         class Layout_X,
+         class Accessor_X>
+void triangular_matrix_vector_solve(
+  tbb_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  DiagonalStorage d,
+  mdspan<ElementType_B, extents<SizeType_B, ext_B>, Layout_B, Accessor_B> b,
+  mdspan<ElementType_X, extents<SizeType_X, ext_X>, Layout_X, Accessor_X> x)
+{
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_vector_product_dispatch_to_blas<decltype(A), decltype(b), decltype(x)>()) {
+    if (impl::triangular_matrix_vector_blas<true>(A, t, d, b, x)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::is_trsv_blockable_v<decltype(A), decltype(b), decltype(x)>) {
+    using T = typename decltype(x)::value_type;
+    impl::blocked_trsv<Triangle, DiagonalStorage>(A, b, x, true,
+      [] (impl::strided_matrix_view<const T> A_block, const T* x_packed, T* acc) {
+        impl::tbb_gemv_accumulate(A_block, x_packed, acc);
+      });
+  }
+  else {
+    triangular_matrix_vector_solve(impl::inline_exec_t{}, A, t, d, b, x);
+  }
+}
+
+// matrix_product
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B,
+         ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C,
+         ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void matrix_product(
+  tbb_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_product_dispatch_to_blas<decltype(A), decltype(B), decltype(C)>()) {
+    if (impl::matrix_product_blas(A, B, ElementType_C{}, C)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+  if constexpr (impl::is_gemm_peelable_product_v<decltype(A), decltype(B), decltype(C)>) {
+    impl::tbb_blocked_gemm(impl::extractScalingFactor(A) * impl::extractScalingFactor(B),
+                           impl::make_strided_matrix_view(A).as_const(),
+                           impl::make_strided_matrix_view(B).as_const(),
+                           ElementType_C{},
+                           impl::make_strided_matrix_view(C));
+  }
+  else {
+    impl::tbb_update_blocks<void>(C, A.extent(1),
+      [] (auto, auto) { return ElementType_C{}; },
+      [&] (auto i, auto j, ::std::size_t k) { return A(i,k) * B(k,j); });
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B,
+         ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_E,
+         class SizeType_E, ::std::size_t numRows_E,
+         ::std::size_t numCols_E,
+         class Layout_E,
+         class Accessor_E,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C,
+         ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void matrix_product(
+  tbb_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_E, extents<SizeType_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+#ifdef LINALG_ENABLE_BLAS
+  constexpr bool blas_able =
+    impl::matrix_product_dispatch_to_blas<decltype(A), decltype(B), decltype(C)>();
+#else
+  constexpr bool blas_able = false;
+#endif // LINALG_ENABLE_BLAS
+  constexpr bool packable =
+    impl::is_gemm_peelable_product_v<decltype(A), decltype(B), decltype(C)>;
+
+  if constexpr (blas_able || packable) {
+    // E may alias C, so copy it first, then accumulate (beta = 1).
+    impl::tbb_update_blocks<void>(C, 0,
+      [&] (auto i, auto j) { return E(i,j); },
+      [] (auto, auto, ::std::size_t) { return ElementType_C{}; });
+  }
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (blas_able) {
+    if (impl::matrix_product_blas(A, B, ElementType_C{1}, C)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+  if constexpr (packable) {
+    impl::tbb_blocked_gemm(impl::extractScalingFactor(A) * impl::extractScalingFactor(B),
+                           impl::make_strided_matrix_view(A).as_const(),
+                           impl::make_strided_matrix_view(B).as_const(),
+                           ElementType_C{1},
+                           impl::make_strided_matrix_view(C));
+  }
+  else {
+    impl::tbb_update_blocks<void>(C, A.extent(1),
+      [&] (auto i, auto j) { return E(i,j); },
+      [&] (auto i, auto j, ::std::size_t k) { return A(i,k) * B(k,j); });
+  }
+}
+
+// Batched matrix_product
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numBatch_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numBatch_B, ::std::size_t numRows_B,
+         ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numBatch_C, ::std::size_t numRows_C,
+         ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void matrix_product(
+  tbb_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numBatch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, numBatch_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_C, extents<SizeType_C, numBatch_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  impl::check_batched_matrix_product_extents(A, B, C);
+  using index_type = typename decltype(C)::index_type;
+  const bool batch_major =
+    impl::is_batch_major(A) && impl::is_batch_major(B) && impl::is_batch_major(C);
+  const impl::batched_matrix_product_zero<ElementType_C> start{};
+
+  // The matrices are independent.  Split them into whole blocks of
+  // lanes, so that each chunk can use the batch-major kernel.
+  constexpr index_type lanes = impl::batched_gemm_blocking<ElementType_C>::lanes;
+  const index_type num_batches = C.extent(0);
+  const tbb::blocked_range<index_type> blocks(index_type(0),
+    index_type((num_batches + lanes - 1) / lanes),
+    impl::parallel_min_chunk(lanes * impl::batched_matrix_product_work(A, C)));
+  tbb::parallel_for(blocks, [&] (const tbb::blocked_range<index_type>& r) {
+      impl::batched_matrix_product(A, B, C, start, r.begin() * lanes,
+        ::std::min(index_type(r.end() * lanes), num_batches), batch_major);
+    });
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numBatch_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numBatch_B, ::std::size_t numRows_B,
+         ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_E,
+         class SizeType_E, ::std::size_t numBatch_E, ::std::size_t numRows_E,
+         ::std::size_t numCols_E,
+         class Layout_E,
+         class Accessor_E,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numBatch_C, ::std::size_t numRows_C,
+         ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void matrix_product(
+  tbb_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numBatch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, numBatch_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_E, extents<SizeType_E, numBatch_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, numBatch_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  impl::check_batched_matrix_product_extents(A, B, C);
+  using index_type = typename decltype(C)::index_type;
+  const bool batch_major =
+    impl::is_batch_major(A) && impl::is_batch_major(B) &&
+    impl::is_batch_major(E) && impl::is_batch_major(C);
+  const auto start = [&] (auto b, auto i, auto j) { return ElementType_C(E(b,i,j)); };
+
+  // The matrices are independent.  Split them into whole blocks of
+  // lanes, so that each chunk can use the batch-major kernel.
+  constexpr index_type lanes = impl::batched_gemm_blocking<ElementType_C>::lanes;
+  const index_type num_batches = C.extent(0);
+  const tbb::blocked_range<index_type> blocks(index_type(0),
+    index_type((num_batches + lanes - 1) / lanes),
+    impl::parallel_min_chunk(lanes * impl::batched_matrix_product_work(A, C)));
+  tbb::parallel_for(blocks, [&] (const tbb::blocked_range<index_type>& r) {
+      impl::batched_matrix_product(A, B, C, start, r.begin() * lanes,
+        ::std::min(index_type(r.end() * lanes), num_batches), batch_major);
+    });
+}
+
+// symmetric_matrix_rank_k_update and hermitian_matrix_rank_k_update
+
+MDSPAN_TEMPLATE_REQUIRES(
+  class ScaleFactorType,
+  class ElementType_A,
+  class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+  class Layout_A,
+  class Accessor_A,
+  class ElementType_C,
+  class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+  class Layout_C,
+  class Accessor_C,
+  class Triangle,
+  /* requires */ (
+   (std::is_same_v<Triangle, lower_triangle_t> ||
+    std::is_same_v<Triangle, upper_triangle_t>) &&
+   !impl::is_linalg_execution_policy_v<ScaleFactorType> && !impl::is_mdspan_v<ScaleFactorType>
+  )
+)
+void symmetric_matrix_rank_k_update(
+  tbb_exec /* exec */,
+  ScaleFactorType alpha,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
+  Triangle /* t */)
+{
+  if constexpr (impl::is_syrk_blockable_v<decltype(A), decltype(C), ScaleFactorType>) {
+    // The tiles of C's triangle all do about the same work.
+    const tbb::blocked_range<::std::ptrdiff_t> tiles(0, impl::syrk_num_tiles(C));
+    tbb::parallel_for(tiles, [&] (const tbb::blocked_range<::std::ptrdiff_t>& r) {
+        impl::blocked_syrk_tiles<false, Triangle>(ElementType_C(alpha), A,
+          impl::rank_update_beta<ElementType_C>(), C, r.begin(), r.end());
+      });
+  }
+  else {
+    impl::tbb_update_blocks<Triangle>(C, A.extent(1),
+      [&] (auto i, auto j) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+        (void) i;
+        (void) j;
+        return ElementType_C{};
+#else
+        return C(i,j);
+#endif
+      },
+      [&] (auto i, auto j, ::std::size_t k) { return alpha * A(i,k) * A(j,k); });
+  }
+}
+
+#if defined(LINALG_FIX_RANK_UPDATES)
+MDSPAN_TEMPLATE_REQUIRES(
+  class ScaleFactorType,
+  class ElementType_A,
+  class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+  class Layout_A,
+  class Accessor_A,
+  class ElementType_E,
+  class Extents_E,
+  class Layout_E,
+  class Accessor_E,
+  class ElementType_C,
+  class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+  class Layout_C,
+  class Accessor_C,
+  class Triangle,
+  /* requires */ (
+   (std::is_same_v<Triangle, lower_triangle_t> ||
+    std::is_same_v<Triangle, upper_triangle_t>) &&
+   !impl::is_linalg_execution_policy_v<ScaleFactorType> && !impl::is_mdspan_v<ScaleFactorType> &&
+   Extents_E::rank() == 2
+  )
+)
+void symmetric_matrix_rank_k_update(
+  tbb_exec /* exec */,
+  ScaleFactorType alpha,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_E, Extents_E, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
+  Triangle /* t */)
+{
+  if constexpr (impl::is_syrk_blockable_v<decltype(A), decltype(C), ScaleFactorType>) {
+    // The tiles of C's triangle all do about the same work.
+    const tbb::blocked_range<::std::ptrdiff_t> tiles(0, impl::syrk_num_tiles(C));
+    tbb::parallel_for(tiles, [&] (const tbb::blocked_range<::std::ptrdiff_t>& r) {
+        impl::blocked_syrk_tiles_from<false, Triangle>(ElementType_C(alpha), A, E, C,
+          r.begin(), r.end());
+      });
+  }
+  else {
+    impl::tbb_update_blocks<Triangle>(C, A.extent(1),
+      [&] (auto i, auto j) { return E(i,j); },
+      [&] (auto i, auto j, ::std::size_t k) { return alpha * A(i,k) * A(j,k); });
+  }
+}
+#endif // LINALG_FIX_RANK_UPDATES
+
+MDSPAN_TEMPLATE_REQUIRES(
+  class ScaleFactorType,
+  class ElementType_A,
+  class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+  class Layout_A,
+  class Accessor_A,
+  class ElementType_C,
+  class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+  class Layout_C,
+  class Accessor_C,
+  class Triangle,
+  /* requires */ (
+   (std::is_same_v<Triangle, lower_triangle_t> ||
+    std::is_same_v<Triangle, upper_triangle_t>) &&
+   !impl::is_linalg_execution_policy_v<ScaleFactorType> && !impl::is_mdspan_v<ScaleFactorType>
+  )
+)
+void hermitian_matrix_rank_k_update(
+  tbb_exec /* exec */,
+  ScaleFactorType alpha,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
+  Triangle /* t */)
+{
+  if constexpr (impl::is_syrk_blockable_v<decltype(A), decltype(C), ScaleFactorType>) {
+    // The tiles of C's triangle all do about the same work.
+    const tbb::blocked_range<::std::ptrdiff_t> tiles(0, impl::syrk_num_tiles(C));
+    tbb::parallel_for(tiles, [&] (const tbb::blocked_range<::std::ptrdiff_t>& r) {
+        impl::blocked_syrk_tiles<true, Triangle>(ElementType_C(alpha), A,
+          impl::rank_update_beta<ElementType_C>(), C, r.begin(), r.end());
+      });
+  }
+  else {
+    impl::tbb_update_blocks<Triangle>(C, A.extent(1),
+      [&] (auto i, auto j) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+        (void) i;
+        (void) j;
+        return ElementType_C{};
+#else
+        return i == j ? ElementType_C(impl::real_if_needed(C(i,j))) : ElementType_C(C(i,j));
+#endif
+      },
+      [&] (auto i, auto j, ::std::size_t k) { return alpha * A(i,k) * impl::conj_if_needed(A(j,k)); });
+  }
+}
+
+#if defined(LINALG_FIX_RANK_UPDATES)
+MDSPAN_TEMPLATE_REQUIRES(
+  class ScaleFactorType,
+  class ElementType_A,
+  class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+  class Layout_A,
+  class Accessor_A,
+  class ElementType_E,
+  class Extents_E,
+  class Layout_E,
+  class Accessor_E,
+  class ElementType_C,
+  class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+  class Layout_C,
+  class Accessor_C,
+  class Triangle,
+  /* requires */ (
+   (std::is_same_v<Triangle, lower_triangle_t> ||
+    std::is_same_v<Triangle, upper_triangle_t>) &&
+   !impl::is_linalg_execution_policy_v<ScaleFactorType> && !impl::is_mdspan_v<ScaleFactorType> &&
+   Extents_E::rank() == 2
+  )
+)
+void hermitian_matrix_rank_k_update(
+  tbb_exec /* exec */,
+  ScaleFactorType alpha,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_E, Extents_E, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
+  Triangle /* t */)
+{
+  if constexpr (impl::is_syrk_blockable_v<decltype(A), decltype(C), ScaleFactorType>) {
+    // The tiles of C's triangle all do about the same work.
+    const tbb::blocked_range<::std::ptrdiff_t> tiles(0, impl::syrk_num_tiles(C));
+    tbb::parallel_for(tiles, [&] (const tbb::blocked_range<::std::ptrdiff_t>& r) {
+        impl::blocked_syrk_tiles_from<true, Triangle>(ElementType_C(alpha), A, E, C,
+          r.begin(), r.end());
+      });
+  }
+  else {
+    impl::tbb_update_blocks<Triangle>(C, A.extent(1),
+      [&] (auto i, auto j) {
+        return i == j ? ElementType_C(impl::real_if_needed(E(i,j))) : ElementType_C(E(i,j));
+      },
+      [&] (auto i, auto j, ::std::size_t k) { return alpha * A(i,k) * impl::conj_if_needed(A(j,k)); });
+  }
+}
+#endif // LINALG_FIX_RANK_UPDATES
+
+// symmetric_matrix_rank_2k_update and hermitian_matrix_rank_2k_update.
+// Element types or layouts that the blocked engine does not take run
+// inline.
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C,
+         class Triangle>
+void symmetric_matrix_rank_2k_update(
+  tbb_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
+  Triangle t)
+{
+  if constexpr (impl::is_syr2k_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    // The tiles of C's triangle all do about the same work.
+    const tbb::blocked_range<::std::ptrdiff_t> tiles(0, impl::syrk_num_tiles(C));
+    tbb::parallel_for(tiles, [&] (const tbb::blocked_range<::std::ptrdiff_t>& r) {
+        impl::blocked_syr2k_tiles<false, Triangle>(A, B,
+          impl::rank_update_beta<ElementType_C>(), C, r.begin(), r.end());
+      });
+  }
+  else {
+    symmetric_matrix_rank_2k_update(impl::inline_exec_t{}, A, B, C, t);
+  }
+}
+
+#if defined(LINALG_FIX_RANK_UPDATES)
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_E,
+         class SizeType_E, ::std::size_t numRows_E, ::std::size_t numCols_E,
+         class Layout_E,
+         class Accessor_E,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C,
+         class Triangle>
+void symmetric_matrix_rank_2k_update(
+  tbb_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_E, extents<SizeType_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
+  Triangle t)
+{
+  if constexpr (impl::is_syr2k_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    // The tiles of C's triangle all do about the same work.
+    const tbb::blocked_range<::std::ptrdiff_t> tiles(0, impl::syrk_num_tiles(C));
+    tbb::parallel_for(tiles, [&] (const tbb::blocked_range<::std::ptrdiff_t>& r) {
+        impl::blocked_syr2k_tiles_from<false, Triangle>(A, B, E, C, r.begin(), r.end());
+      });
+  }
+  else {
+    symmetric_matrix_rank_2k_update(impl::inline_exec_t{}, A, B, E, C, t);
+  }
+}
+#endif // LINALG_FIX_RANK_UPDATES
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C,
+         class Triangle>
+void hermitian_matrix_rank_2k_update(
+  tbb_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
+  Triangle t)
+{
+  if constexpr (impl::is_syr2k_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    // The tiles of C's triangle all do about the same work.
+    const tbb::blocked_range<::std::ptrdiff_t> tiles(0, impl::syrk_num_tiles(C));
+    tbb::parallel_for(tiles, [&] (const tbb::blocked_range<::std::ptrdiff_t>& r) {
+        impl::blocked_syr2k_tiles<true, Triangle>(A, B,
+          impl::rank_update_beta<ElementType_C>(), C, r.begin(), r.end());
+      });
+  }
+  else {
+    hermitian_matrix_rank_2k_update(impl::inline_exec_t{}, A, B, C, t);
+  }
+}
+
+#if defined(LINALG_FIX_RANK_UPDATES)
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_E,
+         class SizeType_E, ::std::size_t numRows_E, ::std::size_t numCols_E,
+         class Layout_E,
+         class Accessor_E,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C,
+         class Triangle>
+void hermitian_matrix_rank_2k_update(
+  tbb_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_E, extents<SizeType_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
+  Triangle t)
+{
+  if constexpr (impl::is_syr2k_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    // The tiles of C's triangle all do about the same work.
+    const tbb::blocked_range<::std::ptrdiff_t> tiles(0, impl::syrk_num_tiles(C));
+    tbb::parallel_for(tiles, [&] (const tbb::blocked_range<::std::ptrdiff_t>& r) {
+        impl::blocked_syr2k_tiles_from<true, Triangle>(A, B, E, C, r.begin(), r.end());
+      });
+  }
+  else {
+    hermitian_matrix_rank_2k_update(impl::inline_exec_t{}, A, B, E, C, t);
+  }
+}
+#endif // LINALG_FIX_RANK_UPDATES
+
+// triangular_matrix_matrix_left_solve and
+// triangular_matrix_matrix_right_solve
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class DiagonalStorage,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B,
+         ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_X,
+         class SizeType_X, ::std::size_t numRows_X,
+         ::std::size_t numCols_X,
+         class Layout_X,
+         class Accessor_X>
+void triangular_matrix_matrix_left_solve(
+  tbb_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  DiagonalStorage d,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_X, extents<SizeType_X, numRows_X, numCols_X>, Layout_X, Accessor_X> X)
+{
+  if constexpr (impl::is_trsm_blockable_v<decltype(A), decltype(B), decltype(X)>) {
+    const auto A_view = impl::make_strided_matrix_view(A).as_const();
+    const auto B_view = impl::make_strided_matrix_view(B).as_const();
+    const auto X_view = impl::make_strided_matrix_view(X);
+    const ::std::ptrdiff_t n = A_view.extent0;
+    // The columns of X are independent.
+    const tbb::blocked_range<::std::ptrdiff_t> columns(0, X_view.extent1,
+      impl::trsm_min_chunk<ElementType_X>(n));
+    tbb::parallel_for(columns, [&] (const tbb::blocked_range<::std::ptrdiff_t>& r) {
+        const ::std::ptrdiff_t j_begin = r.begin();
+        const ::std::ptrdiff_t j_end = r.end();
+        impl::blocked_trsm_left<Triangle, DiagonalStorage>(A_view,
+          B_view.block(0, j_begin, n, j_end - j_begin),
+          X_view.block(0, j_begin, n, j_end - j_begin));
+      });
+  }
+  else {
+    triangular_matrix_matrix_left_solve(impl::inline_exec_t{}, A, t, d, B, X);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class DiagonalStorage,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B,
+         ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_X,
+         class SizeType_X, ::std::size_t numRows_X,
+         ::std::size_t numCols_X,
+         class Layout_X,
+         class Accessor_X>
+void triangular_matrix_matrix_right_solve(
+  tbb_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  DiagonalStorage d,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_X, extents<SizeType_X, numRows_X, numCols_X>, Layout_X, Accessor_X> X)
+{
+  if constexpr (impl::is_trsm_blockable_v<decltype(A), decltype(B), decltype(X)>) {
+    const auto A_view = impl::make_strided_matrix_view(A).as_const();
+    const auto B_view = impl::make_strided_matrix_view(B).as_const();
+    const auto X_view = impl::make_strided_matrix_view(X);
+    const ::std::ptrdiff_t n = A_view.extent1;
+    // The rows of X are independent.
+    const tbb::blocked_range<::std::ptrdiff_t> rows(0, X_view.extent0,
+      impl::trsm_min_chunk<ElementType_X>(n));
+    tbb::parallel_for(rows, [&] (const tbb::blocked_range<::std::ptrdiff_t>& r) {
+        const ::std::ptrdiff_t i_begin = r.begin();
+        const ::std::ptrdiff_t i_end = r.end();
+        impl::blocked_trsm_right<Triangle, DiagonalStorage>(A_view,
+          B_view.block(i_begin, 0, i_end - i_begin, n),
+          X_view.block(i_begin, 0, i_end - i_begin, n));
+      });
+  }
+  else {
+    triangular_matrix_matrix_right_solve(impl::inline_exec_t{}, A, t, d, B, X);
+  }
+}
+
+// symmetric_matrix_product and hermitian_matrix_product.  Element
+// types or layouts that the blocked engine does not take run inline.
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void symmetric_matrix_product(
+  tbb_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  if constexpr (impl::is_symm_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    // The columns of C are independent.
+    const tbb::blocked_range<::std::ptrdiff_t> columns(0, ::std::ptrdiff_t(C.extent(1)),
+      impl::symm_min_chunk<ElementType_C>(::std::ptrdiff_t(A.extent(0))));
+    tbb::parallel_for(columns, [&] (const tbb::blocked_range<::std::ptrdiff_t>& r) {
+        impl::blocked_symm_product<false, Triangle, left_side_t>(
+          A, B, C, r.begin(), r.end());
+      });
+  }
+  else {
+    symmetric_matrix_product(impl::inline_exec_t{}, A, t, B, C);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void symmetric_matrix_product(
+  tbb_exec /* exec */,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  if constexpr (impl::is_symm_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    // The rows of C are independent.
+    const tbb::blocked_range<::std::ptrdiff_t> rows(0, ::std::ptrdiff_t(C.extent(0)),
+      impl::symm_min_chunk<ElementType_C>(::std::ptrdiff_t(A.extent(0))));
+    tbb::parallel_for(rows, [&] (const tbb::blocked_range<::std::ptrdiff_t>& r) {
+        impl::blocked_symm_product<false, Triangle, right_side_t>(
+          A, B, C, r.begin(), r.end());
+      });
+  }
+  else {
+    symmetric_matrix_product(impl::inline_exec_t{}, B, A, t, C);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_E,
+         class SizeType_E, ::std::size_t numRows_E, ::std::size_t numCols_E,
+         class Layout_E,
+         class Accessor_E,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void symmetric_matrix_product(
+  tbb_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_E, extents<SizeType_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  if constexpr (impl::is_symm_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    // The columns of C are independent.
+    const tbb::blocked_range<::std::ptrdiff_t> columns(0, ::std::ptrdiff_t(C.extent(1)),
+      impl::symm_min_chunk<ElementType_C>(::std::ptrdiff_t(A.extent(0))));
+    tbb::parallel_for(columns, [&] (const tbb::blocked_range<::std::ptrdiff_t>& r) {
+        impl::blocked_symm_product<false, Triangle, left_side_t>(
+          A, B, E, C, r.begin(), r.end());
+      });
+  }
+  else {
+    symmetric_matrix_product(impl::inline_exec_t{}, A, t, B, E, C);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_E,
+         class SizeType_E, ::std::size_t numRows_E, ::std::size_t numCols_E,
+         class Layout_E,
+         class Accessor_E,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void symmetric_matrix_product(
+  tbb_exec /* exec */,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  mdspan<ElementType_E, extents<SizeType_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  if constexpr (impl::is_symm_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    // The rows of C are independent.
+    const tbb::blocked_range<::std::ptrdiff_t> rows(0, ::std::ptrdiff_t(C.extent(0)),
+      impl::symm_min_chunk<ElementType_C>(::std::ptrdiff_t(A.extent(0))));
+    tbb::parallel_for(rows, [&] (const tbb::blocked_range<::std::ptrdiff_t>& r) {
+        impl::blocked_symm_product<false, Triangle, right_side_t>(
+          A, B, E, C, r.begin(), r.end());
+      });
+  }
+  else {
+    symmetric_matrix_product(impl::inline_exec_t{}, B, A, t, E, C);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void hermitian_matrix_product(
+  tbb_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  if constexpr (impl::is_symm_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    // The columns of C are independent.
+    const tbb::blocked_range<::std::ptrdiff_t> columns(0, ::std::ptrdiff_t(C.extent(1)),
+      impl::symm_min_chunk<ElementType_C>(::std::ptrdiff_t(A.extent(0))));
+    tbb::parallel_for(columns, [&] (const tbb::blocked_range<::std::ptrdiff_t>& r) {
+        impl::blocked_symm_product<true, Triangle, left_side_t>(
+          A, B, C, r.begin(), r.end());
+      });
+  }
+  else {
+    hermitian_matrix_product(impl::inline_exec_t{}, A, t, B, C);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void hermitian_matrix_product(
+  tbb_exec /* exec */,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  if constexpr (impl::is_symm_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    // The rows of C are independent.
+    const tbb::blocked_range<::std::ptrdiff_t> rows(0, ::std::ptrdiff_t(C.extent(0)),
+      impl::symm_min_chunk<ElementType_C>(::std::ptrdiff_t(A.extent(0))));
+    tbb::parallel_for(rows, [&] (const tbb::blocked_range<::std::ptrdiff_t>& r) {
+        impl::blocked_symm_product<true, Triangle, right_side_t>(
+          A, B, C, r.begin(), r.end());
+      });
+  }
+  else {
+    hermitian_matrix_product(impl::inline_exec_t{}, B, A, t, C);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_E,
+         class SizeType_E, ::std::size_t numRows_E, ::std::size_t numCols_E,
+         class Layout_E,
+         class Accessor_E,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void hermitian_matrix_product(
+  tbb_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_E, extents<SizeType_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  if constexpr (impl::is_symm_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    // The columns of C are independent.
+    const tbb::blocked_range<::std::ptrdiff_t> columns(0, ::std::ptrdiff_t(C.extent(1)),
+      impl::symm_min_chunk<ElementType_C>(::std::ptrdiff_t(A.extent(0))));
+    tbb::parallel_for(columns, [&] (const tbb::blocked_range<::std::ptrdiff_t>& r) {
+        impl::blocked_symm_product<true, Triangle, left_side_t>(
+          A, B, E, C, r.begin(), r.end());
+      });
+  }
+  else {
+    hermitian_matrix_product(impl::inline_exec_t{}, A, t, B, E, C);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_E,
+         class SizeType_E, ::std::size_t numRows_E, ::std::size_t numCols_E,
+         class Layout_E,
+         class Accessor_E,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void hermitian_matrix_product(
+  tbb_exec /* exec */,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  mdspan<ElementType_E, extents<SizeType_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  if constexpr (impl::is_symm_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    // The rows of C are independent.
+    const tbb::blocked_range<::std::ptrdiff_t> rows(0, ::std::ptrdiff_t(C.extent(0)),
+      impl::symm_min_chunk<ElementType_C>(::std::ptrdiff_t(A.extent(0))));
+    tbb::parallel_for(rows, [&] (const tbb::blocked_range<::std::ptrdiff_t>& r) {
+        impl::blocked_symm_product<true, Triangle, right_side_t>(
+          A, B, E, C, r.begin(), r.end());
+      });
+  }
+  else {
+    hermitian_matrix_product(impl::inline_exec_t{}, B, A, t, E, C);
+  }
+}
+
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_TBB_EXEC_HPP_
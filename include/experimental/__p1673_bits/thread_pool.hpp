@@ -0,0 +1,327 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_THREAD_POOL_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_THREAD_POOL_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+namespace impl {
+
+// Persistent, work-stealing pool of std::thread workers behind
+// thread_pool_exec.
+//
+// Each thread that participates has its own task deque.  A thread
+// pushes the tasks of a parallel_for onto its own deque and pops
+// from the back (LIFO, for locality); idle threads steal from the
+// front of other deques (FIFO, so that they take the oldest and
+// usually largest remaining work).  Threads outside the pool share
+// deque 0.  The calling thread of parallel_for executes tasks until
+// all of its own tasks have finished, so nested parallel_for calls
+// from inside a task cannot deadlock.
+class thread_pool {
+public:
+  // num_threads counts the calling thread, so the pool starts
+  // num_threads - 1 workers.
+  explicit thread_pool(::std::size_t num_threads)
+    : queues_(::std::max(num_threads, ::std::size_t(1)))
+  {
+    for (auto& queue : queues_) {
+      queue = ::std::make_unique<task_queue>();
+    }
+    workers_.reserve(queues_.size() - 1);
+    for (::std::size_t index = 1; index < queues_.size(); ++index) {
+      workers_.emplace_back([this, index] { worker_loop(index); });
+    }
+  }
+
+  thread_pool(const thread_pool&) = delete;
+  thread_pool& operator=(const thread_pool&) = delete;
+
+  ~thread_pool() {
+    {
+      ::std::lock_guard<::std::mutex> lock(sleep_mutex_);
+      stop_ = true;
+    }
+    sleep_cv_.notify_all();
+    for (auto& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  ::std::size_t num_threads() const noexcept { return queues_.size(); }
+
+  // Call f(i) for each i in [0, num_tasks), and return once all
+  // calls have finished.  If any call throws, rethrow the first
+  // exception after all calls have finished.
+  template<class F>
+  void parallel_for(::std::size_t num_tasks, const F& f)
+  {
+    if (num_tasks == 0) {
+      return;
+    }
+    if (num_tasks == 1 || num_threads() == 1) {
+      for (::std::size_t i = 0; i < num_tasks; ++i) {
+        f(i);
+      }
+      return;
+    }
+
+    task_group group(num_tasks);
+    auto run = [] (const void* context, ::std::size_t i) {
+      (*static_cast<const F*>(context))(i);
+    };
+    const ::std::size_t queue_index = this_thread_queue_index();
+    {
+      task_queue& queue = *queues_[queue_index];
+      ::std::lock_guard<::std::mutex> lock(queue.mutex);
+      for (::std::size_t i = 0; i < num_tasks; ++i) {
+        queue.tasks.push_back(task{run, ::std::addressof(f), i, &group});
+      }
+      pending_.fetch_add(num_tasks);
+    }
+    {
+      ::std::lock_guard<::std::mutex> lock(sleep_mutex_);
+    }
+    sleep_cv_.notify_all();
+
+    while (group.remaining.load(::std::memory_order_acquire) != 0) {
+      task t;
+      if (try_pop(queue_index, t)) {
+        execute(t);
+      }
+      else {
+        ::std::this_thread::yield();
+      }
+    }
+    if (group.error) {
+      ::std::rethrow_exception(group.error);
+    }
+  }
+
+  // The pool that thread_pool_exec uses.  The environment variable
+  // LINALG_NUM_THREADS sets its size; the default is
+  // std::thread::hardware_concurrency().
+  static thread_pool& global_instance()
+  {
+    static thread_pool pool(default_num_threads());
+    return pool;
+  }
+
+  static ::std::size_t default_num_threads()
+  {
+    if (const char* env = ::std::getenv("LINALG_NUM_THREADS")) {
+      const unsigned long n = ::std::strtoul(env, nullptr, 10);
+      if (n > 0) {
+        return static_cast<::std::size_t>(n);
+      }
+    }
+    const unsigned n = ::std::thread::hardware_concurrency();
+    return n == 0 ? ::std::size_t(1) : ::std::size_t(n);
+  }
+
+private:
+  struct task_group {
+    explicit task_group(::std::size_t num_tasks) : remaining(num_tasks) {}
+
+    void set_exception(::std::exception_ptr e) {
+      ::std::lock_guard<::std::mutex> lock(error_mutex);
+      if (! error) {
+        error = e;
+      }
+    }
+
+    ::std::atomic<::std::size_t> remaining;
+    ::std::mutex error_mutex;
+    ::std::exception_ptr error;
+  };
+
+  struct task {
+    void (*run)(const void*, ::std::size_t) = nullptr;
+    const void* context = nullptr;
+    ::std::size_t index = 0;
+    task_group* group = nullptr;
+  };
+
+  struct task_queue {
+    ::std::mutex mutex;
+    ::std::deque<task> tasks;
+  };
+
+  // Index of the calling thread's deque in this pool.
+  ::std::size_t this_thread_queue_index() const noexcept {
+    return this_thread_pool() == this ? this_thread_index() : 0;
+  }
+
+  static const thread_pool*& this_thread_pool() noexcept {
+    thread_local const thread_pool* pool = nullptr;
+    return pool;
+  }
+
+  static ::std::size_t& this_thread_index() noexcept {
+    thread_local ::std::size_t index = 0;
+    return index;
+  }
+
+  // Pop from the back of our own deque, else steal from the front
+  // of another thread's deque.
+  bool try_pop(::std::size_t queue_index, task& t)
+  {
+    {
+      task_queue& queue = *queues_[queue_index];
+      ::std::lock_guard<::std::mutex> lock(queue.mutex);
+      if (! queue.tasks.empty()) {
+        t = queue.tasks.back();
+        queue.tasks.pop_back();
+        pending_.fetch_sub(1);
+        return true;
+      }
+    }
+    for (::std::size_t k = 1; k < queues_.size(); ++k) {
+      task_queue& queue = *queues_[(queue_index + k) % queues_.size()];
+      ::std::lock_guard<::std::mutex> lock(queue.mutex);
+      if (! queue.tasks.empty()) {
+        t = queue.tasks.front();
+        queue.tasks.pop_front();
+        pending_.fetch_sub(1);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  static void execute(const task& t)
+  {
+    try {
+      t.run(t.context, t.index);
+    }
+    catch (...) {
+      t.group->set_exception(::std::current_exception());
+    }
+    // This must be the last access to the group, since its owner may
+    // return as soon as the count reaches zero.
+    t.group->remaining.fetch_sub(1, ::std::memory_order_acq_rel);
+  }
+
+  void worker_loop(::std::size_t index)
+  {
+    this_thread_pool() = this;
+    this_thread_index() = index;
+    for (;;) {
+      task t;
+      if (try_pop(index, t)) {
+        execute(t);
+        continue;
+      }
+      ::std::unique_lock<::std::mutex> lock(sleep_mutex_);
+      sleep_cv_.wait(lock, [this] { return stop_ || pending_.load() != 0; });
+      if (stop_ && pending_.load() == 0) {
+        return;
+      }
+    }
+  }
+
+  ::std::vector<::std::unique_ptr<task_queue>> queues_;
+  ::std::vector<::std::thread> workers_;
+  // Number of tasks in all deques.  It changes only while the
+  // corresponding deque's mutex is held.
+  ::std::atomic<::std::size_t> pending_{0};
+  ::std::mutex sleep_mutex_;
+  ::std::condition_variable sleep_cv_;
+  bool stop_ = false;
+};
+
+// Number of chunks into which thread_pool_for_ranges and
+// thread_pool_reduce_ranges split [0, n).  It depends only on n and
+// min_chunk_size, not on the number of threads, so that reductions
+// give the same result for any pool size.
+inline ::std::size_t
+thread_pool_num_chunks(::std::size_t n, ::std::size_t min_chunk_size)
+{
+  constexpr ::std::size_t max_chunks = 256;
+  min_chunk_size = ::std::max(min_chunk_size, ::std::size_t(1));
+  return ::std::min((n + min_chunk_size - 1) / min_chunk_size, max_chunks);
+}
+
+// Call f(begin, end) in parallel on contiguous chunks covering [0, n).
+template<class Index, class F>
+void thread_pool_for_ranges(Index n, ::std::size_t min_chunk_size, const F& f)
+{
+  const ::std::size_t count = static_cast<::std::size_t>(n);
+  const ::std::size_t num_chunks = thread_pool_num_chunks(count, min_chunk_size);
+  if (num_chunks <= 1) {
+    if (count != 0) {
+      f(Index(0), n);
+    }
+    return;
+  }
+  thread_pool::global_instance().parallel_for(num_chunks,
+    [&] (::std::size_t chunk) {
+      f(Index(chunk * count / num_chunks), Index((chunk + 1) * count / num_chunks));
+    });
+}
+
+// Return combine(...combine(combine(init, r_0), r_1)..., r_last),
+// where r_k = reduce(begin_k, end_k) for contiguous chunks
+// [begin_k, end_k) covering [0, n).  The chunks are combined in
+// order, so the result is deterministic.
+template<class T, class Index, class Reduce, class Combine>
+T thread_pool_reduce_ranges(Index n, ::std::size_t min_chunk_size, T init,
+                            const Reduce& reduce, const Combine& combine)
+{
+  const ::std::size_t count = static_cast<::std::size_t>(n);
+  const ::std::size_t num_chunks = thread_pool_num_chunks(count, min_chunk_size);
+  ::std::vector<T> partials(num_chunks);
+  auto reduce_chunk = [&] (::std::size_t chunk) {
+    partials[chunk] = reduce(Index(chunk * count / num_chunks),
+                             Index((chunk + 1) * count / num_chunks));
+  };
+  if (num_chunks <= 1) {
+    for (::std::size_t chunk = 0; chunk < num_chunks; ++chunk) {
+      reduce_chunk(chunk);
+    }
+  }
+  else {
+    thread_pool::global_instance().parallel_for(num_chunks, reduce_chunk);
+  }
+  for (const T& partial : partials) {
+    init = combine(init, partial);
+  }
+  return init;
+}
+
+} // end namespace impl
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_THREAD_POOL_HPP_
@@ -0,0 +1,2293 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_THREAD_POOL_EXEC_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_THREAD_POOL_EXEC_HPP_
+
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+// Overloads of the algorithms for thread_pool_exec.  The
+// ExecutionPolicy&& overload of each algorithm finds these through
+// its is_custom_*_avail trait.  Algorithms (and overloads, e.g.,
+// those without a scaling factor) that have no thread_pool_exec
+// overload here run inline.
+//
+// Operations that the external BLAS can take still go to the BLAS,
+// which has its own threading.  Reductions split the input into
+// chunks that depend only on the input's size, and combine the
+// partial results in order, so their results do not depend on the
+// number of threads.
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+namespace impl {
+
+// Minimum chunk length for a loop whose iterations each do about
+// work_per_index operations, so that a chunk amortizes the cost of
+// scheduling it.
+inline ::std::size_t parallel_min_chunk(::std::size_t work_per_index)
+{
+  constexpr ::std::size_t min_work_per_chunk = 16384;
+  return ::std::max(min_work_per_chunk / ::std::max(work_per_index, ::std::size_t(1)),
+                    ::std::size_t(1));
+}
+
+// The parallel implementations of matrix_product run blocked_gemm
+// on independent tiles of C.  Each tile is a whole number of the
+// engine's MC x NR blocks, so the tiles do the same arithmetic as one
+// big call.
+template<class T>
+struct gemm_tiling {
+  static constexpr ::std::ptrdiff_t tile_rows = gemm_blocking<T>::mc;
+  static constexpr ::std::ptrdiff_t tile_cols = 64 * gemm_blocking<T>::nr;
+
+  static ::std::ptrdiff_t num_tile_rows(::std::ptrdiff_t num_rows) {
+    return (num_rows + tile_rows - 1) / tile_rows;
+  }
+  static ::std::ptrdiff_t num_tile_cols(::std::ptrdiff_t num_cols) {
+    return (num_cols + tile_cols - 1) / tile_cols;
+  }
+};
+
+// blocked_gemm on tile (tile_row, tile_col) of C.
+template<class T>
+void blocked_gemm_tile(const T& alpha,
+                       strided_matrix_view<const T> A,
+                       strided_matrix_view<const T> B,
+                       const T& beta,
+                       strided_matrix_view<T> C,
+                       ::std::ptrdiff_t tile_row,
+                       ::std::ptrdiff_t tile_col)
+{
+  using tiling = gemm_tiling<T>;
+  const ::std::ptrdiff_t i0 = tile_row * tiling::tile_rows;
+  const ::std::ptrdiff_t j0 = tile_col * tiling::tile_cols;
+  const ::std::ptrdiff_t m = ::std::min(tiling::tile_rows, C.extent0 - i0);
+  const ::std::ptrdiff_t n = ::std::min(tiling::tile_cols, C.extent1 - j0);
+  const ::std::ptrdiff_t K = A.extent1;
+  blocked_gemm(alpha, A.block(i0, 0, m, K), B.block(0, j0, K, n), beta, C.block(i0, j0, m, n));
+}
+
+// C = beta * C + alpha * A * B, on the thread pool.
+template<class T>
+void thread_pool_blocked_gemm(const T& alpha,
+                              strided_matrix_view<const T> A,
+                              strided_matrix_view<const T> B,
+                              const T& beta,
+                              strided_matrix_view<T> C)
+{
+  using tiling = gemm_tiling<T>;
+  const ::std::ptrdiff_t num_tile_rows = tiling::num_tile_rows(C.extent0);
+  const ::std::ptrdiff_t num_tiles = num_tile_rows * tiling::num_tile_cols(C.extent1);
+
+  thread_pool::global_instance().parallel_for(::std::size_t(num_tiles), [&] (::std::size_t tile) {
+    blocked_gemm_tile(alpha, A, B, beta, C,
+                      ::std::ptrdiff_t(tile) % num_tile_rows,
+                      ::std::ptrdiff_t(tile) / num_tile_rows);
+  });
+}
+
+// Minimum number of right-hand sides in each parallel chunk of a
+// triangular solve with an n x n matrix.  Each chunk does its own
+// matrix products, which need a few register tiles' worth of
+// right-hand sides to run at speed.
+template<class T>
+::std::size_t trsm_min_chunk(::std::ptrdiff_t n)
+{
+  return ::std::max(parallel_min_chunk(::std::size_t(n) * ::std::size_t(n)),
+                    ::std::size_t(trsm_blocking<T>::nu * gemm_blocking<T>::nr));
+}
+
+// Minimum number of columns (or rows) of C in each parallel chunk of
+// a symmetric or Hermitian product with an n x n matrix.  Each chunk
+// packs A again, so it takes enough columns to amortize that.
+template<class T>
+::std::size_t symm_min_chunk(::std::ptrdiff_t n)
+{
+  return ::std::max(parallel_min_chunk(::std::size_t(n) * ::std::size_t(n)),
+                    ::std::size_t(4 * gemm_blocking<T>::nr));
+}
+
+// y(i) = start(i) + (A * x)(i) with blocked_gemv, on the thread pool.
+// Chunks of rows are independent.  If A has too few rows for that,
+// each chunk of columns computes its own partial result instead, and
+// the partial results are added in order, so that the result does not
+// depend on the number of threads.
+template<class A_t, class x_t, class y_t, class Start>
+void thread_pool_blocked_gemv(A_t A, x_t x, y_t y, const Start& start)
+{
+  using T = typename y_t::value_type;
+  const ::std::ptrdiff_t num_rows = A.extent(0);
+  const ::std::ptrdiff_t num_cols = A.extent(1);
+  const ::std::size_t row_min_chunk = parallel_min_chunk(::std::size_t(num_cols));
+  if (gemv_split_columns(num_rows, num_cols, row_min_chunk)) {
+    const ::std::vector<T> sum = thread_pool_reduce_ranges(num_cols,
+      parallel_min_chunk(::std::size_t(num_rows)), ::std::vector<T>(num_rows),
+      [&] (::std::ptrdiff_t begin, ::std::ptrdiff_t end) {
+        return gemv_column_partial(A, x, begin, end);
+      },
+      [] (::std::vector<T> total, const ::std::vector<T>& partial) {
+        for (::std::size_t i = 0; i < total.size(); ++i) {
+          total[i] += partial[i];
+        }
+        return total;
+      });
+    for (::std::ptrdiff_t i = 0; i < num_rows; ++i) {
+      y(i) = static_cast<T>(start(i)) + sum[i];
+    }
+  }
+  else {
+    thread_pool_for_ranges(num_rows, row_min_chunk,
+      [&] (::std::ptrdiff_t begin, ::std::ptrdiff_t end) {
+        blocked_gemv_rows(A, x, y, start, begin, end);
+      });
+  }
+}
+
+// acc += A * x_packed with gemv_accumulate, on the thread pool.
+// Each chunk of A's rows updates its own entries of acc.  The parallel
+// triangular_matrix_vector_solve does its updates with this.
+template<class T>
+void thread_pool_gemv_accumulate(strided_matrix_view<const T> A, const T* x_packed, T* acc)
+{
+  thread_pool_for_ranges(A.extent0, parallel_min_chunk(::std::size_t(A.extent1)),
+    [&] (::std::ptrdiff_t begin, ::std::ptrdiff_t end) {
+      gemv_accumulate(A.block(begin, 0, end - begin, A.extent1), x_packed, acc + begin);
+    });
+}
+
+// y(i) = start(i) + (A * x)(i) with blocked_symv, on the thread
+// pool.  Each chunk of the engine's pairs of column groups computes
+// its own partial result, and the partial results are added in order.
+template<bool Hermitian, class Triangle, class A_t, class x_t, class y_t, class Start>
+void thread_pool_blocked_symv(A_t A, x_t x, y_t y, const Start& start)
+{
+  using T = typename y_t::value_type;
+  const ::std::ptrdiff_t n = A.extent(0);
+  const ::std::vector<T> sum = thread_pool_reduce_ranges(symv_num_pairs<T>(n),
+    parallel_min_chunk(gemv_blocking<T>::rt * ::std::size_t(n)), ::std::vector<T>(n),
+    [&] (::std::ptrdiff_t begin, ::std::ptrdiff_t end) {
+      return symv_partial<Hermitian, Triangle>(A, x, begin, end);
+    },
+    [] (::std::vector<T> total, const ::std::vector<T>& partial) {
+      for (::std::size_t i = 0; i < total.size(); ++i) {
+        total[i] += partial[i];
+      }
+      return total;
+    });
+  for (::std::ptrdiff_t i = 0; i < n; ++i) {
+    y(i) = static_cast<T>(start(i)) + sum[i];
+  }
+}
+
+// A = E + x * y^T (or A = x * y^T if Overwrite) with blocked_ger, on
+// the thread pool.  Each chunk of A's columns (or of its rows, if they
+// are contiguous) is independent.
+template<bool Overwrite, class x_t, class y_t, class A_t, class T>
+void thread_pool_blocked_ger(x_t x, y_t y, strided_matrix_view<const T> E, A_t A)
+{
+  const ger_operands<T> op = make_ger_operands(x, y, E, A);
+  thread_pool_for_ranges(op.A.extent1, parallel_min_chunk(::std::size_t(op.A.extent0)),
+    [&] (::std::ptrdiff_t begin, ::std::ptrdiff_t end) {
+      ger_update_columns<Overwrite>(op, begin, end);
+    });
+}
+
+// A's Triangle triangle = E + x * y^* + y * x^* (without E if
+// Overwrite) with blocked_syr2, on the thread pool.  Each chunk of
+// the engine's pairs of column groups is independent.
+template<bool Hermitian, bool Overwrite, class Triangle, class x_t, class y_t, class A_t, class T>
+void thread_pool_blocked_syr2(x_t x, y_t y, strided_matrix_view<const T> E, A_t A)
+{
+  const syr2_operands<T> op = make_syr2_operands<Hermitian, Triangle>(x, y, E, A);
+  const ::std::ptrdiff_t n = op.A.extent0;
+  thread_pool_for_ranges(symv_num_pairs<T>(n),
+    parallel_min_chunk(2 * gemv_blocking<T>::rt * ::std::size_t(n)),
+    [&] (::std::ptrdiff_t begin, ::std::ptrdiff_t end) {
+      syr2_update_pairs<Hermitian, Overwrite>(op, begin, end);
+    });
+}
+
+// For each (i,j) in rows [i_begin, i_end) and columns [j_begin, j_end)
+// of C that lies in Triangle (all of them if Triangle is void), set
+//
+//   C(i,j) = start(i,j) + term(i,j,0) + ... + term(i,j,num_terms-1),
+//
+// accumulating in the order written.  The parallel implementations
+// of the rank updates and generic matrix products call this on
+// independent blocks of C.
+template<class Triangle, class C_t, class Start, class Term>
+void update_block(C_t C,
+                  typename C_t::index_type i_begin, typename C_t::index_type i_end,
+                  typename C_t::index_type j_begin, typename C_t::index_type j_end,
+                  ::std::size_t num_terms, const Start& start, const Term& term)
+{
+  using index_type = typename C_t::index_type;
+  using value_type = typename C_t::value_type;
+  constexpr bool lower_tri = std::is_same_v<Triangle, lower_triangle_t>;
+  constexpr bool upper_tri = std::is_same_v<Triangle, upper_triangle_t>;
+
+  for (index_type j = j_begin; j < j_end; ++j) {
+    const index_type i_first = lower_tri ? ::std::max(i_begin, j) : i_begin;
+    const index_type i_last = upper_tri ? ::std::min(i_end, index_type(j + 1)) : i_end;
+    for (index_type i = i_first; i < i_last; ++i) {
+      value_type C_ij = start(i, j);
+      for (::std::size_t k = 0; k < num_terms; ++k) {
+        C_ij += term(i, j, k);
+      }
+      C(i,j) = C_ij;
+    }
+  }
+}
+
+// update_block on all of C, in parallel over its columns.
+template<class Triangle, class C_t, class Start, class Term>
+void thread_pool_update_columns(C_t C, ::std::size_t num_terms,
+                                const Start& start, const Term& term)
+{
+  using index_type = typename C_t::index_type;
+  const ::std::size_t work_per_column =
+    ::std::size_t(C.extent(0)) * ::std::max(num_terms, ::std::size_t(1));
+  thread_pool_for_ranges(C.extent(1), parallel_min_chunk(work_per_column),
+    [&] (index_type j_begin, index_type j_end) {
+      update_block<Triangle>(C, index_type(0), C.extent(0), j_begin, j_end,
+                             num_terms, start, term);
+    });
+}
+
+// Partial sums of squares, by Blue's algorithm, of x(i) for i in
+// [begin, end), or of A(i,j) for rows i in [begin, end).  Partial
+// sums merge exactly, so the parallel norms reduce these, and only
+// scale the total.
+template<class Scalar, class Vector, class Index>
+blue_sum_of_squares<Scalar> blue_sum_of_squares_of_range(const Vector& x, Index begin, Index end)
+{
+  using value_type = typename Vector::value_type;
+  blue_sum_of_squares<Scalar> ssq;
+  for (Index i = begin; i < end; ++i) {
+    ssq.add_parts(value_type(x(i)));
+  }
+  return ssq;
+}
+
+template<class Scalar, class Matrix, class Index>
+blue_sum_of_squares<Scalar> blue_sum_of_squares_of_rows(const Matrix& A, Index begin, Index end)
+{
+  using value_type = typename Matrix::value_type;
+  blue_sum_of_squares<Scalar> ssq;
+  for (Index i = begin; i < end; ++i) {
+    for (Index j = 0; j < A.extent(1); ++j) {
+      ssq.add_parts(value_type(A(i,j)));
+    }
+  }
+  return ssq;
+}
+
+// Add abs(value) to the scaled sum of squares (scale, ssq).
+template<class Scalar, class Value>
+void accumulate_sum_of_squares(Scalar& scale, Scalar& ssq, const Value& value)
+{
+  using std::abs;
+  const auto abs_value = abs(value);
+  if (abs_value != 0.0) {
+    if (scale < abs_value) {
+      const auto quotient = scale / abs_value;
+      ssq = Scalar(1.0) + ssq * quotient * quotient;
+      scale = abs_value;
+    }
+    else {
+      const auto quotient = abs_value / scale;
+      ssq = ssq + quotient * quotient;
+    }
+  }
+}
+
+} // end namespace impl
+
+// dot
+
+template<class ElementType1,
+         class SizeType1, ::std::size_t ext1,
+         class Layout1,
+         class Accessor1,
+         class ElementType2,
+         class SizeType2, ::std::size_t ext2,
+         class Layout2,
+         class Accessor2,
+         class Scalar>
+Scalar dot(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType1, extents<SizeType1, ext1>, Layout1, Accessor1> v1,
+  mdspan<ElementType2, extents<SizeType2, ext2>, Layout2, Accessor2> v2,
+  Scalar init)
+{
+  static_assert(v1.static_extent(0) == dynamic_extent ||
+                v2.static_extent(0) == dynamic_extent ||
+                v1.static_extent(0) == v2.static_extent(0));
+
+  using size_type = std::common_type_t<SizeType1, SizeType2>;
+  return impl::thread_pool_reduce_ranges(size_type(v1.extent(0)),
+    impl::parallel_min_chunk(1), init,
+    [&] (size_type begin, size_type end) {
+      Scalar sum{};
+      for (size_type k = begin; k < end; ++k) {
+        sum += v1(k) * v2(k);
+      }
+      return sum;
+    },
+    [] (const Scalar& x, const Scalar& y) { return x + y; });
+}
+
+// vector_abs_sum
+
+template<class ElementType,
+         class SizeType, ::std::size_t ext0,
+         class Layout,
+         class Accessor,
+         class Scalar>
+Scalar vector_abs_sum(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType, extents<SizeType, ext0>, Layout, Accessor> v,
+  Scalar init)
+{
+  using value_type = typename decltype(v)::value_type;
+  return impl::thread_pool_reduce_ranges(v.extent(0),
+    impl::parallel_min_chunk(1), init,
+    [&] (SizeType begin, SizeType end) {
+      Scalar sum{};
+      for (SizeType i = begin; i < end; ++i) {
+        if constexpr (std::is_arithmetic_v<value_type>) {
+          sum += impl::abs_if_needed(v(i));
+        }
+        else {
+          sum += impl::abs_if_needed(impl::real_if_needed(v(i)));
+          sum += impl::abs_if_needed(impl::imag_if_needed(v(i)));
+        }
+      }
+      return sum;
+    },
+    [] (const Scalar& x, const Scalar& y) { return x + y; });
+}
+
+// vector_sum_of_squares and vector_two_norm
+
+template<class ElementType,
+         class SizeType, ::std::size_t ext0,
+         class Layout,
+         class Accessor,
+         class Scalar>
+sum_of_squares_result<Scalar> vector_sum_of_squares(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType, extents<SizeType, ext0>, Layout, Accessor> x,
+  sum_of_squares_result<Scalar> init)
+{
+  if (x.extent(0) == 0) {
+    return init;
+  }
+  using value_type = typename decltype(x)::value_type;
+  if constexpr (impl::use_blue_sum_of_squares_v<value_type, Scalar>) {
+    const auto ssq = impl::thread_pool_reduce_ranges(x.extent(0),
+      impl::parallel_min_chunk(1), impl::blue_sum_of_squares<Scalar>{},
+      [&] (SizeType begin, SizeType end) {
+        return impl::blue_sum_of_squares_of_range<Scalar>(x, begin, end);
+      },
+      impl::blue_sum_of_squares<Scalar>::merged);
+    return combine_sum_of_squares(init, ssq.result());
+  }
+  return impl::thread_pool_reduce_ranges(x.extent(0),
+    impl::parallel_min_chunk(1), init,
+    [&] (SizeType begin, SizeType end) {
+      Scalar scale{};
+      Scalar ssq{};
+      for (SizeType i = begin; i < end; ++i) {
+        impl::accumulate_sum_of_squares(scale, ssq, x(i));
+      }
+      return sum_of_squares_result<Scalar>{scale, ssq};
+    },
+    combine_sum_of_squares<Scalar>);
+}
+
+template<class ElementType,
+         class SizeType, ::std::size_t ext0,
+         class Layout,
+         class Accessor,
+         class Scalar>
+Scalar vector_two_norm(
+  thread_pool_exec exec,
+  mdspan<ElementType, extents<SizeType, ext0>, Layout, Accessor> x,
+  Scalar init)
+{
+  using std::sqrt;
+  using value_type = typename decltype(x)::value_type;
+  if constexpr (impl::is_complex_v<value_type> && impl::use_blue_norm_v<value_type, Scalar>) {
+    const auto ssq = impl::thread_pool_reduce_ranges(x.extent(0),
+      impl::parallel_min_chunk(1), impl::blue_sum_of_squares<Scalar>{},
+      [&] (SizeType begin, SizeType end) {
+        return impl::blue_sum_of_squares_of_range<Scalar>(x, begin, end);
+      },
+      impl::blue_sum_of_squares<Scalar>::merged).result();
+    return init + ssq.scaling_factor * sqrt(ssq.scaled_sum_of_squares);
+  }
+
+  sum_of_squares_result<Scalar> ssq_init;
+  ssq_init.scaling_factor = Scalar{};
+  ssq_init.scaled_sum_of_squares = 1.0;
+
+  auto ssq_res = vector_sum_of_squares(exec, x, ssq_init);
+  return init + ssq_res.scaling_factor * sqrt(ssq_res.scaled_sum_of_squares);
+}
+
+// matrix_frob_norm, matrix_one_norm, and matrix_inf_norm
+
+template<class ElementType,
+         class SizeType, ::std::size_t numRows, ::std::size_t numCols,
+         class Layout,
+         class Accessor,
+         class Scalar>
+Scalar matrix_frob_norm(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType, extents<SizeType, numRows, numCols>, Layout, Accessor> A,
+  Scalar init)
+{
+  using std::abs;
+  using std::sqrt;
+
+  auto result = init;
+  if (A.extent(0) == 0 || A.extent(1) == 0) {
+    return result;
+  }
+  else if (A.extent(0) == SizeType(1) && A.extent(1) == SizeType(1)) {
+    result += abs(A(0, 0));
+    return result;
+  }
+
+  using value_type = typename decltype(A)::value_type;
+  if constexpr (impl::use_blue_norm_v<value_type, Scalar>) {
+    const auto ssq = impl::thread_pool_reduce_ranges(A.extent(0),
+      impl::parallel_min_chunk(A.extent(1)), impl::blue_sum_of_squares<Scalar>{},
+      [&] (SizeType begin, SizeType end) {
+        return impl::blue_sum_of_squares_of_rows<Scalar>(A, begin, end);
+      },
+      impl::blue_sum_of_squares<Scalar>::merged).result();
+    result += ssq.scaling_factor * sqrt(ssq.scaled_sum_of_squares);
+    return result;
+  }
+
+  const auto ssq = impl::thread_pool_reduce_ranges(A.extent(0),
+    impl::parallel_min_chunk(A.extent(1)),
+    sum_of_squares_result<Scalar>{Scalar(0.0), Scalar(1.0)},
+    [&] (SizeType begin, SizeType end) {
+      Scalar scale{};
+      Scalar ssq{};
+      for (SizeType i = begin; i < end; ++i) {
+        for (SizeType j = 0; j < A.extent(1); ++j) {
+          impl::accumulate_sum_of_squares(scale, ssq, A(i,j));
+        }
+      }
+      return sum_of_squares_result<Scalar>{scale, ssq};
+    },
+    combine_sum_of_squares<Scalar>);
+  result += ssq.scaling_factor * sqrt(ssq.scaled_sum_of_squares);
+  return result;
+}
+
+template<class ElementType,
+         class SizeType, ::std::size_t numRows, ::std::size_t numCols,
+         class Layout,
+         class Accessor,
+         class Scalar>
+Scalar matrix_one_norm(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType, extents<SizeType, numRows, numCols>, Layout, Accessor> A,
+  Scalar init)
+{
+  using std::abs;
+  using std::max;
+
+  auto result = init;
+  if (A.extent(0) == 0 || A.extent(1) == 0) {
+    return result;
+  }
+  else if (A.extent(0) == SizeType(1) && A.extent(1) == SizeType(1)) {
+    result += abs(A(0, 0));
+    return result;
+  }
+
+  return impl::thread_pool_reduce_ranges(A.extent(1),
+    impl::parallel_min_chunk(A.extent(0)), result,
+    [&] (SizeType begin, SizeType end) {
+      auto chunk_result = init;
+      for (SizeType j = begin; j < end; ++j) {
+        auto col_sum = init;
+        for (SizeType i = 0; i < A.extent(0); ++i) {
+          col_sum += abs(A(i,j));
+        }
+        chunk_result = max(col_sum, chunk_result);
+      }
+      return chunk_result;
+    },
+    [] (const Scalar& x, const Scalar& y) { return max(y, x); });
+}
+
+template<class ElementType,
+         class SizeType, ::std::size_t numRows, ::std::size_t numCols,
+         class Layout,
+         class Accessor,
+         class Scalar>
+Scalar matrix_inf_norm(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType, extents<SizeType, numRows, numCols>, Layout, Accessor> A,
+  Scalar init)
+{
+  using std::abs;
+  using std::max;
+
+  auto result = init;
+  if (A.extent(0) == 0 || A.extent(1) == 0) {
+    return result;
+  }
+  else if (A.extent(0) == SizeType(1) && A.extent(1) == SizeType(1)) {
+    result += abs(A(0, 0));
+    return result;
+  }
+
+  return impl::thread_pool_reduce_ranges(A.extent(0),
+    impl::parallel_min_chunk(A.extent(1)), result,
+    [&] (SizeType begin, SizeType end) {
+      auto chunk_result = init;
+      for (SizeType i = begin; i < end; ++i) {
+        auto row_sum = init;
+        for (SizeType j = 0; j < A.extent(1); ++j) {
+          row_sum += abs(A(i,j));
+        }
+        chunk_result = max(row_sum, chunk_result);
+      }
+      return chunk_result;
+    },
+    [] (const Scalar& x, const Scalar& y) { return max(y, x); });
+}
+
+// matrix_vector_product
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_x,
+         class SizeType_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y>
+void matrix_vector_product(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y)
+{
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_vector_product_dispatch_to_blas<decltype(A), decltype(x), decltype(y)>()) {
+    if (impl::matrix_vector_product_blas(A, x, ElementType_y{}, y, [] {})) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::is_gemv_blockable_v<decltype(A), decltype(x), decltype(y)>) {
+    impl::thread_pool_blocked_gemv(A, x, y, [] (auto) { return ElementType_y{}; });
+  }
+  else {
+    using size_type = std::common_type_t<SizeType_A, SizeType_x, SizeType_y>;
+    impl::thread_pool_for_ranges(size_type(A.extent(0)),
+      impl::parallel_min_chunk(A.extent(1)),
+      [&] (size_type begin, size_type end) {
+        for (size_type i = begin; i < end; ++i) {
+          y(i) = ElementType_y{};
+          for (size_type j = 0; j < A.extent(1); ++j) {
+            y(i) += A(i,j) * x(j);
+          }
+        }
+      });
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_x,
+         class SizeType_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y,
+         class ElementType_z,
+         class SizeType_z, ::std::size_t ext_z,
+         class Layout_z,
+         class Accessor_z>
+void matrix_vector_product(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y,
+  mdspan<ElementType_z, extents<SizeType_z, ext_z>, Layout_z, Accessor_z> z)
+{
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_vector_product_dispatch_to_blas<decltype(A), decltype(x), decltype(z)>()) {
+    if (impl::matrix_vector_product_blas(A, x, ElementType_z(1), z, [&] { linalg::copy(y, z); })) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::is_gemv_blockable_v<decltype(A), decltype(x), decltype(z)>) {
+    impl::thread_pool_blocked_gemv(A, x, z, [&] (auto i) { return y(i); });
+  }
+  else {
+    using size_type = std::common_type_t<SizeType_A, SizeType_x, SizeType_y, SizeType_z>;
+    impl::thread_pool_for_ranges(size_type(A.extent(0)),
+      impl::parallel_min_chunk(A.extent(1)),
+      [&] (size_type begin, size_type end) {
+        for (size_type i = begin; i < end; ++i) {
+          z(i) = y(i);
+          for (size_type j = 0; j < A.extent(1); ++j) {
+            z(i) += A(i,j) * x(j);
+          }
+        }
+      });
+  }
+}
+
+// symmetric_matrix_vector_product and hermitian_matrix_vector_product.
+// Element types or layouts that the blocked engine does not take run
+// inline.
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class ElementType_x,
+         class SizeType_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y>
+void symmetric_matrix_vector_product(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y)
+{
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::symmetric_matrix_vector_product_dispatch_to_blas<decltype(A), decltype(x), decltype(y)>()) {
+    if (impl::symmetric_matrix_vector_product_blas(A, t, x, ElementType_y{}, y, [] {})) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::is_symv_blockable_v<decltype(A), decltype(x), decltype(y)>) {
+    impl::thread_pool_blocked_symv<false, Triangle>(A, x, y, [] (auto) { return ElementType_y{}; });
+  }
+  else {
+    symmetric_matrix_vector_product(impl::inline_exec_t{}, A, t, x, y);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class ElementType_x,
+         class SizeType_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y,
+         class ElementType_z,
+         class SizeType_z, ::std::size_t ext_z,
+         class Layout_z,
+         class Accessor_z>
+void symmetric_matrix_vector_product(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y,
+  mdspan<ElementType_z, extents<SizeType_z, ext_z>, Layout_z, Accessor_z> z)
+{
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::symmetric_matrix_vector_product_dispatch_to_blas<decltype(A), decltype(x), decltype(z)>()) {
+    if (impl::symmetric_matrix_vector_product_blas(A, t, x, ElementType_z(1), z, [&] { linalg::copy(y, z); })) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::is_symv_blockable_v<decltype(A), decltype(x), decltype(z)>) {
+    impl::thread_pool_blocked_symv<false, Triangle>(A, x, z, [&] (auto i) { return y(i); });
+  }
+  else {
+    symmetric_matrix_vector_product(impl::inline_exec_t{}, A, t, x, y, z);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class ElementType_x,
+         class SizeType_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y>
+void hermitian_matrix_vector_product(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y)
+{
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_vector_product_dispatch_to_blas<decltype(A), decltype(x), decltype(y)>()) {
+    if (impl::hermitian_matrix_vector_product_blas(A, t, x, ElementType_y{}, y, [] {})) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::is_symv_blockable_v<decltype(A), decltype(x), decltype(y)>) {
+    impl::thread_pool_blocked_symv<true, Triangle>(A, x, y, [] (auto) { return ElementType_y{}; });
+  }
+  else {
+    hermitian_matrix_vector_product(impl::inline_exec_t{}, A, t, x, y);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class ElementType_x,
+         class SizeType_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y,
+         class ElementType_z,
+         class SizeType_z, ::std::size_t ext_z,
+         class Layout_z,
+         class Accessor_z>
+void hermitian_matrix_vector_product(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y,
+  mdspan<ElementType_z, extents<SizeType_z, ext_z>, Layout_z, Accessor_z> z)
+{
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_vector_product_dispatch_to_blas<decltype(A), decltype(x), decltype(z)>()) {
+    if (impl::hermitian_matrix_vector_product_blas(A, t, x, ElementType_z(1), z, [&] { linalg::copy(y, z); })) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::is_symv_blockable_v<decltype(A), decltype(x), decltype(z)>) {
+    impl::thread_pool_blocked_symv<true, Triangle>(A, x, z, [&] (auto i) { return y(i); });
+  }
+  else {
+    hermitian_matrix_vector_product(impl::inline_exec_t{}, A, t, x, y, z);
+  }
+}
+
+// triangular_matrix_vector_solve.  Element types or layouts that the
+// blocked engine does not take run inline.
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class DiagonalStorage,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t ext_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_X,
+         class SizeType_X, ::std::size_t ext_X,
+         class Layout_X,
+         class Accessor_X>
+void triangular_matrix_vector_solve(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  DiagonalStorage d,
+  mdspan<ElementType_B, extents<SizeType_B, ext_B>, Layout_B, Accessor_B> b,
+  mdspan<ElementType_X, extents<SizeType_X, ext_X>, Layout_X, Accessor_X> x)
+{
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_vector_product_dispatch_to_blas<decltype(A), decltype(b), decltype(x)>()) {
+    if (impl::triangular_matrix_vector_blas<true>(A, t, d, b, x)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::is_trsv_blockable_v<decltype(A), decltype(b), decltype(x)>) {
+    using T = typename decltype(x)::value_type;
+    impl::blocked_trsv<Triangle, DiagonalStorage>(A, b, x, true,
+      [] (impl::strided_matrix_view<const T> A_block, const T* x_packed, T* acc) {
+        impl::thread_pool_gemv_accumulate(A_block, x_packed, acc);
+      });
+  }
+  else {
+    triangular_matrix_vector_solve(impl::inline_exec_t{}, A, t, d, b, x);
+  }
+}
+
+// matrix_product
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B,
+         ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C,
+         ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void matrix_product(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_product_dispatch_to_blas<decltype(A), decltype(B), decltype(C)>()) {
+    if (impl::matrix_product_blas(A, B, ElementType_C{}, C)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+  if constexpr (impl::is_gemm_peelable_product_v<decltype(A), decltype(B), decltype(C)>) {
+    impl::thread_pool_blocked_gemm(impl::extractScalingFactor(A) * impl::extractScalingFactor(B),
+                                   impl::make_strided_matrix_view(A).as_const(),
+                                   impl::make_strided_matrix_view(B).as_const(),
+                                   ElementType_C{},
+                                   impl::make_strided_matrix_view(C));
+  }
+  else {
+    impl::thread_pool_update_columns<void>(C, A.extent(1),
+      [] (auto, auto) { return ElementType_C{}; },
+      [&] (auto i, auto j, ::std::size_t k) { return A(i,k) * B(k,j); });
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B,
+         ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_E,
+         class SizeType_E, ::std::size_t numRows_E,
+         ::std::size_t numCols_E,
+         class Layout_E,
+         class Accessor_E,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C,
+         ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void matrix_product(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_E, extents<SizeType_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+#ifdef LINALG_ENABLE_BLAS
+  constexpr bool blas_able =
+    impl::matrix_product_dispatch_to_blas<decltype(A), decltype(B), decltype(C)>();
+#else
+  constexpr bool blas_able = false;
+#endif // LINALG_ENABLE_BLAS
+  constexpr bool packable =
+    impl::is_gemm_peelable_product_v<decltype(A), decltype(B), decltype(C)>;
+
+  if constexpr (blas_able || packable) {
+    // E may alias C, so copy it first, then accumulate (beta = 1).
+    impl::thread_pool_update_columns<void>(C, 0,
+      [&] (auto i, auto j) { return E(i,j); },
+      [] (auto, auto, ::std::size_t) { return ElementType_C{}; });
+  }
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (blas_able) {
+    if (impl::matrix_product_blas(A, B, ElementType_C{1}, C)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+  if constexpr (packable) {
+    impl::thread_pool_blocked_gemm(impl::extractScalingFactor(A) * impl::extractScalingFactor(B),
+                                   impl::make_strided_matrix_view(A).as_const(),
+                                   impl::make_strided_matrix_view(B).as_const(),
+                                   ElementType_C{1},
+                                   impl::make_strided_matrix_view(C));
+  }
+  else {
+    impl::thread_pool_update_columns<void>(C, A.extent(1),
+      [&] (auto i, auto j) { return E(i,j); },
+      [&] (auto i, auto j, ::std::size_t k) { return A(i,k) * B(k,j); });
+  }
+}
+
+// Batched matrix_product
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numBatch_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numBatch_B, ::std::size_t numRows_B,
+         ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numBatch_C, ::std::size_t numRows_C,
+         ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void matrix_product(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numBatch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, numBatch_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_C, extents<SizeType_C, numBatch_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  impl::check_batched_matrix_product_extents(A, B, C);
+  using index_type = typename decltype(C)::index_type;
+  const bool batch_major =
+    impl::is_batch_major(A) && impl::is_batch_major(B) && impl::is_batch_major(C);
+  const impl::batched_matrix_product_zero<ElementType_C> start{};
+
+  // The matrices are independent.  Split them into whole blocks of
+  // lanes, so that each chunk can use the batch-major kernel.
+  constexpr index_type lanes = impl::batched_gemm_blocking<ElementType_C>::lanes;
+  const index_type num_batches = C.extent(0);
+  impl::thread_pool_for_ranges(index_type((num_batches + lanes - 1) / lanes),
+    impl::parallel_min_chunk(lanes * impl::batched_matrix_product_work(A, C)),
+    [&] (index_type block_begin, index_type block_end) {
+      impl::batched_matrix_product(A, B, C, start, block_begin * lanes,
+        ::std::min(index_type(block_end * lanes), num_batches), batch_major);
+    });
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numBatch_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numBatch_B, ::std::size_t numRows_B,
+         ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_E,
+         class SizeType_E, ::std::size_t numBatch_E, ::std::size_t numRows_E,
+         ::std::size_t numCols_E,
+         class Layout_E,
+         class Accessor_E,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numBatch_C, ::std::size_t numRows_C,
+         ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void matrix_product(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numBatch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, numBatch_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_E, extents<SizeType_E, numBatch_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, numBatch_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  impl::check_batched_matrix_product_extents(A, B, C);
+  using index_type = typename decltype(C)::index_type;
+  const bool batch_major =
+    impl::is_batch_major(A) && impl::is_batch_major(B) &&
+    impl::is_batch_major(E) && impl::is_batch_major(C);
+  const auto start = [&] (auto b, auto i, auto j) { return ElementType_C(E(b,i,j)); };
+
+  // The matrices are independent.  Split them into whole blocks of
+  // lanes, so that each chunk can use the batch-major kernel.
+  constexpr index_type lanes = impl::batched_gemm_blocking<ElementType_C>::lanes;
+  const index_type num_batches = C.extent(0);
+  impl::thread_pool_for_ranges(index_type((num_batches + lanes - 1) / lanes),
+    impl::parallel_min_chunk(lanes * impl::batched_matrix_product_work(A, C)),
+    [&] (index_type block_begin, index_type block_end) {
+      impl::batched_matrix_product(A, B, C, start, block_begin * lanes,
+        ::std::min(index_type(block_end * lanes), num_batches), batch_major);
+    });
+}
+
+// matrix_rank_1_update
+
+template<class ElementType_x,
+         class SizeType_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y,
+         class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A>
+void matrix_rank_1_update(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A)
+{
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_rank_1_update_dispatch_to_blas<decltype(x), decltype(y), decltype(A)>()) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+    auto init_A = [&] { impl::blas_zero_triangle<void>(A); };
+#else
+    auto init_A = [] {};
+#endif // LINALG_FIX_RANK_UPDATES
+    if (impl::matrix_rank_1_update_blas(x, y, A, init_A)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::is_ger_blockable_v<decltype(x), decltype(y), decltype(A)>) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+    constexpr bool overwrite = true;
+#else
+    constexpr bool overwrite = false;
+#endif // LINALG_FIX_RANK_UPDATES
+    impl::thread_pool_blocked_ger<overwrite>(x, y, impl::make_strided_matrix_view(A).as_const(), A);
+    return;
+  }
+
+  impl::thread_pool_update_columns<void>(A, 1,
+    [&] (auto i, auto j) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+      (void) i;
+      (void) j;
+      return typename decltype(A)::value_type{};
+#else
+      return A(i,j);
+#endif // LINALG_FIX_RANK_UPDATES
+    },
+    [&] (auto i, auto j, ::std::size_t) { return x(i) * y(j); });
+}
+
+#if defined(LINALG_FIX_RANK_UPDATES)
+template<class ElementType_x,
+         class SizeType_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y,
+         class ElementType_E,
+         class SizeType_E, ::std::size_t numRows_E,
+         ::std::size_t numCols_E,
+         class Layout_E,
+         class Accessor_E,
+         class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A>
+void matrix_rank_1_update(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y,
+  mdspan<ElementType_E, extents<SizeType_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A)
+{
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_rank_1_update_dispatch_to_blas<decltype(x), decltype(y), decltype(A)>()) {
+    if (impl::matrix_rank_1_update_blas(x, y, A, [&] { impl::blas_copy_triangle<void>(E, A); })) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::is_ger_blockable_v<decltype(x), decltype(y), decltype(A)> &&
+                impl::is_gemm_packable_matrix_v<decltype(E)> &&
+                std::is_same_v<typename decltype(E)::value_type, typename decltype(A)::value_type>) {
+    impl::thread_pool_blocked_ger<false>(x, y, impl::make_strided_matrix_view(E).as_const(), A);
+    return;
+  }
+
+  impl::thread_pool_update_columns<void>(A, 1,
+    [&] (auto i, auto j) { return E(i,j); },
+    [&] (auto i, auto j, ::std::size_t) { return x(i) * y(j); });
+}
+#endif // LINALG_FIX_RANK_UPDATES
+
+// symmetric_matrix_rank_1_update and hermitian_matrix_rank_1_update
+
+MDSPAN_TEMPLATE_REQUIRES(
+  class ScaleFactorType,
+  class ElementType_x,
+  class SizeType_x, ::std::size_t ext_x,
+  class Layout_x,
+  class Accessor_x,
+  class ElementType_A,
+  class SizeType_A, ::std::size_t numRows_A,
+  ::std::size_t numCols_A,
+  class Layout_A,
+  class Accessor_A,
+  class Triangle,
+  /* requires */ (
+    std::is_same_v<Triangle, lower_triangle_t> ||
+    std::is_same_v<Triangle, upper_triangle_t>
+  )
+)
+void symmetric_matrix_rank_1_update(
+  thread_pool_exec /* exec */,
+  ScaleFactorType alpha,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle /* t */)
+{
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::symmetric_matrix_rank_1_update_dispatch_to_blas<ScaleFactorType, decltype(x), decltype(A)>()) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+    auto init_A = [&] { impl::blas_zero_triangle<Triangle>(A); };
+#else
+    auto init_A = [] {};
+#endif // LINALG_FIX_RANK_UPDATES
+    if (impl::symmetric_matrix_rank_1_update_blas(alpha, x, A, Triangle{}, init_A)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  impl::thread_pool_update_columns<Triangle>(A, 1,
+    [&] (auto i, auto j) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+      (void) i;
+      (void) j;
+      return typename decltype(A)::value_type{};
+#else
+      return A(i,j);
+#endif // LINALG_FIX_RANK_UPDATES
+    },
+    [&] (auto i, auto j, ::std::size_t) { return alpha * x(i) * x(j); });
+}
+
+#if defined(LINALG_FIX_RANK_UPDATES)
+MDSPAN_TEMPLATE_REQUIRES(
+  class ScaleFactorType,
+  class ElementType_x,
+  class SizeType_x, ::std::size_t ext_x,
+  class Layout_x,
+  class Accessor_x,
+  class ElementType_E,
+  class SizeType_E, ::std::size_t numRows_E,
+  ::std::size_t numCols_E,
+  class Layout_E,
+  class Accessor_E,
+  class ElementType_A,
+  class SizeType_A, ::std::size_t numRows_A,
+  ::std::size_t numCols_A,
+  class Layout_A,
+  class Accessor_A,
+  class Triangle,
+  /* requires */ (
+    std::is_same_v<Triangle, lower_triangle_t> ||
+    std::is_same_v<Triangle, upper_triangle_t>
+  )
+)
+void symmetric_matrix_rank_1_update(
+  thread_pool_exec /* exec */,
+  ScaleFactorType alpha,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_E, extents<SizeType_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle /* t */)
+{
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::symmetric_matrix_rank_1_update_dispatch_to_blas<ScaleFactorType, decltype(x), decltype(A)>()) {
+    if (impl::symmetric_matrix_rank_1_update_blas(alpha, x, A, Triangle{}, [&] { impl::blas_copy_triangle<Triangle>(E, A); })) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  impl::thread_pool_update_columns<Triangle>(A, 1,
+    [&] (auto i, auto j) { return E(i,j); },
+    [&] (auto i, auto j, ::std::size_t) { return alpha * x(i) * x(j); });
+}
+#endif // LINALG_FIX_RANK_UPDATES
+
+MDSPAN_TEMPLATE_REQUIRES(
+  class ScaleFactorType,
+  class ElementType_x,
+  class SizeType_x, ::std::size_t ext_x,
+  class Layout_x,
+  class Accessor_x,
+  class ElementType_A,
+  class SizeType_A, ::std::size_t numRows_A,
+  ::std::size_t numCols_A,
+  class Layout_A,
+  class Accessor_A,
+  class Triangle,
+  /* requires */ (
+    std::is_same_v<Triangle, lower_triangle_t> ||
+    std::is_same_v<Triangle, upper_triangle_t>
+  )
+)
+void hermitian_matrix_rank_1_update(
+  thread_pool_exec /* exec */,
+  ScaleFactorType alpha,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle /* t */)
+{
+#if defined(LINALG_FIX_RANK_UPDATES)
+  alpha = impl::real_if_needed(alpha);
+#endif // LINALG_FIX_RANK_UPDATES
+
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::hermitian_matrix_rank_1_update_dispatch_to_blas<ScaleFactorType, decltype(x), decltype(A)>()) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+    auto init_A = [&] { impl::blas_zero_triangle<Triangle>(A); };
+#else
+    auto init_A = [] {};
+#endif // LINALG_FIX_RANK_UPDATES
+    if (impl::hermitian_matrix_rank_1_update_blas(alpha, x, A, Triangle{}, init_A)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  using value_type = typename decltype(A)::value_type;
+  impl::thread_pool_update_columns<Triangle>(A, 1,
+    [&] (auto i, auto j) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+      (void) i;
+      (void) j;
+      return value_type{};
+#else
+      return i == j ? value_type(impl::real_if_needed(A(i,j))) : value_type(A(i,j));
+#endif // LINALG_FIX_RANK_UPDATES
+    },
+    [&] (auto i, auto j, ::std::size_t) { return alpha * x(i) * impl::conj_if_needed(x(j)); });
+}
+
+#if defined(LINALG_FIX_RANK_UPDATES)
+MDSPAN_TEMPLATE_REQUIRES(
+  class ScaleFactorType,
+  class ElementType_x,
+  class SizeType_x, ::std::size_t ext_x,
+  class Layout_x,
+  class Accessor_x,
+  class ElementType_E,
+  class SizeType_E, ::std::size_t numRows_E,
+  ::std::size_t numCols_E,
+  class Layout_E,
+  class Accessor_E,
+  class ElementType_A,
+  class SizeType_A, ::std::size_t numRows_A,
+  ::std::size_t numCols_A,
+  class Layout_A,
+  class Accessor_A,
+  class Triangle,
+  /* requires */ (
+    std::is_same_v<Triangle, lower_triangle_t> ||
+    std::is_same_v<Triangle, upper_triangle_t>
+  )
+)
+void hermitian_matrix_rank_1_update(
+  thread_pool_exec /* exec */,
+  ScaleFactorType alpha,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_E, extents<SizeType_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle /* t */)
+{
+  alpha = impl::real_if_needed(alpha);
+
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::hermitian_matrix_rank_1_update_dispatch_to_blas<ScaleFactorType, decltype(x), decltype(A)>()) {
+    if (impl::hermitian_matrix_rank_1_update_blas(alpha, x, A, Triangle{}, [&] { impl::blas_copy_triangle<Triangle>(E, A); })) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  using value_type = typename decltype(A)::value_type;
+  impl::thread_pool_update_columns<Triangle>(A, 1,
+    [&] (auto i, auto j) {
+      return i == j ? value_type(impl::real_if_needed(E(i,j))) : value_type(E(i,j));
+    },
+    [&] (auto i, auto j, ::std::size_t) { return alpha * x(i) * impl::conj_if_needed(x(j)); });
+}
+#endif // LINALG_FIX_RANK_UPDATES
+
+// symmetric_matrix_rank_2_update and hermitian_matrix_rank_2_update.
+// Element types or layouts that the blocked engine does not take run
+// inline.
+
+MDSPAN_TEMPLATE_REQUIRES(
+  class ElementType_x,
+  class IndexType_x, ::std::size_t ext_x,
+  class Layout_x,
+  class Accessor_x,
+  class ElementType_y,
+  class IndexType_y, ::std::size_t ext_y,
+  class Layout_y,
+  class Accessor_y,
+  class ElementType_A,
+  class IndexType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+  class Layout_A,
+  class Accessor_A,
+  class Triangle,
+  /* requires */ (
+    std::is_same_v<Triangle, lower_triangle_t> ||
+    std::is_same_v<Triangle, upper_triangle_t>
+  )
+)
+void symmetric_matrix_rank_2_update(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_x, extents<IndexType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<IndexType_y, ext_y>, Layout_y, Accessor_y> y,
+  mdspan<ElementType_A, extents<IndexType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t)
+{
+  if constexpr (impl::is_syr2_blockable_v<decltype(x), decltype(y), decltype(A)>) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+    constexpr bool overwrite = true;
+#else
+    constexpr bool overwrite = false;
+#endif // LINALG_FIX_RANK_UPDATES
+    impl::thread_pool_blocked_syr2<false, overwrite, Triangle>(x, y, impl::make_strided_matrix_view(A).as_const(), A);
+  }
+  else {
+    symmetric_matrix_rank_2_update(impl::inline_exec_t{}, x, y, A, t);
+  }
+}
+
+#if defined(LINALG_FIX_RANK_UPDATES)
+MDSPAN_TEMPLATE_REQUIRES(
+  class ElementType_x,
+  class IndexType_x, ::std::size_t ext_x,
+  class Layout_x,
+  class Accessor_x,
+  class ElementType_y,
+  class IndexType_y, ::std::size_t ext_y,
+  class Layout_y,
+  class Accessor_y,
+  class ElementType_E,
+  class IndexType_E, ::std::size_t numRows_E, ::std::size_t numCols_E,
+  class Layout_E,
+  class Accessor_E,
+  class ElementType_A,
+  class IndexType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+  class Layout_A,
+  class Accessor_A,
+  class Triangle,
+  /* requires */ (
+    std::is_same_v<Triangle, lower_triangle_t> ||
+    std::is_same_v<Triangle, upper_triangle_t>
+  )
+)
+void symmetric_matrix_rank_2_update(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_x, extents<IndexType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<IndexType_y, ext_y>, Layout_y, Accessor_y> y,
+  mdspan<ElementType_E, extents<IndexType_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_A, extents<IndexType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t)
+{
+  if constexpr (impl::is_syr2_blockable_v<decltype(x), decltype(y), decltype(A)> &&
+                impl::is_gemm_packable_matrix_v<decltype(E)> &&
+                std::is_same_v<typename decltype(E)::value_type, typename decltype(A)::value_type>) {
+    impl::thread_pool_blocked_syr2<false, false, Triangle>(x, y, impl::make_strided_matrix_view(E).as_const(), A);
+  }
+  else {
+    symmetric_matrix_rank_2_update(impl::inline_exec_t{}, x, y, E, A, t);
+  }
+}
+#endif // LINALG_FIX_RANK_UPDATES
+
+MDSPAN_TEMPLATE_REQUIRES(
+  class ElementType_x,
+  class IndexType_x, ::std::size_t ext_x,
+  class Layout_x,
+  class Accessor_x,
+  class ElementType_y,
+  class IndexType_y, ::std::size_t ext_y,
+  class Layout_y,
+  class Accessor_y,
+  class ElementType_A,
+  class IndexType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+  class Layout_A,
+  class Accessor_A,
+  class Triangle,
+  /* requires */ (
+    std::is_same_v<Triangle, lower_triangle_t> ||
+    std::is_same_v<Triangle, upper_triangle_t>
+  )
+)
+void hermitian_matrix_rank_2_update(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_x, extents<IndexType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<IndexType_y, ext_y>, Layout_y, Accessor_y> y,
+  mdspan<ElementType_A, extents<IndexType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t)
+{
+  if constexpr (impl::is_syr2_blockable_v<decltype(x), decltype(y), decltype(A)>) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+    constexpr bool overwrite = true;
+#else
+    constexpr bool overwrite = false;
+#endif // LINALG_FIX_RANK_UPDATES
+    impl::thread_pool_blocked_syr2<true, overwrite, Triangle>(x, y, impl::make_strided_matrix_view(A).as_const(), A);
+  }
+  else {
+    hermitian_matrix_rank_2_update(impl::inline_exec_t{}, x, y, A, t);
+  }
+}
+
+#if defined(LINALG_FIX_RANK_UPDATES)
+MDSPAN_TEMPLATE_REQUIRES(
+  class ElementType_x,
+  class IndexType_x, ::std::size_t ext_x,
+  class Layout_x,
+  class Accessor_x,
+  class ElementType_y,
+  class IndexType_y, ::std::size_t ext_y,
+  class Layout_y,
+  class Accessor_y,
+  class ElementType_E,
+  class IndexType_E, ::std::size_t numRows_E, ::std::size_t numCols_E,
+  class Layout_E,
+  class Accessor_E,
+  class ElementType_A,
+  class IndexType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+  class Layout_A,
+  class Accessor_A,
+  class Triangle,
+  /* requires */ (
+    std::is_same_v<Triangle, lower_triangle_t> ||
+    std::is_same_v<Triangle, upper_triangle_t>
+  )
+)
+void hermitian_matrix_rank_2_update(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_x, extents<IndexType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<IndexType_y, ext_y>, Layout_y, Accessor_y> y,
+  mdspan<ElementType_E, extents<IndexType_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_A, extents<IndexType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t)
+{
+  if constexpr (impl::is_syr2_blockable_v<decltype(x), decltype(y), decltype(A)> &&
+                impl::is_gemm_packable_matrix_v<decltype(E)> &&
+                std::is_same_v<typename decltype(E)::value_type, typename decltype(A)::value_type>) {
+    impl::thread_pool_blocked_syr2<true, false, Triangle>(x, y, impl::make_strided_matrix_view(E).as_const(), A);
+  }
+  else {
+    hermitian_matrix_rank_2_update(impl::inline_exec_t{}, x, y, E, A, t);
+  }
+}
+#endif // LINALG_FIX_RANK_UPDATES
+
+// symmetric_matrix_rank_k_update and hermitian_matrix_rank_k_update
+
+MDSPAN_TEMPLATE_REQUIRES(
+  class ScaleFactorType,
+  class ElementType_A,
+  class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+  class Layout_A,
+  class Accessor_A,
+  class ElementType_C,
+  class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+  class Layout_C,
+  class Accessor_C,
+  class Triangle,
+  /* requires */ (
+   (std::is_same_v<Triangle, lower_triangle_t> ||
+    std::is_same_v<Triangle, upper_triangle_t>) &&
+   !impl::is_linalg_execution_policy_v<ScaleFactorType> && !impl::is_mdspan_v<ScaleFactorType>
+  )
+)
+void symmetric_matrix_rank_k_update(
+  thread_pool_exec /* exec */,
+  ScaleFactorType alpha,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
+  Triangle /* t */)
+{
+  if constexpr (impl::is_syrk_blockable_v<decltype(A), decltype(C), ScaleFactorType>) {
+    // The tiles of C's triangle all do about the same work.
+    impl::thread_pool_for_ranges(impl::syrk_num_tiles(C), 1,
+      [&] (::std::ptrdiff_t tile_begin, ::std::ptrdiff_t tile_end) {
+        impl::blocked_syrk_tiles<false, Triangle>(ElementType_C(alpha), A,
+          impl::rank_update_beta<ElementType_C>(), C, tile_begin, tile_end);
+      });
+  }
+  else {
+    impl::thread_pool_update_columns<Triangle>(C, A.extent(1),
+      [&] (auto i, auto j) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+        (void) i;
+        (void) j;
+        return ElementType_C{};
+#else
+        return C(i,j);
+#endif
+      },
+      [&] (auto i, auto j, ::std::size_t k) { return alpha * A(i,k) * A(j,k); });
+  }
+}
+
+#if defined(LINALG_FIX_RANK_UPDATES)
+MDSPAN_TEMPLATE_REQUIRES(
+  class ScaleFactorType,
+  class ElementType_A,
+  class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+  class Layout_A,
+  class Accessor_A,
+  class ElementType_E,
+  class Extents_E,
+  class Layout_E,
+  class Accessor_E,
+  class ElementType_C,
+  class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+  class Layout_C,
+  class Accessor_C,
+  class Triangle,
+  /* requires */ (
+   (std::is_same_v<Triangle, lower_triangle_t> ||
+    std::is_same_v<Triangle, upper_triangle_t>) &&
+   !impl::is_linalg_execution_policy_v<ScaleFactorType> && !impl::is_mdspan_v<ScaleFactorType> &&
+   Extents_E::rank() == 2
+  )
+)
+void symmetric_matrix_rank_k_update(
+  thread_pool_exec /* exec */,
+  ScaleFactorType alpha,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_E, Extents_E, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
+  Triangle /* t */)
+{
+  if constexpr (impl::is_syrk_blockable_v<decltype(A), decltype(C), ScaleFactorType>) {
+    // The tiles of C's triangle all do about the same work.
+    impl::thread_pool_for_ranges(impl::syrk_num_tiles(C), 1,
+      [&] (::std::ptrdiff_t tile_begin, ::std::ptrdiff_t tile_end) {
+        impl::blocked_syrk_tiles_from<false, Triangle>(ElementType_C(alpha), A, E, C,
+          tile_begin, tile_end);
+      });
+  }
+  else {
+    impl::thread_pool_update_columns<Triangle>(C, A.extent(1),
+      [&] (auto i, auto j) { return E(i,j); },
+      [&] (auto i, auto j, ::std::size_t k) { return alpha * A(i,k) * A(j,k); });
+  }
+}
+#endif // LINALG_FIX_RANK_UPDATES
+
+MDSPAN_TEMPLATE_REQUIRES(
+  class ScaleFactorType,
+  class ElementType_A,
+  class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+  class Layout_A,
+  class Accessor_A,
+  class ElementType_C,
+  class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+  class Layout_C,
+  class Accessor_C,
+  class Triangle,
+  /* requires */ (
+   (std::is_same_v<Triangle, lower_triangle_t> ||
+    std::is_same_v<Triangle, upper_triangle_t>) &&
+   !impl::is_linalg_execution_policy_v<ScaleFactorType> && !impl::is_mdspan_v<ScaleFactorType>
+  )
+)
+void hermitian_matrix_rank_k_update(
+  thread_pool_exec /* exec */,
+  ScaleFactorType alpha,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
+  Triangle /* t */)
+{
+  if constexpr (impl::is_syrk_blockable_v<decltype(A), decltype(C), ScaleFactorType>) {
+    // The tiles of C's triangle all do about the same work.
+    impl::thread_pool_for_ranges(impl::syrk_num_tiles(C), 1,
+      [&] (::std::ptrdiff_t tile_begin, ::std::ptrdiff_t tile_end) {
+        impl::blocked_syrk_tiles<true, Triangle>(ElementType_C(alpha), A,
+          impl::rank_update_beta<ElementType_C>(), C, tile_begin, tile_end);
+      });
+  }
+  else {
+    impl::thread_pool_update_columns<Triangle>(C, A.extent(1),
+      [&] (auto i, auto j) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+        (void) i;
+        (void) j;
+        return ElementType_C{};
+#else
+        return i == j ? ElementType_C(impl::real_if_needed(C(i,j))) : ElementType_C(C(i,j));
+#endif
+      },
+      [&] (auto i, auto j, ::std::size_t k) { return alpha * A(i,k) * impl::conj_if_needed(A(j,k)); });
+  }
+}
+
+#if defined(LINALG_FIX_RANK_UPDATES)
+MDSPAN_TEMPLATE_REQUIRES(
+  class ScaleFactorType,
+  class ElementType_A,
+  class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+  class Layout_A,
+  class Accessor_A,
+  class ElementType_E,
+  class Extents_E,
+  class Layout_E,
+  class Accessor_E,
+  class ElementType_C,
+  class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+  class Layout_C,
+  class Accessor_C,
+  class Triangle,
+  /* requires */ (
+   (std::is_same_v<Triangle, lower_triangle_t> ||
+    std::is_same_v<Triangle, upper_triangle_t>) &&
+   !impl::is_linalg_execution_policy_v<ScaleFactorType> && !impl::is_mdspan_v<ScaleFactorType> &&
+   Extents_E::rank() == 2
+  )
+)
+void hermitian_matrix_rank_k_update(
+  thread_pool_exec /* exec */,
+  ScaleFactorType alpha,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_E, Extents_E, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
+  Triangle /* t */)
+{
+  if constexpr (impl::is_syrk_blockable_v<decltype(A), decltype(C), ScaleFactorType>) {
+    // The tiles of C's triangle all do about the same work.
+    impl::thread_pool_for_ranges(impl::syrk_num_tiles(C), 1,
+      [&] (::std::ptrdiff_t tile_begin, ::std::ptrdiff_t tile_end) {
+        impl::blocked_syrk_tiles_from<true, Triangle>(ElementType_C(alpha), A, E, C,
+          tile_begin, tile_end);
+      });
+  }
+  else {
+    impl::thread_pool_update_columns<Triangle>(C, A.extent(1),
+      [&] (auto i, auto j) {
+        return i == j ? ElementType_C(impl::real_if_needed(E(i,j))) : ElementType_C(E(i,j));
+      },
+      [&] (auto i, auto j, ::std::size_t k) { return alpha * A(i,k) * impl::conj_if_needed(A(j,k)); });
+  }
+}
+#endif // LINALG_FIX_RANK_UPDATES
+
+// symmetric_matrix_rank_2k_update and hermitian_matrix_rank_2k_update.
+// Element types or layouts that the blocked engine does not take run
+// inline.
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C,
+         class Triangle>
+void symmetric_matrix_rank_2k_update(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
+  Triangle t)
+{
+  if constexpr (impl::is_syr2k_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    // The tiles of C's triangle all do about the same work.
+    impl::thread_pool_for_ranges(impl::syrk_num_tiles(C), 1,
+      [&] (::std::ptrdiff_t tile_begin, ::std::ptrdiff_t tile_end) {
+        impl::blocked_syr2k_tiles<false, Triangle>(A, B,
+          impl::rank_update_beta<ElementType_C>(), C, tile_begin, tile_end);
+      });
+  }
+  else {
+    symmetric_matrix_rank_2k_update(impl::inline_exec_t{}, A, B, C, t);
+  }
+}
+
+#if defined(LINALG_FIX_RANK_UPDATES)
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_E,
+         class SizeType_E, ::std::size_t numRows_E, ::std::size_t numCols_E,
+         class Layout_E,
+         class Accessor_E,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C,
+         class Triangle>
+void symmetric_matrix_rank_2k_update(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_E, extents<SizeType_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
+  Triangle t)
+{
+  if constexpr (impl::is_syr2k_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    // The tiles of C's triangle all do about the same work.
+    impl::thread_pool_for_ranges(impl::syrk_num_tiles(C), 1,
+      [&] (::std::ptrdiff_t tile_begin, ::std::ptrdiff_t tile_end) {
+        impl::blocked_syr2k_tiles_from<false, Triangle>(A, B, E, C, tile_begin, tile_end);
+      });
+  }
+  else {
+    symmetric_matrix_rank_2k_update(impl::inline_exec_t{}, A, B, E, C, t);
+  }
+}
+#endif // LINALG_FIX_RANK_UPDATES
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C,
+         class Triangle>
+void hermitian_matrix_rank_2k_update(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
+  Triangle t)
+{
+  if constexpr (impl::is_syr2k_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    // The tiles of C's triangle all do about the same work.
+    impl::thread_pool_for_ranges(impl::syrk_num_tiles(C), 1,
+      [&] (::std::ptrdiff_t tile_begin, ::std::ptrdiff_t tile_end) {
+        impl::blocked_syr2k_tiles<true, Triangle>(A, B,
+          impl::rank_update_beta<ElementType_C>(), C, tile_begin, tile_end);
+      });
+  }
+  else {
+    hermitian_matrix_rank_2k_update(impl::inline_exec_t{}, A, B, C, t);
+  }
+}
+
+#if defined(LINALG_FIX_RANK_UPDATES)
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_E,
+         class SizeType_E, ::std::size_t numRows_E, ::std::size_t numCols_E,
+         class Layout_E,
+         class Accessor_E,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C,
+         class Triangle>
+void hermitian_matrix_rank_2k_update(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_E, extents<SizeType_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
+  Triangle t)
+{
+  if constexpr (impl::is_syr2k_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    // The tiles of C's triangle all do about the same work.
+    impl::thread_pool_for_ranges(impl::syrk_num_tiles(C), 1,
+      [&] (::std::ptrdiff_t tile_begin, ::std::ptrdiff_t tile_end) {
+        impl::blocked_syr2k_tiles_from<true, Triangle>(A, B, E, C, tile_begin, tile_end);
+      });
+  }
+  else {
+    hermitian_matrix_rank_2k_update(impl::inline_exec_t{}, A, B, E, C, t);
+  }
+}
+#endif // LINALG_FIX_RANK_UPDATES
+
+// triangular_matrix_matrix_left_solve and
+// triangular_matrix_matrix_right_solve.  Element types or layouts
+// that the blocked solver does not take run inline.
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class DiagonalStorage,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B,
+         ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_X,
+         class SizeType_X, ::std::size_t numRows_X,
+         ::std::size_t numCols_X,
+         class Layout_X,
+         class Accessor_X>
+void triangular_matrix_matrix_left_solve(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  DiagonalStorage d,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_X, extents<SizeType_X, numRows_X, numCols_X>, Layout_X, Accessor_X> X)
+{
+  if constexpr (impl::is_trsm_blockable_v<decltype(A), decltype(B), decltype(X)>) {
+    const auto A_view = impl::make_strided_matrix_view(A).as_const();
+    const auto B_view = impl::make_strided_matrix_view(B).as_const();
+    const auto X_view = impl::make_strided_matrix_view(X);
+    const ::std::ptrdiff_t n = A_view.extent0;
+    // The columns of X are independent.
+    impl::thread_pool_for_ranges(X_view.extent1, impl::trsm_min_chunk<ElementType_X>(n),
+      [&] (::std::ptrdiff_t j_begin, ::std::ptrdiff_t j_end) {
+        impl::blocked_trsm_left<Triangle, DiagonalStorage>(A_view,
+          B_view.block(0, j_begin, n, j_end - j_begin),
+          X_view.block(0, j_begin, n, j_end - j_begin));
+      });
+  }
+  else {
+    triangular_matrix_matrix_left_solve(impl::inline_exec_t{}, A, t, d, B, X);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A,
+         ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class DiagonalStorage,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B,
+         ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_X,
+         class SizeType_X, ::std::size_t numRows_X,
+         ::std::size_t numCols_X,
+         class Layout_X,
+         class Accessor_X>
+void triangular_matrix_matrix_right_solve(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  DiagonalStorage d,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_X, extents<SizeType_X, numRows_X, numCols_X>, Layout_X, Accessor_X> X)
+{
+  if constexpr (impl::is_trsm_blockable_v<decltype(A), decltype(B), decltype(X)>) {
+    const auto A_view = impl::make_strided_matrix_view(A).as_const();
+    const auto B_view = impl::make_strided_matrix_view(B).as_const();
+    const auto X_view = impl::make_strided_matrix_view(X);
+    const ::std::ptrdiff_t n = A_view.extent1;
+    // The rows of X are independent.
+    impl::thread_pool_for_ranges(X_view.extent0, impl::trsm_min_chunk<ElementType_X>(n),
+      [&] (::std::ptrdiff_t i_begin, ::std::ptrdiff_t i_end) {
+        impl::blocked_trsm_right<Triangle, DiagonalStorage>(A_view,
+          B_view.block(i_begin, 0, i_end - i_begin, n),
+          X_view.block(i_begin, 0, i_end - i_begin, n));
+      });
+  }
+  else {
+    triangular_matrix_matrix_right_solve(impl::inline_exec_t{}, A, t, d, B, X);
+  }
+}
+
+// symmetric_matrix_product and hermitian_matrix_product.  Element
+// types or layouts that the blocked engine does not take run inline.
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void symmetric_matrix_product(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  if constexpr (impl::is_symm_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    // The columns of C are independent.
+    impl::thread_pool_for_ranges(::std::ptrdiff_t(C.extent(1)),
+      impl::symm_min_chunk<ElementType_C>(::std::ptrdiff_t(A.extent(0))),
+      [&] (::std::ptrdiff_t begin, ::std::ptrdiff_t end) {
+        impl::blocked_symm_product<false, Triangle, left_side_t>(
+          A, B, C, begin, end);
+      });
+  }
+  else {
+    symmetric_matrix_product(impl::inline_exec_t{}, A, t, B, C);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void symmetric_matrix_product(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  if constexpr (impl::is_symm_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    // The rows of C are independent.
+    impl::thread_pool_for_ranges(::std::ptrdiff_t(C.extent(0)),
+      impl::symm_min_chunk<ElementType_C>(::std::ptrdiff_t(A.extent(0))),
+      [&] (::std::ptrdiff_t begin, ::std::ptrdiff_t end) {
+        impl::blocked_symm_product<false, Triangle, right_side_t>(
+          A, B, C, begin, end);
+      });
+  }
+  else {
+    symmetric_matrix_product(impl::inline_exec_t{}, B, A, t, C);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_E,
+         class SizeType_E, ::std::size_t numRows_E, ::std::size_t numCols_E,
+         class Layout_E,
+         class Accessor_E,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void symmetric_matrix_product(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_E, extents<SizeType_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  if constexpr (impl::is_symm_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    // The columns of C are independent.
+    impl::thread_pool_for_ranges(::std::ptrdiff_t(C.extent(1)),
+      impl::symm_min_chunk<ElementType_C>(::std::ptrdiff_t(A.extent(0))),
+      [&] (::std::ptrdiff_t begin, ::std::ptrdiff_t end) {
+        impl::blocked_symm_product<false, Triangle, left_side_t>(
+          A, B, E, C, begin, end);
+      });
+  }
+  else {
+    symmetric_matrix_product(impl::inline_exec_t{}, A, t, B, E, C);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_E,
+         class SizeType_E, ::std::size_t numRows_E, ::std::size_t numCols_E,
+         class Layout_E,
+         class Accessor_E,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void symmetric_matrix_product(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  mdspan<ElementType_E, extents<SizeType_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  if constexpr (impl::is_symm_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    // The rows of C are independent.
+    impl::thread_pool_for_ranges(::std::ptrdiff_t(C.extent(0)),
+      impl::symm_min_chunk<ElementType_C>(::std::ptrdiff_t(A.extent(0))),
+      [&] (::std::ptrdiff_t begin, ::std::ptrdiff_t end) {
+        impl::blocked_symm_product<false, Triangle, right_side_t>(
+          A, B, E, C, begin, end);
+      });
+  }
+  else {
+    symmetric_matrix_product(impl::inline_exec_t{}, B, A, t, E, C);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void hermitian_matrix_product(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  if constexpr (impl::is_symm_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    // The columns of C are independent.
+    impl::thread_pool_for_ranges(::std::ptrdiff_t(C.extent(1)),
+      impl::symm_min_chunk<ElementType_C>(::std::ptrdiff_t(A.extent(0))),
+      [&] (::std::ptrdiff_t begin, ::std::ptrdiff_t end) {
+        impl::blocked_symm_product<true, Triangle, left_side_t>(
+          A, B, C, begin, end);
+      });
+  }
+  else {
+    hermitian_matrix_product(impl::inline_exec_t{}, A, t, B, C);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void hermitian_matrix_product(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  if constexpr (impl::is_symm_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    // The rows of C are independent.
+    impl::thread_pool_for_ranges(::std::ptrdiff_t(C.extent(0)),
+      impl::symm_min_chunk<ElementType_C>(::std::ptrdiff_t(A.extent(0))),
+      [&] (::std::ptrdiff_t begin, ::std::ptrdiff_t end) {
+        impl::blocked_symm_product<true, Triangle, right_side_t>(
+          A, B, C, begin, end);
+      });
+  }
+  else {
+    hermitian_matrix_product(impl::inline_exec_t{}, B, A, t, C);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_E,
+         class SizeType_E, ::std::size_t numRows_E, ::std::size_t numCols_E,
+         class Layout_E,
+         class Accessor_E,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void hermitian_matrix_product(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_E, extents<SizeType_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  if constexpr (impl::is_symm_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    // The columns of C are independent.
+    impl::thread_pool_for_ranges(::std::ptrdiff_t(C.extent(1)),
+      impl::symm_min_chunk<ElementType_C>(::std::ptrdiff_t(A.extent(0))),
+      [&] (::std::ptrdiff_t begin, ::std::ptrdiff_t end) {
+        impl::blocked_symm_product<true, Triangle, left_side_t>(
+          A, B, E, C, begin, end);
+      });
+  }
+  else {
+    hermitian_matrix_product(impl::inline_exec_t{}, A, t, B, E, C);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_E,
+         class SizeType_E, ::std::size_t numRows_E, ::std::size_t numCols_E,
+         class Layout_E,
+         class Accessor_E,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void hermitian_matrix_product(
+  thread_pool_exec /* exec */,
+  mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  mdspan<ElementType_E, extents<SizeType_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  if constexpr (impl::is_symm_blockable_v<decltype(A), decltype(B), decltype(C)>) {
+    // The rows of C are independent.
+    impl::thread_pool_for_ranges(::std::ptrdiff_t(C.extent(0)),
+      impl::symm_min_chunk<ElementType_C>(::std::ptrdiff_t(A.extent(0))),
+      [&] (::std::ptrdiff_t begin, ::std::ptrdiff_t end) {
+        impl::blocked_symm_product<true, Triangle, right_side_t>(
+          A, B, E, C, begin, end);
+      });
+  }
+  else {
+    hermitian_matrix_product(impl::inline_exec_t{}, B, A, t, E, C);
+  }
+}
+
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_THREAD_POOL_EXEC_HPP_
@@ -0,0 +1,422 @@
+#include "./gtest_fixtures.hpp"
+
+// BLAS 2 algorithms with operands that the external BLAS can take:
+// layout_left, layout_right, transposed and strided matrices and
+// vectors, with scaled and conjugated accessors.  Some combinations
+// cannot be expressed as BLAS calls and must fall back correctly.
+// Without LINALG_ENABLE_BLAS, this tests the generic implementation
+// instead.
+
+namespace {
+  using LinearAlgebra::conjugate_transposed;
+  using LinearAlgebra::conjugated;
+  using LinearAlgebra::explicit_diagonal;
+  using LinearAlgebra::explicit_diagonal_t;
+  using LinearAlgebra::hermitian_matrix_rank_1_update;
+  using LinearAlgebra::hermitian_matrix_vector_product;
+  using LinearAlgebra::implicit_unit_diagonal;
+  using LinearAlgebra::lower_triangle;
+  using LinearAlgebra::lower_triangle_t;
+  using LinearAlgebra::matrix_rank_1_update;
+  using LinearAlgebra::matrix_rank_1_update_c;
+  using LinearAlgebra::matrix_vector_product;
+  using LinearAlgebra::scaled;
+  using LinearAlgebra::symmetric_matrix_rank_1_update;
+  using LinearAlgebra::symmetric_matrix_vector_product;
+  using LinearAlgebra::transposed;
+  using LinearAlgebra::triangular_matrix_vector_product;
+  using LinearAlgebra::triangular_matrix_vector_solve;
+  using LinearAlgebra::upper_triangle;
+
+  using matrix_extents_t = extents<std::size_t, dynamic_extent, dynamic_extent>;
+  using vector_extents_t = extents<std::size_t, dynamic_extent>;
+
+  template<class VectorType>
+  std::vector<typename VectorType::value_type> to_vector(VectorType x)
+  {
+    std::vector<typename VectorType::value_type> v(x.extent(0));
+    for (std::size_t i = 0; i < x.extent(0); ++i) {
+      v[i] = x(i);
+    }
+    return v;
+  }
+
+  enum class structure {
+    general, symmetric, hermitian, explicit_triangular, unit_triangular
+  };
+
+  // The matrix that an algorithm sees, given the structure and
+  // Triangle argument, read through A's own accessor.  Column major.
+  template<class AType, class Triangle>
+  std::vector<typename AType::value_type>
+  full_matrix(AType A, Triangle, structure s)
+  {
+    using value_type = typename AType::value_type;
+    constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+    const std::size_t M = A.extent(0);
+    const std::size_t N = A.extent(1);
+    std::vector<value_type> F(M * N);
+    for (std::size_t j = 0; j < N; ++j) {
+      for (std::size_t i = 0; i < M; ++i) {
+        const bool in_triangle = lower ? i >= j : i <= j;
+        value_type v{};
+        if (s == structure::general || (in_triangle && i != j)) {
+          v = A(i,j);
+        }
+        else if (i == j) {
+          v = s == structure::unit_triangular ? value_type(1) :
+            s == structure::hermitian ? value_type(LinearAlgebra::impl::real_if_needed(value_type(A(i,i)))) :
+            value_type(A(i,i));
+        }
+        else if (s == structure::symmetric) {
+          v = A(j,i);
+        }
+        else if (s == structure::hermitian) {
+          v = LinearAlgebra::impl::conj_if_needed(value_type(A(j,i)));
+        }
+        F[i + j * M] = v;
+      }
+    }
+    return F;
+  }
+
+  // y = F * x + y0, with F from full_matrix.
+  template<class Scalar, class XType>
+  std::vector<Scalar> reference_product(const std::vector<Scalar>& F, std::size_t M,
+                                        XType x, const std::vector<Scalar>& y0)
+  {
+    std::vector<Scalar> y(y0);
+    for (std::size_t j = 0; j < x.extent(0); ++j) {
+      for (std::size_t i = 0; i < M; ++i) {
+        y[i] += F[i + j * M] * Scalar(x(j));
+      }
+    }
+    return y;
+  }
+
+  template<class VectorType, class Scalar>
+  void expect_vector_eq(VectorType y, const std::vector<Scalar>& y_ref)
+  {
+    ASSERT_EQ(y.extent(0), y_ref.size());
+    for (std::size_t i = 0; i < y_ref.size(); ++i) {
+      EXPECT_EQ(y(i), y_ref[i]) << "at " << i;
+    }
+  }
+
+  // Checks y = A * x, z = y + A * x, and y = y + A * x, where op(A,
+  // x, y[, z]) runs the algorithm.
+  template<class Scalar, class XType, class Op, class UpdOp>
+  void check_product(const std::vector<Scalar>& F, XType x, Op op, UpdOp upd_op)
+  {
+    const std::size_t M = F.size() / x.extent(0);
+    const std::vector<Scalar> zero(M);
+
+    strided_vector<Scalar> y(M, 10), z(M, 11);
+    op(y.x);
+    expect_vector_eq(y.x, reference_product(F, M, x, zero));
+
+    strided_vector<Scalar> y0(M, 12);
+    upd_op(y0.x, z.x);
+    expect_vector_eq(z.x, reference_product(F, M, x, to_vector(y0.x)));
+
+    // The vector to update may alias the output.
+    const auto y0_old = to_vector(y0.x);
+    upd_op(y0.x, y0.x);
+    expect_vector_eq(y0.x, reference_product(F, M, x, y0_old));
+  }
+
+  template<class Scalar, class Layout>
+  void test_matrix_vector_product()
+  {
+    constexpr std::size_t M = 7, N = 5;
+    test_matrix<Scalar, Layout> A(M, N, 1), A_t(N, M, 2);
+    strided_vector<Scalar> x(N, 3);
+
+    auto check = [&](auto A_view, auto x_view) {
+      const auto F = full_matrix(A_view, lower_triangle, structure::general);
+      check_product(F, x_view,
+        [&](auto y) { matrix_vector_product(A_view, x_view, y); },
+        [&](auto y, auto z) { matrix_vector_product(A_view, x_view, y, z); });
+    };
+    check(A.A, x.x);
+    check(transposed(A_t.A), x.x);
+    check(conjugate_transposed(A_t.A), x.x);
+    // The BLAS cannot conjugate A without transposing, or conjugate x.
+    check(conjugated(A.A), x.x);
+    check(A.A, conjugated(x.x));
+    check(scaled(Scalar(2), A.A), scaled(Scalar(-3), x.x));
+    check(conjugated(scaled(Scalar(2), transposed(A_t.A))), x.x);
+  }
+
+  TEST(BLAS2_blas, matrix_vector_product)
+  {
+    test_matrix_vector_product<double, layout_left>();
+    test_matrix_vector_product<double, layout_right>();
+    test_matrix_vector_product<float, layout_left>();
+    test_matrix_vector_product<std::complex<double>, layout_left>();
+    test_matrix_vector_product<std::complex<double>, layout_right>();
+    test_matrix_vector_product<std::complex<float>, layout_right>();
+  }
+
+  template<class Scalar, class Layout, class Triangle>
+  void test_symmetric_and_hermitian_matrix_vector_product(Triangle t)
+  {
+    constexpr std::size_t N = 6;
+    test_matrix<Scalar, Layout> A(N, N, 1);
+    strided_vector<Scalar> x(N, 2);
+
+    auto check_symmetric = [&](auto A_view) {
+      const auto F = full_matrix(A_view, t, structure::symmetric);
+      check_product(F, x.x,
+        [&](auto y) { symmetric_matrix_vector_product(A_view, t, x.x, y); },
+        [&](auto y, auto z) { symmetric_matrix_vector_product(A_view, t, x.x, y, z); });
+    };
+    auto check_hermitian = [&](auto A_view) {
+      const auto F = full_matrix(A_view, t, structure::hermitian);
+      check_product(F, x.x,
+        [&](auto y) { hermitian_matrix_vector_product(A_view, t, x.x, y); },
+        [&](auto y, auto z) { hermitian_matrix_vector_product(A_view, t, x.x, y, z); });
+    };
+
+    if constexpr (! LinearAlgebra::impl::is_complex_v<Scalar>) {
+      check_symmetric(A.A);
+      check_symmetric(transposed(A.A));
+      check_symmetric(scaled(Scalar(2), A.A));
+    }
+    check_hermitian(A.A);
+    check_hermitian(conjugate_transposed(A.A));
+    check_hermitian(scaled(Scalar(-2), A.A));
+    // For complex Scalar, the BLAS cannot take these.
+    check_hermitian(transposed(A.A));
+    check_hermitian(conjugated(A.A));
+    if constexpr (LinearAlgebra::impl::is_complex_v<Scalar>) {
+      check_hermitian(scaled(Scalar(0, 1), A.A));
+    }
+  }
+
+  TEST(BLAS2_blas, symmetric_and_hermitian_matrix_vector_product)
+  {
+    test_symmetric_and_hermitian_matrix_vector_product<double, layout_left>(lower_triangle);
+    test_symmetric_and_hermitian_matrix_vector_product<double, layout_right>(upper_triangle);
+    test_symmetric_and_hermitian_matrix_vector_product<float, layout_left>(upper_triangle);
+    test_symmetric_and_hermitian_matrix_vector_product<std::complex<double>, layout_left>(lower_triangle);
+    test_symmetric_and_hermitian_matrix_vector_product<std::complex<double>, layout_right>(upper_triangle);
+    test_symmetric_and_hermitian_matrix_vector_product<std::complex<float>, layout_left>(upper_triangle);
+  }
+
+  template<class Scalar, class Layout, class Triangle, class DiagonalStorage>
+  void test_triangular(Triangle t, DiagonalStorage d)
+  {
+    constexpr std::size_t N = 6;
+    constexpr structure s = std::is_same_v<DiagonalStorage, explicit_diagonal_t> ?
+      structure::explicit_triangular : structure::unit_triangular;
+    // A diagonal of twos keeps the solutions exactly representable.
+    test_matrix<Scalar, Layout> A(N, N, 1);
+    for (std::size_t i = 0; i < N; ++i) {
+      A.A(i,i) = Scalar(2);
+    }
+    strided_vector<Scalar> x(N, 2);
+
+    auto check = [&](auto A_view) {
+      const auto F = full_matrix(A_view, t, s);
+      check_product(F, x.x,
+        [&](auto y) { triangular_matrix_vector_product(A_view, t, d, x.x, y); },
+        [&](auto y, auto z) { triangular_matrix_vector_product(A_view, t, d, x.x, y, z); });
+
+      // In place: y = A * y
+      strided_vector<Scalar> y(N, 3);
+      const auto y_ref = reference_product(F, N, y.x, std::vector<Scalar>(N));
+      triangular_matrix_vector_product(A_view, t, d, y.x);
+      expect_vector_eq(y.x, y_ref);
+
+      // Solve A * y = b, then check that A * y = b.
+      strided_vector<Scalar> b(N, 4);
+      triangular_matrix_vector_solve(A_view, t, d, b.x, y.x);
+      expect_vector_eq(b.x, reference_product(F, N, y.x, std::vector<Scalar>(N)));
+    };
+    check(A.A);
+    check(transposed(A.A));
+    check(conjugate_transposed(A.A));
+    check(scaled(Scalar(2), A.A));
+    // The BLAS cannot take these; for an implicit unit diagonal, that
+    // includes the scaled A above.
+    check(conjugated(A.A));
+    check(scaled(Scalar(-1), conjugated(A.A)));
+  }
+
+  TEST(BLAS2_blas, triangular_matrix_vector_product_and_solve)
+  {
+    test_triangular<double, layout_left>(lower_triangle, explicit_diagonal);
+    test_triangular<double, layout_right>(upper_triangle, explicit_diagonal);
+    test_triangular<double, layout_left>(upper_triangle, implicit_unit_diagonal);
+    test_triangular<float, layout_right>(lower_triangle, implicit_unit_diagonal);
+    test_triangular<std::complex<double>, layout_left>(upper_triangle, explicit_diagonal);
+    test_triangular<std::complex<double>, layout_right>(lower_triangle, implicit_unit_diagonal);
+    test_triangular<std::complex<float>, layout_left>(lower_triangle, explicit_diagonal);
+  }
+
+  // Expected result of a rank-1 update of A_old by the outer product
+  // F (column major), on the given structure's part of A.  Entries
+  // outside that part must not change.
+  template<class AType, class Scalar, class Triangle>
+  void expect_rank_1_update(AType A, const std::vector<Scalar>& A_old,
+                            const std::vector<Scalar>& F, Triangle, structure s)
+  {
+    constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+    const std::size_t M = A.extent(0);
+    for (std::size_t j = 0; j < A.extent(1); ++j) {
+      for (std::size_t i = 0; i < M; ++i) {
+        const bool updated = s == structure::general || (lower ? i >= j : i <= j);
+        Scalar expected = A_old[i + j * M];
+        if (updated) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+          expected = Scalar{};
+#endif // LINALG_FIX_RANK_UPDATES
+          if (s == structure::hermitian && i == j) {
+            expected = Scalar(LinearAlgebra::impl::real_if_needed(expected));
+          }
+          expected += F[i + j * M];
+        }
+        EXPECT_EQ(A(i,j), expected) << "at (" << i << "," << j << ")";
+      }
+    }
+  }
+
+  template<class AType>
+  std::vector<typename AType::value_type> to_vector_2d(AType A)
+  {
+    std::vector<typename AType::value_type> v(A.extent(0) * A.extent(1));
+    for (std::size_t j = 0; j < A.extent(1); ++j) {
+      for (std::size_t i = 0; i < A.extent(0); ++i) {
+        v[i + j * A.extent(0)] = A(i,j);
+      }
+    }
+    return v;
+  }
+
+  template<class Scalar, class XType, class YType>
+  std::vector<Scalar> outer_product(Scalar alpha, XType x, YType y, bool conj_y)
+  {
+    std::vector<Scalar> F(x.extent(0) * y.extent(0));
+    for (std::size_t j = 0; j < y.extent(0); ++j) {
+      for (std::size_t i = 0; i < x.extent(0); ++i) {
+        const Scalar y_j = conj_y ? LinearAlgebra::impl::conj_if_needed(Scalar(y(j))) : Scalar(y(j));
+        F[i + j * x.extent(0)] = alpha * Scalar(x(i)) * y_j;
+      }
+    }
+    return F;
+  }
+
+  template<class Scalar, class Layout>
+  void test_matrix_rank_1_update()
+  {
+    constexpr std::size_t M = 7, N = 5;
+    test_matrix<Scalar, Layout> A(M, N, 1);
+    strided_vector<Scalar> x(M, 2), y(N, 3);
+
+    auto check = [&](auto x_view, auto y_view) {
+      const auto A_old = to_vector_2d(A.A);
+      matrix_rank_1_update(x_view, y_view, A.A);
+      expect_rank_1_update(A.A, A_old, outer_product(Scalar(1), x_view, y_view, false),
+                           lower_triangle, structure::general);
+    };
+    check(x.x, y.x);
+    check(scaled(Scalar(2), x.x), scaled(Scalar(-1), y.x));
+    check(x.x, conjugated(y.x));
+    check(conjugated(x.x), y.x);
+    check(conjugated(x.x), scaled(Scalar(3), conjugated(y.x)));
+
+    const auto A_old = to_vector_2d(A.A);
+    matrix_rank_1_update_c(x.x, y.x, A.A);
+    expect_rank_1_update(A.A, A_old, outer_product(Scalar(1), x.x, y.x, true),
+                         lower_triangle, structure::general);
+  }
+
+  TEST(BLAS2_blas, matrix_rank_1_update)
+  {
+    test_matrix_rank_1_update<double, layout_left>();
+    test_matrix_rank_1_update<double, layout_right>();
+    test_matrix_rank_1_update<float, layout_right>();
+    test_matrix_rank_1_update<std::complex<double>, layout_left>();
+    test_matrix_rank_1_update<std::complex<double>, layout_right>();
+    test_matrix_rank_1_update<std::complex<float>, layout_left>();
+  }
+
+  template<class Scalar, class Layout, class Triangle>
+  void test_symmetric_and_hermitian_rank_1_update(Triangle t)
+  {
+    constexpr std::size_t N = 6;
+    test_matrix<Scalar, Layout> A(N, N, 1);
+    strided_vector<Scalar> x(N, 2);
+
+    auto check_symmetric = [&](auto alpha, auto x_view) {
+      const auto A_old = to_vector_2d(A.A);
+      symmetric_matrix_rank_1_update(alpha, x_view, A.A, t);
+      expect_rank_1_update(A.A, A_old, outer_product(Scalar(alpha), x_view, x_view, false),
+                           t, structure::symmetric);
+    };
+    auto check_hermitian = [&](auto alpha, auto x_view) {
+      const auto A_old = to_vector_2d(A.A);
+      hermitian_matrix_rank_1_update(alpha, x_view, A.A, t);
+      expect_rank_1_update(A.A, A_old, outer_product(Scalar(alpha), x_view, x_view, true),
+                           t, structure::hermitian);
+    };
+
+    if constexpr (! LinearAlgebra::impl::is_complex_v<Scalar>) {
+      check_symmetric(Scalar(1), x.x);
+      check_symmetric(Scalar(-2), scaled(Scalar(3), x.x));
+    }
+    check_hermitian(Scalar(1), x.x);
+    check_hermitian(Scalar(-2), scaled(Scalar(3), x.x));
+    // For complex Scalar, only one of these can go to the BLAS,
+    // depending on A's layout.
+    check_hermitian(Scalar(1), conjugated(x.x));
+    check_hermitian(Scalar(2), scaled(Scalar(-1), conjugated(x.x)));
+  }
+
+  TEST(BLAS2_blas, symmetric_and_hermitian_matrix_rank_1_update)
+  {
+    test_symmetric_and_hermitian_rank_1_update<double, layout_left>(lower_triangle);
+    test_symmetric_and_hermitian_rank_1_update<double, layout_right>(upper_triangle);
+    test_symmetric_and_hermitian_rank_1_update<float, layout_left>(upper_triangle);
+    test_symmetric_and_hermitian_rank_1_update<std::complex<double>, layout_left>(lower_triangle);
+    test_symmetric_and_hermitian_rank_1_update<std::complex<double>, layout_right>(upper_triangle);
+    test_symmetric_and_hermitian_rank_1_update<std::complex<float>, layout_right>(lower_triangle);
+  }
+
+#ifdef LINALG_ENABLE_BLAS
+  TEST(BLAS2_blas, dispatch_predicates)
+  {
+    using LinearAlgebra::impl::matrix_vector_product_dispatch_to_blas;
+    using LinearAlgebra::impl::symmetric_matrix_vector_product_dispatch_to_blas;
+    using LinearAlgebra::impl::matrix_rank_1_update_dispatch_to_blas;
+    using LinearAlgebra::impl::symmetric_matrix_rank_1_update_dispatch_to_blas;
+    using LinearAlgebra::impl::hermitian_matrix_rank_1_update_dispatch_to_blas;
+    using matrix_t = mdspan<double, matrix_extents_t, layout_right>;
+    using vector_t = mdspan<double, vector_extents_t, layout_stride>;
+    using cmatrix_t = mdspan<std::complex<double>, matrix_extents_t, layout_left>;
+    using cvector_t = mdspan<std::complex<double>, vector_extents_t>;
+    using small_matrix_t = mdspan<double, extents<std::size_t, 3, 3>>;
+
+    matrix_t A(nullptr, 1, 1);
+    cvector_t z(nullptr, 1);
+    using scaled_t = decltype(scaled(2.0, transposed(A)));
+    using conj_vector_t = decltype(conjugated(z));
+
+    static_assert(matrix_vector_product_dispatch_to_blas<scaled_t, vector_t, vector_t>());
+    static_assert(matrix_vector_product_dispatch_to_blas<cmatrix_t, conj_vector_t, cvector_t>());
+    static_assert(symmetric_matrix_vector_product_dispatch_to_blas<matrix_t, vector_t, vector_t>());
+    static_assert(! symmetric_matrix_vector_product_dispatch_to_blas<cmatrix_t, cvector_t, cvector_t>());
+    static_assert(! matrix_vector_product_dispatch_to_blas<small_matrix_t, vector_t, vector_t>());
+    static_assert(! matrix_vector_product_dispatch_to_blas<matrix_t, vector_t, cvector_t>());
+    static_assert(! matrix_vector_product_dispatch_to_blas<matrix_t, vector_t, conj_vector_t>());
+
+    static_assert(matrix_rank_1_update_dispatch_to_blas<conj_vector_t, cvector_t, cmatrix_t>());
+    static_assert(! matrix_rank_1_update_dispatch_to_blas<vector_t, vector_t, scaled_t>());
+    static_assert(symmetric_matrix_rank_1_update_dispatch_to_blas<int, vector_t, matrix_t>());
+    static_assert(! symmetric_matrix_rank_1_update_dispatch_to_blas<double, cvector_t, cmatrix_t>());
+    static_assert(hermitian_matrix_rank_1_update_dispatch_to_blas<double, conj_vector_t, cmatrix_t>());
+  }
+#endif // LINALG_ENABLE_BLAS
+
+} // end anonymous namespace
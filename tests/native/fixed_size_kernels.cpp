@@ -0,0 +1,177 @@
+#include "./gtest_fixtures.hpp"
+
+// dot, matrix_vector_product, and matrix_product on operands whose
+// extents are all compile-time constants use fully unrolled kernels.
+// Their results must match those of the same algorithms on the same
+// data viewed with run-time extents.  Small integers keep every
+// partial sum exact.
+
+namespace {
+  using LinearAlgebra::dot;
+  using LinearAlgebra::matrix_product;
+  using LinearAlgebra::matrix_vector_product;
+  using LinearAlgebra::scaled;
+
+  template<class Scalar, std::size_t M, std::size_t N, class Layout = layout_right>
+  struct static_matrix {
+    using static_t = mdspan<Scalar, extents<std::size_t, M, N>, Layout>;
+    using dynamic_t = mdspan<Scalar, dextents<std::size_t, 2>, Layout>;
+
+    explicit static_matrix(std::size_t seed) : storage(M * N)
+    {
+      static_t A = view();
+      for (std::size_t i = 0; i < M; ++i) {
+        for (std::size_t j = 0; j < N; ++j) {
+          A(i,j) = test_value<Scalar>(i, j, seed);
+        }
+      }
+    }
+    static_t view() { return static_t(storage.data()); }
+    dynamic_t dynamic_view() { return dynamic_t(storage.data(), M, N); }
+
+    std::vector<Scalar> storage;
+  };
+
+  template<class Scalar, std::size_t M, std::size_t N, std::size_t K,
+           class Layout_A, class Layout_B, class Layout_C>
+  void test_matrix_product()
+  {
+    static_matrix<Scalar, M, K, Layout_A> A(1);
+    static_matrix<Scalar, K, N, Layout_B> B(2);
+    static_matrix<Scalar, M, N, Layout_C> E(3);
+    static_matrix<Scalar, M, N, Layout_C> C(4);
+    static_matrix<Scalar, M, N, Layout_C> C_expected(5);
+    static_assert(LinearAlgebra::impl::use_unrolled_matrix_product_v<
+      decltype(A.view()), decltype(B.view()), decltype(C.view())>);
+
+    matrix_product(A.view(), B.view(), C.view());
+    matrix_product(A.dynamic_view(), B.dynamic_view(), C_expected.dynamic_view());
+    EXPECT_EQ(C.storage, C_expected.storage) << "overwrite";
+
+    matrix_product(A.view(), B.view(), E.view(), C.view());
+    matrix_product(A.dynamic_view(), B.dynamic_view(), E.dynamic_view(), C_expected.dynamic_view());
+    EXPECT_EQ(C.storage, C_expected.storage) << "update";
+
+    // E may be C.
+    matrix_product(A.view(), B.view(), C.view(), C.view());
+    matrix_product(A.dynamic_view(), B.dynamic_view(), C_expected.dynamic_view(), C_expected.dynamic_view());
+    EXPECT_EQ(C.storage, C_expected.storage) << "in-place update";
+
+    matrix_product(scaled(Scalar(2), A.view()), B.view(), C.view());
+    matrix_product(scaled(Scalar(2), A.dynamic_view()), B.dynamic_view(), C_expected.dynamic_view());
+    EXPECT_EQ(C.storage, C_expected.storage) << "scaled A";
+  }
+
+  template<class Scalar, std::size_t M, std::size_t N>
+  void test_matrix_vector_product()
+  {
+    static_matrix<Scalar, M, N> A(1);
+    static_matrix<Scalar, N, 1, layout_left> x(2);
+    static_matrix<Scalar, M, 1, layout_left> y(3);
+    static_matrix<Scalar, M, 1, layout_left> z(4);
+    static_matrix<Scalar, M, 1, layout_left> z_expected(5);
+    auto x_s = submdspan(x.view(), full_extent, 0);
+    auto y_s = submdspan(y.view(), full_extent, 0);
+    auto z_s = submdspan(z.view(), full_extent, 0);
+    auto x_d = submdspan(x.dynamic_view(), full_extent, 0);
+    auto y_d = submdspan(y.dynamic_view(), full_extent, 0);
+    auto z_d = submdspan(z_expected.dynamic_view(), full_extent, 0);
+    static_assert(LinearAlgebra::impl::use_unrolled_matrix_vector_product_v<
+      decltype(A.view()), decltype(x_s), decltype(z_s)>);
+
+    matrix_vector_product(A.view(), x_s, z_s);
+    matrix_vector_product(A.dynamic_view(), x_d, z_d);
+    EXPECT_EQ(z.storage, z_expected.storage) << "overwrite";
+
+    matrix_vector_product(A.view(), x_s, y_s, z_s);
+    matrix_vector_product(A.dynamic_view(), x_d, y_d, z_d);
+    EXPECT_EQ(z.storage, z_expected.storage) << "update";
+
+    // y may be z.
+    matrix_vector_product(A.view(), x_s, z_s, z_s);
+    matrix_vector_product(A.dynamic_view(), x_d, z_d, z_d);
+    EXPECT_EQ(z.storage, z_expected.storage) << "in-place update";
+  }
+
+  TEST(fixed_size_kernels, matrix_product)
+  {
+    test_matrix_product<double, 3, 3, 3, layout_right, layout_right, layout_right>();
+    test_matrix_product<double, 4, 4, 4, layout_left, layout_left, layout_left>();
+    test_matrix_product<double, 6, 6, 6, layout_left, layout_right, layout_left>();
+    test_matrix_product<double, 8, 8, 8, layout_right, layout_right, layout_right>();
+    test_matrix_product<float, 5, 2, 7, layout_right, layout_left, layout_right>();
+    test_matrix_product<std::complex<double>, 3, 4, 5, layout_left, layout_left, layout_left>();
+  }
+
+  TEST(fixed_size_kernels, matrix_vector_product)
+  {
+    test_matrix_vector_product<double, 3, 3>();
+    test_matrix_vector_product<double, 6, 4>();
+    test_matrix_vector_product<double, 8, 8>();
+    test_matrix_vector_product<std::complex<double>, 5, 3>();
+  }
+
+  TEST(fixed_size_kernels, dot)
+  {
+    static_matrix<double, 7, 1, layout_left> x(1);
+    static_matrix<double, 7, 1, layout_left> y(2);
+    auto x_s = submdspan(x.view(), full_extent, 0);
+    auto y_s = submdspan(y.view(), full_extent, 0);
+    auto x_d = submdspan(x.dynamic_view(), full_extent, 0);
+    auto y_d = submdspan(y.dynamic_view(), full_extent, 0);
+    EXPECT_EQ(dot(x_s, y_s), dot(x_d, y_d));
+    EXPECT_EQ(dot(x_s, y_s, 3.0), dot(x_d, y_d, 3.0));
+    EXPECT_EQ(dot(scaled(2.0, x_s), y_s), dot(scaled(2.0, x_d), y_d));
+  }
+
+  TEST(fixed_size_kernels, too_large_to_unroll)
+  {
+    using big_t = mdspan<double, extents<std::size_t, 32, 32>>;
+    static_assert(! LinearAlgebra::impl::use_unrolled_matrix_product_v<big_t, big_t, big_t>);
+    static_matrix<double, 32, 32> A(1);
+    static_matrix<double, 32, 32> B(2);
+    static_matrix<double, 32, 32> C(3);
+    static_matrix<double, 32, 32> C_expected(4);
+    matrix_product(A.view(), B.view(), C.view());
+    matrix_product(A.dynamic_view(), B.dynamic_view(), C_expected.dynamic_view());
+    EXPECT_EQ(C.storage, C_expected.storage);
+  }
+
+  // The algorithms without an execution policy may be used in
+  // constant expressions on operands of compile-time size.
+  constexpr double constexpr_quadratic_form()
+  {
+    std::array<double, 9> A_storage{}, B_storage{}, C_storage{};
+    mdspan<double, extents<std::size_t, 3, 3>> A(A_storage.data());
+    mdspan<double, extents<std::size_t, 3, 3>> B(B_storage.data());
+    mdspan<double, extents<std::size_t, 3, 3>> C(C_storage.data());
+    for (std::size_t i = 0; i < 3; ++i) {
+      for (std::size_t j = 0; j < 3; ++j) {
+        A(i,j) = test_value<double>(i, j, 1);
+        B(i,j) = test_value<double>(i, j, 2);
+      }
+    }
+    matrix_product(A, B, C);
+    std::array<double, 3> x_storage{1.0, 2.0, 3.0}, y_storage{};
+    mdspan<double, extents<std::size_t, 3>> x(x_storage.data());
+    mdspan<double, extents<std::size_t, 3>> y(y_storage.data());
+    matrix_vector_product(C, x, y);
+    return dot(x, y);
+  }
+
+  TEST(fixed_size_kernels, constant_expression)
+  {
+    constexpr double result = constexpr_quadratic_form();
+
+    static_matrix<double, 3, 3> A(1);
+    static_matrix<double, 3, 3> B(2);
+    static_matrix<double, 3, 3> C(0);
+    matrix_product(A.dynamic_view(), B.dynamic_view(), C.dynamic_view());
+    std::vector<double> x_storage{1.0, 2.0, 3.0}, y_storage(3);
+    mdspan<double, dextents<std::size_t, 1>> x(x_storage.data(), 3);
+    mdspan<double, dextents<std::size_t, 1>> y(y_storage.data(), 3);
+    matrix_vector_product(C.dynamic_view(), x, y);
+    EXPECT_EQ(result, dot(x, y));
+  }
+
+} // end anonymous namespace
@@ -0,0 +1,163 @@
+#include "./gtest_fixtures.hpp"
+
+// Exercise the flat and tiled paths of copy, swap_elements, scale,
+// and add: matrices stored without gaps in the same order, in
+// different orders, and with gaps, with sizes that cross the tiles,
+// and vectors with and without unit stride.
+
+namespace {
+  using LinearAlgebra::add;
+  using LinearAlgebra::copy;
+  using LinearAlgebra::scale;
+  using LinearAlgebra::swap_elements;
+
+  using matrix_extents_t = extents<std::size_t, dynamic_extent, dynamic_extent>;
+  using vector_extents_t = extents<std::size_t, dynamic_extent>;
+
+  constexpr storage all_storages[] = {
+    storage::column_major, storage::row_major,
+    storage::column_padded, storage::row_padded
+  };
+
+  template<class Scalar>
+  void test_matrices(std::size_t m, std::size_t n, storage s_x, storage s_y)
+  {
+    static_assert(LinearAlgebra::impl::are_flat_operands_v<
+      mdspan<Scalar, matrix_extents_t, layout_stride>>);
+    const std::size_t seed_x = 1, seed_y = 2;
+    auto expect_values = [&] (auto A, std::size_t seed, const char* what) {
+      for (std::size_t j = 0; j < n; ++j) {
+        for (std::size_t i = 0; i < m; ++i) {
+          EXPECT_EQ(A(i,j), test_value<Scalar>(i, j, seed)) << what << ", at (" << i << "," << j << ")";
+        }
+      }
+    };
+    {
+      const test_matrix<Scalar> x(m, n, s_x, seed_x);
+      test_matrix<Scalar> y(m, n, s_y, seed_y);
+      copy(x.A, y.A);
+      expect_values(y.A, seed_x, "copy");
+    }
+    {
+      test_matrix<Scalar> x(m, n, s_x, seed_x);
+      test_matrix<Scalar> y(m, n, s_y, seed_y);
+      swap_elements(x.A, y.A);
+      expect_values(x.A, seed_y, "swap_elements, x");
+      expect_values(y.A, seed_x, "swap_elements, y");
+    }
+    {
+      const test_matrix<Scalar> x(m, n, s_x, seed_x);
+      const test_matrix<Scalar> y(m, n, s_y, seed_y);
+      test_matrix<Scalar> z(m, n, s_y, 3);
+      add(x.A, y.A, z.A);
+      // Add with z stored as x is, too.
+      test_matrix<Scalar> w(m, n, s_x, 3);
+      add(x.A, y.A, w.A);
+      for (std::size_t j = 0; j < n; ++j) {
+        for (std::size_t i = 0; i < m; ++i) {
+          const Scalar expected = test_value<Scalar>(i, j, seed_x) + test_value<Scalar>(i, j, seed_y);
+          EXPECT_EQ(z.A(i,j), expected) << "add, at (" << i << "," << j << ")";
+          EXPECT_EQ(w.A(i,j), expected) << "add, at (" << i << "," << j << ")";
+        }
+      }
+    }
+    {
+      test_matrix<Scalar> x(m, n, s_x, seed_x);
+      scale(Scalar(3), x.A);
+      for (std::size_t j = 0; j < n; ++j) {
+        for (std::size_t i = 0; i < m; ++i) {
+          EXPECT_EQ(x.A(i,j), Scalar(3) * test_value<Scalar>(i, j, seed_x)) << "scale, at (" << i << "," << j << ")";
+        }
+      }
+    }
+  }
+
+  template<class Scalar>
+  void test_all_storages(std::size_t m, std::size_t n)
+  {
+    for (storage s_x : all_storages) {
+      for (storage s_y : all_storages) {
+        test_matrices<Scalar>(m, n, s_x, s_y);
+      }
+    }
+  }
+
+  TEST(BLAS1_flat_kernels, matrices)
+  {
+    // Tiles have at most 32 rows and columns.
+    for (std::size_t m : {0, 1, 5, 32, 33, 100}) {
+      for (std::size_t n : {1, 7, 65}) {
+        test_all_storages<double>(m, n);
+      }
+    }
+    test_all_storages<float>(45, 37);
+    test_all_storages<std::complex<double>>(40, 3);
+    test_all_storages<std::complex<float>>(9, 70);
+    test_all_storages<int>(33, 34);
+  }
+
+  TEST(BLAS1_flat_kernels, flatness)
+  {
+    std::vector<double> storage(60);
+    mdspan<double, matrix_extents_t, layout_left> A_left(storage.data(), 6, 10);
+    mdspan<double, matrix_extents_t, layout_right> A_right(storage.data(), 6, 10);
+    mdspan<double, matrix_extents_t, layout_left> column(storage.data(), 6, 1);
+    using mapping_t = layout_stride::mapping<matrix_extents_t>;
+    mdspan<double, matrix_extents_t, layout_stride> padded(storage.data(),
+      mapping_t(matrix_extents_t(5, 10), std::array<std::size_t, 2>{1, 6}));
+
+    using LinearAlgebra::impl::is_flat;
+    EXPECT_TRUE(is_flat(A_left, A_left));
+    EXPECT_TRUE(is_flat(A_right, A_right));
+    EXPECT_FALSE(is_flat(A_left, A_right));
+    EXPECT_FALSE(is_flat(padded));
+    // A single column is flat in either order.
+    EXPECT_TRUE(is_flat(column));
+    mdspan<double, matrix_extents_t, layout_right> row(storage.data(), 6, 1);
+    EXPECT_TRUE(is_flat(column, row));
+
+    // Scaled or conjugated operands take the generic loops.
+    static_assert(! LinearAlgebra::impl::are_flat_operands_v<
+      decltype(LinearAlgebra::scaled(2.0, A_left))>);
+  }
+
+  TEST(BLAS1_flat_kernels, vectors)
+  {
+    constexpr std::size_t n = 37;
+    for (std::size_t stride : {1, 3}) {
+      std::vector<double> x_storage(n * stride), y_storage(n * stride), z_storage(n * stride);
+      using mapping_t = layout_stride::mapping<vector_extents_t>;
+      const mapping_t mapping(vector_extents_t(n), std::array<std::size_t, 1>{stride});
+      mdspan<double, vector_extents_t, layout_stride> x(x_storage.data(), mapping);
+      mdspan<double, vector_extents_t, layout_stride> y(y_storage.data(), mapping);
+      mdspan<double, vector_extents_t, layout_stride> z(z_storage.data(), mapping);
+      for (std::size_t i = 0; i < n; ++i) {
+        x(i) = test_value<double>(i, 0, 1);
+        y(i) = test_value<double>(i, 0, 2);
+      }
+      add(x, y, z);
+      swap_elements(x, y);
+      scale(2.0, x);
+      copy(y, z);
+      for (std::size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(x(i), 2.0 * test_value<double>(i, 0, 2)) << "stride " << stride << ", at " << i;
+        EXPECT_EQ(y(i), test_value<double>(i, 0, 1)) << "stride " << stride << ", at " << i;
+        EXPECT_EQ(z(i), test_value<double>(i, 0, 1)) << "stride " << stride << ", at " << i;
+      }
+    }
+
+    // copy converts between element types.
+    std::vector<float> xf_storage(n);
+    std::vector<double> yd_storage(n);
+    mdspan<float, vector_extents_t> xf(xf_storage.data(), n);
+    mdspan<double, vector_extents_t> yd(yd_storage.data(), n);
+    for (std::size_t i = 0; i < n; ++i) {
+      xf(i) = test_value<float>(i, 0, 4);
+    }
+    copy(xf, yd);
+    for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_EQ(yd(i), double(test_value<float>(i, 0, 4))) << "at " << i;
+    }
+  }
+
+} // end anonymous namespace
@@ -0,0 +1,196 @@
+#include "./gtest_fixtures.hpp"
+
+// Batched matrix_product over rank-3 mdspan, whose leftmost extent
+// is the batch index.  Each result must match the product of the
+// corresponding matrices, computed directly.  Small integers keep
+// every partial sum exact, so the order of summation does not
+// matter.
+
+namespace {
+  using LinearAlgebra::matrix_product;
+
+  using batch_extents_t = extents<std::size_t, dynamic_extent, dynamic_extent, dynamic_extent>;
+
+  template<class Scalar>
+  Scalar test_value(std::size_t b, std::size_t i, std::size_t j, std::size_t seed)
+  {
+    const int v = int((5 * b + 3 * i + 7 * j + seed) % 11) - 5;
+    if constexpr (LinearAlgebra::impl::is_complex_v<Scalar>) {
+      return Scalar(v, int((2 * b + 5 * i + 2 * j + seed) % 7) - 3);
+    }
+    else {
+      return Scalar(v);
+    }
+  }
+
+  template<class Scalar, class Layout>
+  struct batch {
+    batch(std::size_t num_batches, std::size_t num_rows, std::size_t num_cols,
+          std::size_t seed) :
+      storage(num_batches * num_rows * num_cols),
+      A(storage.data(), num_batches, num_rows, num_cols)
+    {
+      for (std::size_t b = 0; b < num_batches; ++b) {
+        for (std::size_t i = 0; i < num_rows; ++i) {
+          for (std::size_t j = 0; j < num_cols; ++j) {
+            A(b,i,j) = test_value<Scalar>(b, i, j, seed);
+          }
+        }
+      }
+    }
+    std::vector<Scalar> storage;
+    mdspan<Scalar, batch_extents_t, Layout> A;
+  };
+
+  // C[b,:,:] = E[b,:,:] + A[b,:,:] * B[b,:,:], computed directly.
+  template<class Scalar, class A_t, class B_t, class E_t>
+  Scalar expected_value(A_t A, B_t B, E_t E, std::size_t b, std::size_t i, std::size_t j)
+  {
+    Scalar sum = E(b,i,j);
+    for (std::size_t k = 0; k < A.extent(2); ++k) {
+      sum += A(b,i,k) * B(b,k,j);
+    }
+    return sum;
+  }
+
+  template<class Scalar, class Layout_A, class Layout_B, class Layout_C>
+  void test_batched_matrix_product(std::size_t num_batches,
+                                   std::size_t M, std::size_t N, std::size_t K)
+  {
+    batch<Scalar, Layout_A> A(num_batches, M, K, 1);
+    batch<Scalar, Layout_B> B(num_batches, K, N, 2);
+    batch<Scalar, Layout_C> E(num_batches, M, N, 3);
+    batch<Scalar, Layout_C> C(num_batches, M, N, 4);
+    batch<Scalar, Layout_C> zero(num_batches, M, N, 0);
+    std::fill(zero.storage.begin(), zero.storage.end(), Scalar{});
+
+    matrix_product(A.A, B.A, C.A);
+    for (std::size_t b = 0; b < num_batches; ++b) {
+      for (std::size_t i = 0; i < M; ++i) {
+        for (std::size_t j = 0; j < N; ++j) {
+          EXPECT_EQ(C.A(b,i,j), expected_value<Scalar>(A.A, B.A, zero.A, b, i, j))
+            << "overwrite, at (" << b << "," << i << "," << j << ")";
+        }
+      }
+    }
+
+    matrix_product(A.A, B.A, E.A, C.A);
+    for (std::size_t b = 0; b < num_batches; ++b) {
+      for (std::size_t i = 0; i < M; ++i) {
+        for (std::size_t j = 0; j < N; ++j) {
+          EXPECT_EQ(C.A(b,i,j), expected_value<Scalar>(A.A, B.A, E.A, b, i, j))
+            << "update, at (" << b << "," << i << "," << j << ")";
+        }
+      }
+    }
+
+    // E may be C.
+    std::vector<Scalar> C_before(C.storage);
+    matrix_product(A.A, B.A, C.A, C.A);
+    mdspan<Scalar, batch_extents_t, Layout_C> C_before_A(C_before.data(), num_batches, M, N);
+    for (std::size_t b = 0; b < num_batches; ++b) {
+      for (std::size_t i = 0; i < M; ++i) {
+        for (std::size_t j = 0; j < N; ++j) {
+          EXPECT_EQ(C.A(b,i,j), expected_value<Scalar>(A.A, B.A, C_before_A, b, i, j))
+            << "in-place update, at (" << b << "," << i << "," << j << ")";
+        }
+      }
+    }
+  }
+
+  TEST(BLAS3_gemm_batched, batch_major)
+  {
+    // The batch-major kernel computes 8 doubles (4 complex<double>)
+    // at once; odd batch counts exercise the remainder.
+    for (std::size_t num_batches : {1, 7, 8, 9, 40, 67}) {
+      test_batched_matrix_product<double, layout_left, layout_left, layout_left>(num_batches, 8, 4, 4);
+      test_batched_matrix_product<double, layout_left, layout_left, layout_left>(num_batches, 4, 8, 4);
+      test_batched_matrix_product<double, layout_left, layout_left, layout_left>(num_batches, 16, 16, 16);
+      test_batched_matrix_product<double, layout_left, layout_left, layout_left>(num_batches, 3, 5, 7);
+    }
+    test_batched_matrix_product<float, layout_left, layout_left, layout_left>(37, 6, 6, 6);
+    test_batched_matrix_product<std::complex<double>, layout_left, layout_left, layout_left>(21, 4, 4, 4);
+  }
+
+  TEST(BLAS3_gemm_batched, not_batch_major)
+  {
+    test_batched_matrix_product<double, layout_right, layout_right, layout_right>(9, 8, 4, 4);
+    test_batched_matrix_product<double, layout_right, layout_right, layout_right>(5, 16, 16, 16);
+    test_batched_matrix_product<double, layout_left, layout_right, layout_left>(17, 4, 4, 4);
+    test_batched_matrix_product<std::complex<double>, layout_right, layout_left, layout_right>(10, 5, 3, 4);
+    // Large enough that each matrix goes to the blocked engine.
+    test_batched_matrix_product<double, layout_right, layout_right, layout_right>(3, 40, 36, 33);
+  }
+
+  // Scaled and conjugated matrices big enough for the blocked engine,
+  // which applies the scaling factors and conjugation once.
+  TEST(BLAS3_gemm_batched, scaled_and_conjugated)
+  {
+    using Scalar = std::complex<double>;
+    constexpr std::size_t num_batches = 3, M = 40, N = 36, K = 33;
+    batch<Scalar, layout_right> A(num_batches, M, K, 1);
+    batch<Scalar, layout_right> B(num_batches, K, N, 2);
+    batch<Scalar, layout_right> E(num_batches, M, N, 3);
+    batch<Scalar, layout_right> C(num_batches, M, N, 4);
+    auto A_scaled = LinearAlgebra::scaled(Scalar(2.0, -1.0), A.A);
+    auto B_conj = LinearAlgebra::conjugated(LinearAlgebra::scaled(Scalar(0.0, 3.0), B.A));
+
+    matrix_product(A_scaled, B_conj, E.A, C.A);
+    for (std::size_t b = 0; b < num_batches; ++b) {
+      for (std::size_t i = 0; i < M; ++i) {
+        for (std::size_t j = 0; j < N; ++j) {
+          EXPECT_EQ(C.A(b,i,j), expected_value<Scalar>(A_scaled, B_conj, E.A, b, i, j))
+            << "at (" << b << "," << i << "," << j << ")";
+        }
+      }
+    }
+  }
+
+  TEST(BLAS3_gemm_batched, degenerate_extents)
+  {
+    test_batched_matrix_product<double, layout_left, layout_left, layout_left>(0, 4, 4, 4);
+    test_batched_matrix_product<double, layout_left, layout_left, layout_left>(10, 0, 4, 4);
+    test_batched_matrix_product<double, layout_left, layout_left, layout_left>(10, 4, 4, 0);
+    test_batched_matrix_product<double, layout_right, layout_right, layout_right>(10, 4, 0, 4);
+  }
+
+  TEST(BLAS3_gemm_batched, static_extents)
+  {
+    // The pattern of examples/03_matrix_vector_product_mixedprec.cpp,
+    // without the loop over submdspan.
+    constexpr std::size_t num_batches = 19;
+    using A_extents_t = extents<int, dynamic_extent, 8, 4>;
+    using B_extents_t = extents<int, dynamic_extent, 4, 4>;
+    using C_extents_t = extents<int, dynamic_extent, 8, 4>;
+    std::vector<double> A_storage(num_batches * 32), B_storage(num_batches * 16),
+      C_storage(num_batches * 32);
+    mdspan<double, A_extents_t, layout_left> A(A_storage.data(), num_batches);
+    mdspan<double, B_extents_t, layout_left> B(B_storage.data(), num_batches);
+    mdspan<double, C_extents_t, layout_left> C(C_storage.data(), num_batches);
+    for (int b = 0; b < A.extent(0); ++b) {
+      for (int i = 0; i < 8; ++i) {
+        for (int k = 0; k < 4; ++k) {
+          A(b,i,k) = test_value<double>(b, i, k, 1);
+        }
+      }
+      for (int k = 0; k < 4; ++k) {
+        for (int j = 0; j < 4; ++j) {
+          B(b,k,j) = test_value<double>(b, k, j, 2);
+        }
+      }
+    }
+    matrix_product(A, B, C);
+    for (int b = 0; b < C.extent(0); ++b) {
+      for (int i = 0; i < 8; ++i) {
+        for (int j = 0; j < 4; ++j) {
+          double sum = 0.0;
+          for (int k = 0; k < 4; ++k) {
+            sum += A(b,i,k) * B(b,k,j);
+          }
+          EXPECT_EQ(C(b,i,j), sum) << "at (" << b << "," << i << "," << j << ")";
+        }
+      }
+    }
+  }
+
+} // end anonymous namespace
@@ -0,0 +1,176 @@
+#include "./gtest_fixtures.hpp"
+
+// matrix_product with operands that the external BLAS can take:
+// layout_left, layout_right, transposed and padded (layout_stride)
+// matrices, with scaled and conjugated accessors.  Without
+// LINALG_ENABLE_BLAS, this tests the generic implementation instead.
+
+namespace {
+  using LinearAlgebra::conjugate_transposed;
+  using LinearAlgebra::conjugated;
+  using LinearAlgebra::matrix_product;
+  using LinearAlgebra::scaled;
+  using LinearAlgebra::transposed;
+
+  using extents_t = extents<std::size_t, dynamic_extent, dynamic_extent>;
+
+  // C = A * B + E, computed through the mdspan's own accessors.
+  template<class AType, class BType, class EType>
+  std::vector<typename EType::value_type>
+  reference_product(AType A, BType B, EType E)
+  {
+    using value_type = typename EType::value_type;
+    const std::size_t M = A.extent(0);
+    const std::size_t N = B.extent(1);
+    std::vector<value_type> C_ref(M * N);
+    for (std::size_t j = 0; j < N; ++j) {
+      for (std::size_t i = 0; i < M; ++i) {
+        value_type sum = E(i,j);
+        for (std::size_t k = 0; k < A.extent(1); ++k) {
+          sum += value_type(A(i,k)) * value_type(B(k,j));
+        }
+        C_ref[i + j * M] = sum;
+      }
+    }
+    return C_ref;
+  }
+
+  template<class AType, class BType, class CType>
+  void check_overwriting_and_updating(AType A, BType B, CType C, CType E)
+  {
+    using value_type = typename CType::value_type;
+    const std::size_t M = C.extent(0);
+    const std::size_t N = C.extent(1);
+
+    // E = 0 gives the overwriting result.
+    std::vector<value_type> zero_storage(M * N);
+    mdspan<value_type, extents_t, layout_left> zero(zero_storage.data(), M, N);
+    const auto C_ref = reference_product(A, B, zero);
+    matrix_product(A, B, C);
+    for (std::size_t j = 0; j < N; ++j) {
+      for (std::size_t i = 0; i < M; ++i) {
+        EXPECT_EQ(C(i,j), C_ref[i + j * M]) << "at (" << i << "," << j << ")";
+      }
+    }
+
+    const auto C_upd_ref = reference_product(A, B, E);
+    matrix_product(A, B, E, C);
+    for (std::size_t j = 0; j < N; ++j) {
+      for (std::size_t i = 0; i < M; ++i) {
+        EXPECT_EQ(C(i,j), C_upd_ref[i + j * M]) << "at (" << i << "," << j << ")";
+      }
+    }
+
+    // The updating overload maps to beta = 1, so E may alias C.
+    const auto C_alias_ref = reference_product(A, B, C);
+    matrix_product(A, B, C, C);
+    for (std::size_t j = 0; j < N; ++j) {
+      for (std::size_t i = 0; i < M; ++i) {
+        EXPECT_EQ(C(i,j), C_alias_ref[i + j * M]) << "at (" << i << "," << j << ")";
+      }
+    }
+  }
+
+  template<class Scalar, class Layout_C>
+  void test_blas_matrix_product()
+  {
+    constexpr std::size_t M = 11, N = 7, K = 13;
+
+    std::vector<Scalar> A_storage(M * K);
+    std::vector<Scalar> A_t_storage(K * M);
+    std::vector<Scalar> B_storage(K * N);
+    std::vector<Scalar> C_storage(M * N);
+    std::vector<Scalar> E_storage(M * N);
+
+    mdspan<Scalar, extents_t, layout_left> A(A_storage.data(), M, K);
+    mdspan<Scalar, extents_t, layout_left> A_t(A_t_storage.data(), K, M);
+    mdspan<Scalar, extents_t, layout_right> B(B_storage.data(), K, N);
+    mdspan<Scalar, extents_t, Layout_C> C(C_storage.data(), M, N);
+    mdspan<Scalar, extents_t, Layout_C> E(E_storage.data(), M, N);
+    fill_test_values(A, 1);
+    fill_test_values(A_t, 2);
+    fill_test_values(B, 3);
+    fill_test_values(E, 4);
+
+    check_overwriting_and_updating(A, B, C, E);
+    check_overwriting_and_updating(transposed(A_t), B, C, E);
+    check_overwriting_and_updating(conjugate_transposed(A_t), B, C, E);
+    // The BLAS has no "conjugate, don't transpose" option for a
+    // column-major A and C; this must fall back correctly.
+    check_overwriting_and_updating(conjugated(A), B, C, E);
+    check_overwriting_and_updating(A, conjugated(B), C, E);
+    check_overwriting_and_updating(scaled(Scalar(2), A), scaled(Scalar(-3), B), C, E);
+    check_overwriting_and_updating(conjugated(scaled(Scalar(2), transposed(A_t))),
+                                   scaled(Scalar(3), conjugated(B)), C, E);
+  }
+
+  TEST(BLAS3_gemm_blas, layouts_and_accessors)
+  {
+    test_blas_matrix_product<double, layout_left>();
+    test_blas_matrix_product<double, layout_right>();
+    test_blas_matrix_product<float, layout_left>();
+    test_blas_matrix_product<std::complex<double>, layout_left>();
+    test_blas_matrix_product<std::complex<double>, layout_right>();
+    test_blas_matrix_product<std::complex<float>, layout_right>();
+  }
+
+  TEST(BLAS3_gemm_blas, padded_layout_stride)
+  {
+    constexpr std::size_t M = 6, N = 5, K = 4;
+    constexpr std::size_t ld = M + 2;
+    std::vector<double> A_storage(ld * K);
+    std::vector<double> B_storage(K * N);
+    std::vector<double> C_storage(M * N);
+    std::vector<double> E_storage(M * N);
+
+    using mapping_t = layout_stride::mapping<extents_t>;
+    mdspan<double, extents_t, layout_stride> A(A_storage.data(),
+      mapping_t(extents_t(M, K), std::array<std::size_t, 2>{1, ld}));
+    mdspan<double, extents_t, layout_left> B(B_storage.data(), K, N);
+    mdspan<double, extents_t, layout_left> C(C_storage.data(), M, N);
+    mdspan<double, extents_t, layout_left> E(E_storage.data(), M, N);
+    fill_test_values(A, 5);
+    fill_test_values(B, 6);
+    fill_test_values(E, 7);
+    check_overwriting_and_updating(A, B, C, E);
+
+    // Neither stride is one: the BLAS cannot take this matrix.
+    std::vector<double> A2_storage(2 * M * 2 * K);
+    mdspan<double, extents_t, layout_stride> A2(A2_storage.data(),
+      mapping_t(extents_t(M, K), std::array<std::size_t, 2>{2, 2 * M}));
+    fill_test_values(A2, 8);
+    check_overwriting_and_updating(A2, B, C, E);
+  }
+
+#ifdef LINALG_ENABLE_BLAS
+  TEST(BLAS3_gemm_blas, dispatch_predicate)
+  {
+    using LinearAlgebra::impl::matrix_product_dispatch_to_blas;
+    using matrix_t = mdspan<double, extents_t, layout_left>;
+    using matrix_right_t = mdspan<double, extents_t, layout_right>;
+    using cmatrix_t = mdspan<std::complex<double>, extents_t, layout_left>;
+    using small_matrix_t = mdspan<double, extents<std::size_t, 3, 3>, layout_left>;
+    using int_matrix_t = mdspan<int, extents_t, layout_left>;
+
+    matrix_t A(nullptr, 1, 1);
+    cmatrix_t Z(nullptr, 1, 1);
+    using scaled_t = decltype(scaled(2.0, A));
+    using transposed_t = decltype(transposed(A));
+    using conj_trans_t = decltype(conjugate_transposed(Z));
+    using scaled_conj_t = decltype(scaled(std::complex<double>(2.0), conjugated(Z)));
+
+    static_assert(matrix_product_dispatch_to_blas<matrix_t, matrix_t, matrix_t>());
+    static_assert(matrix_product_dispatch_to_blas<matrix_right_t, matrix_t, matrix_right_t>());
+    static_assert(matrix_product_dispatch_to_blas<scaled_t, transposed_t, matrix_t>());
+    static_assert(matrix_product_dispatch_to_blas<conj_trans_t, scaled_conj_t, cmatrix_t>());
+    // Static extents are left to the generic implementation.
+    static_assert(! matrix_product_dispatch_to_blas<small_matrix_t, small_matrix_t, small_matrix_t>());
+    static_assert(! matrix_product_dispatch_to_blas<int_matrix_t, int_matrix_t, int_matrix_t>());
+    // Mixed precision is not a classic BLAS operation.
+    static_assert(! matrix_product_dispatch_to_blas<matrix_t, matrix_t, cmatrix_t>());
+    // The output must be writable through default_accessor.
+    static_assert(! matrix_product_dispatch_to_blas<matrix_t, matrix_t, scaled_t>());
+  }
+#endif // LINALG_ENABLE_BLAS
+
+} // end anonymous namespace
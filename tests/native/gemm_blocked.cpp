@@ -0,0 +1,299 @@
+#include "./gtest_fixtures.hpp"
+
+// Exercise the cache-blocked, packed matrix_product engine with
+// problem sizes that cross its register-tile and cache-block
+// boundaries, for every strided layout it accepts.
+
+namespace {
+  using LinearAlgebra::conjugate_transposed;
+  using LinearAlgebra::conjugated;
+  using LinearAlgebra::matrix_product;
+  using LinearAlgebra::scaled;
+  using LinearAlgebra::transposed;
+
+  using extents_t = extents<std::size_t, dynamic_extent, dynamic_extent>;
+
+  template<class Scalar, class Layout_A, class Layout_B, class Layout_C>
+  void test_blocked_matrix_product(std::size_t M, std::size_t N, std::size_t K)
+  {
+    std::vector<Scalar> A_storage(M * K);
+    std::vector<Scalar> B_storage(K * N);
+    std::vector<Scalar> C_storage(M * N);
+    std::vector<Scalar> E_storage(M * N);
+    std::vector<Scalar> C_ref_storage(M * N);
+
+    mdspan<Scalar, extents_t, Layout_A> A(A_storage.data(), M, K);
+    mdspan<Scalar, extents_t, Layout_B> B(B_storage.data(), K, N);
+    mdspan<Scalar, extents_t, Layout_C> C(C_storage.data(), M, N);
+    mdspan<Scalar, extents_t, Layout_C> E(E_storage.data(), M, N);
+    mdspan<Scalar, extents_t, layout_left> C_ref(C_ref_storage.data(), M, N);
+    fill_test_values(A, 1);
+    fill_test_values(B, 2);
+    fill_test_values(E, 3);
+
+    for (std::size_t j = 0; j < N; ++j) {
+      for (std::size_t i = 0; i < M; ++i) {
+        C_ref(i,j) = Scalar{};
+        for (std::size_t k = 0; k < K; ++k) {
+          C_ref(i,j) += A(i,k) * B(k,j);
+        }
+        // Flag values make sure that the overwriting product
+        // does not read C.
+        C(i,j) = poison_value<Scalar>();
+      }
+    }
+
+    matrix_product(A, B, C);
+    for (std::size_t j = 0; j < N; ++j) {
+      for (std::size_t i = 0; i < M; ++i) {
+        EXPECT_EQ(C(i,j), C_ref(i,j)) << "at (" << i << "," << j << ")";
+      }
+    }
+
+    matrix_product(A, B, E, C);
+    for (std::size_t j = 0; j < N; ++j) {
+      for (std::size_t i = 0; i < M; ++i) {
+        EXPECT_EQ(C(i,j), C_ref(i,j) + E(i,j)) << "at (" << i << "," << j << ")";
+      }
+    }
+
+    // The updating overload permits E to alias C.
+    matrix_product(A, B, C, C);
+    for (std::size_t j = 0; j < N; ++j) {
+      for (std::size_t i = 0; i < M; ++i) {
+        EXPECT_EQ(C(i,j), Scalar(2) * C_ref(i,j) + E(i,j)) << "at (" << i << "," << j << ")";
+      }
+    }
+  }
+
+  TEST(BLAS3_gemm_blocked, crosses_block_boundaries)
+  {
+    // 133 > mc and 300 > kc for double; 9 is not a multiple of nr.
+    test_blocked_matrix_product<double, layout_left, layout_left, layout_left>(133, 9, 300);
+    test_blocked_matrix_product<double, layout_right, layout_left, layout_right>(17, 45, 263);
+    test_blocked_matrix_product<float, layout_right, layout_right, layout_left>(37, 70, 5);
+    test_blocked_matrix_product<std::complex<double>, layout_left, layout_right, layout_left>(21, 13, 259);
+    test_blocked_matrix_product<int, layout_left, layout_left, layout_right>(67, 3, 11);
+  }
+
+  TEST(BLAS3_gemm_blocked, degenerate_extents)
+  {
+    test_blocked_matrix_product<double, layout_left, layout_left, layout_left>(1, 1, 1);
+    test_blocked_matrix_product<double, layout_left, layout_left, layout_left>(5, 3, 0);
+    test_blocked_matrix_product<double, layout_left, layout_left, layout_left>(0, 3, 4);
+  }
+
+  TEST(BLAS3_gemm_blocked, strided_and_transposed)
+  {
+    constexpr std::size_t M = 19, N = 23, K = 29;
+    constexpr std::size_t lda = M + 3;
+    std::vector<double> A_storage(lda * K);
+    std::vector<double> B_t_storage(N * K);
+    std::vector<double> C_storage(M * N);
+
+    // A is a padded column-major matrix, and B is the transpose of
+    // a row-major matrix.
+    using mapping_t = layout_stride::mapping<extents_t>;
+    mdspan<double, extents_t, layout_stride> A(A_storage.data(),
+      mapping_t(extents_t(M, K), std::array<std::size_t, 2>{1, lda}));
+    mdspan<double, extents_t, layout_right> B_t(B_t_storage.data(), N, K);
+    mdspan<double, extents_t, layout_left> C(C_storage.data(), M, N);
+    fill_test_values(A, 4);
+    fill_test_values(B_t, 5);
+
+    matrix_product(A, transposed(B_t), C);
+    for (std::size_t j = 0; j < N; ++j) {
+      for (std::size_t i = 0; i < M; ++i) {
+        double expected = 0.0;
+        for (std::size_t k = 0; k < K; ++k) {
+          expected += A(i,k) * B_t(j,k);
+        }
+        EXPECT_EQ(C(i,j), expected) << "at (" << i << "," << j << ")";
+      }
+    }
+  }
+
+  TEST(BLAS3_gemm_blocked, narrow)
+  {
+    // C with at most 16 columns takes the path that reads A in place.
+    // 70 rows are not a whole number of row tiles, and 300 > kc.
+    for (std::size_t N : {1, 2, 3, 4, 5, 8, 13, 16, 17}) {
+      test_blocked_matrix_product<int, layout_left, layout_left, layout_left>(70, N, 300);
+      test_blocked_matrix_product<int, layout_right, layout_right, layout_right>(70, N, 300);
+    }
+    test_blocked_matrix_product<int, layout_right, layout_left, layout_left>(3, 6, 0);
+  }
+
+  // A narrow product must match the same columns of a wide one bit for
+  // bit, even for inexact values, since each entry of C takes its
+  // products in the same order on both paths.
+  template<class Scalar>
+  void test_narrow_matches_wide(std::size_t stride0, std::size_t stride1, bool conjugate_A)
+  {
+    using LinearAlgebra::impl::blocked_gemm;
+    using LinearAlgebra::impl::make_strided_matrix_view;
+    constexpr std::size_t M = 45, N_wide = 21, K = 300;
+    std::vector<Scalar> A_storage((M - 1) * stride0 + (K - 1) * stride1 + 1);
+    std::vector<Scalar> B_storage(K * N_wide);
+    std::vector<Scalar> C_wide_storage(M * N_wide);
+    using mapping_t = layout_stride::mapping<extents_t>;
+    mdspan<Scalar, extents_t, layout_stride> A(A_storage.data(),
+      mapping_t(extents_t(M, K), std::array<std::size_t, 2>{stride0, stride1}));
+    mdspan<Scalar, extents_t, layout_left> B(B_storage.data(), K, N_wide);
+    mdspan<Scalar, extents_t, layout_left> C_wide(C_wide_storage.data(), M, N_wide);
+    fill_test_values(A, 1);
+    fill_test_values(B, 2);
+    for (std::size_t k = 0; k < K; ++k) {
+      for (std::size_t i = 0; i < M; ++i) {
+        A(i,k) *= Scalar(0.1);
+      }
+    }
+    auto A_view = make_strided_matrix_view(A).as_const();
+    A_view.conjugated = conjugate_A;
+    const auto B_view = make_strided_matrix_view(B).as_const();
+    const Scalar alpha(1.3), beta(0.7);
+
+    fill_test_values(C_wide, 3);
+    blocked_gemm(alpha, A_view, B_view, beta, make_strided_matrix_view(C_wide));
+    for (std::size_t N : {1, 4, 7, 16}) {
+      std::vector<Scalar> C_storage(M * N);
+      mdspan<Scalar, extents_t, layout_left> C(C_storage.data(), M, N);
+      fill_test_values(C, 3);
+      blocked_gemm(alpha, A_view, B_view.block(0, 0, K, N), beta, make_strided_matrix_view(C));
+      for (std::size_t j = 0; j < N; ++j) {
+        for (std::size_t i = 0; i < M; ++i) {
+          EXPECT_EQ(C(i,j), C_wide(i,j)) << "N = " << N << ", at (" << i << "," << j << ")";
+        }
+      }
+    }
+  }
+
+  TEST(BLAS3_gemm_blocked, narrow_matches_wide)
+  {
+    test_narrow_matches_wide<double>(1, 45, false);
+    test_narrow_matches_wide<double>(300, 1, false);
+    test_narrow_matches_wide<double>(2, 90, false);
+    test_narrow_matches_wide<std::complex<double>>(1, 45, true);
+    test_narrow_matches_wide<std::complex<double>>(300, 1, true);
+  }
+
+  // The engine peels scaled_accessor and conjugated_accessor off the
+  // input matrices.  Strides of two in both dimensions keep the
+  // external BLAS out of the way.
+  template<class Scalar, class A_t, class B_t>
+  void test_peeled_matrix_product(A_t A, B_t B)
+  {
+    using C_t = mdspan<Scalar, extents_t, layout_stride>;
+    static_assert(LinearAlgebra::impl::is_gemm_peelable_product_v<A_t, B_t, C_t>);
+    const std::size_t M = A.extent(0), N = B.extent(1), K = A.extent(1);
+    std::vector<Scalar> C_storage(4 * M * N, poison_value<Scalar>());
+    std::vector<Scalar> E_storage(4 * M * N);
+    const layout_stride::mapping<extents_t> C_mapping(
+      extents_t(M, N), std::array<std::size_t, 2>{2, 2 * M});
+    C_t C(C_storage.data(), C_mapping);
+    C_t E(E_storage.data(), C_mapping);
+    fill_test_values(E, 3);
+
+    matrix_product(A, B, C);
+    for (std::size_t j = 0; j < N; ++j) {
+      for (std::size_t i = 0; i < M; ++i) {
+        Scalar expected{};
+        for (std::size_t k = 0; k < K; ++k) {
+          expected += A(i,k) * B(k,j);
+        }
+        EXPECT_EQ(C(i,j), expected) << "at (" << i << "," << j << ")";
+      }
+    }
+
+    matrix_product(A, B, E, C);
+    for (std::size_t j = 0; j < N; ++j) {
+      for (std::size_t i = 0; i < M; ++i) {
+        Scalar expected = E(i,j);
+        for (std::size_t k = 0; k < K; ++k) {
+          expected += A(i,k) * B(k,j);
+        }
+        EXPECT_EQ(C(i,j), expected) << "at (" << i << "," << j << ")";
+      }
+    }
+  }
+
+  template<class Scalar>
+  void test_peeled_matrix_product(Scalar alpha, Scalar beta)
+  {
+    // Crosses the register-tile and cache-block boundaries.
+    constexpr std::size_t M = 37, N = 11, K = 270;
+    std::vector<Scalar> A_storage(4 * M * K);
+    std::vector<Scalar> B_storage(4 * K * N);
+    using mapping_t = layout_stride::mapping<extents_t>;
+    mdspan<Scalar, extents_t, layout_stride> A(A_storage.data(),
+      mapping_t(extents_t(M, K), std::array<std::size_t, 2>{2, 2 * M}));
+    mdspan<Scalar, extents_t, layout_stride> B(B_storage.data(),
+      mapping_t(extents_t(K, N), std::array<std::size_t, 2>{2, 2 * K}));
+    mdspan<Scalar, extents_t, layout_stride> B_t(B_storage.data(),
+      mapping_t(extents_t(N, K), std::array<std::size_t, 2>{2 * K, 2}));
+    fill_test_values(A, 1);
+    fill_test_values(B, 2);
+
+    test_peeled_matrix_product<Scalar>(scaled(alpha, A), B);
+    test_peeled_matrix_product<Scalar>(A, scaled(beta, B));
+    test_peeled_matrix_product<Scalar>(scaled(alpha, A), scaled(beta, B));
+    test_peeled_matrix_product<Scalar>(conjugated(A), B);
+    test_peeled_matrix_product<Scalar>(scaled(alpha, conjugated(A)), conjugated(scaled(beta, B)));
+    test_peeled_matrix_product<Scalar>(A, conjugate_transposed(scaled(beta, B_t)));
+    test_peeled_matrix_product<Scalar>(conjugated(conjugated(A)), scaled(alpha, scaled(beta, B)));
+  }
+
+  TEST(BLAS3_gemm_blocked, scaled_and_conjugated)
+  {
+    test_peeled_matrix_product<double>(-2.0, 3.0);
+    test_peeled_matrix_product<std::complex<double>>({2.0, -1.0}, {0.0, 3.0});
+    test_peeled_matrix_product<int>(-2, 3);
+
+    // The stored elements must have the value type.
+    using A_t = mdspan<float, extents_t>;
+    using C_t = mdspan<double, extents_t>;
+    using scaled_t = decltype(scaled(2.0, std::declval<A_t>()));
+    static_assert(! LinearAlgebra::impl::is_gemm_peelable_product_v<scaled_t, scaled_t, C_t>);
+  }
+
+  TEST(BLAS3_gemm_blocked, bool_takes_generic_loops)
+  {
+    // The generic loops promote bool to int before adding, so each
+    // C(i,j) is the OR over k of A(i,k) AND B(k,j).
+    using bool_matrix_t = mdspan<bool, extents_t, layout_left>;
+    static_assert(! LinearAlgebra::impl::is_gemm_peelable_product_v<
+      bool_matrix_t, bool_matrix_t, bool_matrix_t>);
+    static_assert(! LinearAlgebra::impl::is_gemm_packable_value_v<char>);
+    static_assert(LinearAlgebra::impl::is_gemm_packable_value_v<short>);
+
+    constexpr std::size_t M = 9, N = 7, K = 11;
+    // std::vector<bool> does not store bool objects.
+    std::array<bool, M * K> A_storage{};
+    std::array<bool, K * N> B_storage{};
+    std::array<bool, M * N> C_storage{};
+    bool_matrix_t A(A_storage.data(), M, K);
+    bool_matrix_t B(B_storage.data(), K, N);
+    bool_matrix_t C(C_storage.data(), M, N);
+    for (std::size_t j = 0; j < K; ++j) {
+      for (std::size_t i = 0; i < M; ++i) {
+        A(i,j) = (i + 2 * j) % 5 == 0;
+      }
+    }
+    for (std::size_t j = 0; j < N; ++j) {
+      for (std::size_t i = 0; i < K; ++i) {
+        B(i,j) = (3 * i + j) % 4 == 0;
+      }
+    }
+    matrix_product(A, B, C);
+    for (std::size_t j = 0; j < N; ++j) {
+      for (std::size_t i = 0; i < M; ++i) {
+        bool expected = false;
+        for (std::size_t k = 0; k < K; ++k) {
+          expected = expected || (A(i,k) && B(k,j));
+        }
+        EXPECT_EQ(C(i,j), expected) << "at (" << i << "," << j << ")";
+      }
+    }
+  }
+
+} // end anonymous namespace
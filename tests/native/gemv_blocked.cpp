@@ -0,0 +1,148 @@
+#include "./gtest_fixtures.hpp"
+
+// Exercise the blocked matrix-vector product with problem sizes that
+// cross the engine's register-tile and cache-block boundaries, for
+// column-major, row-major, and strided matrices, with scaled and
+// conjugated operands.  Small integers keep every sum exact, so the
+// results must match exactly.
+
+namespace {
+  using LinearAlgebra::conjugated;
+  using LinearAlgebra::matrix_vector_product;
+  using LinearAlgebra::scaled;
+
+  using matrix_extents_t = extents<std::size_t, dynamic_extent, dynamic_extent>;
+  using vector_extents_t = extents<std::size_t, dynamic_extent>;
+
+  template<class VectorType>
+  void fill_vector(VectorType x, std::size_t seed)
+  {
+    using value_type = typename VectorType::value_type;
+    for (std::size_t i = 0; i < x.extent(0); ++i) {
+      x(i) = test_value<value_type>(i, 0, seed);
+    }
+  }
+
+  // Check that y(i) = start(i) + (A * x)(i).
+  template<class A_t, class x_t, class y_t, class Start>
+  void check_product(const char* what, A_t A, x_t x, y_t y, const Start& start)
+  {
+    using value_type = typename y_t::value_type;
+    for (std::size_t i = 0; i < A.extent(0); ++i) {
+      value_type expected = start(i);
+      for (std::size_t j = 0; j < A.extent(1); ++j) {
+        expected += value_type(A(i,j)) * value_type(x(j));
+      }
+      EXPECT_EQ(y(i), expected) << what << ", at " << i;
+    }
+  }
+
+  // y = A * x and z = y + A * x, including in place (z = y).
+  template<class A_t>
+  void test_product(A_t A)
+  {
+    using Scalar = typename A_t::value_type;
+    using vector_t = mdspan<Scalar, vector_extents_t>;
+    const std::size_t M = A.extent(0);
+    const std::size_t N = A.extent(1);
+    std::vector<Scalar> x_storage(N), y_storage(M), z_storage(M);
+    vector_t x(x_storage.data(), N);
+    vector_t y(y_storage.data(), M);
+    vector_t z(z_storage.data(), M);
+    fill_vector(x, 2);
+    static_assert(LinearAlgebra::impl::is_gemv_blockable_v<A_t, vector_t, vector_t>);
+
+    auto zero = [] (std::size_t) { return Scalar{}; };
+    std::fill(y_storage.begin(), y_storage.end(), Scalar(7));
+    matrix_vector_product(A, x, y);
+    check_product("overwrite", A, x, y, zero);
+
+    fill_vector(y, 3);
+    matrix_vector_product(A, x, y, z);
+    check_product("update", A, x, z, [&] (std::size_t i) { return y(i); });
+
+    std::vector<Scalar> y_orig(y_storage);
+    matrix_vector_product(A, x, y, y);
+    check_product("in-place update", A, x, y, [&] (std::size_t i) { return y_orig[i]; });
+  }
+
+  template<class Scalar, class Layout>
+  void test_layout(std::size_t M, std::size_t N)
+  {
+    std::vector<Scalar> A_storage(M * N);
+    mdspan<Scalar, matrix_extents_t, Layout> A(A_storage.data(), M, N);
+    fill_test_values(A, 1);
+    test_product(A);
+  }
+
+  TEST(BLAS2_gemv_blocked, crosses_block_boundaries)
+  {
+    // The register tiles cover 4 columns or rows, and the cache blocks
+    // cover 512 entries of double and 256 of complex<double>.
+    for (std::size_t M : {1, 3, 4, 5, 511, 512, 513, 1100}) {
+      for (std::size_t N : {1, 3, 4, 7, 600}) {
+        test_layout<double, layout_left>(M, N);
+        test_layout<double, layout_right>(M, N);
+      }
+    }
+    for (std::size_t M : {1, 255, 256, 257}) {
+      test_layout<std::complex<double>, layout_left>(M, 300);
+      test_layout<std::complex<double>, layout_right>(M, 300);
+    }
+    test_layout<float, layout_left>(100, 30);
+    test_layout<float, layout_right>(30, 100);
+  }
+
+  TEST(BLAS2_gemv_blocked, strided_and_degenerate)
+  {
+    constexpr std::size_t M = 70, N = 45;
+    std::vector<double> A_storage(6 * M * N);
+    using mapping_t = layout_stride::mapping<matrix_extents_t>;
+    // Neither dimension contiguous; columns closer together, then rows.
+    mdspan<double, matrix_extents_t, layout_stride> A_cols(A_storage.data(),
+      mapping_t(matrix_extents_t(M, N), std::array<std::size_t, 2>{2, 2 * M}));
+    fill_test_values(A_cols, 1);
+    test_product(A_cols);
+    mdspan<double, matrix_extents_t, layout_stride> A_rows(A_storage.data(),
+      mapping_t(matrix_extents_t(M, N), std::array<std::size_t, 2>{3 * N, 3}));
+    fill_test_values(A_rows, 1);
+    test_product(A_rows);
+
+    test_layout<double, layout_left>(0, 5);
+    test_layout<double, layout_right>(5, 0);
+    test_layout<std::complex<double>, layout_left>(5, 0);
+  }
+
+  TEST(BLAS2_gemv_blocked, scaled_and_conjugated)
+  {
+    // The engine peels A's and x's scaling factors and conjugations.
+    using Scalar = std::complex<double>;
+    constexpr std::size_t M = 90, N = 33;
+    std::vector<Scalar> A_storage(M * N), x_storage(N), y_storage(M);
+    mdspan<Scalar, matrix_extents_t> A(A_storage.data(), M, N);
+    mdspan<Scalar, matrix_extents_t, layout_left> A_left(A_storage.data(), M, N);
+    mdspan<Scalar, vector_extents_t> x(x_storage.data(), N);
+    mdspan<Scalar, vector_extents_t> y(y_storage.data(), M);
+    fill_test_values(A, 1);
+    fill_vector(x, 2);
+    auto zero = [] (std::size_t) { return Scalar{}; };
+
+    auto A_op = scaled(Scalar(2.0, -1.0), conjugated(A));
+    auto x_op = conjugated(scaled(Scalar(-1.0, 3.0), x));
+    static_assert(LinearAlgebra::impl::is_gemv_blockable_v<
+      decltype(A_op), decltype(x_op), decltype(y)>);
+    matrix_vector_product(A_op, x_op, y);
+    check_product("layout_right", A_op, x_op, y, zero);
+
+    auto A_left_op = conjugated(A_left);
+    matrix_vector_product(A_left_op, x_op, y);
+    check_product("layout_left", A_left_op, x_op, y, zero);
+
+    // Mixed precision takes the generic loops.
+    std::vector<float> x_float_storage(N, 1.0f);
+    mdspan<float, vector_extents_t> x_float(x_float_storage.data(), N);
+    static_assert(! LinearAlgebra::impl::is_gemv_blockable_v<
+      decltype(A), decltype(x_float), decltype(y)>);
+  }
+
+} // end anonymous namespace
@@ -0,0 +1,168 @@
+#include "./gtest_fixtures.hpp"
+
+// Exercise the blocked rank-1 update with problem sizes that cross
+// its row blocks and column tiles, with column-major, row-major, and
+// strided matrices, both directly and through matrix_rank_1_update
+// and matrix_rank_1_update_c, serially and on the thread pool.
+
+namespace {
+  using LinearAlgebra::conjugated;
+  using LinearAlgebra::matrix_rank_1_update;
+  using LinearAlgebra::matrix_rank_1_update_c;
+  using LinearAlgebra::scaled;
+  using LinearAlgebra::thread_pool_exec;
+
+  using matrix_extents_t = extents<std::size_t, dynamic_extent, dynamic_extent>;
+  using vector_extents_t = extents<std::size_t, dynamic_extent>;
+
+  // Test data are small integers, so the update is exact.
+  template<class Scalar>
+  void test_sizes(std::size_t m, std::size_t n, storage s_A, storage s_E)
+  {
+    std::vector<Scalar> x_storage(m), y_storage(2 * n);
+    for (std::size_t i = 0; i < m; ++i) {
+      x_storage[i] = test_value<Scalar>(i, 0, 1);
+    }
+    for (std::size_t j = 0; j < 2 * n; ++j) {
+      y_storage[j] = test_value<Scalar>(j, 0, 2);
+    }
+    mdspan<Scalar, vector_extents_t> x(x_storage.data(), m);
+    mdspan<Scalar, vector_extents_t, layout_stride> y(y_storage.data(),
+      layout_stride::mapping<vector_extents_t>(vector_extents_t(n), std::array<std::size_t, 1>{2}));
+    static_assert(LinearAlgebra::impl::is_ger_blockable_v<decltype(x), decltype(y),
+      mdspan<Scalar, matrix_extents_t, layout_stride>>);
+
+    const test_matrix<Scalar> E(m, n, s_E, 3);
+    auto check = [&] (auto A, bool from_E, bool conj_y, const char* what) {
+      for (std::size_t j = 0; j < n; ++j) {
+        const Scalar y_j = conj_y ? LinearAlgebra::impl::conj_if_needed(y(j)) : y(j);
+        for (std::size_t i = 0; i < m; ++i) {
+          const Scalar start = from_E ? E.A(i,j) : Scalar{};
+          EXPECT_EQ(A(i,j), start + x(i) * y_j) << what << ", at (" << i << "," << j << ")";
+        }
+      }
+    };
+
+    for (bool overwrite : {false, true}) {
+      test_matrix<Scalar> A(m, n, s_A, 3);
+      if (overwrite) {
+        LinearAlgebra::impl::blocked_ger<true>(x, y,
+          LinearAlgebra::impl::make_strided_matrix_view(A.A).as_const(), A.A);
+      }
+      else {
+        LinearAlgebra::impl::blocked_ger<false>(x, y,
+          LinearAlgebra::impl::make_strided_matrix_view(E.A).as_const(), A.A);
+      }
+      check(A.A, ! overwrite, false, overwrite ? "blocked_ger, overwriting" : "blocked_ger");
+    }
+
+    // The generic algorithms, serially and on the thread pool.  A
+    // starts out as E, so that the nonoverwriting update of A gives
+    // E + x y^T in either build.
+    for (bool parallel : {false, true}) {
+      test_matrix<Scalar> A(m, n, s_A, 3);
+      for (bool conj_y : {false, true}) {
+        for (std::size_t j = 0; j < n; ++j) {
+          for (std::size_t i = 0; i < m; ++i) {
+            A.A(i,j) = E.A(i,j);
+          }
+        }
+        if (parallel) {
+          if (conj_y) {
+            matrix_rank_1_update_c(thread_pool_exec{}, x, y, A.A);
+          }
+          else {
+            matrix_rank_1_update(thread_pool_exec{}, x, y, A.A);
+          }
+        }
+        else {
+          if (conj_y) {
+            matrix_rank_1_update_c(x, y, A.A);
+          }
+          else {
+            matrix_rank_1_update(x, y, A.A);
+          }
+        }
+#if defined(LINALG_FIX_RANK_UPDATES)
+        check(A.A, false, conj_y, "matrix_rank_1_update");
+#else
+        check(A.A, true, conj_y, "matrix_rank_1_update");
+#endif // LINALG_FIX_RANK_UPDATES
+      }
+#if defined(LINALG_FIX_RANK_UPDATES)
+      if (parallel) {
+        matrix_rank_1_update(thread_pool_exec{}, x, y, E.A, A.A);
+      }
+      else {
+        matrix_rank_1_update(x, y, E.A, A.A);
+      }
+      check(A.A, true, false, "updating matrix_rank_1_update");
+#endif // LINALG_FIX_RANK_UPDATES
+    }
+  }
+
+  TEST(BLAS2_ger_blocked, crosses_block_boundaries)
+  {
+    // Row blocks have 512 entries of double, and column tiles have 4
+    // columns.
+    for (std::size_t m : {1, 5, 511, 512, 513, 1100}) {
+      for (std::size_t n : {1, 3, 4, 9}) {
+        test_sizes<double>(m, n, storage::column_major, storage::row_major);
+        test_sizes<double>(n, m, storage::row_major, storage::column_major);
+        test_sizes<double>(m, n, storage::strided, storage::strided);
+        test_sizes<double>(n, m, storage::strided, storage::column_major);
+      }
+    }
+  }
+
+  TEST(BLAS2_ger_blocked, layouts_and_types)
+  {
+    test_sizes<float>(70, 30, storage::column_major, storage::column_major);
+    test_sizes<float>(30, 70, storage::row_major, storage::strided);
+    test_sizes<std::complex<double>>(40, 23, storage::column_major, storage::strided);
+    test_sizes<std::complex<double>>(23, 40, storage::row_major, storage::row_major);
+    test_sizes<std::complex<double>>(33, 21, storage::strided, storage::column_major);
+    test_sizes<double>(0, 5, storage::column_major, storage::column_major);
+    test_sizes<double>(5, 0, storage::row_major, storage::row_major);
+  }
+
+  TEST(BLAS2_ger_blocked, scaled_vectors)
+  {
+    // The engine peels the vectors' scaling factors and conjugations.
+    using Scalar = std::complex<double>;
+    constexpr std::size_t m = 37, n = 29;
+    std::vector<Scalar> x_storage(m), y_storage(n);
+    for (std::size_t i = 0; i < m; ++i) {
+      x_storage[i] = test_value<Scalar>(i, 0, 4);
+    }
+    for (std::size_t j = 0; j < n; ++j) {
+      y_storage[j] = test_value<Scalar>(j, 0, 5);
+    }
+    mdspan<Scalar, vector_extents_t> x(x_storage.data(), m);
+    mdspan<Scalar, vector_extents_t> y(y_storage.data(), n);
+    auto x_op = scaled(Scalar(2.0), x);
+    auto y_op = conjugated(scaled(Scalar(0.0, 1.0), y));
+    test_matrix<Scalar> A(m, n, storage::strided, 6);
+    static_assert(LinearAlgebra::impl::is_ger_blockable_v<
+      decltype(x_op), decltype(y_op), decltype(A.A)>);
+
+    matrix_rank_1_update(x_op, y_op, A.A);
+    for (std::size_t j = 0; j < n; ++j) {
+      for (std::size_t i = 0; i < m; ++i) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+        const Scalar start{};
+#else
+        const Scalar start = test_value<Scalar>(i, j, 6);
+#endif // LINALG_FIX_RANK_UPDATES
+        const Scalar expected =
+          start + (2.0 * x(i)) * std::conj(Scalar(0.0, 1.0) * y(j));
+        EXPECT_EQ(A.A(i,j), expected) << "at (" << i << "," << j << ")";
+      }
+    }
+
+    // A scaled or conjugated matrix takes the generic loops.
+    static_assert(! LinearAlgebra::impl::is_ger_blockable_v<
+      decltype(x), decltype(y), decltype(conjugated(A.A))>);
+  }
+
+} // end anonymous namespace
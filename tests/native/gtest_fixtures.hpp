@@ -29,8 +29,11 @@
 #include <mdspan/mdspan.hpp>
 #include "experimental/__p2630_bits/submdspan.hpp"
 #include <experimental/linalg>
+#include <algorithm>
 #include <array>
 #include <complex>
+#include <limits>
+#include <type_traits>
 #include <vector>
 
 namespace KokkosStd = MDSPAN_IMPL_STANDARD_NAMESPACE;
@@ -132,4 +135,158 @@ protected:
   cpx_vector_t v;
 }; // end class signed_double_vector
 
+// Small Gaussian integers: every partial sum of products of these
+// stays exactly representable, so results computed in any order or
+// blocking must match a reference bit for bit.
+template<class Scalar>
+constexpr Scalar test_value(std::size_t i, std::size_t j, std::size_t seed)
+{
+  const int v = int((3 * i + 7 * j + seed) % 11) - 5;
+  if constexpr (LinearAlgebra::impl::is_complex_v<Scalar>) {
+    return Scalar(v, int((5 * i + 2 * j + seed) % 7) - 3);
+  }
+  else {
+    return Scalar(v);
+  }
+}
+
+// Value that poisons any result that reads it.
+template<class Scalar>
+Scalar poison_value()
+{
+  if constexpr (std::is_integral_v<Scalar>) {
+    return Scalar(-1000);
+  }
+  else {
+    return Scalar(std::numeric_limits<double>::quiet_NaN());
+  }
+}
+
+template<class MatrixType>
+void fill_test_values(MatrixType A, std::size_t seed)
+{
+  using value_type = typename MatrixType::value_type;
+  for (std::size_t j = 0; j < A.extent(1); ++j) {
+    for (std::size_t i = 0; i < A.extent(0); ++i) {
+      A(i,j) = test_value<value_type>(i, j, seed);
+    }
+  }
+}
+
+// Matrix of test values with strides (2, 2 * num_rows).
+template<class Scalar>
+struct strided_matrix {
+  using extents_type = extents<std::size_t, dynamic_extent, dynamic_extent>;
+
+  strided_matrix(std::size_t num_rows, std::size_t num_cols, std::size_t seed) :
+    storage(4 * num_rows * num_cols),
+    A(storage.data(), layout_stride::mapping<extents_type>(
+        extents_type(num_rows, num_cols),
+        std::array<std::size_t, 2>{2, 2 * num_rows}))
+  {
+    fill_test_values(A, seed);
+  }
+  std::vector<Scalar> storage;
+  mdspan<Scalar, extents_type, layout_stride> A;
+};
+
+// How a test_matrix stores its elements.
+enum class storage {
+  column_major,  // without gaps, stride0 = 1
+  row_major,     // without gaps, stride1 = 1
+  column_padded, // stride0 = 1, with gaps between columns
+  row_padded,    // stride1 = 1, with gaps between rows
+  strided        // neither stride is one
+};
+
+// m x n matrix of test values in its own storage.  With
+// layout_stride, the storage argument says how it stores its
+// elements; layout_left and layout_right store them without gaps.
+template<class Scalar, class Layout = layout_stride>
+struct test_matrix {
+  using extents_type = extents<std::size_t, dynamic_extent, dynamic_extent>;
+
+  test_matrix(std::size_t m, std::size_t n, storage s, std::size_t seed) :
+    storage_(2 * (m + 3) * (n + 3)),
+    A(storage_.data(), stride_mapping(m, n, s))
+  {
+    static_assert(std::is_same_v<Layout, layout_stride>);
+    fill_test_values(A, seed);
+  }
+
+  test_matrix(std::size_t m, std::size_t n, std::size_t seed) :
+    storage_(m * n),
+    A(storage_.data(), m, n)
+  {
+    static_assert(! std::is_same_v<Layout, layout_stride>);
+    fill_test_values(A, seed);
+  }
+
+  static layout_stride::mapping<extents_type>
+  stride_mapping(std::size_t m, std::size_t n, storage s)
+  {
+    std::array<std::size_t, 2> strides{1, std::max(m, std::size_t(1))};
+    if (s == storage::row_major) {
+      strides = {std::max(n, std::size_t(1)), 1};
+    }
+    else if (s == storage::column_padded) {
+      strides = {1, m + 3};
+    }
+    else if (s == storage::row_padded) {
+      strides = {n + 3, 1};
+    }
+    else if (s == storage::strided) {
+      strides = {2 * n + 2, 2};
+    }
+    return layout_stride::mapping<extents_type>(extents_type(m, n), strides);
+  }
+
+  std::vector<Scalar> storage_;
+  mdspan<Scalar, extents_type, Layout> A;
+};
+
+// Vector of test values with the given stride.
+template<class Scalar>
+struct test_vector {
+  using extents_type = extents<std::size_t, dynamic_extent>;
+
+  test_vector(std::size_t n, std::size_t seed, std::size_t stride = 1) :
+    storage(stride * n),
+    x(storage.data(), layout_stride::mapping<extents_type>(
+        extents_type(n), std::array<std::size_t, 1>{stride}))
+  {
+    for (std::size_t i = 0; i < n; ++i) {
+      x(i) = test_value<Scalar>(i, 0, seed);
+    }
+  }
+  std::vector<Scalar> storage;
+  mdspan<Scalar, extents_type, layout_stride> x;
+};
+
+// Vector of test values with stride 2.
+template<class Scalar>
+struct strided_vector : test_vector<Scalar> {
+  strided_vector(std::size_t n, std::size_t seed) :
+    test_vector<Scalar>(n, seed, 2)
+  {}
+};
+
+template<class MatrixType>
+void expect_matrix_eq(MatrixType A, MatrixType B)
+{
+  for (std::size_t j = 0; j < A.extent(1); ++j) {
+    for (std::size_t i = 0; i < A.extent(0); ++i) {
+      EXPECT_EQ(A(i,j), B(i,j)) << "at (" << i << "," << j << ")";
+    }
+  }
+}
+
+template<class VectorType>
+void expect_vector_eq(VectorType x, VectorType y)
+{
+  for (std::size_t i = 0; i < x.extent(0); ++i) {
+    EXPECT_EQ(x(i), y(i)) << "at " << i;
+  }
+}
+
 #endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_FIXTURES_HPP_
@@ -159,4 +159,163 @@ namespace {
     static_assert( std::is_same_v<std::remove_const_t<decltype(normResultAuto)>, mag_t> );
     EXPECT_NEAR( expectedNormResult, normResultAuto, tol );
   }
+  // vector_two_norm must neither overflow nor underflow unless the
+  // norm itself does.  Check vectors whose elements' squares would
+  // underflow or overflow, or span both, in contiguous storage and
+  // with a stride (which takes a different code path).
+  template<class Real, class Value>
+  void test_two_norm_scaling(std::vector<Value> values, Real expected)
+  {
+    const Real tol = 4 * std::numeric_limits<Real>::epsilon() * expected;
+    using extents_t = extents<std::size_t, dynamic_extent>;
+    mdspan<Value, extents_t> x(values.data(), values.size());
+    EXPECT_NEAR(vector_two_norm(x, Real{}), expected, tol);
+
+    std::vector<Value> strided_values(2 * values.size());
+    for (std::size_t k = 0; k < values.size(); ++k) {
+      strided_values[2 * k] = values[k];
+    }
+    mdspan<Value, extents_t, layout_stride> x_strided(strided_values.data(),
+      layout_stride::mapping<extents_t>(extents_t(values.size()),
+                                        std::array<std::size_t, 1>{2}));
+    EXPECT_NEAR(vector_two_norm(x_strided, Real{}), expected, tol);
+  }
+
+  template<class Real>
+  void test_two_norm_scaling()
+  {
+    using std::ldexp;
+    using limits = std::numeric_limits<Real>;
+    const int big_exp = limits::max_exponent - 10;
+    const int small_exp = limits::min_exponent - 10;
+    const int medium_small_exp = limits::min_exponent / 2 - 10;
+
+    for (int e : {0, big_exp, small_exp, medium_small_exp, -medium_small_exp}) {
+      // 3-4-5 triangles, with zeros in between.
+      std::vector<Real> x(40);
+      x[3] = ldexp(Real(3.0), e);
+      x[31] = ldexp(Real(-4.0), e);
+      test_two_norm_scaling<Real>(x, ldexp(Real(5.0), e));
+
+      std::vector<std::complex<Real>> z(17);
+      z[8] = std::complex<Real>(ldexp(Real(3.0), e), ldexp(Real(-4.0), e));
+      test_two_norm_scaling<Real>(z, ldexp(Real(5.0), e));
+    }
+
+    // Big and small elements together: the small ones do not matter.
+    std::vector<Real> x(20, ldexp(Real(1.0), small_exp));
+    x[5] = ldexp(Real(3.0), big_exp - 2);
+    x[6] = ldexp(Real(4.0), big_exp - 2);
+    test_two_norm_scaling<Real>(x, ldexp(Real(5.0), big_exp - 2));
+
+    // Medium and small elements together.
+    std::vector<Real> y(64, ldexp(Real(1.0), medium_small_exp));
+    y[0] = Real(0.75);
+    y[1] = Real(1.0);
+    test_two_norm_scaling<Real>(y, Real(1.25));
+
+    // The norm overflows only if it must.
+    std::vector<Real> w(4, limits::max() / Real(2.0));
+    test_two_norm_scaling<Real>(w, limits::max());
+  }
+
+  TEST(BLAS1_norm2, extreme_magnitudes)
+  {
+    test_two_norm_scaling<double>();
+    test_two_norm_scaling<float>();
+  }
+
+  TEST(BLAS1_norm2, inf_and_nan)
+  {
+    using extents_t = extents<std::size_t, dynamic_extent>;
+    for (std::size_t position : {0, 5, 9}) {
+      std::vector<double> x(10, 1.0);
+      x[position] = std::numeric_limits<double>::infinity();
+      EXPECT_EQ(vector_two_norm(mdspan<double, extents_t>(x.data(), x.size())),
+                std::numeric_limits<double>::infinity());
+      x[position] = std::numeric_limits<double>::quiet_NaN();
+      EXPECT_TRUE(std::isnan(vector_two_norm(mdspan<double, extents_t>(x.data(), x.size()))));
+
+      std::vector<std::complex<double>> z(10, 1.0);
+      z[position] = std::complex<double>(1.0, -std::numeric_limits<double>::infinity());
+      EXPECT_EQ(vector_two_norm(mdspan<std::complex<double>, extents_t>(z.data(), z.size())),
+                std::numeric_limits<double>::infinity());
+
+      // The vectorized maximum ignores NaN; with only zeros around
+      // it, the NaN must still reach the result.
+      std::vector<double> y(10, 0.0);
+      y[position] = std::numeric_limits<double>::quiet_NaN();
+      EXPECT_TRUE(std::isnan(vector_two_norm(mdspan<double, extents_t>(y.data(), y.size()))));
+      const auto ssq = LinearAlgebra::vector_sum_of_squares(
+        mdspan<double, extents_t>(y.data(), y.size()),
+        LinearAlgebra::sum_of_squares_result<double>{1.0, 0.0});
+      EXPECT_TRUE(std::isnan(ssq.scaling_factor) || std::isnan(ssq.scaled_sum_of_squares));
+    }
+  }
+
+  TEST(BLAS1_norm2, sum_of_squares_scaling_factor)
+  {
+    // The scaling factor is the largest of init's and the elements'
+    // magnitudes, and scaling_factor^2 * scaled_sum_of_squares is
+    // init's plus the sum of the squares of the elements.
+    using LinearAlgebra::sum_of_squares_result;
+    using LinearAlgebra::vector_sum_of_squares;
+    using extents_t = extents<std::size_t, dynamic_extent>;
+    const double scale = std::ldexp(1.0, 600);
+    std::vector<double> storage{2.0 * scale, -6.0 * scale, 3.0 * scale, 0.0};
+    // With a stride, vector_sum_of_squares takes Blue's algorithm.
+    mdspan<double, extents_t, layout_stride> x(storage.data(),
+      layout_stride::mapping<extents_t>(extents_t(2), std::array<std::size_t, 1>{2}));
+
+    auto result = vector_sum_of_squares(x, sum_of_squares_result<double>{scale, 5.0});
+    EXPECT_EQ(result.scaling_factor, 3.0 * scale);
+    EXPECT_NEAR(result.scaled_sum_of_squares, (5.0 + 4.0 + 9.0) / 9.0, 1.0e-15);
+
+    result = vector_sum_of_squares(x, sum_of_squares_result<double>{4.0 * scale, 1.0});
+    EXPECT_EQ(result.scaling_factor, 4.0 * scale);
+    EXPECT_NEAR(result.scaled_sum_of_squares, (16.0 + 4.0 + 9.0) / 16.0, 1.0e-15);
+  }
+  TEST(BLAS1_norm2, combine_sum_of_squares)
+  {
+    // Sums of squares of the parts of a vector combine to that of the
+    // whole vector, in any grouping.
+    using LinearAlgebra::combine_sum_of_squares;
+    using LinearAlgebra::sum_of_squares_result;
+    using LinearAlgebra::vector_sum_of_squares;
+    using extents_t = extents<std::size_t, dynamic_extent>;
+    using result_t = sum_of_squares_result<double>;
+    const double big = std::ldexp(1.0, 900);
+    std::vector<double> storage{1.0, -2.0, 2.0 * big, 3.0, big, -4.0, 0.5, 2.0};
+    auto part = [&] (std::size_t begin, std::size_t end) {
+      return vector_sum_of_squares(mdspan<double, extents_t>(storage.data() + begin, end - begin),
+                                   result_t{0.0, 1.0});
+    };
+    auto value = [] (const result_t& r) {
+      return r.scaling_factor * std::sqrt(r.scaled_sum_of_squares);
+    };
+    const double expected = std::sqrt(5.0) * big;
+    const double tol = 4.0e-16 * expected;
+
+    const result_t a = part(0, 2), b = part(2, 5), c = part(5, 8);
+    EXPECT_NEAR(value(combine_sum_of_squares(combine_sum_of_squares(a, b), c)), expected, tol);
+    EXPECT_NEAR(value(combine_sum_of_squares(a, combine_sum_of_squares(b, c))), expected, tol);
+    EXPECT_NEAR(value(combine_sum_of_squares(c, combine_sum_of_squares(b, a))), expected, tol);
+    EXPECT_EQ(combine_sum_of_squares(a, b).scaling_factor, 2.0 * big);
+    EXPECT_EQ(combine_sum_of_squares(b, a).scaling_factor, 2.0 * big);
+
+    // A zero scaling factor is an identity.
+    const result_t zero{0.0, 1.0};
+    EXPECT_EQ(combine_sum_of_squares(zero, b).scaling_factor, b.scaling_factor);
+    EXPECT_EQ(combine_sum_of_squares(zero, b).scaled_sum_of_squares, b.scaled_sum_of_squares);
+    EXPECT_EQ(combine_sum_of_squares(b, zero).scaled_sum_of_squares, b.scaled_sum_of_squares);
+
+    // Infinity and NaN propagate.
+    const double inf = std::numeric_limits<double>::infinity();
+    const result_t infinite{inf, 1.0};
+    EXPECT_EQ(value(combine_sum_of_squares(infinite, infinite)), inf);
+    EXPECT_EQ(value(combine_sum_of_squares(b, infinite)), inf);
+    const result_t nan{std::numeric_limits<double>::quiet_NaN(), 1.0};
+    EXPECT_TRUE(std::isnan(combine_sum_of_squares(nan, b).scaling_factor));
+    EXPECT_TRUE(std::isnan(combine_sum_of_squares(b, nan).scaling_factor));
+  }
 }
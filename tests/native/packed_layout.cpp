@@ -0,0 +1,294 @@
+#include "./gtest_fixtures.hpp"
+
+// layout_blas_packed, packed(), and the algorithms' packed-storage
+// kernels.  The kernels must match the same algorithms applied to a
+// full (layout_left) copy of the matrix; small Gaussian integers keep
+// every partial sum exact, so the order of summation does not matter.
+
+namespace {
+  using LinearAlgebra::column_major;
+  using LinearAlgebra::column_major_t;
+  using LinearAlgebra::layout_blas_packed;
+  using LinearAlgebra::lower_triangle;
+  using LinearAlgebra::lower_triangle_t;
+  using LinearAlgebra::row_major;
+  using LinearAlgebra::row_major_t;
+  using LinearAlgebra::upper_triangle;
+  using LinearAlgebra::upper_triangle_t;
+
+  using matrix_extents_t = extents<std::size_t, dynamic_extent, dynamic_extent>;
+  using vector_extents_t = extents<std::size_t, dynamic_extent>;
+
+  template<class Triangle>
+  bool in_triangle(std::size_t i, std::size_t j)
+  {
+    return std::is_same_v<Triangle, upper_triangle_t> ? i <= j : i >= j;
+  }
+
+  // Zero-based offset of A(i,j) in the BLAS' packed storage formats.
+  template<class Triangle, class StorageOrder>
+  std::size_t blas_packed_offset(std::size_t n, std::size_t i, std::size_t j)
+  {
+    if (! in_triangle<Triangle>(i, j)) {
+      std::swap(i, j);
+    }
+    constexpr bool upper = std::is_same_v<Triangle, upper_triangle_t>;
+    if constexpr (std::is_same_v<StorageOrder, column_major_t>) {
+      return upper ? i + j * (j + 1) / 2 : i + j * (2 * n - j - 1) / 2;
+    }
+    else {
+      return upper ? j + i * (2 * n - i - 1) / 2 : j + i * (i + 1) / 2;
+    }
+  }
+
+  template<class Triangle, class StorageOrder>
+  void test_mapping(std::size_t n)
+  {
+    using mapping_t = typename layout_blas_packed<Triangle, StorageOrder>::template mapping<matrix_extents_t>;
+    const mapping_t mapping(matrix_extents_t(n, n));
+
+    EXPECT_EQ(mapping.required_span_size(), n * (n + 1) / 2);
+    EXPECT_EQ(mapping.is_unique(), n < 2);
+    EXPECT_TRUE(mapping.is_exhaustive());
+    EXPECT_FALSE(mapping_t::is_always_unique());
+
+    std::vector<int> hits(mapping.required_span_size(), 0);
+    for (std::size_t j = 0; j < n; ++j) {
+      for (std::size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(std::size_t(mapping(i,j)), (blas_packed_offset<Triangle, StorageOrder>(n, i, j)))
+          << "at (" << i << "," << j << ")";
+        EXPECT_EQ(mapping(i,j), mapping(j,i));
+        if (in_triangle<Triangle>(i, j)) {
+          ++hits[mapping(i,j)];
+        }
+      }
+    }
+    for (int h : hits) {
+      EXPECT_EQ(h, 1);
+    }
+  }
+
+  TEST(packed_layout, mapping)
+  {
+    for (std::size_t n : {0, 1, 2, 7}) {
+      test_mapping<upper_triangle_t, column_major_t>(n);
+      test_mapping<lower_triangle_t, column_major_t>(n);
+      test_mapping<upper_triangle_t, row_major_t>(n);
+      test_mapping<lower_triangle_t, row_major_t>(n);
+    }
+
+    using static_mapping_t = layout_blas_packed<upper_triangle_t, column_major_t>::mapping<extents<int, 1, 1>>;
+    static_assert(static_mapping_t::is_always_unique());
+    static_assert(static_mapping_t::is_always_strided());
+  }
+
+  TEST(packed_layout, packed_and_transposed)
+  {
+    constexpr std::size_t n = 5;
+    std::vector<double> storage(n * (n + 1) / 2);
+    for (std::size_t k = 0; k < storage.size(); ++k) {
+      storage[k] = double(k);
+    }
+    mdspan<double, vector_extents_t> v(storage.data(), storage.size());
+
+    auto A = LinearAlgebra::packed(v, n, lower_triangle, row_major);
+    static_assert(std::is_same_v<typename decltype(A)::layout_type,
+                                 layout_blas_packed<lower_triangle_t, row_major_t>>);
+    ASSERT_EQ(A.extent(0), n);
+    ASSERT_EQ(A.extent(1), n);
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        EXPECT_EQ(A(i,j), double((blas_packed_offset<lower_triangle_t, row_major_t>(n, i, j))));
+      }
+    }
+
+    // The transpose of a row-major lower triangle is a column-major
+    // upper triangle over the same storage.
+    auto A_t = LinearAlgebra::transposed(A);
+    static_assert(std::is_same_v<typename decltype(A_t)::layout_type,
+                                 layout_blas_packed<upper_triangle_t, column_major_t>>);
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        EXPECT_EQ(A_t(i,j), A(j,i));
+      }
+    }
+  }
+
+  // Packed matrix and a full copy of it, with both triangles filled.
+  template<class Scalar, class Triangle, class StorageOrder>
+  struct packed_and_full {
+    using packed_t = mdspan<Scalar, matrix_extents_t, layout_blas_packed<Triangle, StorageOrder>>;
+    using full_t = mdspan<Scalar, matrix_extents_t, layout_left>;
+
+    packed_and_full(std::size_t n, std::size_t seed, Scalar diagonal = Scalar{}) :
+      packed_storage(n * (n + 1) / 2),
+      full_storage(n * n),
+      A(packed_storage.data(), n, n),
+      A_full(full_storage.data(), n, n)
+    {
+      for (std::size_t j = 0; j < n; ++j) {
+        for (std::size_t i = 0; i < n; ++i) {
+          if (in_triangle<Triangle>(i, j)) {
+            const Scalar value = (i == j && diagonal != Scalar{}) ? diagonal : test_value<Scalar>(i, j, seed);
+            A(i,j) = value;
+            A_full(i,j) = value;
+            A_full(j,i) = value;
+          }
+        }
+      }
+    }
+
+    void expect_triangle_eq() const
+    {
+      for (std::size_t j = 0; j < A.extent(1); ++j) {
+        for (std::size_t i = 0; i < A.extent(0); ++i) {
+          if (in_triangle<Triangle>(i, j)) {
+            EXPECT_EQ(A(i,j), A_full(i,j)) << "at (" << i << "," << j << ")";
+          }
+        }
+      }
+    }
+
+    std::vector<Scalar> packed_storage;
+    std::vector<Scalar> full_storage;
+    packed_t A;
+    full_t A_full;
+  };
+
+  template<class Scalar, class Triangle, class StorageOrder>
+  void test_matrix_vector_products(std::size_t n)
+  {
+    constexpr Triangle t{};
+    const packed_and_full<Scalar, Triangle, StorageOrder> A(n, 1);
+    const test_vector<Scalar> x(n, 2);
+    const test_vector<Scalar> y(n, 3);
+    test_vector<Scalar> z(n, 0);
+    test_vector<Scalar> z_ref(n, 0);
+
+    LinearAlgebra::symmetric_matrix_vector_product(A.A, t, x.x, z.x);
+    LinearAlgebra::symmetric_matrix_vector_product(A.A_full, t, x.x, z_ref.x);
+    expect_vector_eq(z.x, z_ref.x);
+
+    LinearAlgebra::symmetric_matrix_vector_product(A.A, t, x.x, y.x, z.x);
+    LinearAlgebra::symmetric_matrix_vector_product(A.A_full, t, x.x, y.x, z_ref.x);
+    expect_vector_eq(z.x, z_ref.x);
+
+    LinearAlgebra::hermitian_matrix_vector_product(A.A, t, x.x, z.x);
+    LinearAlgebra::hermitian_matrix_vector_product(A.A_full, t, x.x, z_ref.x);
+    expect_vector_eq(z.x, z_ref.x);
+
+    LinearAlgebra::hermitian_matrix_vector_product(A.A, t, x.x, y.x, z.x);
+    LinearAlgebra::hermitian_matrix_vector_product(A.A_full, t, x.x, y.x, z_ref.x);
+    expect_vector_eq(z.x, z_ref.x);
+
+    // Scaled and conjugated views keep the packed layout.
+    LinearAlgebra::hermitian_matrix_vector_product(
+      LinearAlgebra::scaled(Scalar(2), LinearAlgebra::conjugated(A.A)), t, x.x, z.x);
+    LinearAlgebra::hermitian_matrix_vector_product(
+      LinearAlgebra::scaled(Scalar(2), LinearAlgebra::conjugated(A.A_full)), t, x.x, z_ref.x);
+    expect_vector_eq(z.x, z_ref.x);
+  }
+
+  template<class Scalar, class Triangle, class StorageOrder, class DiagonalStorage>
+  void test_triangular_solve(std::size_t n, DiagonalStorage d)
+  {
+    constexpr Triangle t{};
+    // With 2 on the diagonal, and b = A x_true for an integer
+    // x_true, the solve is exact.
+    const packed_and_full<Scalar, Triangle, StorageOrder> A(n, 1, Scalar(2));
+    const test_vector<Scalar> x_true(n, 2);
+    test_vector<Scalar> b(n, 0);
+    LinearAlgebra::triangular_matrix_vector_product(A.A_full, t, d, x_true.x, b.x);
+
+    test_vector<Scalar> x(n, 0);
+    LinearAlgebra::triangular_matrix_vector_solve(A.A, t, d, b.x, x.x);
+    expect_vector_eq(x.x, x_true.x);
+  }
+
+  template<class Scalar, class Triangle, class StorageOrder>
+  void test_rank_updates(std::size_t n)
+  {
+    constexpr Triangle t{};
+    const test_vector<Scalar> x(n, 2);
+    const test_vector<Scalar> y(n, 3);
+    const Scalar alpha(-2);
+    {
+      packed_and_full<Scalar, Triangle, StorageOrder> A(n, 1);
+      LinearAlgebra::symmetric_matrix_rank_1_update(alpha, x.x, A.A, t);
+      LinearAlgebra::symmetric_matrix_rank_1_update(alpha, x.x, A.A_full, t);
+      A.expect_triangle_eq();
+    }
+    {
+      packed_and_full<Scalar, Triangle, StorageOrder> A(n, 1);
+      LinearAlgebra::hermitian_matrix_rank_1_update(alpha, x.x, A.A, t);
+      LinearAlgebra::hermitian_matrix_rank_1_update(alpha, x.x, A.A_full, t);
+      A.expect_triangle_eq();
+    }
+    {
+      packed_and_full<Scalar, Triangle, StorageOrder> A(n, 1);
+      LinearAlgebra::symmetric_matrix_rank_2_update(x.x, y.x, A.A, t);
+      LinearAlgebra::symmetric_matrix_rank_2_update(x.x, y.x, A.A_full, t);
+      A.expect_triangle_eq();
+    }
+    {
+      packed_and_full<Scalar, Triangle, StorageOrder> A(n, 1);
+      LinearAlgebra::hermitian_matrix_rank_2_update(x.x, y.x, A.A, t);
+      LinearAlgebra::hermitian_matrix_rank_2_update(x.x, y.x, A.A_full, t);
+      A.expect_triangle_eq();
+    }
+#if defined(LINALG_FIX_RANK_UPDATES)
+    const packed_and_full<Scalar, Triangle, StorageOrder> E(n, 4);
+    {
+      packed_and_full<Scalar, Triangle, StorageOrder> A(n, 1);
+      LinearAlgebra::symmetric_matrix_rank_1_update(alpha, x.x, E.A, A.A, t);
+      LinearAlgebra::symmetric_matrix_rank_1_update(alpha, x.x, E.A_full, A.A_full, t);
+      A.expect_triangle_eq();
+    }
+    {
+      packed_and_full<Scalar, Triangle, StorageOrder> A(n, 1);
+      LinearAlgebra::hermitian_matrix_rank_1_update(alpha, x.x, E.A, A.A, t);
+      LinearAlgebra::hermitian_matrix_rank_1_update(alpha, x.x, E.A_full, A.A_full, t);
+      A.expect_triangle_eq();
+    }
+    {
+      packed_and_full<Scalar, Triangle, StorageOrder> A(n, 1);
+      LinearAlgebra::symmetric_matrix_rank_2_update(x.x, y.x, E.A, A.A, t);
+      LinearAlgebra::symmetric_matrix_rank_2_update(x.x, y.x, E.A_full, A.A_full, t);
+      A.expect_triangle_eq();
+    }
+    {
+      packed_and_full<Scalar, Triangle, StorageOrder> A(n, 1);
+      LinearAlgebra::hermitian_matrix_rank_2_update(x.x, y.x, E.A, A.A, t);
+      LinearAlgebra::hermitian_matrix_rank_2_update(x.x, y.x, E.A_full, A.A_full, t);
+      A.expect_triangle_eq();
+    }
+#endif // LINALG_FIX_RANK_UPDATES
+  }
+
+  template<class Scalar, class Triangle, class StorageOrder>
+  void test_algorithms(std::size_t n)
+  {
+    test_matrix_vector_products<Scalar, Triangle, StorageOrder>(n);
+    test_triangular_solve<Scalar, Triangle, StorageOrder>(n, LinearAlgebra::explicit_diagonal);
+    test_triangular_solve<Scalar, Triangle, StorageOrder>(n, LinearAlgebra::implicit_unit_diagonal);
+    test_rank_updates<Scalar, Triangle, StorageOrder>(n);
+  }
+
+  template<class Scalar>
+  void test_all_packed_layouts(std::size_t n)
+  {
+    test_algorithms<Scalar, upper_triangle_t, column_major_t>(n);
+    test_algorithms<Scalar, lower_triangle_t, column_major_t>(n);
+    test_algorithms<Scalar, upper_triangle_t, row_major_t>(n);
+    test_algorithms<Scalar, lower_triangle_t, row_major_t>(n);
+  }
+
+  TEST(packed_layout, algorithms)
+  {
+    for (std::size_t n : {0, 1, 2, 17}) {
+      test_all_packed_layouts<double>(n);
+      test_all_packed_layouts<std::complex<double>>(n);
+    }
+  }
+
+} // end anonymous namespace
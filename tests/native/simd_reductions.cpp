@@ -0,0 +1,275 @@
+#include "./gtest_fixtures.hpp"
+
+// dot, vector_abs_sum, vector_idx_abs_max, and vector_sum_of_squares
+// use vectorized kernels for contiguous vectors of float or double.
+// The kernels process several vectors' worth of elements at a time,
+// so the tests cover every length up to a few times the widest
+// (AVX-512) vector, and starting addresses that are not aligned to
+// a vector.  Test values are small multiples of 1/8, so that every
+// partial sum is exact in any order.
+
+namespace {
+  using LinearAlgebra::dot;
+  using LinearAlgebra::sum_of_squares_result;
+  using LinearAlgebra::vector_abs_sum;
+  using LinearAlgebra::vector_idx_abs_max;
+  using LinearAlgebra::vector_sum_of_squares;
+  using LinearAlgebra::vector_two_norm;
+
+  template<class Scalar>
+  Scalar test_value(std::size_t k, std::size_t seed)
+  {
+    const double v = double(int((37 * k + 11 * seed) % 101) - 50) / 8.0;
+    if constexpr (LinearAlgebra::impl::is_complex_v<Scalar>) {
+      return Scalar(v, double(int((17 * k + seed) % 23) - 11) / 8.0);
+    }
+    else {
+      return Scalar(v);
+    }
+  }
+
+  template<class Scalar>
+  std::vector<Scalar> test_storage(std::size_t size, std::size_t seed)
+  {
+    std::vector<Scalar> storage(size);
+    for (std::size_t k = 0; k < size; ++k) {
+      storage[k] = test_value<Scalar>(k, seed);
+    }
+    return storage;
+  }
+
+  using vector_extents_t = extents<std::size_t, dynamic_extent>;
+
+  constexpr std::size_t max_length = 70;
+  constexpr std::size_t max_offset = 3;
+
+  template<class Scalar>
+  void test_dot()
+  {
+    using vector_t = mdspan<Scalar, vector_extents_t>;
+    static_assert(! LinearAlgebra::impl::is_simd_reduction_value_v<Scalar> ||
+                  LinearAlgebra::impl::use_simd_dot_v<vector_t, vector_t, Scalar>);
+
+    auto x_storage = test_storage<Scalar>(max_length + max_offset, 1);
+    auto y_storage = test_storage<Scalar>(max_length + max_offset, 2);
+    for (std::size_t offset = 0; offset <= max_offset; ++offset) {
+      for (std::size_t n = 0; n <= max_length; ++n) {
+        vector_t x(x_storage.data() + offset, n);
+        vector_t y(y_storage.data(), n);
+        Scalar expected(0.5);
+        for (std::size_t k = 0; k < n; ++k) {
+          expected += x(k) * y(k);
+        }
+        EXPECT_EQ(dot(x, y, Scalar(0.5)), expected) << "offset " << offset << ", n " << n;
+      }
+    }
+
+    // Not contiguous, so dot uses the generic loop.
+    mdspan<Scalar, vector_extents_t, layout_stride> x_strided(x_storage.data(),
+      layout_stride::mapping<vector_extents_t>(vector_extents_t(max_length / 2),
+                                               std::array<std::size_t, 1>{2}));
+    vector_t y(y_storage.data(), max_length / 2);
+    Scalar expected{};
+    for (std::size_t k = 0; k < y.extent(0); ++k) {
+      expected += x_strided(k) * y(k);
+    }
+    EXPECT_EQ(dot(x_strided, y), expected);
+  }
+
+  TEST(BLAS1_simd_reductions, dot)
+  {
+    test_dot<double>();
+    test_dot<float>();
+    test_dot<std::complex<double>>();
+  }
+
+  template<class Scalar>
+  void test_abs_sum()
+  {
+    using vector_t = mdspan<Scalar, vector_extents_t>;
+    using real_t = decltype(LinearAlgebra::impl::abs_if_needed(
+      LinearAlgebra::impl::real_if_needed(std::declval<Scalar>())));
+    static_assert(! LinearAlgebra::impl::is_simd_reduction_value_v<real_t> ||
+                  LinearAlgebra::impl::use_simd_abs_sum_v<vector_t, real_t>);
+
+    auto x_storage = test_storage<Scalar>(max_length + max_offset, 1);
+    for (std::size_t offset = 0; offset <= max_offset; ++offset) {
+      for (std::size_t n = 0; n <= max_length; ++n) {
+        vector_t x(x_storage.data() + offset, n);
+        real_t expected(0.25);
+        for (std::size_t k = 0; k < n; ++k) {
+          expected += std::abs(LinearAlgebra::impl::real_if_needed(x(k)));
+          expected += std::abs(LinearAlgebra::impl::imag_if_needed(x(k)));
+        }
+        EXPECT_EQ(vector_abs_sum(x, real_t(0.25)), expected) << "offset " << offset << ", n " << n;
+      }
+    }
+  }
+
+  TEST(BLAS1_simd_reductions, vector_abs_sum)
+  {
+    test_abs_sum<double>();
+    test_abs_sum<float>();
+    test_abs_sum<std::complex<double>>();
+    test_abs_sum<std::complex<float>>();
+  }
+
+  template<class Scalar>
+  void test_idx_abs_max()
+  {
+    using vector_t = mdspan<Scalar, vector_extents_t>;
+    static_assert(LinearAlgebra::impl::use_simd_idx_abs_max_v<vector_t> ==
+                  LinearAlgebra::impl::is_simd_reduction_value_v<Scalar>);
+
+    auto x_storage = test_storage<Scalar>(max_length + max_offset, 1);
+    for (std::size_t offset = 0; offset <= max_offset; ++offset) {
+      for (std::size_t n = 1; n <= max_length; ++n) {
+        vector_t x(x_storage.data() + offset, n);
+        std::size_t expected = 0;
+        for (std::size_t k = 1; k < n; ++k) {
+          if (std::abs(x(expected)) < std::abs(x(k))) {
+            expected = k;
+          }
+        }
+        EXPECT_EQ(vector_idx_abs_max(x), expected) << "offset " << offset << ", n " << n;
+      }
+    }
+
+    // Ties go to the first index, wherever it falls in a vector.
+    for (std::size_t first = 0; first < max_length; first += 3) {
+      for (std::size_t second : {first + 1, first + 8, first + 17, max_length - 1}) {
+        if (second <= first || second >= max_length) {
+          continue;
+        }
+        std::vector<Scalar> storage(max_length, Scalar(1.0));
+        storage[first] = Scalar(-100.0);
+        storage[second] = Scalar(100.0);
+        vector_t x(storage.data(), max_length);
+        EXPECT_EQ(vector_idx_abs_max(x), first) << "first " << first << ", second " << second;
+      }
+    }
+
+    // NaN wins only at index 0, since nothing compares greater than it.
+    std::vector<Scalar> storage(max_length, Scalar(1.0));
+    storage[max_length / 2] = Scalar(-2.0);
+    storage[5] = std::numeric_limits<Scalar>::quiet_NaN();
+    vector_t x(storage.data(), max_length);
+    EXPECT_EQ(vector_idx_abs_max(x), max_length / 2);
+    storage[0] = std::numeric_limits<Scalar>::quiet_NaN();
+    EXPECT_EQ(vector_idx_abs_max(x), 0u);
+  }
+
+  TEST(BLAS1_simd_reductions, vector_idx_abs_max)
+  {
+    test_idx_abs_max<double>();
+    test_idx_abs_max<float>();
+  }
+
+  template<class Scalar>
+  void test_sum_of_squares()
+  {
+    using vector_t = mdspan<Scalar, vector_extents_t>;
+    static_assert(LinearAlgebra::impl::use_simd_sum_of_squares_v<vector_t, Scalar> ==
+                  LinearAlgebra::impl::is_simd_reduction_value_v<Scalar>);
+    const Scalar tol = 8 * std::numeric_limits<Scalar>::epsilon();
+
+    auto x_storage = test_storage<Scalar>(max_length + max_offset, 1);
+    for (std::size_t offset = 0; offset <= max_offset; ++offset) {
+      for (std::size_t n = 0; n <= max_length; ++n) {
+        vector_t x(x_storage.data() + offset, n);
+        Scalar max_abs(1.0);
+        Scalar sum(1.0 * 1.0 * 3.0);
+        for (std::size_t k = 0; k < n; ++k) {
+          max_abs = std::max(max_abs, std::abs(x(k)));
+          sum += x(k) * x(k);
+        }
+        sum_of_squares_result<Scalar> init{Scalar(1.0), Scalar(3.0)};
+        auto result = vector_sum_of_squares(x, init);
+        EXPECT_EQ(result.scaling_factor, max_abs) << "offset " << offset << ", n " << n;
+        EXPECT_NEAR(result.scaling_factor * result.scaling_factor * result.scaled_sum_of_squares,
+                    sum, tol * sum) << "offset " << offset << ", n " << n;
+      }
+    }
+
+    // Values whose squares would underflow or overflow take the
+    // generic loop, which uses Blue's algorithm.
+    for (Scalar magnitude : {std::numeric_limits<Scalar>::min() * Scalar(4.0),
+                             std::numeric_limits<Scalar>::max() / Scalar(64.0)}) {
+      std::vector<Scalar> storage(max_length, magnitude);
+      vector_t x(storage.data(), max_length);
+      const Scalar expected = magnitude * std::sqrt(Scalar(max_length));
+      EXPECT_NEAR(vector_two_norm(x), expected, tol * expected);
+    }
+
+    std::vector<Scalar> storage(max_length, Scalar(1.0));
+    storage[max_length / 2] = std::numeric_limits<Scalar>::infinity();
+    vector_t x(storage.data(), max_length);
+    EXPECT_EQ(vector_two_norm(x), std::numeric_limits<Scalar>::infinity());
+
+    std::fill(storage.begin(), storage.end(), Scalar{});
+    sum_of_squares_result<Scalar> init{Scalar(2.0), Scalar(5.0)};
+    auto result = vector_sum_of_squares(x, init);
+    EXPECT_EQ(result.scaling_factor, init.scaling_factor);
+    EXPECT_EQ(result.scaled_sum_of_squares, init.scaled_sum_of_squares);
+  }
+
+  TEST(BLAS1_simd_reductions, vector_sum_of_squares)
+  {
+    test_sum_of_squares<double>();
+    test_sum_of_squares<float>();
+  }
+
+  // dot peels scaled_accessor and conjugated_accessor off its
+  // arguments, and applies the scaling factors once.
+  TEST(BLAS1_simd_reductions, scaled_dot)
+  {
+    using LinearAlgebra::conjugated;
+    using LinearAlgebra::scaled;
+    using vector_t = mdspan<double, vector_extents_t>;
+    using scaled_t = decltype(scaled(2.0, std::declval<vector_t>()));
+    using conjugated_t = decltype(conjugated(std::declval<scaled_t>()));
+    static_assert(LinearAlgebra::impl::use_simd_dot_v<scaled_t, conjugated_t, double>);
+    using float_scaled_t = decltype(scaled(2.0, std::declval<mdspan<float, vector_extents_t>>()));
+    static_assert(! LinearAlgebra::impl::use_simd_dot_v<float_scaled_t, vector_t, double>);
+
+    auto x_storage = test_storage<double>(max_length, 1);
+    auto y_storage = test_storage<double>(max_length, 2);
+    for (std::size_t n = 0; n <= max_length; n += 7) {
+      vector_t x(x_storage.data(), n);
+      vector_t y(y_storage.data(), n);
+      auto x_scaled = scaled(-3.0, x);
+      auto y_scaled = conjugated(scaled(0.5, scaled(2.0, y)));
+      double expected = 1.0;
+      for (std::size_t k = 0; k < n; ++k) {
+        expected += x_scaled(k) * y_scaled(k);
+      }
+      EXPECT_EQ(dot(x_scaled, y_scaled, 1.0), expected) << "n " << n;
+      EXPECT_EQ(dot(x, y_scaled, 1.0), dot(x, y, 1.0)) << "n " << n;
+    }
+  }
+
+  TEST(BLAS1_simd_reductions, long_vectors)
+  {
+    // Long enough for the kernels' unrolled main loops to dominate.
+    for (std::size_t n : {1000, 1001, 4099}) {
+      auto x_storage = test_storage<double>(n, 1);
+      auto y_storage = test_storage<double>(n, 2);
+      mdspan<double, vector_extents_t> x(x_storage.data(), n);
+      mdspan<double, vector_extents_t> y(y_storage.data(), n);
+      double expected_dot = 0.0;
+      double expected_abs_sum = 0.0;
+      std::size_t expected_idx = 0;
+      for (std::size_t k = 0; k < n; ++k) {
+        expected_dot += x(k) * y(k);
+        expected_abs_sum += std::abs(x(k));
+        if (std::abs(x(expected_idx)) < std::abs(x(k))) {
+          expected_idx = k;
+        }
+      }
+      EXPECT_EQ(dot(x, y), expected_dot);
+      EXPECT_EQ(vector_abs_sum(x), expected_abs_sum);
+      EXPECT_EQ(vector_idx_abs_max(x), expected_idx);
+    }
+  }
+
+} // end anonymous namespace
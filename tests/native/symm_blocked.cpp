@@ -0,0 +1,213 @@
+#include "./gtest_fixtures.hpp"
+
+// Exercise the blocked symmetric and Hermitian matrix products with
+// problem sizes that cross the engine's diagonal-block boundaries,
+// for both triangles, both sides, the overwriting and updating
+// overloads, and every strided layout the engine accepts.
+
+namespace {
+  using LinearAlgebra::conjugated;
+  using LinearAlgebra::hermitian_matrix_product;
+  using LinearAlgebra::lower_triangle;
+  using LinearAlgebra::scaled;
+  using LinearAlgebra::symmetric_matrix_product;
+  using LinearAlgebra::upper_triangle;
+
+  using extents_t = extents<std::size_t, dynamic_extent, dynamic_extent>;
+
+  // Fill A's triangle, including its diagonal, with small integers,
+  // so that every intermediate result is exactly representable.  A
+  // Hermitian matrix's diagonal keeps a nonzero imaginary part, which
+  // the product must ignore.  NaN in the other triangle catches reads
+  // from it.
+  template<class Triangle, class MatrixType>
+  void fill_triangle(MatrixType A)
+  {
+    using value_type = typename MatrixType::value_type;
+    constexpr bool lower = std::is_same_v<Triangle, LinearAlgebra::lower_triangle_t>;
+    for (std::size_t j = 0; j < A.extent(1); ++j) {
+      for (std::size_t i = 0; i < A.extent(0); ++i) {
+        A(i,j) = (i == j || lower == (i > j)) ?
+          test_value<value_type>(i, j, 1) : poison_value<value_type>();
+      }
+    }
+  }
+
+  // Element (i,j) of the full matrix whose Triangle A stores.
+  template<bool Hermitian, class Triangle, class MatrixType>
+  typename MatrixType::value_type
+  full_element(MatrixType A, std::size_t i, std::size_t j)
+  {
+    using value_type = typename MatrixType::value_type;
+    constexpr bool lower = std::is_same_v<Triangle, LinearAlgebra::lower_triangle_t>;
+    if (i == j) {
+      if constexpr (Hermitian) {
+        return value_type(LinearAlgebra::impl::real_if_needed(A(i,i)));
+      }
+      else {
+        return A(i,i);
+      }
+    }
+    if (lower == (i > j)) {
+      return A(i,j);
+    }
+    if constexpr (Hermitian) {
+      return value_type(LinearAlgebra::impl::conj_if_needed(A(j,i)));
+    }
+    else {
+      return A(j,i);
+    }
+  }
+
+  template<bool Hermitian, class... Args>
+  void product(Args... args)
+  {
+    if constexpr (Hermitian) {
+      hermitian_matrix_product(args...);
+    }
+    else {
+      symmetric_matrix_product(args...);
+    }
+  }
+
+  // C = A * B (left) or B * A (right), then C = E + A * B or E + B * A
+  // with separate E and with E = C.  A is n x n, and B and C are
+  // n x num_cols (left) or num_cols x n (right).
+  template<bool Hermitian, class Scalar, class Layout_A, class Layout_B, class Layout_C,
+           class Triangle>
+  void test_blocked_symm(Triangle t, std::size_t n, std::size_t num_cols)
+  {
+    using A_t = mdspan<Scalar, extents_t, Layout_A>;
+    using B_t = mdspan<Scalar, extents_t, Layout_B>;
+    using C_t = mdspan<Scalar, extents_t, Layout_C>;
+    static_assert(LinearAlgebra::impl::is_symm_blockable_v<A_t, B_t, C_t>);
+
+    std::vector<Scalar> A_storage(n * n);
+    A_t A(A_storage.data(), n, n);
+    fill_triangle<Triangle>(A);
+    auto A_elt = [&] (std::size_t i, std::size_t j) {
+      return full_element<Hermitian, Triangle>(A, i, j);
+    };
+
+    for (bool left : {true, false}) {
+      const std::size_t num_rows = left ? n : num_cols;
+      const std::size_t num_C_cols = left ? num_cols : n;
+      std::vector<Scalar> B_storage(num_rows * num_C_cols);
+      std::vector<Scalar> E_storage(num_rows * num_C_cols);
+      std::vector<Scalar> C_storage(num_rows * num_C_cols, poison_value<Scalar>());
+      B_t B(B_storage.data(), num_rows, num_C_cols);
+      C_t E(E_storage.data(), num_rows, num_C_cols);
+      C_t C(C_storage.data(), num_rows, num_C_cols);
+      fill_test_values(B, 2);
+      fill_test_values(E, 3);
+
+      auto expected = [&] (std::size_t i, std::size_t j) {
+        Scalar sum{};
+        for (std::size_t k = 0; k < n; ++k) {
+          sum += left ? A_elt(i, k) * B(k,j) : B(i,k) * A_elt(k, j);
+        }
+        return sum;
+      };
+      auto check = [&] (const char* what, auto start) {
+        for (std::size_t j = 0; j < num_C_cols; ++j) {
+          for (std::size_t i = 0; i < num_rows; ++i) {
+            EXPECT_EQ(C(i,j), start(i,j) + expected(i,j))
+              << (left ? "left" : "right") << " " << what << ", at (" << i << "," << j << ")";
+          }
+        }
+      };
+      auto zero = [] (std::size_t, std::size_t) { return Scalar{}; };
+
+      if (left) {
+        product<Hermitian>(A, t, B, C);
+        check("overwrite", zero);
+        product<Hermitian>(A, t, B, E, C);
+        check("update", [&] (std::size_t i, std::size_t j) { return E(i,j); });
+        product<Hermitian>(A, t, B, E, E);
+      }
+      else {
+        product<Hermitian>(B, A, t, C);
+        check("overwrite", zero);
+        product<Hermitian>(B, A, t, E, C);
+        check("update", [&] (std::size_t i, std::size_t j) { return E(i,j); });
+        product<Hermitian>(B, A, t, E, E);
+      }
+      // E = E + A * B, in place; C still holds E + A * B.
+      for (std::size_t j = 0; j < num_C_cols; ++j) {
+        for (std::size_t i = 0; i < num_rows; ++i) {
+          EXPECT_EQ(E(i,j), C(i,j)) << (left ? "left" : "right")
+            << " in-place update, at (" << i << "," << j << ")";
+        }
+      }
+    }
+  }
+
+  template<bool Hermitian, class Scalar, class Layout_A, class Layout_B, class Layout_C>
+  void test_both_triangles(std::size_t n, std::size_t num_cols)
+  {
+    test_blocked_symm<Hermitian, Scalar, Layout_A, Layout_B, Layout_C>(lower_triangle, n, num_cols);
+    test_blocked_symm<Hermitian, Scalar, Layout_A, Layout_B, Layout_C>(upper_triangle, n, num_cols);
+  }
+
+  TEST(BLAS3_symm_blocked, crosses_block_boundaries)
+  {
+    // nb is 128 for double and 64 for complex<double>.
+    for (std::size_t n : {1, 5, 127, 128, 129, 300}) {
+      for (std::size_t num_cols : {1, 6, 17}) {
+        test_both_triangles<false, double, layout_left, layout_left, layout_left>(n, num_cols);
+      }
+    }
+    for (std::size_t n : {1, 63, 64, 65, 150}) {
+      test_both_triangles<false, std::complex<double>, layout_left, layout_left, layout_left>(n, 7);
+      test_both_triangles<true, std::complex<double>, layout_left, layout_left, layout_left>(n, 7);
+    }
+  }
+
+  TEST(BLAS3_symm_blocked, layouts)
+  {
+    test_both_triangles<false, double, layout_right, layout_right, layout_right>(140, 9);
+    test_both_triangles<false, double, layout_left, layout_right, layout_left>(131, 6);
+    test_both_triangles<false, float, layout_right, layout_left, layout_right>(70, 5);
+    test_both_triangles<true, double, layout_right, layout_left, layout_left>(133, 4);
+    test_both_triangles<true, std::complex<double>, layout_right, layout_right, layout_left>(90, 11);
+  }
+
+  TEST(BLAS3_symm_blocked, degenerate_extents)
+  {
+    test_both_triangles<false, double, layout_left, layout_left, layout_left>(0, 3);
+    test_both_triangles<true, std::complex<double>, layout_left, layout_left, layout_left>(5, 0);
+  }
+
+  TEST(BLAS3_symm_blocked, scaled_and_conjugated)
+  {
+    // The engine peels B's scaling factor and conjugation.
+    using Scalar = std::complex<double>;
+    constexpr std::size_t n = 80, num_cols = 6;
+    const Scalar alpha(2.0, -1.0);
+    std::vector<Scalar> A_storage(n * n), B_storage(n * num_cols), C_storage(n * num_cols);
+    mdspan<Scalar, extents_t> A(A_storage.data(), n, n);
+    mdspan<Scalar, extents_t> B(B_storage.data(), n, num_cols);
+    mdspan<Scalar, extents_t> C(C_storage.data(), n, num_cols);
+    fill_triangle<LinearAlgebra::upper_triangle_t>(A);
+    fill_test_values(B, 2);
+
+    auto B_op = scaled(alpha, conjugated(B));
+    static_assert(LinearAlgebra::impl::is_symm_blockable_v<
+      decltype(A), decltype(B_op), decltype(C)>);
+    hermitian_matrix_product(A, upper_triangle, B_op, C);
+    for (std::size_t j = 0; j < num_cols; ++j) {
+      for (std::size_t i = 0; i < n; ++i) {
+        Scalar expected{};
+        for (std::size_t k = 0; k < n; ++k) {
+          expected += full_element<true, LinearAlgebra::upper_triangle_t>(A, i, k) * B_op(k,j);
+        }
+        EXPECT_EQ(C(i,j), expected) << "at (" << i << "," << j << ")";
+      }
+    }
+
+    // A's accessor is not peeled; such products run the generic loops.
+    static_assert(! LinearAlgebra::impl::is_symm_blockable_v<
+      decltype(scaled(alpha, A)), decltype(B), decltype(C)>);
+  }
+
+} // end anonymous namespace
@@ -0,0 +1,220 @@
+#include "./gtest_fixtures.hpp"
+
+// Exercise the blocked symmetric and Hermitian matrix-vector products
+// with problem sizes that cross the engine's column groups, for both
+// triangles and for column-major, row-major, and strided matrices.
+// Small integers keep every sum exact, so the results must match
+// exactly.
+
+namespace {
+  using LinearAlgebra::conjugated;
+  using LinearAlgebra::hermitian_matrix_vector_product;
+  using LinearAlgebra::lower_triangle;
+  using LinearAlgebra::scaled;
+  using LinearAlgebra::symmetric_matrix_vector_product;
+  using LinearAlgebra::upper_triangle;
+
+  using matrix_extents_t = extents<std::size_t, dynamic_extent, dynamic_extent>;
+  using vector_extents_t = extents<std::size_t, dynamic_extent>;
+
+  template<class Triangle>
+  bool in_triangle(std::size_t i, std::size_t j)
+  {
+    return std::is_same_v<Triangle, LinearAlgebra::lower_triangle_t> ? i >= j : i <= j;
+  }
+
+  // A's triangle holds test values, its other triangle NaN, so that
+  // reads outside the triangle show up.
+  template<class Triangle, class A_t>
+  void fill_triangle(A_t A)
+  {
+    using value_type = typename A_t::value_type;
+    for (std::size_t j = 0; j < A.extent(1); ++j) {
+      for (std::size_t i = 0; i < A.extent(0); ++i) {
+        A(i,j) = in_triangle<Triangle>(i, j) ? test_value<value_type>(i, j, 1) :
+          poison_value<value_type>();
+      }
+    }
+  }
+
+  template<class VectorType>
+  void fill_vector(VectorType x, std::size_t seed)
+  {
+    using value_type = typename VectorType::value_type;
+    for (std::size_t i = 0; i < x.extent(0); ++i) {
+      x(i) = test_value<value_type>(i, 0, seed);
+    }
+  }
+
+  // The full matrix's (i,j) entry, from the stored triangle.
+  template<bool Hermitian, class Triangle, class A_t>
+  typename A_t::value_type full_entry(A_t A, std::size_t i, std::size_t j)
+  {
+    using value_type = typename A_t::value_type;
+    if (i == j) {
+      return Hermitian ? value_type(LinearAlgebra::impl::real_if_needed(A(i,i))) : A(i,i);
+    }
+    if (in_triangle<Triangle>(i, j)) {
+      return A(i,j);
+    }
+    return Hermitian ? value_type(LinearAlgebra::impl::conj_if_needed(A(j,i))) : A(j,i);
+  }
+
+  // Check that y(i) = start(i) + (A * x)(i).
+  template<bool Hermitian, class Triangle, class A_t, class x_t, class y_t, class Start>
+  void check_product(const char* what, A_t A, x_t x, y_t y, const Start& start)
+  {
+    using value_type = typename y_t::value_type;
+    for (std::size_t i = 0; i < A.extent(0); ++i) {
+      value_type expected = start(i);
+      for (std::size_t j = 0; j < A.extent(1); ++j) {
+        expected += full_entry<Hermitian, Triangle>(A, i, j) * value_type(x(j));
+      }
+      EXPECT_EQ(y(i), expected) << what << ", at " << i;
+    }
+  }
+
+  template<bool Hermitian, class... Args>
+  void product(Args... args)
+  {
+    if constexpr (Hermitian) {
+      hermitian_matrix_vector_product(args...);
+    }
+    else {
+      symmetric_matrix_vector_product(args...);
+    }
+  }
+
+  // y = A * x and z = y + A * x, including in place (z = y).
+  template<bool Hermitian, class Triangle, class A_t>
+  void test_product(A_t A, Triangle t)
+  {
+    using Scalar = typename A_t::value_type;
+    using vector_t = mdspan<Scalar, vector_extents_t>;
+    static_assert(LinearAlgebra::impl::is_symv_blockable_v<A_t, vector_t, vector_t>);
+    const std::size_t n = A.extent(0);
+    std::vector<Scalar> x_storage(n), y_storage(n, Scalar(7)), z_storage(n);
+    vector_t x(x_storage.data(), n);
+    vector_t y(y_storage.data(), n);
+    vector_t z(z_storage.data(), n);
+    fill_triangle<Triangle>(A);
+    fill_vector(x, 2);
+
+    product<Hermitian>(A, t, x, y);
+    check_product<Hermitian, Triangle>("overwrite", A, x, y,
+      [] (std::size_t) { return Scalar{}; });
+
+    fill_vector(y, 3);
+    product<Hermitian>(A, t, x, y, z);
+    check_product<Hermitian, Triangle>("update", A, x, z,
+      [&] (std::size_t i) { return y(i); });
+
+    std::vector<Scalar> y_orig(y_storage);
+    product<Hermitian>(A, t, x, y, y);
+    check_product<Hermitian, Triangle>("in-place update", A, x, y,
+      [&] (std::size_t i) { return y_orig[i]; });
+  }
+
+  template<bool Hermitian, class Scalar, class Layout>
+  void test_layout(std::size_t n)
+  {
+    std::vector<Scalar> A_storage(n * n);
+    mdspan<Scalar, matrix_extents_t, Layout> A(A_storage.data(), n, n);
+    test_product<Hermitian>(A, lower_triangle);
+    test_product<Hermitian>(A, upper_triangle);
+  }
+
+  // Matrices with no unit stride cannot go to an external BLAS, so
+  // they always reach the engine.
+  template<bool Hermitian, class Scalar>
+  void test_strided(std::size_t n, std::size_t stride0, std::size_t stride1)
+  {
+    std::vector<Scalar> A_storage(n == 0 ? 0 : (n - 1) * (stride0 + stride1) + 1);
+    using mapping_t = layout_stride::mapping<matrix_extents_t>;
+    mdspan<Scalar, matrix_extents_t, layout_stride> A(A_storage.data(),
+      mapping_t(matrix_extents_t(n, n), std::array<std::size_t, 2>{stride0, stride1}));
+    test_product<Hermitian>(A, lower_triangle);
+    test_product<Hermitian>(A, upper_triangle);
+  }
+
+  TEST(BLAS2_symv_blocked, crosses_block_boundaries)
+  {
+    // Column groups are 4 wide.
+    for (std::size_t n : {1, 2, 3, 4, 5, 7, 8, 9, 12, 13, 100}) {
+      test_strided<false, double>(n, 2, 2 * n);
+      test_strided<false, double>(n, 2 * n, 2);
+      test_strided<true, std::complex<double>>(n, 2, 2 * n);
+      test_strided<true, std::complex<double>>(n, 2 * n, 2);
+      test_strided<false, std::complex<double>>(n, 2 * n, 2);
+    }
+  }
+
+  TEST(BLAS2_symv_blocked, layouts)
+  {
+    test_layout<false, double, layout_left>(37);
+    test_layout<false, double, layout_right>(37);
+    test_layout<false, float, layout_left>(21);
+    test_layout<true, std::complex<double>, layout_left>(30);
+    test_layout<true, std::complex<double>, layout_right>(30);
+    test_layout<true, double, layout_right>(11);
+    test_strided<true, std::complex<double>>(0, 1, 1);
+  }
+
+  // An external BLAS takes contiguous real matrices, so call the
+  // engine directly to test its vector kernel.
+  template<bool Hermitian, class Scalar, class Layout, class Triangle>
+  void test_vector_kernel(std::size_t n, Triangle)
+  {
+    std::vector<Scalar> A_storage(n * n), x_storage(n), y_storage(n);
+    mdspan<Scalar, matrix_extents_t, Layout> A(A_storage.data(), n, n);
+    mdspan<Scalar, vector_extents_t> x(x_storage.data(), n);
+    mdspan<Scalar, vector_extents_t> y(y_storage.data(), n);
+    fill_triangle<Triangle>(A);
+    fill_vector(x, 2);
+    fill_vector(y, 3);
+    const std::vector<Scalar> y_orig(y_storage);
+    LinearAlgebra::impl::blocked_symv<Hermitian, Triangle>(A, x, y,
+      [&] (std::size_t i) { return y(i); });
+    check_product<Hermitian, Triangle>("vector kernel", A, x, y,
+      [&] (std::size_t i) { return y_orig[i]; });
+  }
+
+  TEST(BLAS2_symv_blocked, vector_kernel)
+  {
+    // Vectors hold 2 to 16 elements; rows past the last whole vector
+    // take the scalar tail.
+    for (std::size_t n : {1, 5, 16, 17, 31, 33, 70}) {
+      test_vector_kernel<false, double, layout_left>(n, lower_triangle);
+      test_vector_kernel<false, double, layout_left>(n, upper_triangle);
+      test_vector_kernel<true, double, layout_right>(n, lower_triangle);
+      test_vector_kernel<false, float, layout_right>(n, upper_triangle);
+    }
+  }
+
+  TEST(BLAS2_symv_blocked, scaled_and_conjugated_x)
+  {
+    // The engine peels x's scaling factor and conjugation.
+    using Scalar = std::complex<double>;
+    constexpr std::size_t n = 23;
+    std::vector<Scalar> A_storage(n * n), x_storage(n), y_storage(n);
+    mdspan<Scalar, matrix_extents_t, layout_left> A(A_storage.data(), n, n);
+    mdspan<Scalar, vector_extents_t> x(x_storage.data(), n);
+    mdspan<Scalar, vector_extents_t> y(y_storage.data(), n);
+    fill_triangle<LinearAlgebra::upper_triangle_t>(A);
+    fill_vector(x, 2);
+
+    auto x_op = conjugated(scaled(Scalar(-1.0, 3.0), x));
+    static_assert(LinearAlgebra::impl::is_symv_blockable_v<decltype(A), decltype(x_op), decltype(y)>);
+    hermitian_matrix_vector_product(A, upper_triangle, x_op, y);
+    check_product<true, LinearAlgebra::upper_triangle_t>("Hermitian", A, x_op, y,
+      [] (std::size_t) { return Scalar{}; });
+    symmetric_matrix_vector_product(A, upper_triangle, x_op, y);
+    check_product<false, LinearAlgebra::upper_triangle_t>("symmetric", A, x_op, y,
+      [] (std::size_t) { return Scalar{}; });
+
+    // A scaled or conjugated matrix takes the generic loops.
+    static_assert(! LinearAlgebra::impl::is_symv_blockable_v<
+      decltype(scaled(Scalar(2.0), A)), decltype(x), decltype(y)>);
+  }
+
+} // end anonymous namespace
@@ -0,0 +1,201 @@
+#include "./gtest_fixtures.hpp"
+
+// Exercise the blocked symmetric and Hermitian rank-2 update with
+// problem sizes that cross its column groups, for both triangles,
+// with column-major, row-major, and strided matrices, through the
+// engine directly and through the overwriting and updating
+// algorithms, serially and on the thread pool.
+
+namespace {
+  using LinearAlgebra::conjugated;
+  using LinearAlgebra::hermitian_matrix_rank_2_update;
+  using LinearAlgebra::lower_triangle;
+  using LinearAlgebra::scaled;
+  using LinearAlgebra::symmetric_matrix_rank_2_update;
+  using LinearAlgebra::thread_pool_exec;
+  using LinearAlgebra::upper_triangle;
+
+  using matrix_extents_t = extents<std::size_t, dynamic_extent, dynamic_extent>;
+  using vector_extents_t = extents<std::size_t, dynamic_extent>;
+
+  // Test data are small integers, so the update is exact.  The
+  // entries outside Triangle must keep their values.
+  template<bool Hermitian, class Scalar, class Triangle>
+  void test_update(std::size_t n, storage s_A, storage s_E, Triangle t)
+  {
+    constexpr bool lower = std::is_same_v<Triangle, LinearAlgebra::lower_triangle_t>;
+    std::vector<Scalar> x_storage(n), y_storage(2 * n);
+    for (std::size_t i = 0; i < n; ++i) {
+      x_storage[i] = test_value<Scalar>(i, 0, 1);
+    }
+    for (std::size_t i = 0; i < 2 * n; ++i) {
+      y_storage[i] = test_value<Scalar>(i, 0, 2);
+    }
+    mdspan<Scalar, vector_extents_t> x(x_storage.data(), n);
+    mdspan<Scalar, vector_extents_t, layout_stride> y(y_storage.data(),
+      layout_stride::mapping<vector_extents_t>(vector_extents_t(n), std::array<std::size_t, 1>{2}));
+    static_assert(LinearAlgebra::impl::is_syr2_blockable_v<decltype(x), decltype(y),
+      mdspan<Scalar, matrix_extents_t, layout_stride>>);
+
+    const test_matrix<Scalar> E(n, n, s_E, 3);
+    auto conj_h = [] (Scalar v) {
+      return Hermitian ? Scalar(LinearAlgebra::impl::conj_if_needed(v)) : v;
+    };
+    auto check = [&] (auto A, bool from_E, const char* what) {
+      for (std::size_t j = 0; j < n; ++j) {
+        for (std::size_t i = 0; i < n; ++i) {
+          if (i != j && lower != (i > j)) {
+            EXPECT_EQ(A(i,j), test_value<Scalar>(i, j, 4)) << what << ", outside the triangle at ("
+              << i << "," << j << ")";
+            continue;
+          }
+          Scalar start{};
+          if (from_E) {
+            start = Hermitian && i == j ?
+              Scalar(LinearAlgebra::impl::real_if_needed(E.A(i,j))) : Scalar(E.A(i,j));
+          }
+          const Scalar expected = start + (x(i) * conj_h(y(j)) + y(i) * conj_h(x(j)));
+          EXPECT_EQ(A(i,j), expected) << what << ", at (" << i << "," << j << ")";
+        }
+      }
+    };
+    // A starts out as E in the triangle, so that the nonoverwriting
+    // update of A gives E + x y^* + y x^* in either build.
+    auto make_A = [&] {
+      test_matrix<Scalar> A(n, n, s_A, 4);
+      for (std::size_t j = 0; j < n; ++j) {
+        for (std::size_t i = 0; i < n; ++i) {
+          if (i == j || lower == (i > j)) {
+            A.A(i,j) = E.A(i,j);
+          }
+        }
+      }
+      return A;
+    };
+
+    for (bool overwrite : {false, true}) {
+      test_matrix<Scalar> A = make_A();
+      if (overwrite) {
+        LinearAlgebra::impl::blocked_syr2<Hermitian, true, Triangle>(x, y,
+          LinearAlgebra::impl::make_strided_matrix_view(A.A).as_const(), A.A);
+      }
+      else {
+        LinearAlgebra::impl::blocked_syr2<Hermitian, false, Triangle>(x, y,
+          LinearAlgebra::impl::make_strided_matrix_view(E.A).as_const(), A.A);
+      }
+      check(A.A, ! overwrite, overwrite ? "blocked_syr2, overwriting" : "blocked_syr2");
+    }
+
+    for (bool parallel : {false, true}) {
+      test_matrix<Scalar> A = make_A();
+      if constexpr (Hermitian) {
+        if (parallel) {
+          hermitian_matrix_rank_2_update(thread_pool_exec{}, x, y, A.A, t);
+        }
+        else {
+          hermitian_matrix_rank_2_update(x, y, A.A, t);
+        }
+      }
+      else {
+        if (parallel) {
+          symmetric_matrix_rank_2_update(thread_pool_exec{}, x, y, A.A, t);
+        }
+        else {
+          symmetric_matrix_rank_2_update(x, y, A.A, t);
+        }
+      }
+#if defined(LINALG_FIX_RANK_UPDATES)
+      check(A.A, false, "rank_2_update");
+
+      if constexpr (Hermitian) {
+        if (parallel) {
+          hermitian_matrix_rank_2_update(thread_pool_exec{}, x, y, E.A, A.A, t);
+        }
+        else {
+          hermitian_matrix_rank_2_update(x, y, E.A, A.A, t);
+        }
+      }
+      else {
+        if (parallel) {
+          symmetric_matrix_rank_2_update(thread_pool_exec{}, x, y, E.A, A.A, t);
+        }
+        else {
+          symmetric_matrix_rank_2_update(x, y, E.A, A.A, t);
+        }
+      }
+      check(A.A, true, "updating rank_2_update");
+#else
+      check(A.A, true, "rank_2_update");
+#endif // LINALG_FIX_RANK_UPDATES
+    }
+  }
+
+  template<class Scalar>
+  void test_all(std::size_t n, storage s_A, storage s_E)
+  {
+    test_update<false, Scalar>(n, s_A, s_E, lower_triangle);
+    test_update<false, Scalar>(n, s_A, s_E, upper_triangle);
+    test_update<true, Scalar>(n, s_A, s_E, lower_triangle);
+    test_update<true, Scalar>(n, s_A, s_E, upper_triangle);
+  }
+
+  TEST(BLAS2_syr2_blocked, crosses_group_boundaries)
+  {
+    // Column groups have 4 columns.
+    for (std::size_t n : {1, 2, 3, 4, 5, 7, 8, 9, 33, 100}) {
+      test_all<double>(n, storage::column_major, storage::row_major);
+      test_all<double>(n, storage::row_major, storage::column_major);
+      test_all<double>(n, storage::strided, storage::strided);
+    }
+  }
+
+  TEST(BLAS2_syr2_blocked, layouts_and_types)
+  {
+    test_all<float>(70, storage::column_major, storage::column_major);
+    test_all<float>(70, storage::row_major, storage::strided);
+    test_all<std::complex<double>>(41, storage::column_major, storage::strided);
+    test_all<std::complex<double>>(41, storage::row_major, storage::row_major);
+    test_all<std::complex<double>>(30, storage::strided, storage::column_major);
+    test_all<double>(0, storage::column_major, storage::column_major);
+  }
+
+  TEST(BLAS2_syr2_blocked, scaled_vectors)
+  {
+    // The engine peels the vectors' scaling factors and conjugations.
+    using Scalar = std::complex<double>;
+    constexpr std::size_t n = 23;
+    std::vector<Scalar> x_storage(n), y_storage(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      x_storage[i] = test_value<Scalar>(i, 0, 5);
+      y_storage[i] = test_value<Scalar>(i, 0, 6);
+    }
+    mdspan<Scalar, vector_extents_t> x(x_storage.data(), n);
+    mdspan<Scalar, vector_extents_t> y(y_storage.data(), n);
+    auto x_op = scaled(Scalar(2.0), x);
+    auto y_op = conjugated(y);
+    test_matrix<Scalar> A(n, n, storage::row_major, 7);
+    test_matrix<Scalar> A_ref(n, n, storage::row_major, 7);
+    static_assert(LinearAlgebra::impl::is_syr2_blockable_v<
+      decltype(x_op), decltype(y_op), decltype(A.A)>);
+
+    hermitian_matrix_rank_2_update(x_op, y_op, A.A, lower_triangle);
+    for (std::size_t j = 0; j < n; ++j) {
+      for (std::size_t i = j; i < n; ++i) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+        const Scalar start{};
+#else
+        const Scalar start = i == j ? Scalar(std::real(A_ref.A(i,j))) : Scalar(A_ref.A(i,j));
+#endif // LINALG_FIX_RANK_UPDATES
+        const Scalar x_i = 2.0 * x(i), x_j = 2.0 * x(j);
+        const Scalar y_i = std::conj(y(i)), y_j = std::conj(y(j));
+        const Scalar expected = start + (x_i * std::conj(y_j) + y_i * std::conj(x_j));
+        EXPECT_EQ(A.A(i,j), expected) << "at (" << i << "," << j << ")";
+      }
+    }
+
+    // A scaled or conjugated matrix takes the generic loops.
+    static_assert(! LinearAlgebra::impl::is_syr2_blockable_v<
+      decltype(x), decltype(y), decltype(conjugated(A.A))>);
+  }
+
+} // end anonymous namespace
@@ -0,0 +1,223 @@
+#include "./gtest_fixtures.hpp"
+
+// Exercise the blocked symmetric and Hermitian rank-k updates with
+// problem sizes that cross the engine's tile and recursion
+// boundaries, for both triangles, with and without E, and every
+// strided layout the engine accepts.
+
+namespace {
+  using LinearAlgebra::conjugated;
+  using LinearAlgebra::hermitian_matrix_rank_k_update;
+  using LinearAlgebra::lower_triangle;
+  using LinearAlgebra::scaled;
+  using LinearAlgebra::symmetric_matrix_rank_k_update;
+  using LinearAlgebra::upper_triangle;
+
+  using extents_t = extents<std::size_t, dynamic_extent, dynamic_extent>;
+
+  template<class Scalar>
+  bool is_nan(const Scalar& x)
+  {
+    using std::isnan;
+    return isnan(LinearAlgebra::impl::real_if_needed(x));
+  }
+
+  template<bool Hermitian, class... Args>
+  void rank_k_update(Args... args)
+  {
+    if constexpr (Hermitian) {
+      hermitian_matrix_rank_k_update(args...);
+    }
+    else {
+      symmetric_matrix_rank_k_update(args...);
+    }
+  }
+
+  template<class Triangle>
+  bool in_triangle(std::size_t i, std::size_t j)
+  {
+    return std::is_same_v<Triangle, LinearAlgebra::lower_triangle_t> ? i >= j : i <= j;
+  }
+
+  // Check that C's triangle is start(i,j) + alpha * A * A^T, and that
+  // C's other triangle still holds NaN.
+  template<bool Hermitian, class Triangle, class Scalar, class C_t, class A_t, class Start>
+  void check_update(const char* what, C_t C, Scalar alpha, A_t A, const Start& start)
+  {
+    const std::size_t n = C.extent(0);
+    for (std::size_t j = 0; j < n; ++j) {
+      for (std::size_t i = 0; i < n; ++i) {
+        if (! in_triangle<Triangle>(i, j)) {
+          EXPECT_TRUE(is_nan(C(i,j))) << what << ", outside the triangle at ("
+                                      << i << "," << j << ")";
+          continue;
+        }
+        Scalar sum{};
+        for (std::size_t k = 0; k < A.extent(1); ++k) {
+          if constexpr (Hermitian) {
+            sum += A(i,k) * LinearAlgebra::impl::conj_if_needed(A(j,k));
+          }
+          else {
+            sum += A(i,k) * A(j,k);
+          }
+        }
+        EXPECT_EQ(C(i,j), start(i,j) + alpha * sum) << what << ", at (" << i << "," << j << ")";
+      }
+    }
+  }
+
+  // C's triangle holds test values, its other triangle NaN, so that
+  // writes outside the triangle show up.
+  template<class Triangle, class C_t>
+  void fill_triangle(C_t C, std::size_t seed)
+  {
+    using value_type = typename C_t::value_type;
+    for (std::size_t j = 0; j < C.extent(1); ++j) {
+      for (std::size_t i = 0; i < C.extent(0); ++i) {
+        C(i,j) = in_triangle<Triangle>(i, j) ?
+          test_value<value_type>(i, j, seed) : poison_value<value_type>();
+      }
+    }
+  }
+
+  template<bool Hermitian, class Scalar, class Layout_A, class Layout_C, class Triangle>
+  void test_blocked_syrk(Triangle t, std::size_t n, std::size_t k)
+  {
+    using A_t = mdspan<Scalar, extents_t, Layout_A>;
+    using C_t = mdspan<Scalar, extents_t, Layout_C>;
+    static_assert(LinearAlgebra::impl::is_syrk_blockable_v<A_t, C_t>);
+
+    std::vector<Scalar> A_storage(n * k);
+    std::vector<Scalar> C_storage(n * n);
+    std::vector<Scalar> C_orig_storage(n * n);
+    A_t A(A_storage.data(), n, k);
+    C_t C(C_storage.data(), n, n);
+    C_t C_orig(C_orig_storage.data(), n, n);
+    fill_test_values(A, 1);
+    fill_triangle<Triangle>(C_orig, 2);
+    const Scalar alpha(-2);
+
+    // The diagonal of a Hermitian matrix is real.
+    auto start_from = [] (auto M) {
+      return [=] (std::size_t i, std::size_t j) {
+        return Hermitian && i == j ? Scalar(LinearAlgebra::impl::real_if_needed(M(i,j))) : M(i,j);
+      };
+    };
+
+    std::copy(C_orig_storage.begin(), C_orig_storage.end(), C_storage.begin());
+    rank_k_update<Hermitian>(alpha, A, C, t);
+#if defined(LINALG_FIX_RANK_UPDATES)
+    check_update<Hermitian, Triangle>("overwrite", C, alpha, A,
+      [] (std::size_t, std::size_t) { return Scalar{}; });
+#else
+    check_update<Hermitian, Triangle>("update", C, alpha, A, start_from(C_orig));
+#endif // LINALG_FIX_RANK_UPDATES
+
+    std::copy(C_orig_storage.begin(), C_orig_storage.end(), C_storage.begin());
+    rank_k_update<Hermitian>(A, C, t);
+#if defined(LINALG_FIX_RANK_UPDATES)
+    check_update<Hermitian, Triangle>("overwrite without alpha", C, Scalar(1), A,
+      [] (std::size_t, std::size_t) { return Scalar{}; });
+
+    // E = C_orig, and in place (E = C).
+    std::fill(C_storage.begin(), C_storage.end(), poison_value<Scalar>());
+    for (std::size_t j = 0; j < n; ++j) {
+      for (std::size_t i = 0; i < n; ++i) {
+        if (! in_triangle<Triangle>(i, j)) {
+          C_orig(i,j) = Scalar(7);
+        }
+      }
+    }
+    rank_k_update<Hermitian>(alpha, A, C_orig, C, t);
+    check_update<Hermitian, Triangle>("E", C, alpha, A, start_from(C_orig));
+
+    fill_triangle<Triangle>(C, 2);
+    rank_k_update<Hermitian>(A, C, C, t);
+    check_update<Hermitian, Triangle>("E = C", C, Scalar(1), A, start_from(C_orig));
+#else
+    check_update<Hermitian, Triangle>("update without alpha", C, Scalar(1), A, start_from(C_orig));
+#endif // LINALG_FIX_RANK_UPDATES
+  }
+
+  template<bool Hermitian, class Scalar, class Layout_A, class Layout_C>
+  void test_both_triangles(std::size_t n, std::size_t k)
+  {
+    test_blocked_syrk<Hermitian, Scalar, Layout_A, Layout_C>(lower_triangle, n, k);
+    test_blocked_syrk<Hermitian, Scalar, Layout_A, Layout_C>(upper_triangle, n, k);
+  }
+
+  TEST(BLAS3_syrk_blocked, crosses_block_boundaries)
+  {
+    // Tiles are 128 x 128 for double and 64 x 64 for complex<double>,
+    // and the recursion stops at 8 and 4 rows.
+    for (std::size_t n : {1, 7, 8, 9, 127, 128, 129, 300}) {
+      for (std::size_t k : {1, 5, 270}) {
+        test_both_triangles<false, double, layout_left, layout_left>(n, k);
+      }
+    }
+    for (std::size_t n : {1, 3, 63, 64, 65, 150}) {
+      test_both_triangles<false, std::complex<double>, layout_left, layout_left>(n, 9);
+      test_both_triangles<true, std::complex<double>, layout_left, layout_left>(n, 9);
+    }
+  }
+
+  TEST(BLAS3_syrk_blocked, layouts)
+  {
+    test_both_triangles<false, double, layout_right, layout_right>(140, 9);
+    test_both_triangles<false, double, layout_left, layout_right>(131, 6);
+    test_both_triangles<false, float, layout_right, layout_left>(70, 5);
+    test_both_triangles<true, double, layout_right, layout_left>(133, 4);
+    test_both_triangles<true, std::complex<double>, layout_right, layout_right>(90, 11);
+  }
+
+  TEST(BLAS3_syrk_blocked, degenerate_extents)
+  {
+    test_both_triangles<false, double, layout_left, layout_left>(0, 3);
+    test_both_triangles<true, std::complex<double>, layout_left, layout_left>(5, 0);
+  }
+
+  TEST(BLAS3_syrk_blocked, scaled_and_conjugated)
+  {
+    // The engine peels A's scaling factor and conjugation.
+    using Scalar = std::complex<double>;
+    constexpr std::size_t n = 80, k = 6;
+    std::vector<Scalar> A_storage(n * k), C_storage(n * n);
+    mdspan<Scalar, extents_t> A(A_storage.data(), n, k);
+    mdspan<Scalar, extents_t> C(C_storage.data(), n, n);
+    fill_test_values(A, 1);
+
+    const Scalar alpha(3.0, 0.0), beta(2.0, -1.0);
+    auto A_op = scaled(beta, conjugated(A));
+    static_assert(LinearAlgebra::impl::is_syrk_blockable_v<decltype(A_op), decltype(C)>);
+
+    fill_triangle<LinearAlgebra::upper_triangle_t>(C, 2);
+    std::vector<Scalar> C_orig(C_storage);
+    mdspan<Scalar, extents_t> C_start(C_orig.data(), n, n);
+    hermitian_matrix_rank_k_update(alpha.real(), A_op, C, upper_triangle);
+    check_update<true, LinearAlgebra::upper_triangle_t>("Hermitian", C, alpha, A_op,
+      [&] (std::size_t i, std::size_t j) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+        (void) i;
+        (void) j;
+        return Scalar{};
+#else
+        return i == j ? Scalar(C_start(i,j).real()) : C_start(i,j);
+#endif // LINALG_FIX_RANK_UPDATES
+      });
+
+    fill_triangle<LinearAlgebra::lower_triangle_t>(C, 2);
+    std::copy(C_storage.begin(), C_storage.end(), C_orig.begin());
+    symmetric_matrix_rank_k_update(alpha, A_op, C, lower_triangle);
+    check_update<false, LinearAlgebra::lower_triangle_t>("symmetric", C, alpha, A_op,
+      [&] (std::size_t i, std::size_t j) {
+#if defined(LINALG_FIX_RANK_UPDATES)
+        (void) i;
+        (void) j;
+        return Scalar{};
+#else
+        return C_start(i,j);
+#endif // LINALG_FIX_RANK_UPDATES
+      });
+  }
+
+} // end anonymous namespace
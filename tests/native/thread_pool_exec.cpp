@@ -0,0 +1,689 @@
+#include "./gtest_fixtures.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+
+// The native thread pool, and the algorithms' thread_pool_exec
+// overloads.  CMakeLists.txt runs this test with several threads.
+// The results must match the inline implementation's; small Gaussian
+// integers keep every partial sum exact, so the order of summation
+// does not matter.  Strided (non-unit stride) operands keep the
+// external BLAS out of the way.
+
+namespace {
+  using LinearAlgebra::thread_pool_exec;
+  using LinearAlgebra::impl::inline_exec_t;
+  using LinearAlgebra::impl::thread_pool;
+
+  TEST(thread_pool, parallel_for)
+  {
+    thread_pool pool(4);
+    EXPECT_EQ(pool.num_threads(), std::size_t(4));
+
+    constexpr std::size_t n = 1000;
+    std::vector<std::atomic<int>> counts(n);
+    pool.parallel_for(n, [&] (std::size_t i) { ++counts[i]; });
+    for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_EQ(counts[i].load(), 1) << "at " << i;
+    }
+
+    // Nested calls from inside tasks must not deadlock.
+    std::atomic<std::size_t> total{0};
+    pool.parallel_for(8, [&] (std::size_t) {
+      pool.parallel_for(100, [&] (std::size_t) { ++total; });
+    });
+    EXPECT_EQ(total.load(), std::size_t(800));
+  }
+
+  TEST(thread_pool, exceptions)
+  {
+    thread_pool pool(4);
+    std::atomic<std::size_t> count{0};
+    EXPECT_THROW(pool.parallel_for(100, [&] (std::size_t i) {
+        ++count;
+        if (i == 37) {
+          throw std::runtime_error("task 37");
+        }
+      }), std::runtime_error);
+    // The remaining tasks still run, and the pool stays usable.
+    EXPECT_EQ(count.load(), std::size_t(100));
+    pool.parallel_for(10, [&] (std::size_t) { ++count; });
+    EXPECT_EQ(count.load(), std::size_t(110));
+  }
+
+#if defined(LINALG_HAS_EXECUTION) && ! defined(LINALG_ENABLE_KOKKOS) && ! defined(LINALG_ENABLE_TBB)
+  TEST(thread_pool_exec, standard_parallel_policies)
+  {
+    using LinearAlgebra::impl::map_execpolicy_with_check;
+    static_assert(std::is_same_v<decltype(map_execpolicy_with_check(std::execution::par)), thread_pool_exec>);
+    static_assert(std::is_same_v<decltype(map_execpolicy_with_check(std::execution::par_unseq)), thread_pool_exec>);
+    static_assert(std::is_same_v<decltype(map_execpolicy_with_check(std::execution::seq)), inline_exec_t>);
+  }
+#endif
+
+  TEST(thread_pool_exec, reductions)
+  {
+    constexpr std::size_t n = 100000;
+    strided_vector<double> x(n, 1);
+    strided_vector<double> y(n, 2);
+    EXPECT_EQ(LinearAlgebra::dot(thread_pool_exec{}, x.x, y.x, 3.0),
+              LinearAlgebra::dot(inline_exec_t{}, x.x, y.x, 3.0));
+    EXPECT_EQ(LinearAlgebra::vector_abs_sum(thread_pool_exec{}, x.x, 0.0),
+              LinearAlgebra::vector_abs_sum(inline_exec_t{}, x.x, 0.0));
+    const double norm_ref = LinearAlgebra::vector_two_norm(inline_exec_t{}, x.x, 0.0);
+    EXPECT_NEAR(LinearAlgebra::vector_two_norm(thread_pool_exec{}, x.x, 0.0),
+                norm_ref, 1.0e-12 * norm_ref);
+
+    strided_vector<std::complex<double>> z(n, 3);
+    strided_vector<std::complex<double>> w(n, 4);
+    EXPECT_EQ(LinearAlgebra::dot(thread_pool_exec{}, z.x, w.x, std::complex<double>{}),
+              LinearAlgebra::dot(inline_exec_t{}, z.x, w.x, std::complex<double>{}));
+    EXPECT_EQ(LinearAlgebra::vector_abs_sum(thread_pool_exec{}, z.x, 0.0),
+              LinearAlgebra::vector_abs_sum(inline_exec_t{}, z.x, 0.0));
+
+    strided_matrix<double> A(300, 200, 5);
+    EXPECT_EQ(LinearAlgebra::matrix_one_norm(thread_pool_exec{}, A.A, 0.0),
+              LinearAlgebra::matrix_one_norm(inline_exec_t{}, A.A, 0.0));
+    EXPECT_EQ(LinearAlgebra::matrix_inf_norm(thread_pool_exec{}, A.A, 0.0),
+              LinearAlgebra::matrix_inf_norm(inline_exec_t{}, A.A, 0.0));
+    // The rescaling in the norms costs a few ulps per element; the
+    // unscaled formula cannot overflow here.
+    double frob_ssq = 0.0;
+    for (std::size_t j = 0; j < A.A.extent(1); ++j) {
+      for (std::size_t i = 0; i < A.A.extent(0); ++i) {
+        frob_ssq += A.A(i,j) * A.A(i,j);
+      }
+    }
+    const double frob_ref = std::sqrt(frob_ssq);
+    EXPECT_NEAR(LinearAlgebra::matrix_frob_norm(thread_pool_exec{}, A.A, 0.0),
+                frob_ref, 1.0e-12 * frob_ref);
+    EXPECT_NEAR(LinearAlgebra::matrix_frob_norm(inline_exec_t{}, A.A, 0.0),
+                frob_ref, 1.0e-12 * frob_ref);
+  }
+
+  // The parallel norms combine partial sums of squares.  Their results
+  // depend only on the number of threads, and cannot overflow or
+  // underflow unless the norm does.
+  TEST(thread_pool_exec, norms)
+  {
+    constexpr std::size_t n = 100000;
+    const double scale = std::ldexp(1.0, 700);
+    strided_vector<double> x(n, 1);
+    strided_vector<std::complex<double>> z(n, 3);
+    strided_matrix<std::complex<double>> A(300, 200, 5);
+    double x_ssq = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+      x_ssq += x.x(i) * x.x(i);
+      x.x(i) *= scale;
+    }
+
+    using LinearAlgebra::sum_of_squares_result;
+    const sum_of_squares_result<double> init{scale, 2.0};
+    const auto ssq = LinearAlgebra::vector_sum_of_squares(thread_pool_exec{}, x.x, init);
+    const auto ssq_ref = LinearAlgebra::vector_sum_of_squares(inline_exec_t{}, x.x, init);
+    EXPECT_EQ(ssq.scaling_factor, 5.0 * scale);
+    EXPECT_EQ(ssq.scaling_factor, ssq_ref.scaling_factor);
+    EXPECT_NEAR(ssq.scaled_sum_of_squares, (x_ssq + 2.0) / 25.0, 1.0e-12 * x_ssq);
+    EXPECT_NEAR(ssq.scaled_sum_of_squares, ssq_ref.scaled_sum_of_squares, 1.0e-12 * x_ssq);
+
+    const double norm = LinearAlgebra::vector_two_norm(thread_pool_exec{}, x.x, 0.0);
+    EXPECT_NEAR(norm / scale, std::sqrt(x_ssq), 1.0e-12 * std::sqrt(x_ssq));
+
+    const double z_norm = LinearAlgebra::vector_two_norm(thread_pool_exec{}, z.x, 0.0);
+    const double z_norm_ref = LinearAlgebra::vector_two_norm(inline_exec_t{}, z.x, 0.0);
+    EXPECT_NEAR(z_norm, z_norm_ref, 1.0e-12 * z_norm_ref);
+
+    const double A_norm = LinearAlgebra::matrix_frob_norm(thread_pool_exec{}, A.A, 0.0);
+    const double A_norm_ref = LinearAlgebra::matrix_frob_norm(inline_exec_t{}, A.A, 0.0);
+    EXPECT_NEAR(A_norm, A_norm_ref, 1.0e-12 * A_norm_ref);
+
+    for (int repeat = 0; repeat < 3; ++repeat) {
+      const auto ssq_again = LinearAlgebra::vector_sum_of_squares(thread_pool_exec{}, x.x, init);
+      EXPECT_EQ(ssq_again.scaled_sum_of_squares, ssq.scaled_sum_of_squares);
+      EXPECT_EQ(LinearAlgebra::vector_two_norm(thread_pool_exec{}, x.x, 0.0), norm);
+      EXPECT_EQ(LinearAlgebra::vector_two_norm(thread_pool_exec{}, z.x, 0.0), z_norm);
+      EXPECT_EQ(LinearAlgebra::matrix_frob_norm(thread_pool_exec{}, A.A, 0.0), A_norm);
+    }
+  }
+
+  template<class Scalar>
+  void test_matrix_vector_product()
+  {
+    constexpr std::size_t M = 500, N = 300;
+    strided_matrix<Scalar> A(M, N, 1);
+    strided_vector<Scalar> x(N, 2);
+    strided_vector<Scalar> y(M, 3);
+    strided_vector<Scalar> z(M, 4);
+    strided_vector<Scalar> z_ref(M, 4);
+
+    LinearAlgebra::matrix_vector_product(thread_pool_exec{}, A.A, x.x, z.x);
+    LinearAlgebra::matrix_vector_product(inline_exec_t{}, A.A, x.x, z_ref.x);
+    expect_vector_eq(z.x, z_ref.x);
+
+    auto A_scaled = LinearAlgebra::scaled(Scalar(2), A.A);
+    LinearAlgebra::matrix_vector_product(thread_pool_exec{}, A_scaled, x.x, y.x, z.x);
+    LinearAlgebra::matrix_vector_product(inline_exec_t{}, A_scaled, x.x, y.x, z_ref.x);
+    expect_vector_eq(z.x, z_ref.x);
+
+    // Too few rows to split; the columns' partial results are summed.
+    constexpr std::size_t M_wide = 6, N_wide = 20000;
+    strided_matrix<Scalar> A_wide(M_wide, N_wide, 5);
+    strided_vector<Scalar> x_wide(N_wide, 6);
+    strided_vector<Scalar> z_wide(M_wide, 4);
+    strided_vector<Scalar> z_wide_ref(M_wide, 4);
+    LinearAlgebra::matrix_vector_product(thread_pool_exec{}, A_wide.A, x_wide.x, z_wide.x);
+    LinearAlgebra::matrix_vector_product(inline_exec_t{}, A_wide.A, x_wide.x, z_wide_ref.x);
+    expect_vector_eq(z_wide.x, z_wide_ref.x);
+
+    LinearAlgebra::matrix_vector_product(thread_pool_exec{}, A_wide.A, x_wide.x, z_wide.x, z_wide.x);
+    LinearAlgebra::matrix_vector_product(inline_exec_t{}, A_wide.A, x_wide.x, z_wide_ref.x, z_wide_ref.x);
+    expect_vector_eq(z_wide.x, z_wide_ref.x);
+  }
+
+  TEST(thread_pool_exec, matrix_vector_product)
+  {
+    test_matrix_vector_product<double>();
+    test_matrix_vector_product<std::complex<double>>();
+  }
+
+  // Symmetric and Hermitian matrices read only their stored triangle;
+  // chunks of the engine's column groups are summed in parallel.
+  template<class Scalar>
+  void test_symmetric_matrix_vector_product()
+  {
+    constexpr std::size_t N = 300;
+    strided_matrix<Scalar> A(N, N, 1);
+    strided_vector<Scalar> x(N, 2);
+    strided_vector<Scalar> y(N, 3);
+    strided_vector<Scalar> z(N, 4);
+    strided_vector<Scalar> z_ref(N, 4);
+
+    auto check = [&] (auto t) {
+      LinearAlgebra::symmetric_matrix_vector_product(thread_pool_exec{}, A.A, t, x.x, z.x);
+      LinearAlgebra::symmetric_matrix_vector_product(inline_exec_t{}, A.A, t, x.x, z_ref.x);
+      expect_vector_eq(z.x, z_ref.x);
+
+      LinearAlgebra::symmetric_matrix_vector_product(thread_pool_exec{}, A.A, t, x.x, y.x, z.x);
+      LinearAlgebra::symmetric_matrix_vector_product(inline_exec_t{}, A.A, t, x.x, y.x, z_ref.x);
+      expect_vector_eq(z.x, z_ref.x);
+
+      LinearAlgebra::hermitian_matrix_vector_product(thread_pool_exec{}, A.A, t, x.x, z.x);
+      LinearAlgebra::hermitian_matrix_vector_product(inline_exec_t{}, A.A, t, x.x, z_ref.x);
+      expect_vector_eq(z.x, z_ref.x);
+
+      LinearAlgebra::hermitian_matrix_vector_product(thread_pool_exec{}, A.A, t, x.x, z.x, z.x);
+      LinearAlgebra::hermitian_matrix_vector_product(inline_exec_t{}, A.A, t, x.x, z_ref.x, z_ref.x);
+      expect_vector_eq(z.x, z_ref.x);
+
+      // A scaled matrix takes the generic loops.
+      auto A_scaled = LinearAlgebra::scaled(Scalar(2), A.A);
+      LinearAlgebra::symmetric_matrix_vector_product(thread_pool_exec{}, A_scaled, t, x.x, z.x);
+      LinearAlgebra::symmetric_matrix_vector_product(inline_exec_t{}, A_scaled, t, x.x, z_ref.x);
+      expect_vector_eq(z.x, z_ref.x);
+    };
+    check(LinearAlgebra::lower_triangle);
+    check(LinearAlgebra::upper_triangle);
+  }
+
+  TEST(thread_pool_exec, symmetric_matrix_vector_product)
+  {
+    test_symmetric_matrix_vector_product<double>();
+    test_symmetric_matrix_vector_product<std::complex<double>>();
+  }
+
+  template<class Scalar>
+  void test_matrix_product()
+  {
+    constexpr std::size_t M = 200, N = 270, K = 20;
+    strided_matrix<Scalar> A(M, K, 1);
+    strided_matrix<Scalar> B(K, N, 2);
+    strided_matrix<Scalar> E(M, N, 3);
+    strided_matrix<Scalar> C(M, N, 0);
+    strided_matrix<Scalar> C_ref(M, N, 0);
+
+    // Packed engine, on tiles of C.
+    LinearAlgebra::matrix_product(thread_pool_exec{}, A.A, B.A, C.A);
+    LinearAlgebra::matrix_product(inline_exec_t{}, A.A, B.A, C_ref.A);
+    expect_matrix_eq(C.A, C_ref.A);
+
+    LinearAlgebra::matrix_product(thread_pool_exec{}, A.A, B.A, E.A, C.A);
+    LinearAlgebra::matrix_product(inline_exec_t{}, A.A, B.A, E.A, C_ref.A);
+    expect_matrix_eq(C.A, C_ref.A);
+
+    // E may alias C.
+    LinearAlgebra::matrix_product(thread_pool_exec{}, A.A, B.A, C.A, C.A);
+    LinearAlgebra::matrix_product(inline_exec_t{}, A.A, B.A, C_ref.A, C_ref.A);
+    expect_matrix_eq(C.A, C_ref.A);
+
+    // Scaled and conjugated inputs go through the packed engine, too.
+    auto A_scaled = LinearAlgebra::scaled(Scalar(2), A.A);
+    auto B_conj = LinearAlgebra::conjugated(B.A);
+    LinearAlgebra::matrix_product(thread_pool_exec{}, A_scaled, B_conj, C.A);
+    LinearAlgebra::matrix_product(inline_exec_t{}, A_scaled, B_conj, C_ref.A);
+    expect_matrix_eq(C.A, C_ref.A);
+
+    LinearAlgebra::matrix_product(thread_pool_exec{}, A_scaled, B_conj, E.A, C.A);
+    LinearAlgebra::matrix_product(inline_exec_t{}, A_scaled, B_conj, E.A, C_ref.A);
+    expect_matrix_eq(C.A, C_ref.A);
+
+    // Mixed precision takes the generic loops.
+    if constexpr (std::is_same_v<Scalar, double>) {
+      strided_matrix<float> A_float(M, K, 1);
+      LinearAlgebra::matrix_product(thread_pool_exec{}, A_float.A, B.A, C.A);
+      LinearAlgebra::matrix_product(inline_exec_t{}, A_float.A, B.A, C_ref.A);
+      expect_matrix_eq(C.A, C_ref.A);
+
+      LinearAlgebra::matrix_product(thread_pool_exec{}, A_float.A, B.A, E.A, C.A);
+      LinearAlgebra::matrix_product(inline_exec_t{}, A_float.A, B.A, E.A, C_ref.A);
+      expect_matrix_eq(C.A, C_ref.A);
+    }
+  }
+
+  TEST(thread_pool_exec, matrix_product)
+  {
+    test_matrix_product<double>();
+    test_matrix_product<std::complex<double>>();
+  }
+
+#if defined(LINALG_HAS_EXECUTION) && ! defined(LINALG_ENABLE_KOKKOS)
+  TEST(thread_pool_exec, matrix_product_par)
+  {
+    constexpr std::size_t M = 200, N = 300, K = 40;
+    strided_matrix<double> A(M, K, 1);
+    strided_matrix<double> B(K, N, 2);
+    strided_matrix<double> C(M, N, 0);
+    strided_matrix<double> C_ref(M, N, 0);
+    LinearAlgebra::matrix_product(std::execution::par, A.A, B.A, C.A);
+    LinearAlgebra::matrix_product(A.A, B.A, C_ref.A);
+    expect_matrix_eq(C.A, C_ref.A);
+  }
+#endif
+
+  template<class Layout>
+  void test_batched_matrix_product(std::size_t num_batches, std::size_t M,
+                                   std::size_t N, std::size_t K)
+  {
+    using batch_extents_t =
+      extents<std::size_t, dynamic_extent, dynamic_extent, dynamic_extent>;
+    auto make_batch = [num_batches] (std::vector<double>& storage, std::size_t num_rows,
+                                     std::size_t num_cols, std::size_t seed) {
+      storage.resize(num_batches * num_rows * num_cols);
+      for (std::size_t k = 0; k < storage.size(); ++k) {
+        storage[k] = test_value<double>(k, 0, seed);
+      }
+      return mdspan<double, batch_extents_t, Layout>(storage.data(), num_batches, num_rows, num_cols);
+    };
+    std::vector<double> A_storage, B_storage, E_storage, C_storage, C_ref_storage;
+    auto A = make_batch(A_storage, M, K, 1);
+    auto B = make_batch(B_storage, K, N, 2);
+    auto E = make_batch(E_storage, M, N, 3);
+    auto C = make_batch(C_storage, M, N, 0);
+    auto C_ref = make_batch(C_ref_storage, M, N, 0);
+
+    LinearAlgebra::matrix_product(thread_pool_exec{}, A, B, C);
+    LinearAlgebra::matrix_product(inline_exec_t{}, A, B, C_ref);
+    EXPECT_EQ(C_storage, C_ref_storage);
+
+    LinearAlgebra::matrix_product(thread_pool_exec{}, A, B, E, C);
+    LinearAlgebra::matrix_product(inline_exec_t{}, A, B, E, C_ref);
+    EXPECT_EQ(C_storage, C_ref_storage);
+  }
+
+  TEST(thread_pool_exec, batched_matrix_product)
+  {
+    test_batched_matrix_product<layout_left>(1000, 4, 4, 4);
+    test_batched_matrix_product<layout_left>(301, 8, 4, 8);
+    test_batched_matrix_product<layout_right>(500, 6, 5, 3);
+    test_batched_matrix_product<layout_right>(9, 40, 36, 33);
+  }
+
+  template<class Scalar, class Triangle>
+  void test_rank_updates(Triangle t)
+  {
+    constexpr std::size_t N = 200, K = 20;
+    strided_vector<Scalar> x(N, 1);
+    strided_vector<Scalar> y(N, 2);
+    strided_matrix<Scalar> A_k(N, K, 3);
+    const Scalar alpha(-2);
+
+    {
+      strided_matrix<Scalar> A(N, N, 4);
+      strided_matrix<Scalar> A_ref(N, N, 4);
+      LinearAlgebra::matrix_rank_1_update(thread_pool_exec{}, x.x, y.x, A.A);
+      LinearAlgebra::matrix_rank_1_update(inline_exec_t{}, x.x, y.x, A_ref.A);
+      expect_matrix_eq(A.A, A_ref.A);
+    }
+    {
+      strided_matrix<Scalar> A(N, N, 4);
+      strided_matrix<Scalar> A_ref(N, N, 4);
+      LinearAlgebra::symmetric_matrix_rank_1_update(thread_pool_exec{}, alpha, x.x, A.A, t);
+      LinearAlgebra::symmetric_matrix_rank_1_update(inline_exec_t{}, alpha, x.x, A_ref.A, t);
+      expect_matrix_eq(A.A, A_ref.A);
+    }
+    {
+      strided_matrix<Scalar> A(N, N, 4);
+      strided_matrix<Scalar> A_ref(N, N, 4);
+      LinearAlgebra::hermitian_matrix_rank_1_update(thread_pool_exec{}, alpha, x.x, A.A, t);
+      LinearAlgebra::hermitian_matrix_rank_1_update(inline_exec_t{}, alpha, x.x, A_ref.A, t);
+      expect_matrix_eq(A.A, A_ref.A);
+    }
+    {
+      strided_matrix<Scalar> A(N, N, 4);
+      strided_matrix<Scalar> A_ref(N, N, 4);
+      LinearAlgebra::symmetric_matrix_rank_2_update(thread_pool_exec{}, x.x, y.x, A.A, t);
+      LinearAlgebra::symmetric_matrix_rank_2_update(inline_exec_t{}, x.x, y.x, A_ref.A, t);
+      expect_matrix_eq(A.A, A_ref.A);
+    }
+    {
+      strided_matrix<Scalar> A(N, N, 4);
+      strided_matrix<Scalar> A_ref(N, N, 4);
+      LinearAlgebra::hermitian_matrix_rank_2_update(thread_pool_exec{}, x.x, y.x, A.A, t);
+      LinearAlgebra::hermitian_matrix_rank_2_update(inline_exec_t{}, x.x, y.x, A_ref.A, t);
+      expect_matrix_eq(A.A, A_ref.A);
+    }
+    {
+      strided_matrix<Scalar> C(N, N, 4);
+      strided_matrix<Scalar> C_ref(N, N, 4);
+      LinearAlgebra::symmetric_matrix_rank_k_update(thread_pool_exec{}, alpha, A_k.A, C.A, t);
+      LinearAlgebra::symmetric_matrix_rank_k_update(inline_exec_t{}, alpha, A_k.A, C_ref.A, t);
+      expect_matrix_eq(C.A, C_ref.A);
+    }
+    {
+      strided_matrix<Scalar> C(N, N, 4);
+      strided_matrix<Scalar> C_ref(N, N, 4);
+      LinearAlgebra::hermitian_matrix_rank_k_update(thread_pool_exec{}, alpha, A_k.A, C.A, t);
+      LinearAlgebra::hermitian_matrix_rank_k_update(inline_exec_t{}, alpha, A_k.A, C_ref.A, t);
+      expect_matrix_eq(C.A, C_ref.A);
+    }
+#if defined(LINALG_FIX_RANK_UPDATES)
+    strided_matrix<Scalar> E(N, N, 5);
+    {
+      strided_matrix<Scalar> A(N, N, 4);
+      strided_matrix<Scalar> A_ref(N, N, 4);
+      LinearAlgebra::matrix_rank_1_update(thread_pool_exec{}, x.x, y.x, E.A, A.A);
+      LinearAlgebra::matrix_rank_1_update(inline_exec_t{}, x.x, y.x, E.A, A_ref.A);
+      expect_matrix_eq(A.A, A_ref.A);
+    }
+    {
+      strided_matrix<Scalar> A(N, N, 4);
+      strided_matrix<Scalar> A_ref(N, N, 4);
+      LinearAlgebra::symmetric_matrix_rank_1_update(thread_pool_exec{}, alpha, x.x, E.A, A.A, t);
+      LinearAlgebra::symmetric_matrix_rank_1_update(inline_exec_t{}, alpha, x.x, E.A, A_ref.A, t);
+      expect_matrix_eq(A.A, A_ref.A);
+    }
+    {
+      strided_matrix<Scalar> A(N, N, 4);
+      strided_matrix<Scalar> A_ref(N, N, 4);
+      LinearAlgebra::hermitian_matrix_rank_1_update(thread_pool_exec{}, alpha, x.x, E.A, A.A, t);
+      LinearAlgebra::hermitian_matrix_rank_1_update(inline_exec_t{}, alpha, x.x, E.A, A_ref.A, t);
+      expect_matrix_eq(A.A, A_ref.A);
+    }
+    {
+      strided_matrix<Scalar> A(N, N, 4);
+      strided_matrix<Scalar> A_ref(N, N, 4);
+      LinearAlgebra::symmetric_matrix_rank_2_update(thread_pool_exec{}, x.x, y.x, E.A, A.A, t);
+      LinearAlgebra::symmetric_matrix_rank_2_update(inline_exec_t{}, x.x, y.x, E.A, A_ref.A, t);
+      expect_matrix_eq(A.A, A_ref.A);
+    }
+    {
+      strided_matrix<Scalar> A(N, N, 4);
+      strided_matrix<Scalar> A_ref(N, N, 4);
+      LinearAlgebra::hermitian_matrix_rank_2_update(thread_pool_exec{}, x.x, y.x, E.A, A.A, t);
+      LinearAlgebra::hermitian_matrix_rank_2_update(inline_exec_t{}, x.x, y.x, E.A, A_ref.A, t);
+      expect_matrix_eq(A.A, A_ref.A);
+    }
+    {
+      strided_matrix<Scalar> C(N, N, 4);
+      strided_matrix<Scalar> C_ref(N, N, 4);
+      LinearAlgebra::symmetric_matrix_rank_k_update(thread_pool_exec{}, alpha, A_k.A, E.A, C.A, t);
+      LinearAlgebra::symmetric_matrix_rank_k_update(inline_exec_t{}, alpha, A_k.A, E.A, C_ref.A, t);
+      expect_matrix_eq(C.A, C_ref.A);
+    }
+    {
+      strided_matrix<Scalar> C(N, N, 4);
+      strided_matrix<Scalar> C_ref(N, N, 4);
+      LinearAlgebra::hermitian_matrix_rank_k_update(thread_pool_exec{}, alpha, A_k.A, E.A, C.A, t);
+      LinearAlgebra::hermitian_matrix_rank_k_update(inline_exec_t{}, alpha, A_k.A, E.A, C_ref.A, t);
+      expect_matrix_eq(C.A, C_ref.A);
+    }
+#endif // LINALG_FIX_RANK_UPDATES
+  }
+
+  TEST(thread_pool_exec, rank_updates)
+  {
+    test_rank_updates<double>(LinearAlgebra::lower_triangle);
+    test_rank_updates<double>(LinearAlgebra::upper_triangle);
+    test_rank_updates<std::complex<double>>(LinearAlgebra::lower_triangle);
+    test_rank_updates<std::complex<double>>(LinearAlgebra::upper_triangle);
+  }
+
+  template<class Scalar, class Triangle>
+  void test_rank_2k_updates(Triangle t)
+  {
+    constexpr std::size_t N = 200, K = 20;
+    strided_matrix<Scalar> A(N, K, 3);
+    strided_matrix<Scalar> B(N, K, 6);
+
+    {
+      strided_matrix<Scalar> C(N, N, 4);
+      strided_matrix<Scalar> C_ref(N, N, 4);
+      LinearAlgebra::symmetric_matrix_rank_2k_update(thread_pool_exec{}, A.A, B.A, C.A, t);
+      LinearAlgebra::symmetric_matrix_rank_2k_update(inline_exec_t{}, A.A, B.A, C_ref.A, t);
+      expect_matrix_eq(C.A, C_ref.A);
+    }
+    {
+      strided_matrix<Scalar> C(N, N, 4);
+      strided_matrix<Scalar> C_ref(N, N, 4);
+      LinearAlgebra::hermitian_matrix_rank_2k_update(thread_pool_exec{}, A.A, B.A, C.A, t);
+      LinearAlgebra::hermitian_matrix_rank_2k_update(inline_exec_t{}, A.A, B.A, C_ref.A, t);
+      expect_matrix_eq(C.A, C_ref.A);
+    }
+#if defined(LINALG_FIX_RANK_UPDATES)
+    strided_matrix<Scalar> E(N, N, 5);
+    {
+      strided_matrix<Scalar> C(N, N, 4);
+      strided_matrix<Scalar> C_ref(N, N, 4);
+      LinearAlgebra::symmetric_matrix_rank_2k_update(thread_pool_exec{}, A.A, B.A, E.A, C.A, t);
+      LinearAlgebra::symmetric_matrix_rank_2k_update(inline_exec_t{}, A.A, B.A, E.A, C_ref.A, t);
+      expect_matrix_eq(C.A, C_ref.A);
+    }
+    {
+      strided_matrix<Scalar> C(N, N, 4);
+      strided_matrix<Scalar> C_ref(N, N, 4);
+      LinearAlgebra::hermitian_matrix_rank_2k_update(thread_pool_exec{}, A.A, B.A, E.A, C.A, t);
+      LinearAlgebra::hermitian_matrix_rank_2k_update(inline_exec_t{}, A.A, B.A, E.A, C_ref.A, t);
+      expect_matrix_eq(C.A, C_ref.A);
+    }
+#endif // LINALG_FIX_RANK_UPDATES
+  }
+
+  TEST(thread_pool_exec, rank_2k_updates)
+  {
+    test_rank_2k_updates<double>(LinearAlgebra::lower_triangle);
+    test_rank_2k_updates<double>(LinearAlgebra::upper_triangle);
+    test_rank_2k_updates<std::complex<double>>(LinearAlgebra::lower_triangle);
+    test_rank_2k_updates<std::complex<double>>(LinearAlgebra::upper_triangle);
+  }
+
+  // Triangular matrix with 2 on the diagonal, and B = A X for an
+  // integer X, so that the solves are exact.
+  template<class Scalar, class Triangle>
+  void test_triangular_solves(Triangle t)
+  {
+    constexpr std::size_t N = 150, num_rhs = 70;
+    constexpr bool lower = std::is_same_v<Triangle, LinearAlgebra::lower_triangle_t>;
+    strided_matrix<Scalar> A(N, N, 1);
+    for (std::size_t j = 0; j < N; ++j) {
+      for (std::size_t i = 0; i < N; ++i) {
+        if (i == j) {
+          A.A(i,j) = Scalar(2);
+        }
+        else if (lower != (i > j)) {
+          A.A(i,j) = Scalar{};
+        }
+      }
+    }
+    {
+      strided_matrix<Scalar> X_true(N, num_rhs, 2);
+      strided_matrix<Scalar> B(N, num_rhs, 0);
+      LinearAlgebra::matrix_product(inline_exec_t{}, A.A, X_true.A, B.A);
+      strided_matrix<Scalar> X(N, num_rhs, 0);
+      strided_matrix<Scalar> X_ref(N, num_rhs, 0);
+      LinearAlgebra::triangular_matrix_matrix_left_solve(thread_pool_exec{}, A.A, t,
+        LinearAlgebra::explicit_diagonal, B.A, X.A);
+      LinearAlgebra::triangular_matrix_matrix_left_solve(inline_exec_t{}, A.A, t,
+        LinearAlgebra::explicit_diagonal, B.A, X_ref.A);
+      expect_matrix_eq(X.A, X_ref.A);
+      expect_matrix_eq(X.A, X_true.A);
+    }
+    {
+      strided_matrix<Scalar> X_true(num_rhs, N, 3);
+      strided_matrix<Scalar> B(num_rhs, N, 0);
+      LinearAlgebra::matrix_product(inline_exec_t{}, X_true.A, A.A, B.A);
+      strided_matrix<Scalar> X(num_rhs, N, 0);
+      strided_matrix<Scalar> X_ref(num_rhs, N, 0);
+      LinearAlgebra::triangular_matrix_matrix_right_solve(thread_pool_exec{}, A.A, t,
+        LinearAlgebra::explicit_diagonal, B.A, X.A);
+      LinearAlgebra::triangular_matrix_matrix_right_solve(inline_exec_t{}, A.A, t,
+        LinearAlgebra::explicit_diagonal, B.A, X_ref.A);
+      expect_matrix_eq(X.A, X_ref.A);
+      expect_matrix_eq(X.A, X_true.A);
+    }
+  }
+
+  TEST(thread_pool_exec, triangular_solves)
+  {
+    test_triangular_solves<double>(LinearAlgebra::lower_triangle);
+    test_triangular_solves<double>(LinearAlgebra::upper_triangle);
+    test_triangular_solves<std::complex<double>>(LinearAlgebra::lower_triangle);
+    test_triangular_solves<std::complex<double>>(LinearAlgebra::upper_triangle);
+  }
+  // Large enough that the updates split among threads.
+  template<class Scalar, class Triangle>
+  void test_triangular_vector_solve(Triangle t)
+  {
+    constexpr std::size_t N = 600;
+    constexpr bool lower = std::is_same_v<Triangle, LinearAlgebra::lower_triangle_t>;
+    strided_matrix<Scalar> A(N, N, 1);
+    for (std::size_t j = 0; j < N; ++j) {
+      for (std::size_t i = 0; i < N; ++i) {
+        if (i == j) {
+          A.A(i,j) = Scalar(2);
+        }
+        else if (lower != (i > j)) {
+          A.A(i,j) = Scalar{};
+        }
+      }
+    }
+    strided_vector<Scalar> x_true(N, 2);
+    strided_vector<Scalar> b(N, 0);
+    LinearAlgebra::matrix_vector_product(inline_exec_t{}, A.A, x_true.x, b.x);
+    strided_vector<Scalar> x(N, 0);
+    strided_vector<Scalar> x_ref(N, 0);
+    LinearAlgebra::triangular_matrix_vector_solve(thread_pool_exec{}, A.A, t,
+      LinearAlgebra::explicit_diagonal, b.x, x.x);
+    LinearAlgebra::triangular_matrix_vector_solve(inline_exec_t{}, A.A, t,
+      LinearAlgebra::explicit_diagonal, b.x, x_ref.x);
+    expect_vector_eq(x.x, x_ref.x);
+    expect_vector_eq(x.x, x_true.x);
+
+    // x may be b.
+    LinearAlgebra::triangular_matrix_vector_solve(thread_pool_exec{}, A.A, t,
+      LinearAlgebra::explicit_diagonal, b.x, b.x);
+    expect_vector_eq(b.x, x_true.x);
+  }
+
+  TEST(thread_pool_exec, triangular_vector_solve)
+  {
+    test_triangular_vector_solve<double>(LinearAlgebra::lower_triangle);
+    test_triangular_vector_solve<double>(LinearAlgebra::upper_triangle);
+    test_triangular_vector_solve<std::complex<double>>(LinearAlgebra::lower_triangle);
+    test_triangular_vector_solve<std::complex<double>>(LinearAlgebra::upper_triangle);
+  }
+
+  // Symmetric and Hermitian products, both sides, overwriting and
+  // updating, compared with the inline implementation.
+  template<class Scalar, class Triangle>
+  void test_symmetric_products(Triangle t)
+  {
+    constexpr std::size_t N = 150, num_cols = 70;
+    strided_matrix<Scalar> A(N, N, 1);
+    strided_matrix<Scalar> B_left(N, num_cols, 2);
+    strided_matrix<Scalar> E_left(N, num_cols, 3);
+    strided_matrix<Scalar> B_right(num_cols, N, 4);
+    strided_matrix<Scalar> E_right(num_cols, N, 5);
+    {
+      strided_matrix<Scalar> C(N, num_cols, 0);
+      strided_matrix<Scalar> C_ref(N, num_cols, 0);
+      LinearAlgebra::symmetric_matrix_product(thread_pool_exec{}, A.A, t, B_left.A, C.A);
+      LinearAlgebra::symmetric_matrix_product(inline_exec_t{}, A.A, t, B_left.A, C_ref.A);
+      expect_matrix_eq(C.A, C_ref.A);
+      LinearAlgebra::hermitian_matrix_product(thread_pool_exec{}, A.A, t, B_left.A, E_left.A, C.A);
+      LinearAlgebra::hermitian_matrix_product(inline_exec_t{}, A.A, t, B_left.A, E_left.A, C_ref.A);
+      expect_matrix_eq(C.A, C_ref.A);
+    }
+    {
+      strided_matrix<Scalar> C(num_cols, N, 0);
+      strided_matrix<Scalar> C_ref(num_cols, N, 0);
+      LinearAlgebra::hermitian_matrix_product(thread_pool_exec{}, B_right.A, A.A, t, C.A);
+      LinearAlgebra::hermitian_matrix_product(inline_exec_t{}, B_right.A, A.A, t, C_ref.A);
+      expect_matrix_eq(C.A, C_ref.A);
+      LinearAlgebra::symmetric_matrix_product(thread_pool_exec{}, B_right.A, A.A, t, E_right.A, C.A);
+      LinearAlgebra::symmetric_matrix_product(inline_exec_t{}, B_right.A, A.A, t, E_right.A, C_ref.A);
+      expect_matrix_eq(C.A, C_ref.A);
+    }
+  }
+
+  TEST(thread_pool_exec, symmetric_products)
+  {
+    test_symmetric_products<double>(LinearAlgebra::lower_triangle);
+    test_symmetric_products<double>(LinearAlgebra::upper_triangle);
+    test_symmetric_products<std::complex<double>>(LinearAlgebra::lower_triangle);
+    test_symmetric_products<std::complex<double>>(LinearAlgebra::upper_triangle);
+  }
+
+  // Algorithms deduce ExecutionPolicy&& as an lvalue reference type for
+  // a named policy object.  Algorithms without a thread_pool_exec
+  // overload fall back to the inline implementation.
+  TEST(thread_pool_exec, named_policy)
+  {
+    constexpr std::size_t N = 40;
+    const thread_pool_exec exec{};
+    strided_matrix<double> A(N, N, 1);
+    strided_matrix<double> B(N, N, 2);
+    strided_vector<double> x(N, 3);
+    strided_vector<double> y(N, 4);
+    {
+      strided_matrix<double> C(N, N, 0);
+      strided_matrix<double> C_ref(N, N, 0);
+      LinearAlgebra::symmetric_matrix_product(exec, A.A, LinearAlgebra::lower_triangle, B.A, C.A);
+      LinearAlgebra::symmetric_matrix_product(inline_exec_t{}, A.A, LinearAlgebra::lower_triangle, B.A, C_ref.A);
+      expect_matrix_eq(C.A, C_ref.A);
+
+      LinearAlgebra::symmetric_matrix_product(exec, B.A, A.A, LinearAlgebra::upper_triangle, C.A);
+      LinearAlgebra::symmetric_matrix_product(inline_exec_t{}, B.A, A.A, LinearAlgebra::upper_triangle, C_ref.A);
+      expect_matrix_eq(C.A, C_ref.A);
+
+      LinearAlgebra::hermitian_matrix_product(exec, A.A, LinearAlgebra::lower_triangle, B.A, C.A);
+      LinearAlgebra::hermitian_matrix_product(inline_exec_t{}, A.A, LinearAlgebra::lower_triangle, B.A, C_ref.A);
+      expect_matrix_eq(C.A, C_ref.A);
+
+      LinearAlgebra::hermitian_matrix_product(exec, B.A, A.A, LinearAlgebra::upper_triangle, C.A);
+      LinearAlgebra::hermitian_matrix_product(inline_exec_t{}, B.A, A.A, LinearAlgebra::upper_triangle, C_ref.A);
+      expect_matrix_eq(C.A, C_ref.A);
+    }
+    {
+      strided_matrix<double> C(N, N, 5);
+      strided_matrix<double> C_ref(N, N, 5);
+      LinearAlgebra::symmetric_matrix_rank_2_update(exec, x.x, y.x, C.A, LinearAlgebra::lower_triangle);
+      LinearAlgebra::symmetric_matrix_rank_2_update(inline_exec_t{}, x.x, y.x, C_ref.A, LinearAlgebra::lower_triangle);
+      expect_matrix_eq(C.A, C_ref.A);
+
+      LinearAlgebra::symmetric_matrix_rank_1_update(exec, 2.0, x.x, C.A, LinearAlgebra::upper_triangle);
+      LinearAlgebra::symmetric_matrix_rank_1_update(inline_exec_t{}, 2.0, x.x, C_ref.A, LinearAlgebra::upper_triangle);
+      expect_matrix_eq(C.A, C_ref.A);
+    }
+  }
+
+} // end anonymous namespace
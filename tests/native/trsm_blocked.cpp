@@ -0,0 +1,204 @@
+#include "./gtest_fixtures.hpp"
+
+// Exercise the blocked, recursive triangular solve with problem sizes
+// that cross its diagonal-block and column-unrolling boundaries, for
+// both triangles, both sides, both diagonal storages, and every
+// strided layout it accepts.
+
+namespace {
+  using LinearAlgebra::explicit_diagonal;
+  using LinearAlgebra::implicit_unit_diagonal;
+  using LinearAlgebra::lower_triangle;
+  using LinearAlgebra::transposed;
+  using LinearAlgebra::triangular_matrix_matrix_left_solve;
+  using LinearAlgebra::triangular_matrix_matrix_right_solve;
+  using LinearAlgebra::upper_triangle;
+
+  using extents_t = extents<std::size_t, dynamic_extent, dynamic_extent>;
+
+  // Fill A's triangle with small integers and its diagonal with 2
+  // (or NaN, if the solve must not read it), so that every
+  // intermediate result of the solve is exactly representable.
+  // NaN in the other triangle catches reads from it.
+  template<class Triangle, class DiagonalStorage, class MatrixType>
+  void fill_triangular(MatrixType A)
+  {
+    using value_type = typename MatrixType::value_type;
+    constexpr bool lower = std::is_same_v<Triangle, LinearAlgebra::lower_triangle_t>;
+    for (std::size_t j = 0; j < A.extent(1); ++j) {
+      for (std::size_t i = 0; i < A.extent(0); ++i) {
+        if (i == j) {
+          A(i,j) = std::is_same_v<DiagonalStorage, LinearAlgebra::explicit_diagonal_t> ?
+            value_type(2) : poison_value<value_type>();
+        }
+        else if (lower == (i > j)) {
+          A(i,j) = test_value<value_type>(i, j, 1);
+        }
+        else {
+          A(i,j) = poison_value<value_type>();
+        }
+      }
+    }
+  }
+
+  template<class Triangle, class DiagonalStorage, class Scalar>
+  Scalar triangular_element(const std::vector<Scalar>& A_ref, std::size_t n,
+                            std::size_t i, std::size_t j)
+  {
+    constexpr bool lower = std::is_same_v<Triangle, LinearAlgebra::lower_triangle_t>;
+    if (i == j) {
+      return std::is_same_v<DiagonalStorage, LinearAlgebra::explicit_diagonal_t> ?
+        A_ref[i + j * n] : Scalar(1);
+    }
+    return lower == (i > j) ? A_ref[i + j * n] : Scalar{};
+  }
+
+  // Solve op(A) X = B (left side) or X op(A) = B (right side) for
+  // B = op(A) X_true or X_true op(A), and compare X with X_true.
+  template<class Scalar, class Layout_A, class Layout_B, class Layout_X,
+           class Triangle, class DiagonalStorage>
+  void test_blocked_trsm(Triangle t, DiagonalStorage d,
+                         std::size_t n, std::size_t num_rhs)
+  {
+    std::vector<Scalar> A_storage(n * n);
+    mdspan<Scalar, extents_t, Layout_A> A(A_storage.data(), n, n);
+    fill_triangular<Triangle, DiagonalStorage>(A);
+    std::vector<Scalar> A_ref(n * n);
+    for (std::size_t j = 0; j < n; ++j) {
+      for (std::size_t i = 0; i < n; ++i) {
+        A_ref[i + j * n] = A(i,j);
+      }
+    }
+    auto A_elt = [&] (std::size_t i, std::size_t j) {
+      return triangular_element<Triangle, DiagonalStorage>(A_ref, n, i, j);
+    };
+
+    // Left side: X and B are n x num_rhs.
+    {
+      std::vector<Scalar> X_true_storage(n * num_rhs);
+      std::vector<Scalar> B_storage(n * num_rhs);
+      std::vector<Scalar> X_storage(n * num_rhs, poison_value<Scalar>());
+      mdspan<Scalar, extents_t, layout_left> X_true(X_true_storage.data(), n, num_rhs);
+      mdspan<Scalar, extents_t, Layout_B> B(B_storage.data(), n, num_rhs);
+      mdspan<Scalar, extents_t, Layout_X> X(X_storage.data(), n, num_rhs);
+      for (std::size_t j = 0; j < num_rhs; ++j) {
+        for (std::size_t i = 0; i < n; ++i) {
+          X_true(i,j) = test_value<Scalar>(i, j, 2);
+        }
+      }
+      for (std::size_t j = 0; j < num_rhs; ++j) {
+        for (std::size_t i = 0; i < n; ++i) {
+          Scalar sum{};
+          for (std::size_t k = 0; k < n; ++k) {
+            sum += A_elt(i, k) * X_true(k,j);
+          }
+          B(i,j) = sum;
+        }
+      }
+      triangular_matrix_matrix_left_solve(A, t, d, B, X);
+      for (std::size_t j = 0; j < num_rhs; ++j) {
+        for (std::size_t i = 0; i < n; ++i) {
+          EXPECT_EQ(X(i,j), X_true(i,j)) << "left side, at (" << i << "," << j << ")";
+        }
+      }
+    }
+
+    // Right side: X and B are num_rhs x n.
+    {
+      std::vector<Scalar> X_true_storage(num_rhs * n);
+      std::vector<Scalar> B_storage(num_rhs * n);
+      std::vector<Scalar> X_storage(num_rhs * n, poison_value<Scalar>());
+      mdspan<Scalar, extents_t, layout_left> X_true(X_true_storage.data(), num_rhs, n);
+      mdspan<Scalar, extents_t, Layout_B> B(B_storage.data(), num_rhs, n);
+      mdspan<Scalar, extents_t, Layout_X> X(X_storage.data(), num_rhs, n);
+      for (std::size_t j = 0; j < n; ++j) {
+        for (std::size_t i = 0; i < num_rhs; ++i) {
+          X_true(i,j) = test_value<Scalar>(i, j, 3);
+        }
+      }
+      for (std::size_t j = 0; j < n; ++j) {
+        for (std::size_t i = 0; i < num_rhs; ++i) {
+          Scalar sum{};
+          for (std::size_t k = 0; k < n; ++k) {
+            sum += X_true(i,k) * A_elt(k, j);
+          }
+          B(i,j) = sum;
+        }
+      }
+      triangular_matrix_matrix_right_solve(A, t, d, B, X);
+      for (std::size_t j = 0; j < n; ++j) {
+        for (std::size_t i = 0; i < num_rhs; ++i) {
+          EXPECT_EQ(X(i,j), X_true(i,j)) << "right side, at (" << i << "," << j << ")";
+        }
+      }
+    }
+  }
+
+  template<class Scalar, class Layout_A, class Layout_B, class Layout_X>
+  void test_all_triangles(std::size_t n, std::size_t num_rhs)
+  {
+    test_blocked_trsm<Scalar, Layout_A, Layout_B, Layout_X>(lower_triangle, explicit_diagonal, n, num_rhs);
+    test_blocked_trsm<Scalar, Layout_A, Layout_B, Layout_X>(upper_triangle, explicit_diagonal, n, num_rhs);
+    test_blocked_trsm<Scalar, Layout_A, Layout_B, Layout_X>(lower_triangle, implicit_unit_diagonal, n, num_rhs);
+    test_blocked_trsm<Scalar, Layout_A, Layout_B, Layout_X>(upper_triangle, implicit_unit_diagonal, n, num_rhs);
+  }
+
+  TEST(BLAS3_trsm_blocked, crosses_block_boundaries)
+  {
+    // nb is 32, and the kernel solves 4 right-hand sides at once.
+    for (std::size_t n : {1, 31, 32, 33, 100, 200}) {
+      for (std::size_t num_rhs : {1, 5, 37}) {
+        test_all_triangles<double, layout_left, layout_left, layout_left>(n, num_rhs);
+      }
+    }
+  }
+
+  TEST(BLAS3_trsm_blocked, layouts)
+  {
+    test_all_triangles<double, layout_right, layout_right, layout_right>(70, 9);
+    test_all_triangles<double, layout_left, layout_right, layout_left>(65, 6);
+    test_all_triangles<float, layout_right, layout_left, layout_right>(40, 7);
+    test_all_triangles<std::complex<double>, layout_left, layout_left, layout_right>(67, 11);
+  }
+
+  TEST(BLAS3_trsm_blocked, degenerate_extents)
+  {
+    test_all_triangles<double, layout_left, layout_left, layout_left>(0, 3);
+    test_all_triangles<double, layout_left, layout_left, layout_left>(5, 0);
+  }
+
+  TEST(BLAS3_trsm_blocked, transposed)
+  {
+    // transposed(A) of a row-major lower triangle is a column-major
+    // upper triangle.
+    constexpr std::size_t n = 45, num_rhs = 10;
+    std::vector<double> A_storage(n * n);
+    mdspan<double, extents_t, layout_right> A(A_storage.data(), n, n);
+    fill_triangular<LinearAlgebra::lower_triangle_t, LinearAlgebra::explicit_diagonal_t>(A);
+
+    std::vector<double> X_true(n * num_rhs), B_storage(n * num_rhs), X_storage(n * num_rhs);
+    mdspan<double, extents_t, layout_left> B(B_storage.data(), n, num_rhs);
+    mdspan<double, extents_t, layout_left> X(X_storage.data(), n, num_rhs);
+    for (std::size_t j = 0; j < num_rhs; ++j) {
+      for (std::size_t i = 0; i < n; ++i) {
+        X_true[i + j * n] = test_value<double>(i, j, 4);
+      }
+    }
+    for (std::size_t j = 0; j < num_rhs; ++j) {
+      for (std::size_t i = 0; i < n; ++i) {
+        double sum = 0.0;
+        for (std::size_t k = i; k < n; ++k) {
+          sum += A(k,i) * X_true[k + j * n];
+        }
+        B(i,j) = sum;
+      }
+    }
+    triangular_matrix_matrix_left_solve(transposed(A), upper_triangle, explicit_diagonal, B, X);
+    for (std::size_t j = 0; j < num_rhs; ++j) {
+      for (std::size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(X(i,j), X_true[i + j * n]) << "at (" << i << "," << j << ")";
+      }
+    }
+  }
+
+} // end anonymous namespace
@@ -0,0 +1,194 @@
+#include "./gtest_fixtures.hpp"
+
+// Exercise the blocked triangular solve with one right-hand side,
+// with problem sizes that cross its diagonal blocks, for both
+// triangles, both diagonal storages, both forms of its updates, and
+// column-major, row-major, and strided matrices.
+
+namespace {
+  using LinearAlgebra::conjugated;
+  using LinearAlgebra::explicit_diagonal;
+  using LinearAlgebra::implicit_unit_diagonal;
+  using LinearAlgebra::lower_triangle;
+  using LinearAlgebra::scaled;
+  using LinearAlgebra::triangular_matrix_vector_solve;
+  using LinearAlgebra::upper_triangle;
+
+  using matrix_extents_t = extents<std::size_t, dynamic_extent, dynamic_extent>;
+  using vector_extents_t = extents<std::size_t, dynamic_extent>;
+
+  // Fill A's triangle with small integers and its diagonal with 2
+  // (or NaN, if the solve must not read it), so that every
+  // intermediate result of the solve is exactly representable.
+  // NaN in the other triangle catches reads from it.
+  template<class Triangle, class DiagonalStorage, class MatrixType>
+  void fill_triangular(MatrixType A)
+  {
+    using value_type = typename MatrixType::value_type;
+    constexpr bool lower = std::is_same_v<Triangle, LinearAlgebra::lower_triangle_t>;
+    for (std::size_t j = 0; j < A.extent(1); ++j) {
+      for (std::size_t i = 0; i < A.extent(0); ++i) {
+        if (i == j) {
+          A(i,j) = std::is_same_v<DiagonalStorage, LinearAlgebra::explicit_diagonal_t> ?
+            value_type(2) : poison_value<value_type>();
+        }
+        else if (lower == (i > j)) {
+          A(i,j) = test_value<value_type>(i, j, 1);
+        }
+        else {
+          A(i,j) = poison_value<value_type>();
+        }
+      }
+    }
+  }
+
+  // b = A * x_true, for the triangular A that fill_triangular made.
+  template<class Triangle, class DiagonalStorage, class MatrixType, class Scalar>
+  std::vector<Scalar> triangular_product(MatrixType A, const std::vector<Scalar>& x_true)
+  {
+    constexpr bool lower = std::is_same_v<Triangle, LinearAlgebra::lower_triangle_t>;
+    constexpr bool explicit_diag =
+      std::is_same_v<DiagonalStorage, LinearAlgebra::explicit_diagonal_t>;
+    const std::size_t n = A.extent(0);
+    std::vector<Scalar> b(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      Scalar sum = explicit_diag ? Scalar(A(i,i)) * x_true[i] : x_true[i];
+      for (std::size_t j = 0; j < n; ++j) {
+        if (j != i && lower == (i > j)) {
+          sum += Scalar(A(i,j)) * x_true[j];
+        }
+      }
+      b[i] = sum;
+    }
+    return b;
+  }
+
+  // Solve A x = b for b = A x_true, through the engine directly in
+  // both of its forms and through triangular_matrix_vector_solve,
+  // and compare x with x_true.
+  template<class Triangle, class DiagonalStorage, class MatrixType>
+  void test_solve(MatrixType A, Triangle t, DiagonalStorage d)
+  {
+    using Scalar = typename MatrixType::value_type;
+    using vector_t = mdspan<Scalar, vector_extents_t>;
+    static_assert(LinearAlgebra::impl::is_trsv_blockable_v<MatrixType, vector_t, vector_t>);
+    const std::size_t n = A.extent(0);
+    fill_triangular<Triangle, DiagonalStorage>(A);
+    std::vector<Scalar> x_true(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      x_true[i] = test_value<Scalar>(i, 0, 2);
+    }
+    std::vector<Scalar> b_storage = triangular_product<Triangle, DiagonalStorage>(A, x_true);
+    std::vector<Scalar> x_storage(n, poison_value<Scalar>());
+    vector_t b(b_storage.data(), n);
+    vector_t x(x_storage.data(), n);
+
+    auto check = [&] (const char* what) {
+      for (std::size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(x(i), x_true[i]) << what << ", at " << i;
+      }
+    };
+    for (bool right_looking : {false, true}) {
+      std::fill(x_storage.begin(), x_storage.end(), poison_value<Scalar>());
+      LinearAlgebra::impl::blocked_trsv<Triangle, DiagonalStorage>(A, b, x, right_looking,
+        [] (LinearAlgebra::impl::strided_matrix_view<const Scalar> A_block,
+            const Scalar* x_packed, Scalar* acc) {
+          LinearAlgebra::impl::gemv_accumulate(A_block, x_packed, acc);
+        });
+      check(right_looking ? "right-looking" : "left-looking");
+    }
+
+    std::fill(x_storage.begin(), x_storage.end(), poison_value<Scalar>());
+    triangular_matrix_vector_solve(A, t, d, b, x);
+    check("triangular_matrix_vector_solve");
+
+    // x may be b.
+    triangular_matrix_vector_solve(A, t, d, b, b);
+    for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_EQ(b(i), x_true[i]) << "in place, at " << i;
+    }
+  }
+
+  template<class Scalar, class Layout>
+  void test_layout(std::size_t n)
+  {
+    std::vector<Scalar> A_storage(n * n);
+    mdspan<Scalar, matrix_extents_t, Layout> A(A_storage.data(), n, n);
+    test_solve(A, lower_triangle, explicit_diagonal);
+    test_solve(A, upper_triangle, explicit_diagonal);
+    test_solve(A, lower_triangle, implicit_unit_diagonal);
+    test_solve(A, upper_triangle, implicit_unit_diagonal);
+  }
+
+  // Matrices with no unit stride cannot go to an external BLAS, so
+  // triangular_matrix_vector_solve always gives them to the engine.
+  template<class Scalar>
+  void test_strided(std::size_t n, std::size_t stride0, std::size_t stride1)
+  {
+    std::vector<Scalar> A_storage(n == 0 ? 0 : (n - 1) * (stride0 + stride1) + 1);
+    using mapping_t = layout_stride::mapping<matrix_extents_t>;
+    mdspan<Scalar, matrix_extents_t, layout_stride> A(A_storage.data(),
+      mapping_t(matrix_extents_t(n, n), std::array<std::size_t, 2>{stride0, stride1}));
+    test_solve(A, lower_triangle, explicit_diagonal);
+    test_solve(A, upper_triangle, explicit_diagonal);
+    test_solve(A, lower_triangle, implicit_unit_diagonal);
+    test_solve(A, upper_triangle, implicit_unit_diagonal);
+  }
+
+  TEST(BLAS2_trsv_blocked, crosses_block_boundaries)
+  {
+    // Diagonal blocks have 64 rows.
+    for (std::size_t n : {1, 2, 63, 64, 65, 128, 200}) {
+      test_layout<double, layout_left>(n);
+      test_layout<double, layout_right>(n);
+      test_strided<double>(n, 2, 2 * n);
+      test_strided<double>(n, 2 * n, 2);
+    }
+  }
+
+  TEST(BLAS2_trsv_blocked, layouts_and_types)
+  {
+    test_layout<float, layout_left>(90);
+    test_layout<std::complex<double>, layout_left>(100);
+    test_layout<std::complex<double>, layout_right>(100);
+    test_strided<std::complex<double>>(70, 2 * 70, 2);
+    test_strided<double>(0, 1, 1);
+  }
+
+  TEST(BLAS2_trsv_blocked, scaled_and_conjugated_b)
+  {
+    // The engine peels b's scaling factor and conjugation.
+    using Scalar = std::complex<double>;
+    constexpr std::size_t n = 75;
+    std::vector<Scalar> A_storage(n * n);
+    mdspan<Scalar, matrix_extents_t, layout_stride> A(A_storage.data(),
+      layout_stride::mapping<matrix_extents_t>(matrix_extents_t(n, n),
+        std::array<std::size_t, 2>{n, 1}));
+    fill_triangular<LinearAlgebra::lower_triangle_t, LinearAlgebra::explicit_diagonal_t>(A);
+    std::vector<Scalar> x_true(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      x_true[i] = test_value<Scalar>(i, 0, 3);
+    }
+    // A x_true = conj(2 b), so b = conj(A x_true) / 2.
+    std::vector<Scalar> b_storage =
+      triangular_product<LinearAlgebra::lower_triangle_t, LinearAlgebra::explicit_diagonal_t>(A, x_true);
+    for (auto& b_i : b_storage) {
+      b_i = std::conj(b_i) / 2.0;
+    }
+    std::vector<Scalar> x_storage(n);
+    mdspan<Scalar, vector_extents_t> b(b_storage.data(), n);
+    mdspan<Scalar, vector_extents_t> x(x_storage.data(), n);
+
+    auto b_op = conjugated(scaled(Scalar(2.0), b));
+    static_assert(LinearAlgebra::impl::is_trsv_blockable_v<decltype(A), decltype(b_op), decltype(x)>);
+    triangular_matrix_vector_solve(A, lower_triangle, explicit_diagonal, b_op, x);
+    for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_EQ(x(i), x_true[i]) << "at " << i;
+    }
+
+    // A scaled matrix takes the generic loops.
+    static_assert(! LinearAlgebra::impl::is_trsv_blockable_v<
+      decltype(scaled(Scalar(2.0), A)), decltype(b), decltype(x)>);
+  }
+
+} // end anonymous namespace